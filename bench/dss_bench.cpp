@@ -0,0 +1,1196 @@
+/*!
+
+dss_bench.cpp: solver benchmark suite for DSS C-API, built on dss.hpp
+
+Builds synthetic radial or meshed distribution circuits of configurable size
+through the Obj/Batch API (`APIUtil::create`), then times the main solution
+modes: snapshot, daily, yearly, fault study, harmonics, a control-heavy
+daily run (capacitor and regulator controls on every feeder) and a
+regulator-dense daily run (banks of single-phase regulators along the main
+lines, stepping their taps every interval) and the snapshot with the
+backward/forward sweep algorithm (`set algorithm=sweep`), whose voltages are
+compared to the normal algorithm. The "batched" scenario is a yearly run with
+the admittance load model and the source following the yearly shape, solved
+step by step (reference, not included in the total) and with the batched time
+series (`Solution_Set_BatchSize`); the monitor data of both runs are compared.
+The "dynamics" scenario adds synchronous generators at the lateral buses and
+runs the Dynamics mode after a load step, with the fixed step (reference, not
+included in the total) and with the adaptive step and parallel integration of
+the states (`Solution_Set_DynamicsTolerance` and related); the frequencies of
+the generators are compared at the times of the adaptive steps. The "monitors"
+scenario adds a power monitor at every load and runs the yearly simulation with
+the plain monitor streams (reference, not included in the total) and with the
+compressed storage (`compress=yes`); the memory used by the monitors is
+reported for both and their byte streams are compared. The "meters" scenario
+adds an energy meter at the head of every feeder and lateral and runs the
+yearly simulation with the demand interval files of every meter
+(`DemandInterval` and `DIVerbose`), including writing the files; the run with
+the binary tables (`DIBinary`, reference, not included in the total) is
+compared to the CSV files in time and size. The "exports" scenario repeats a
+set of exports of the snapshot solution (voltages, sequence voltages, currents,
+powers and losses) as CSV files (reference, not included in the total) and as
+binary tables (`ExportFormat=Binary`), and checks the tables kept in memory
+(`ExportFormat=Memory`). The "cim" scenario exports the circuit as CIM100 XML,
+combined and as separate profiles, with a single thread (reference, not
+included in the total) and with the parallel sections, and checks that the
+files are byte for byte the same.
+
+For each scenario, the time per step, the power flow iterations and the
+process memory high-water mark are reported. The results can be saved as a
+baseline JSON file and compared in later runs:
+
+    ./dss_bench --save-baseline baseline.json
+    ./dss_bench --baseline baseline.json --tolerance 10
+
+When a baseline is given, the exit code is 2 if any scenario is slower than
+the baseline by more than the tolerance (in percent).
+
+Run `./dss_bench --help` for the circuit size options. See CMakeLists.txt
+in this folder for building.
+
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "dss.hpp"
+
+namespace {
+
+using dss::string;
+using dss::strings;
+using dss::VectorXd;
+using dss::obj::LineCode;
+using dss::obj::LineBatch;
+using dss::obj::LoadBatch;
+using dss::obj::LoadShape;
+using dss::obj::Transformer;
+using dss::obj::Capacitor;
+using dss::obj::CapControl;
+using dss::obj::RegControl;
+using dss::obj::EnergyMeter;
+using dss::obj::Monitor;
+using dss::obj::Generator;
+
+typedef std::vector<int8_t> Bytes;
+
+struct CircuitOptions
+{
+    int32_t feeders = 4;
+    int32_t sections = 50; // main line sections per feeder
+    int32_t lateral_every = 5; // a lateral is connected at every N-th main bus
+    int32_t lateral_sections = 4;
+    int32_t cap_every = 25; // a switched capacitor at every N-th main bus
+    bool meshed = false; // add ties between adjacent feeders
+    bool controls = false; // add CapControls and RegControls
+    bool regulators = false; // add the single-phase regulator banks
+    int32_t reg_every = 10; // a bank of single-phase regulators at every N-th main section
+    bool generators = false; // add a generator at every lateral bus, monitoring the first one of each feeder
+    bool load_monitors = false; // add a power monitor at every load
+    bool lateral_meters = false; // add an energy meter at every feeder and lateral head
+};
+
+struct BenchOptions
+{
+    CircuitOptions circuit;
+    strings scenarios = {"snapshot", "daily", "yearly", "faultstudy", "harmonic", "controls", "regulators", "sweep", "batched", "dynamics", "monitors", "meters", "exports", "cim"};
+    int32_t snapshot_reps = 20;
+    int32_t yearly_hours = 8760;
+    int32_t batch_size = 96; // batched: steps solved together
+    int32_t dynamics_steps = 1000; // dynamics: fixed steps of 2 ms
+    double dynamics_tolerance = 1e-4; // dynamics: local error of the adaptive step
+    int32_t dynamics_threads = 0; // dynamics: threads for the integration of the states
+    double tolerance = 10.0; // percent
+    string baseline_in;
+    string baseline_out;
+    bool profile = false;
+};
+
+struct ScenarioResult
+{
+    string name;
+    int32_t steps = 0;
+    double total_ms = 0;
+    double time_per_step_ms = 0;
+    int32_t iterations = 0; // most iterations done in a single step
+    int32_t control_iterations = 0;
+    int64_t peak_memory_kb = 0;
+    int32_t num_nodes = 0;
+    double max_vdiff_pu = -1; // sweep, batched: max. voltage difference to the reference solution
+    string fallback_reason; // sweep: why the normal algorithm was used instead
+    double reference_ms = -1; // batched, dynamics, monitors, meters, exports, cim: time per step of the reference run
+    int32_t adaptive_steps = 0; // dynamics: steps taken with the adaptive step
+    double max_freq_diff_pu = -1; // dynamics: max. generator frequency difference to the fixed step
+    int64_t storage_kb = -1; // monitors: memory used by the monitors
+    int64_t reference_storage_kb = -1; // monitors: same, without compression
+    int32_t num_meters = 0; // meters: energy meters in the circuit
+    int64_t output_kb = -1; // meters, exports: size of the CSV files; cim: size of the XML files
+    int64_t reference_output_kb = -1; // meters, exports: size of the binary files
+    strings profile_names;
+    VectorXd profile;
+};
+
+int64_t peak_memory_kb()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return int64_t(pmc.PeakWorkingSetSize / 1024);
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#ifdef __APPLE__
+    return int64_t(usage.ru_maxrss / 1024); // bytes on macOS
+#else
+    return int64_t(usage.ru_maxrss); // kilobytes on Linux
+#endif
+#endif
+}
+
+VectorXd daily_mult()
+{
+    VectorXd mult(24);
+    for (int32_t h = 0; h < 24; ++h)
+    {
+        // Residential-like shape, peaking at 19h
+        mult[h] = 0.55 + 0.4 * std::exp(-std::pow((h - 19.0) / 3.5, 2)) + 0.15 * std::exp(-std::pow((h - 8.0) / 2.0, 2));
+    }
+    return mult;
+}
+
+VectorXd yearly_mult(int32_t npts)
+{
+    VectorXd daily = daily_mult();
+    VectorXd mult(npts);
+    for (int32_t h = 0; h < npts; ++h)
+    {
+        const double season = 0.85 + 0.15 * std::cos(2 * M_PI * (h / 24.0 - 200.0) / 365.0);
+        mult[h] = season * daily[h % 24];
+    }
+    return mult;
+}
+
+///
+/// Synthetic circuit: a substation transformer feeding N feeders, each with
+/// a regulator at the head, a main line with laterals, loads at all buses
+/// and, optionally, ties between feeders and controls.
+///
+class SyntheticCircuit
+{
+public:
+    dss::APIUtil &util;
+    dss::classic::IDSS &dss;
+    const CircuitOptions &opts;
+
+    SyntheticCircuit(dss::APIUtil &util_, dss::classic::IDSS &dss_, const CircuitOptions &opts_): util(util_), dss(dss_), opts(opts_)
+    {
+    }
+
+    void build(int32_t yearly_hours)
+    {
+        dss.ClearAll();
+        // The circuit itself (and its Vsource) can only be created by the command interface
+        dss.Text.Command("new circuit.bench basekv=115 pu=1.02 bus1=source MVAsc3=2000 MVAsc1=1800");
+
+        LineCode lc = util.create<LineCode>("lc_main");
+        lc.nphases(3).units(dss::obj::DimensionUnits::kft).r1(0.0580).x1(0.1206).r0(0.1784).x0(0.4047).C1(3.4).C0(1.6).normamps(600).end_edit();
+        LineCode lc_lat = util.create<LineCode>("lc_lateral");
+        lc_lat.nphases(3).units(dss::obj::DimensionUnits::kft).r1(0.1859).x1(0.1412).r0(0.3325).x0(0.4722).C1(3.0).C0(1.4).normamps(300).end_edit();
+
+        LoadShape daily = util.create<LoadShape>("daily_bench");
+        VectorXd dmult = daily_mult();
+        daily.npts(24).interval(1).mult(dmult).end_edit();
+
+        LoadShape yearly = util.create<LoadShape>("yearly_bench");
+        VectorXd ymult = yearly_mult(yearly_hours);
+        yearly.npts(yearly_hours).interval(1).mult(ymult).end_edit();
+
+        add_transformer("sub", "source", "subbus", 115, 12.47, 30000, 8);
+
+        strings line_bus1, line_bus2, line_code, load_bus;
+        std::vector<double> line_len, load_kw;
+        strings main_buses, cap_buses, gen_buses, meter_lines;
+
+        for (int32_t f = 1; f <= opts.feeders; ++f)
+        {
+            const string head = fmt::format("f{}_0", f);
+            add_transformer(fmt::format("reg{}", f), "subbus", head, 12.47, 12.47, 10000, 0.01);
+
+            string prev = head;
+            for (int32_t s = 1; s <= opts.sections; ++s)
+            {
+                const string bus = fmt::format("f{}_{}", f, s);
+                if (opts.regulators && opts.reg_every > 0 && (s % opts.reg_every) == 0)
+                {
+                    add_regulator_bank(fmt::format("f{}_{}", f, s), prev, bus);
+                }
+                else
+                {
+                    line_bus1.push_back(prev);
+                    line_bus2.push_back(bus);
+                    line_code.push_back("lc_main");
+                    line_len.push_back(0.3 + 0.1 * ((s * 7) % 5));
+                }
+                load_bus.push_back(bus);
+                load_kw.push_back(30.0 + (s * 37 + f * 11) % 70);
+                if (opts.cap_every > 0 && (s % opts.cap_every) == 0)
+                    cap_buses.push_back(bus);
+
+                if (opts.lateral_every > 0 && (s % opts.lateral_every) == 0)
+                {
+                    gen_buses.push_back(bus);
+                    string lprev = bus;
+                    for (int32_t l = 1; l <= opts.lateral_sections; ++l)
+                    {
+                        const string lbus = fmt::format("f{}_{}_l{}", f, s, l);
+                        if (l == 1)
+                            meter_lines.push_back(fmt::format("Line.ln{}", line_bus1.size() + 1));
+                        line_bus1.push_back(lprev);
+                        line_bus2.push_back(lbus);
+                        line_code.push_back("lc_lateral");
+                        line_len.push_back(0.2);
+                        load_bus.push_back(lbus);
+                        load_kw.push_back(15.0 + (l * 13 + s) % 30);
+                        lprev = lbus;
+                    }
+                }
+                prev = bus;
+            }
+            main_buses.push_back(prev);
+        }
+
+        if (opts.meshed && opts.feeders > 1)
+        {
+            // Close loops between the ends and the middle of adjacent feeders
+            for (int32_t f = 1; f <= opts.feeders; ++f)
+            {
+                const int32_t g = (f % opts.feeders) + 1;
+                line_bus1.push_back(fmt::format("f{}_{}", f, opts.sections));
+                line_bus2.push_back(fmt::format("f{}_{}", g, opts.sections));
+                line_code.push_back("lc_main");
+                line_len.push_back(1.0);
+                line_bus1.push_back(fmt::format("f{}_{}", f, opts.sections / 2));
+                line_bus2.push_back(fmt::format("f{}_{}", g, opts.sections / 2));
+                line_code.push_back("lc_main");
+                line_len.push_back(1.5);
+            }
+        }
+
+        LineBatch lines = util.create<LineBatch>("ln", int32_t(line_bus1.size()));
+        lines.bus1(line_bus1).bus2(line_bus2).length(line_len);
+        set_each(lines, LineBatch::Properties::linecode, line_code);
+        lines.units(dss::obj::DimensionUnits::kft).end_edit();
+
+        LoadBatch loads = util.create<LoadBatch>("ld", int32_t(load_bus.size()));
+        loads.bus1(load_bus).kV(12.47).kW(load_kw).pf(0.95).daily("daily_bench").yearly("yearly_bench").end_edit();
+
+        if (opts.load_monitors)
+        {
+            for (size_t i = 0; i < load_bus.size(); ++i)
+            {
+                Monitor mon = util.create<Monitor>(fmt::format("ld{}", i + 1));
+                mon.element(fmt::format("Load.ld{}", i + 1)).terminal(1).mode(1).PPolar(false).end_edit();
+            }
+        }
+
+        for (size_t i = 0; i < cap_buses.size(); ++i)
+        {
+            Capacitor cap = util.create<Capacitor>(fmt::format("cap{}", i + 1));
+            VectorXd kvar(1);
+            kvar[0] = 600;
+            cap.bus1(cap_buses[i]).kv(12.47).kvar(kvar).end_edit();
+        }
+
+        if (opts.generators)
+            add_generators(gen_buses);
+
+        EnergyMeter meter = util.create<EnergyMeter>("sub");
+        meter.element("Transformer.sub").terminal(1).end_edit();
+        for (int32_t f = 1; f <= opts.feeders; ++f)
+        {
+            Monitor mon = util.create<Monitor>(fmt::format("head{}", f));
+            mon.element(fmt::format("Transformer.reg{}", f)).terminal(2).mode(0).end_edit();
+        }
+
+        if (opts.lateral_meters)
+        {
+            for (int32_t f = 1; f <= opts.feeders; ++f)
+            {
+                EnergyMeter fmeter = util.create<EnergyMeter>(fmt::format("f{}", f));
+                fmeter.element(fmt::format("Transformer.reg{}", f)).terminal(2).end_edit();
+            }
+            for (size_t i = 0; i < meter_lines.size(); ++i)
+            {
+                EnergyMeter lmeter = util.create<EnergyMeter>(fmt::format("lat{}", i + 1));
+                lmeter.element(meter_lines[i]).terminal(1).end_edit();
+            }
+        }
+
+        if (opts.controls)
+            add_controls(cap_buses.size());
+
+        dss.Text.Command("set voltagebases=[115 12.47]");
+        dss.Text.Command("calcvoltagebases");
+    }
+
+private:
+    template <typename BatchT>
+    void set_each(BatchT &batch, int32_t prop, strings &values)
+    {
+        for (int32_t i = 0; i < batch.count[0]; ++i)
+            Obj_SetString(batch.pointer[i], prop, values[i].c_str(), 0);
+        util.check_for_error();
+    }
+
+    void add_transformer(const string &name, const string &bus1, const string &bus2, double kv1, double kv2, double kva, double xhl)
+    {
+        Transformer tr = util.create<Transformer>(name);
+        strings buses = {bus1, bus2};
+        VectorXd kvs(2), kvas(2);
+        kvs << kv1, kv2;
+        kvas << kva, kva;
+        tr.phases(3).windings(2).buses(buses).kVs(kvs).kVAs(kvas).XHL(xhl).end_edit();
+    }
+
+    // Three single-phase regulators (with their RegControls) between two buses.
+    // The narrow band makes them step with the daily load variation.
+    void add_regulator_bank(const string &name, const string &bus1, const string &bus2)
+    {
+        for (int32_t ph = 1; ph <= 3; ++ph)
+        {
+            const string reg_name = fmt::format("reg_{}_{}", name, ph);
+            Transformer tr = util.create<Transformer>(reg_name);
+            strings buses = {fmt::format("{}.{}", bus1, ph), fmt::format("{}.{}", bus2, ph)};
+            VectorXd kvs(2), kvas(2);
+            kvs << 7.2, 7.2;
+            kvas << 1666, 1666;
+            tr.phases(1).windings(2).buses(buses).kVs(kvs).kVAs(kvas).XHL(0.01).end_edit();
+
+            RegControl reg = util.create<RegControl>(reg_name);
+            reg.transformer(reg_name).winding(2).vreg(121).band(1).ptratio(60).delay(15).end_edit();
+        }
+    }
+
+    void add_generators(const strings &buses)
+    {
+        const size_t per_feeder = buses.size() / std::max(opts.feeders, 1);
+        for (size_t i = 0; i < buses.size(); ++i)
+        {
+            const string name = fmt::format("g{}", i + 1);
+            Generator gen = util.create<Generator>(name);
+            gen.bus1(buses[i]).kv(12.47).kW(150 + 10 * (i % 5)).pf(0.95).model(1).H(1.5 + 0.1 * (i % 3)).D(1).end_edit();
+            if (per_feeder == 0 || (i % per_feeder) != 0)
+                continue;
+
+            // Mode 3: state variables, the frequency is channel 1
+            Monitor mon = util.create<Monitor>(fmt::format("gen{}", 1 + i / per_feeder));
+            mon.element("Generator." + name).terminal(1).mode(3).end_edit();
+        }
+    }
+
+    void add_controls(size_t num_caps)
+    {
+        for (size_t i = 0; i < num_caps; ++i)
+        {
+            CapControl ctrl = util.create<CapControl>(fmt::format("capctrl{}", i + 1));
+            ctrl.element(fmt::format("Line.ln{}", 1 + i)).terminal(1)
+                .capacitor(fmt::format("cap{}", i + 1))
+                .type(CapControl::CapControlType::Voltage)
+                .PTratio(60).ONsetting(119).OFFsetting(124).Delay(30)
+                .end_edit();
+        }
+        for (int32_t f = 1; f <= opts.feeders; ++f)
+        {
+            RegControl reg = util.create<RegControl>(fmt::format("reg{}", f));
+            reg.transformer(fmt::format("reg{}", f)).winding(2).vreg(122).band(2).ptratio(60).delay(15).end_edit();
+        }
+    }
+};
+
+///
+/// Runs the scenarios on fresh circuits, one at a time
+///
+class BenchRunner
+{
+public:
+    BenchOptions opts;
+    dss::APIUtil util;
+    dss::classic::IDSS dss;
+
+    BenchRunner(const BenchOptions &opts_): opts(opts_), util(true), dss(&util)
+    {
+        ctx_DSS_Set_AllowForms(util.ctx, false);
+    }
+
+    ScenarioResult run(const string &name)
+    {
+        CircuitOptions copts = opts.circuit;
+        copts.controls = (name == "controls");
+        copts.regulators = (name == "regulators");
+        copts.generators = (name == "dynamics");
+        copts.load_monitors = (name == "monitors");
+        copts.lateral_meters = (name == "meters");
+        SyntheticCircuit ckt(util, dss, copts);
+        ckt.build(opts.yearly_hours);
+
+        auto &sol = dss.ActiveCircuit.Solution;
+        ScenarioResult res;
+        res.name = name;
+        res.num_nodes = dss.ActiveCircuit.NumNodes();
+
+        // Initial power flow, not timed
+        sol.Solve();
+        util.check_for_error();
+
+        VectorXd mon_reference;
+        if (name == "batched")
+        {
+            // The system Y is fixed with the admittance load model; only the
+            // source follows the yearly shape
+            dss.Text.Command("set loadmodel=admittance");
+            dss.Text.Command("vsource.source.yearly=yearly_bench");
+            ctx_Solution_Set_BatchSize(util.ctx, 0);
+            auto r0 = std::chrono::steady_clock::now();
+            dss.Text.Command(fmt::format("set mode=yearly stepsize=1h number={} hour=0", opts.yearly_hours));
+            sol.Solve();
+            auto r1 = std::chrono::steady_clock::now();
+            util.check_for_error();
+            res.reference_ms = std::chrono::duration<double, std::milli>(r1 - r0).count() / std::max(opts.yearly_hours, 1);
+            mon_reference = monitor_data();
+            dss.ActiveCircuit.Monitors.ResetAll();
+            ctx_Solution_Set_BatchSize(util.ctx, opts.batch_size);
+        }
+
+        VectorXd hours_reference;
+        std::vector<VectorXd> freq_reference;
+        if (name == "dynamics")
+        {
+            start_dynamics();
+            auto r0 = std::chrono::steady_clock::now();
+            dss.Text.Command(fmt::format("set number={}", opts.dynamics_steps));
+            sol.Solve();
+            auto r1 = std::chrono::steady_clock::now();
+            util.check_for_error();
+            res.reference_ms = std::chrono::duration<double, std::milli>(r1 - r0).count() / std::max(opts.dynamics_steps, 1);
+            freq_reference = generator_frequencies(hours_reference);
+
+            // Same disturbance on a fresh circuit for the adaptive run
+            ckt.build(opts.yearly_hours);
+            sol.Solve();
+            util.check_for_error();
+            start_dynamics();
+            ctx_Solution_Set_DynamicsTolerance(util.ctx, opts.dynamics_tolerance);
+            ctx_Solution_Set_DynamicsThreads(util.ctx, opts.dynamics_threads);
+        }
+
+        std::vector<Bytes> streams_reference;
+        if (name == "monitors")
+        {
+            auto r0 = std::chrono::steady_clock::now();
+            dss.Text.Command(fmt::format("set mode=yearly stepsize=1h number={} hour=0", opts.yearly_hours));
+            sol.Solve();
+            auto r1 = std::chrono::steady_clock::now();
+            util.check_for_error();
+            res.reference_ms = std::chrono::duration<double, std::milli>(r1 - r0).count() / std::max(opts.yearly_hours, 1);
+            streams_reference = monitor_streams(res.reference_storage_kb);
+            dss.Text.Command("batchedit monitor..* compress=yes");
+            dss.ActiveCircuit.Monitors.ResetAll();
+        }
+
+        const string data_path = dss.DataPath();
+        std::filesystem::path di_path;
+        if (name == "meters")
+        {
+            // The demand interval files go to a scratch folder
+            di_path = std::filesystem::temp_directory_path() / "dss_bench_meters";
+            std::filesystem::remove_all(di_path);
+            std::filesystem::create_directories(di_path);
+            dss.DataPath(di_path.string());
+            res.num_meters = dss.ActiveCircuit.Meters.Count();
+
+            auto r0 = std::chrono::steady_clock::now();
+            dss.Text.Command("set DemandInterval=true DIVerbose=true DIBinary=true");
+            dss.Text.Command(fmt::format("set mode=yearly stepsize=1h number={} hour=0", opts.yearly_hours));
+            sol.Solve();
+            dss.Text.Command("closedi");
+            auto r1 = std::chrono::steady_clock::now();
+            util.check_for_error();
+            res.reference_ms = std::chrono::duration<double, std::milli>(r1 - r0).count() / std::max(opts.yearly_hours, 1);
+            res.reference_output_kb = output_size(di_path, ".bin") / 1024;
+            dss.Text.Command("set DemandInterval=true DIBinary=false");
+        }
+        else if (name == "exports")
+        {
+            // The exported files go to a scratch folder
+            di_path = std::filesystem::temp_directory_path() / "dss_bench_exports";
+            std::filesystem::remove_all(di_path);
+            std::filesystem::create_directories(di_path);
+            dss.DataPath(di_path.string());
+
+            auto r0 = std::chrono::steady_clock::now();
+            for (int32_t i = 0; i < opts.snapshot_reps; ++i)
+                export_set();
+            auto r1 = std::chrono::steady_clock::now();
+            util.check_for_error();
+            res.reference_ms = std::chrono::duration<double, std::milli>(r1 - r0).count() / std::max(opts.snapshot_reps, 1);
+            res.output_kb = output_size(di_path, ".csv") / 1024;
+            dss.Text.Command("set ExportFormat=Binary");
+        }
+        else if (name == "cim")
+        {
+            // The XML files go to a scratch folder
+            di_path = std::filesystem::temp_directory_path() / "dss_bench_cim";
+            std::filesystem::remove_all(di_path);
+            std::filesystem::create_directories(di_path);
+
+            auto r0 = std::chrono::steady_clock::now();
+            export_cim(di_path / "serial", 1);
+            auto r1 = std::chrono::steady_clock::now();
+            util.check_for_error();
+            res.reference_ms = std::chrono::duration<double, std::milli>(r1 - r0).count();
+        }
+
+        if (opts.profile)
+        {
+            ctx_Solution_Set_ProfileEnabled(util.ctx, true);
+            ctx_Solution_ResetProfile(util.ctx);
+        }
+
+        auto t0 = std::chrono::steady_clock::now();
+        if (name == "snapshot" || name == "sweep")
+        {
+            if (name == "sweep")
+                dss.Text.Command("set algorithm=sweep");
+
+            res.steps = opts.snapshot_reps;
+            for (int32_t i = 0; i < res.steps; ++i)
+            {
+                sol.LoadMult(0.9 + 0.2 * (i % 2));
+                sol.Solve();
+                res.iterations = std::max(res.iterations, sol.Iterations());
+            }
+        }
+        else if (name == "daily" || name == "controls" || name == "regulators")
+        {
+            dss.Text.Command("set mode=daily stepsize=15m number=96");
+            res.steps = 96;
+            sol.Solve();
+        }
+        else if (name == "yearly")
+        {
+            dss.Text.Command(fmt::format("set mode=yearly stepsize=1h number={}", opts.yearly_hours));
+            res.steps = opts.yearly_hours;
+            sol.Solve();
+        }
+        else if (name == "batched" || name == "monitors")
+        {
+            dss.Text.Command(fmt::format("set mode=yearly stepsize=1h number={} hour=0", opts.yearly_hours));
+            res.steps = opts.yearly_hours;
+            sol.Solve();
+        }
+        else if (name == "meters")
+        {
+            dss.Text.Command(fmt::format("set mode=yearly stepsize=1h number={} hour=0", opts.yearly_hours));
+            res.steps = opts.yearly_hours;
+            sol.Solve();
+            dss.Text.Command("closedi");
+        }
+        else if (name == "exports")
+        {
+            res.steps = opts.snapshot_reps;
+            for (int32_t i = 0; i < res.steps; ++i)
+                export_set();
+        }
+        else if (name == "cim")
+        {
+            res.steps = 1;
+            export_cim(di_path / "parallel", 0);
+        }
+        else if (name == "dynamics")
+        {
+            dss.Text.Command(fmt::format("set number={}", opts.dynamics_steps));
+            res.steps = opts.dynamics_steps;
+            sol.Solve();
+        }
+        else if (name == "faultstudy")
+        {
+            dss.Text.Command("set mode=faultstudy");
+            res.steps = 1;
+            sol.Solve();
+        }
+        else if (name == "harmonic")
+        {
+            dss.Text.Command("set mode=harmonics");
+            res.steps = 1;
+            sol.Solve();
+        }
+        else
+        {
+            throw std::runtime_error(fmt::format("Unknown scenario: {}", name));
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        util.check_for_error();
+
+        res.total_ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        res.time_per_step_ms = res.total_ms / std::max(res.steps, 1);
+        if (name != "snapshot" && name != "sweep")
+            res.iterations = sol.MostIterationsDone();
+        res.control_iterations = sol.ControlIterations();
+        res.peak_memory_kb = peak_memory_kb();
+
+        if (name == "sweep")
+        {
+            // Accuracy, against the normal algorithm for the same (last) load level
+            if (!ctx_Solution_Get_SweepActive(util.ctx))
+                res.fallback_reason = ctx_Solution_Get_SweepFallbackReason(util.ctx);
+            VectorXd v_sweep = dss.ActiveCircuit.AllBusVmagPu();
+            dss.Text.Command("set algorithm=normal");
+            sol.Solve();
+            util.check_for_error();
+            VectorXd v_normal = dss.ActiveCircuit.AllBusVmagPu();
+            res.max_vdiff_pu = (v_sweep - v_normal).cwiseAbs().maxCoeff();
+        }
+        else if (name == "batched")
+        {
+            VectorXd mon_batched = monitor_data();
+            ctx_Solution_Set_BatchSize(util.ctx, 0);
+            if (mon_batched.size() != mon_reference.size())
+                throw std::runtime_error("batched: the monitors have a different number of samples");
+            res.max_vdiff_pu = (mon_batched - mon_reference).cwiseAbs().maxCoeff() / (12.47e3 / std::sqrt(3.0));
+        }
+        else if (name == "dynamics")
+        {
+            VectorXd hours;
+            std::vector<VectorXd> freq = generator_frequencies(hours);
+            ctx_Solution_Set_DynamicsTolerance(util.ctx, 0);
+            ctx_Solution_Set_DynamicsThreads(util.ctx, 1);
+            res.adaptive_steps = int32_t(hours.size());
+            double max_diff = 0;
+            for (size_t g = 0; g < freq.size(); ++g)
+            {
+                for (Eigen::Index i = 0; i < hours.size(); ++i)
+                    max_diff = std::max(max_diff, std::abs(freq[g][i] - interpolate(hours_reference, freq_reference[g], hours[i])));
+            }
+            res.max_freq_diff_pu = max_diff / 60.0;
+        }
+        else if (name == "monitors")
+        {
+            std::vector<Bytes> streams = monitor_streams(res.storage_kb);
+            if (streams != streams_reference)
+                throw std::runtime_error("monitors: the compressed monitors returned different data");
+        }
+        else if (name == "meters")
+        {
+            res.output_kb = output_size(di_path, ".csv") / 1024;
+            dss.Text.Command("set DemandInterval=false DIVerbose=false");
+            dss.DataPath(data_path);
+            util.check_for_error();
+            if (binary_rows(di_path, "DI_Totals") != opts.yearly_hours)
+                throw std::runtime_error("meters: the binary totals file does not have a row per hour");
+            std::filesystem::remove_all(di_path);
+        }
+        else if (name == "exports")
+        {
+            res.reference_output_kb = output_size(di_path, ".bin") / 1024;
+            const int32_t num_buses = dss.ActiveCircuit.NumBuses();
+            if (binary_rows(di_path, dss.ActiveCircuit.Name() + "_EXP_VOLTAGES") != num_buses)
+                throw std::runtime_error("exports: the binary voltages file does not have a row per bus");
+            dss.Text.Command("set ExportFormat=Memory");
+            dss.Text.Command("export voltages");
+            const int64_t num_rows = dss.Text.ExportColumn(2).size();
+            dss.Text.Command("set ExportFormat=CSV");
+            dss.DataPath(data_path);
+            util.check_for_error();
+            if (num_rows != num_buses)
+                throw std::runtime_error("exports: the voltages table in memory does not have a row per bus");
+            std::filesystem::remove_all(di_path);
+        }
+        else if (name == "cim")
+        {
+            // The UUIDs are kept between exports, so both runs must write the same bytes
+            res.output_kb = output_size(di_path, ".xml") / 1024;
+            for (const auto &entry: std::filesystem::directory_iterator(di_path))
+            {
+                const string file_name = entry.path().filename().string();
+                if (file_name.compare(0, 6, "serial") != 0)
+                    continue;
+                const std::filesystem::path other = di_path / ("parallel" + file_name.substr(6));
+                if (read_file(entry.path()) != read_file(other))
+                    throw std::runtime_error(fmt::format("cim: \"{}\" differs from the serial export", other.filename().string()));
+            }
+            std::filesystem::remove_all(di_path);
+        }
+
+        if (opts.profile)
+        {
+            res.profile_names = util.get_string_array(ctx_Solution_Get_ProfileNames);
+            ctx_Solution_Get_Profile_GR(util.ctx);
+            res.profile = util.get_float64_gr_array();
+            ctx_Solution_Set_ProfileEnabled(util.ctx, false);
+        }
+        return res;
+    }
+
+private:
+    // Dynamics mode from the power flow solution, followed by a load step.
+    // The first step initializes the states of the generators.
+    void start_dynamics()
+    {
+        dss.Text.Command("set mode=dynamics stepsize=0.002 number=1");
+        dss.ActiveCircuit.Solution.Solve();
+        util.check_for_error();
+        dss.Text.Command("set loadmult=1.3");
+        dss.ActiveCircuit.Monitors.ResetAll();
+    }
+
+    // Frequencies (channel 1) of the generator monitors, and the sample times in hours
+    std::vector<VectorXd> generator_frequencies(VectorXd &hours)
+    {
+        std::vector<VectorXd> freq;
+        for (int32_t f = 1; f <= opts.circuit.feeders; ++f)
+        {
+            dss.ActiveCircuit.Monitors.Name(fmt::format("gen{}", f));
+            freq.push_back(dss.ActiveCircuit.Monitors.Channel(1));
+            hours = dss.ActiveCircuit.Monitors.dblHour();
+        }
+        return freq;
+    }
+
+    // Linear interpolation of (x, y) at xi; x must be increasing
+    static double interpolate(const VectorXd &x, const VectorXd &y, double xi)
+    {
+        if (x.size() == 0)
+            return 0;
+        const double *it = std::upper_bound(x.data(), x.data() + x.size(), xi);
+        const Eigen::Index i = it - x.data();
+        if (i == 0)
+            return y[0];
+        if (i == x.size())
+            return y[i - 1];
+        const double w = (xi - x[i - 1]) / (x[i] - x[i - 1]);
+        return y[i - 1] + w * (y[i] - y[i - 1]);
+    }
+
+    // Byte streams of all the monitors, and the memory they use
+    std::vector<Bytes> monitor_streams(int64_t &storage_kb)
+    {
+        std::vector<Bytes> streams;
+        uint64_t storage = 0;
+        auto &monitors = dss.ActiveCircuit.Monitors;
+        for (int32_t i = monitors.First(); i != 0; i = monitors.Next())
+        {
+            streams.push_back(monitors.ByteStream<Bytes>());
+            storage += monitors.StorageSize();
+        }
+        storage_kb = int64_t(storage / 1024);
+        return streams;
+    }
+
+    // Exports of the "exports" scenario, in the current ExportFormat
+    void export_set()
+    {
+        for (const char *what: {"voltages", "seqvoltages", "currents", "powers", "losses"})
+            dss.Text.Command(fmt::format("export {}", what));
+    }
+
+    // CIM100 exports, combined (base.xml) and as separate profiles (base_*.xml);
+    // threads = 1 for the serial export
+    void export_cim(const std::filesystem::path &base, int32_t threads)
+    {
+        dss.Text.Command(fmt::format("export cim100 file=\"{}.xml\" threads={}", base.string(), threads));
+        dss.Text.Command(fmt::format("export cim100fragments file=\"{}\" threads={}", base.string(), threads));
+    }
+
+    // Whole contents of a file, empty if missing
+    static string read_file(const std::filesystem::path &path)
+    {
+        std::ifstream f(path, std::ios::binary);
+        std::ostringstream contents;
+        contents << f.rdbuf();
+        return contents.str();
+    }
+
+    // Total size of the files with the extension in the folder and its subfolders
+    static int64_t output_size(const std::filesystem::path &path, const string &ext)
+    {
+        int64_t size = 0;
+        for (const auto &entry: std::filesystem::recursive_directory_iterator(path))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == ext)
+                size += int64_t(entry.file_size());
+        }
+        return size;
+    }
+
+    // Number of rows in the first block of a binary table file (name starting
+    // with prefix, case-insensitive), found anywhere in the folder; -1 if missing
+    static int32_t binary_rows(const std::filesystem::path &path, const string &prefix)
+    {
+        auto lower = [](string text) {
+            std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return char(std::tolower(c)); });
+            return text;
+        };
+        const string lower_prefix = lower(prefix);
+        for (const auto &entry: std::filesystem::recursive_directory_iterator(path))
+        {
+            const string file_name = lower(entry.path().filename().string());
+            if (!entry.is_regular_file() || entry.path().extension() != ".bin" || file_name.compare(0, lower_prefix.size(), lower_prefix) != 0)
+                continue;
+            // Signature (8 bytes), version, number of rows, ...
+            std::ifstream f(entry.path(), std::ios::binary);
+            char signature[8];
+            int32_t version = 0, rows = -1;
+            f.read(signature, sizeof(signature));
+            f.read(reinterpret_cast<char*>(&version), sizeof(version));
+            f.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+            if (!f || string(signature, 7) != "DSSMTBL")
+                return -1;
+            return rows;
+        }
+        return -1;
+    }
+
+    // Voltage magnitudes (channel 1) of all the feeder head monitors
+    VectorXd monitor_data()
+    {
+        std::vector<VectorXd> channels;
+        Eigen::Index total = 0;
+        for (int32_t f = 1; f <= opts.circuit.feeders; ++f)
+        {
+            dss.ActiveCircuit.Monitors.Name(fmt::format("head{}", f));
+            channels.push_back(dss.ActiveCircuit.Monitors.Channel(1));
+            total += channels.back().size();
+        }
+        VectorXd data(total);
+        Eigen::Index pos = 0;
+        for (const VectorXd &ch: channels)
+        {
+            data.segment(pos, ch.size()) = ch;
+            pos += ch.size();
+        }
+        return data;
+    }
+};
+
+//------------------------------------------------------------------------------
+// Minimal JSON support for the baseline files: nested objects of numbers
+// and strings, which is all we write.
+
+struct JSONValue
+{
+    double number = 0;
+    string text;
+    std::map<string, JSONValue> members;
+    bool is_object = false;
+};
+
+class JSONReader
+{
+    const string &src;
+    size_t pos = 0;
+
+    void skip_ws()
+    {
+        while (pos < src.size() && std::isspace((unsigned char) src[pos]))
+            ++pos;
+    }
+
+    void expect(char c)
+    {
+        skip_ws();
+        if (pos >= src.size() || src[pos] != c)
+            throw std::runtime_error(fmt::format("Invalid baseline JSON: expected '{}' at position {}", c, pos));
+        ++pos;
+    }
+
+    string parse_string()
+    {
+        expect('"');
+        string res;
+        while (pos < src.size() && src[pos] != '"')
+        {
+            if (src[pos] == '\\' && pos + 1 < src.size())
+                ++pos;
+            res += src[pos++];
+        }
+        expect('"');
+        return res;
+    }
+
+public:
+    JSONReader(const string &text): src(text)
+    {
+    }
+
+    JSONValue parse()
+    {
+        JSONValue val;
+        skip_ws();
+        if (pos >= src.size())
+            throw std::runtime_error("Invalid baseline JSON: unexpected end of input");
+
+        if (src[pos] == '{')
+        {
+            val.is_object = true;
+            ++pos;
+            skip_ws();
+            if (src[pos] == '}')
+            {
+                ++pos;
+                return val;
+            }
+            while (true)
+            {
+                string key = parse_string();
+                expect(':');
+                val.members[key] = parse();
+                skip_ws();
+                if (src[pos] == ',')
+                {
+                    ++pos;
+                    continue;
+                }
+                expect('}');
+                break;
+            }
+        }
+        else if (src[pos] == '"')
+        {
+            val.text = parse_string();
+        }
+        else
+        {
+            size_t used = 0;
+            val.number = std::stod(src.substr(pos, 32), &used);
+            pos += used;
+        }
+        return val;
+    }
+};
+
+void write_baseline(const string &path, const BenchOptions &opts, const std::vector<ScenarioResult> &results)
+{
+    std::ofstream out(path);
+    if (!out)
+        throw std::runtime_error(fmt::format("Could not write baseline file \"{}\"", path));
+
+    const CircuitOptions &c = opts.circuit;
+    out << "{\n";
+    out << fmt::format("    \"circuit\": {{\"feeders\": {}, \"sections\": {}, \"lateral_every\": {}, \"lateral_sections\": {}, \"meshed\": {}}},\n",
+        c.feeders, c.sections, c.lateral_every, c.lateral_sections, c.meshed ? 1 : 0);
+    out << "    \"scenarios\": {\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const ScenarioResult &r = results[i];
+        out << fmt::format(
+            "        \"{}\": {{\"steps\": {}, \"time_per_step_ms\": {:.6f}, \"iterations\": {}, \"control_iterations\": {}, \"peak_memory_kb\": {}, \"num_nodes\": {}}}{}\n",
+            r.name, r.steps, r.time_per_step_ms, r.iterations, r.control_iterations, r.peak_memory_kb, r.num_nodes,
+            (i + 1 < results.size()) ? "," : ""
+        );
+    }
+    out << "    }\n}\n";
+}
+
+// Returns the number of scenarios slower than the baseline beyond the tolerance
+int32_t compare_baseline(const string &path, const BenchOptions &opts, const std::vector<ScenarioResult> &results)
+{
+    std::ifstream in(path);
+    if (!in)
+        throw std::runtime_error(fmt::format("Could not read baseline file \"{}\"", path));
+
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const string text = buffer.str();
+    JSONValue root = JSONReader(text).parse();
+    const auto &scenarios = root.members["scenarios"].members;
+
+    int32_t regressions = 0;
+    std::cout << fmt::format("\nComparison against baseline \"{}\" (tolerance {:.1f}%)\n", path, opts.tolerance);
+    std::cout << fmt::format("{:<12} {:>14} {:>14} {:>9}  {}\n", "scenario", "baseline ms", "current ms", "change", "");
+    for (const ScenarioResult &r: results)
+    {
+        auto it = scenarios.find(r.name);
+        if (it == scenarios.end())
+        {
+            std::cout << fmt::format("{:<12} {:>14} {:>14.4f}\n", r.name, "-", r.time_per_step_ms);
+            continue;
+        }
+        const auto &base = it->second.members;
+        const double base_ms = base.count("time_per_step_ms") ? base.at("time_per_step_ms").number : 0;
+        const double change = (base_ms > 0) ? 100.0 * (r.time_per_step_ms - base_ms) / base_ms : 0;
+        const bool regression = change > opts.tolerance;
+        if (regression)
+            ++regressions;
+
+        string note = regression ? "REGRESSION" : "";
+        if (base.count("num_nodes") && int32_t(base.at("num_nodes").number) != r.num_nodes)
+            note += " (different circuit size)";
+        std::cout << fmt::format("{:<12} {:>14.4f} {:>14.4f} {:>+8.1f}%  {}\n", r.name, base_ms, r.time_per_step_ms, change, note);
+    }
+    return regressions;
+}
+
+void print_usage()
+{
+    std::cout <<
+        "Usage: dss_bench [options]\n"
+        "  --feeders N            number of feeders (default 4)\n"
+        "  --sections N           main line sections per feeder (default 50)\n"
+        "  --lateral-every N      connect a lateral at every N-th main bus (default 5)\n"
+        "  --lateral-sections N   sections per lateral (default 4)\n"
+        "  --cap-every N          add a capacitor at every N-th main bus (default 25)\n"
+        "  --meshed               add ties between adjacent feeders\n"
+        "  --reg-every N          regulators scenario: a regulator bank at every N-th main section (default 10)\n"
+        "  --scenarios a,b,...    subset of: snapshot,daily,yearly,faultstudy,harmonic,controls,regulators,sweep,batched,dynamics,\n"
+        "                         monitors,meters,exports,cim\n"
+        "  --snapshot-reps N      number of snapshot (and sweep) solutions, or of export sets (default 20)\n"
+        "  --yearly-hours N       number of hours for the yearly (batched, monitors and meters) scenario (default 8760)\n"
+        "  --batch-size N         batched scenario: steps solved together (default 96)\n"
+        "  --dynamics-steps N     dynamics scenario: fixed steps of 2 ms (default 1000)\n"
+        "  --dynamics-tolerance X dynamics scenario: local error of the adaptive step (default 1e-4)\n"
+        "  --dynamics-threads N   dynamics scenario: threads for the states, 0 for all CPUs (default 0)\n"
+        "  --profile              also report the solver profile for each scenario\n"
+        "  --baseline FILE        compare the results against a baseline JSON file\n"
+        "  --tolerance PCT        allowed slowdown in percent before flagging a regression (default 10)\n"
+        "  --save-baseline FILE   save the results as a baseline JSON file\n";
+}
+
+BenchOptions parse_args(int argc, char **argv)
+{
+    BenchOptions opts;
+    for (int i = 1; i < argc; ++i)
+    {
+        const string arg = argv[i];
+        auto next = [&]() -> string {
+            if (i + 1 >= argc)
+                throw std::runtime_error(fmt::format("Missing value for {}", arg));
+            return argv[++i];
+        };
+        if (arg == "--help" || arg == "-h")
+        {
+            print_usage();
+            std::exit(0);
+        }
+        else if (arg == "--feeders") opts.circuit.feeders = std::stoi(next());
+        else if (arg == "--sections") opts.circuit.sections = std::stoi(next());
+        else if (arg == "--lateral-every") opts.circuit.lateral_every = std::stoi(next());
+        else if (arg == "--lateral-sections") opts.circuit.lateral_sections = std::stoi(next());
+        else if (arg == "--cap-every") opts.circuit.cap_every = std::stoi(next());
+        else if (arg == "--meshed") opts.circuit.meshed = true;
+        else if (arg == "--reg-every") opts.circuit.reg_every = std::stoi(next());
+        else if (arg == "--snapshot-reps") opts.snapshot_reps = std::stoi(next());
+        else if (arg == "--yearly-hours") opts.yearly_hours = std::stoi(next());
+        else if (arg == "--batch-size") opts.batch_size = std::stoi(next());
+        else if (arg == "--dynamics-steps") opts.dynamics_steps = std::stoi(next());
+        else if (arg == "--dynamics-tolerance") opts.dynamics_tolerance = std::stod(next());
+        else if (arg == "--dynamics-threads") opts.dynamics_threads = std::stoi(next());
+        else if (arg == "--profile") opts.profile = true;
+        else if (arg == "--baseline") opts.baseline_in = next();
+        else if (arg == "--save-baseline") opts.baseline_out = next();
+        else if (arg == "--tolerance") opts.tolerance = std::stod(next());
+        else if (arg == "--scenarios")
+        {
+            opts.scenarios.clear();
+            std::stringstream ss(next());
+            string item;
+            while (std::getline(ss, item, ','))
+                opts.scenarios.push_back(item);
+        }
+        else
+        {
+            throw std::runtime_error(fmt::format("Unknown option: {}", arg));
+        }
+    }
+    return opts;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    try
+    {
+        BenchOptions opts = parse_args(argc, argv);
+        BenchRunner runner(opts);
+        std::vector<ScenarioResult> results;
+
+        std::cout << fmt::format("{} circuit: {} feeders, {} sections, lateral every {} ({} sections)\n\n",
+            opts.circuit.meshed ? "Meshed" : "Radial", opts.circuit.feeders, opts.circuit.sections,
+            opts.circuit.lateral_every, opts.circuit.lateral_sections);
+        std::cout << fmt::format("{:<12} {:>7} {:>7} {:>12} {:>14} {:>6} {:>8} {:>12}\n",
+            "scenario", "nodes", "steps", "total ms", "ms/step", "iter", "ctrl it", "peak KiB");
+
+        for (const string &name: opts.scenarios)
+        {
+            ScenarioResult r = runner.run(name);
+            std::cout << fmt::format("{:<12} {:>7} {:>7} {:>12.2f} {:>14.4f} {:>6} {:>8} {:>12}\n",
+                r.name, r.num_nodes, r.steps, r.total_ms, r.time_per_step_ms, r.iterations, r.control_iterations, r.peak_memory_kb);
+            if (!r.fallback_reason.empty())
+                std::cout << fmt::format("    sweep not used, solved with the normal algorithm: {}\n", r.fallback_reason);
+            if (r.reference_ms >= 0 && r.name == "dynamics")
+                std::cout << fmt::format("    fixed step: {:.4f} ms/step, adaptive: {} steps, speedup {:.2f}x\n", r.reference_ms, r.adaptive_steps, r.reference_ms / std::max(r.time_per_step_ms, 1e-12));
+            else if (r.reference_ms >= 0 && r.name == "monitors")
+                std::cout << fmt::format("    plain monitors: {:.4f} ms/step, compressed overhead {:+.1f}%\n", r.reference_ms, 100.0 * (r.time_per_step_ms / std::max(r.reference_ms, 1e-12) - 1.0));
+            else if (r.reference_ms >= 0 && r.name == "meters")
+                std::cout << fmt::format("    {} meters, binary files: {:.4f} ms/step, {} KiB; CSV files: {} KiB\n", r.num_meters, r.reference_ms, r.reference_output_kb, r.output_kb);
+            else if (r.reference_ms >= 0 && r.name == "cim")
+                std::cout << fmt::format("    single thread: {:.2f} ms, {} KiB; same output, speedup {:.2f}x\n", r.reference_ms, r.output_kb, r.reference_ms / std::max(r.time_per_step_ms, 1e-12));
+            else if (r.reference_ms >= 0 && r.name == "exports")
+                std::cout << fmt::format("    CSV files: {:.4f} ms/set, {} KiB; binary files: {} KiB, speedup {:.2f}x\n", r.reference_ms, r.output_kb, r.reference_output_kb, r.reference_ms / std::max(r.time_per_step_ms, 1e-12));
+            else if (r.reference_ms >= 0)
+                std::cout << fmt::format("    step by step: {:.4f} ms/step, batched speedup {:.2f}x\n", r.reference_ms, r.reference_ms / std::max(r.time_per_step_ms, 1e-12));
+            if (r.max_vdiff_pu >= 0)
+                std::cout << fmt::format("    max. |V| difference to the {}: {:.3e} pu\n", (r.name == "sweep") ? "normal algorithm" : "step-by-step monitors", r.max_vdiff_pu);
+            if (r.max_freq_diff_pu >= 0)
+                std::cout << fmt::format("    max. frequency difference to the fixed step: {:.3e} pu\n", r.max_freq_diff_pu);
+            if (r.storage_kb >= 0)
+                std::cout << fmt::format("    monitor storage: {} KiB compressed, {} KiB plain ({:.1f}x)\n", r.storage_kb, r.reference_storage_kb, double(r.reference_storage_kb) / std::max<int64_t>(r.storage_kb, 1));
+            if (opts.profile)
+            {
+                for (size_t p = 0; p < r.profile_names.size() && 2 * p + 1 < size_t(r.profile.size()); ++p)
+                {
+                    if (r.profile[2 * p] == 0)
+                        continue;
+                    std::cout << fmt::format("    {:<20} {:>10} calls {:>12.1f} us\n", r.profile_names[p], int64_t(r.profile[2 * p]), r.profile[2 * p + 1]);
+                }
+            }
+            results.push_back(r);
+        }
+
+        if (!opts.baseline_out.empty())
+        {
+            write_baseline(opts.baseline_out, opts, results);
+            std::cout << fmt::format("\nBaseline saved to \"{}\"\n", opts.baseline_out);
+        }
+
+        if (!opts.baseline_in.empty() && compare_baseline(opts.baseline_in, opts, results) != 0)
+            return 2;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -963,6 +963,41 @@ extern "C" {
     */
     DSS_CAPI_DLL const char* ctx_Circuit_ToJSON(const void* ctx, int32_t options);
 
+    /*!
+    Same as `Circuit_ToJSON`, but writes the JSON document to the file `fileName`.
+    The document is written as it is generated, so the whole text is never kept
+    in memory, which is preferable for large circuits.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Circuit_ToJSONFile(const void* ctx, const char* fileName, int32_t options);
+
+    /*!
+    Compares the active circuit with the active circuit of the DSS context `otherCtx`,
+    object by object and property by property, using the property metadata of the
+    DSS classes. Returns a JSON-encoded object with an entry for each class with
+    differences, each one with three arrays:
+
+    - `Added`: objects only present in the other circuit, with the properties set by the user;
+    - `Removed`: objects only present in the active circuit, with the properties set by the user;
+    - `Changed`: objects present in both, with the properties that differ, as `[value, otherValue]`.
+
+    The objects are matched by name. The classes are compared in parallel.
+    `options` are the same as for `Obj_ToJSON` (e.g. `Pretty`, `LowercaseKeys`, `EnumAsInt`).
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL const char* ctx_Circuit_Diff(const void* ctx, const void* otherCtx, int32_t options);
+
+    /*!
+    Same as `Circuit_Diff`, but the other circuit is loaded from `snapshot`, a JSON
+    document as returned by `Circuit_ToJSON`. The snapshot is loaded in a temporary
+    DSS context, which is disposed before returning.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL const char* ctx_Circuit_DiffJSON(const void* ctx, const char* snapshot, int32_t options);
+
     /*
     Equivalent of the "save circuit" DSS command, but allows customization
     through the `saveFlags` argument, which is a set of bit flags. 
@@ -996,6 +1031,40 @@ extern "C" {
     */
     DSS_CAPI_DLL void ctx_Circuit_FromJSON(const void* ctx, const char *circ, int32_t options);
 
+    /*!
+    Clears the DSS engine and generates a synthetic distribution circuit,
+    intended for scale testing and benchmarks.
+
+    The circuit has a substation transformer feeding `NumFeeders` three-phase
+    feeders. Each feeder has an optional regulator at the head, a main line
+    with `MainSections` sections and `LateralsPerFeeder` laterals (with
+    `LateralSections` sections each) spread along the main line. Loads
+    (three-phase on the main line, single-phase on the laterals), PV systems
+    and storage elements are placed randomly at the buses, following the
+    densities given, and capacitors (optionally with CapControls) are spread
+    along the main lines. The random placement is deterministic for a given
+    `Seed`.
+
+    The elements are created directly through the batch/object API, without
+    the text parser, so large circuits can be created quickly.
+
+    `params` is a JSON-encoded object; all keys are optional. The keys and
+    defaults are: `Name` ("synthetic"), `SourcekV` (115), `FeederkV` (12.47),
+    `NumFeeders` (4), `MainSections` (100), `LateralsPerFeeder` (10),
+    `LateralSections` (10), `SectionLength` (0.1, in km), `LoadDensity` (1.0),
+    `LoadkW` (10, per phase), `LoadPF` (0.95), `PVDensity` (0.2), `PVkVA` (8),
+    `StorageDensity` (0.05), `StoragekW` (5), `StoragekWh` (13.5),
+    `Regulators` (true), `CapacitorsPerFeeder` (2), `Capacitorkvar` (300),
+    `CapControls` (true), `NumLoadShapes` (4), `LoadShapeNpts` (24),
+    `LoadShapeInterval` (1, in hours), `EnergyMeter` (true),
+    `SetVoltageBases` (true), `Seed` (1). The densities are probabilities,
+    from 0 to 1, of a bus having a load, and of a load having a PV system or
+    storage element.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Circuit_Generate(const void* ctx, const char *params);
+
     /*! 
     Array of strings. Get  Bus definitions to which each terminal is connected. 0-based array.
     */
@@ -3524,6 +3593,64 @@ extern "C" {
     Returns the list of all PCE within the area covered by the energy meter
     */
     DSS_CAPI_DLL void ctx_Meters_Get_ZonePCE(const void* ctx, char*** ResultPtr, int32_t* ResultDims);
+
+    /*!
+    Column names of a demand interval table (see `MeterTables`), without the hour column.
+    The tables are kept in memory when the option `DIMemory` is enabled, until the
+    next solution reopens them. Tables 0 and 1 refer to the active energy meter.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Meters_Get_DIColumnNames(const void* ctx, char*** ResultPtr, int32_t* ResultCount, int32_t Table);
+    /*!
+    Same as Meters_Get_DIColumnNames but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Meters_Get_DIColumnNames_GR(const void* ctx, int32_t Table);
+
+    /*!
+    Hours of the rows of a demand interval table. Empty if the table has no hour column.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Meters_Get_DIHours(const void* ctx, double** ResultPtr, int32_t* ResultCount, int32_t Table);
+    /*!
+    Same as Meters_Get_DIHours but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Meters_Get_DIHours_GR(const void* ctx, int32_t Table);
+
+    /*!
+    Values of a column (1-based) of a demand interval table. Text values are returned as NaN.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Meters_Get_DIColumn(const void* ctx, double** ResultPtr, int32_t* ResultCount, int32_t Table, int32_t Column);
+    /*!
+    Same as Meters_Get_DIColumn but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Meters_Get_DIColumn_GR(const void* ctx, int32_t Table, int32_t Column);
+
+    /*!
+    Values of a column (1-based) of a demand interval table, as text.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Meters_Get_DIColumnText(const void* ctx, char*** ResultPtr, int32_t* ResultCount, int32_t Table, int32_t Column);
+    /*!
+    Same as Meters_Get_DIColumnText but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Meters_Get_DIColumnText_GR(const void* ctx, int32_t Table, int32_t Column);
+
+    /*!
+    All numeric columns of a demand interval table, as a column-major matrix with
+    one row per interval (dimensions are rows, columns).
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Meters_Get_DIData(const void* ctx, double** ResultPtr, int32_t* ResultCount, int32_t Table);
+    /*!
+    Same as Meters_Get_DIData but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Meters_Get_DIData_GR(const void* ctx, int32_t Table);
     
 
     /*! 
@@ -3656,6 +3783,62 @@ extern "C" {
     */
     DSS_CAPI_DLL void ctx_Monitors_Get_Channel_GR(const void* ctx, int32_t Index);
 
+    /*!
+    All channels of several monitors in a single array, filled in parallel across the monitors
+    (`NumThreads`, 0 for all the logical CPUs). `Names` selects the monitors; if empty
+    (`NamesCount` = 0), all monitors of the circuit are used, in the order of Monitors_Get_AllNames.
+
+    The data of each monitor is a column-major block of samples-by-columns values, where the
+    first two columns are the hour and the seconds (frequency and harmonic in harmonics mode),
+    followed by the channels. The position and size of each block is given by
+    Monitors_Get_ChannelMatrixIndex for the same selection.
+
+    A `Save` or `SaveAll` should be executed first, which is done automatically by most
+    standard solution modes.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Monitors_Get_ChannelMatrix(const void* ctx, double** ResultPtr, int32_t* ResultDims, const char** Names, int32_t NamesCount, int32_t NumThreads);
+
+    /*!
+    Same as Monitors_Get_ChannelMatrix but using the global buffer interface for results
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Monitors_Get_ChannelMatrix_GR(const void* ctx, const char** Names, int32_t NamesCount, int32_t NumThreads);
+
+    /*!
+    Same as Monitors_Get_ChannelMatrix, keeping the float32 values stored by the monitors. Use
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Monitors_Get_ChannelMatrixSingle(const void* ctx, float** ResultPtr, int32_t* ResultDims, const char** Names, int32_t NamesCount, int32_t NumThreads);
+
+    /*!
+    Index table for Monitors_Get_ChannelMatrix: three values per selected monitor, the offset
+    of its block in the array, the number of samples (rows) and the number of columns
+    (channels + 2).
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Monitors_Get_ChannelMatrixIndex(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims, const char** Names, int32_t NamesCount);
+
+    /*!
+    Same as Monitors_Get_ChannelMatrixIndex but using the global buffer interface for results
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Monitors_Get_ChannelMatrixIndex_GR(const void* ctx, const char** Names, int32_t NamesCount);
+
+    /*!
+    Memory used by the samples of the active monitor, in bytes. For monitors with
+    `compress=yes`, this includes the compressed store; the data returned by the
+    ByteStream and Channel functions is the same for both storage modes.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL uint64_t ctx_Monitors_Get_StorageSize(const void* ctx);
+
     /*! 
     Array of doubles containing frequency values for harmonics mode solutions; Empty for time mode solutions (use dblHour)
     */
@@ -5458,12 +5641,12 @@ extern "C" {
     DSS_CAPI_DLL void ctx_Solution_Set_Capkvar(const void* ctx, double Value);
 
     /*! 
-    Base Solution algorithm: {NormalSolve | NewtonSolve}
+    Base Solution algorithm: {NormalSolve | NewtonSolve | SweepSolve}
     */
     DSS_CAPI_DLL int32_t ctx_Solution_Get_Algorithm(const void* ctx);
 
     /*! 
-    Base Solution algorithm: {NormalSolve | NewtonSolve}
+    Base Solution algorithm: {NormalSolve | NewtonSolve | SweepSolve}
     */
     DSS_CAPI_DLL void ctx_Solution_Set_Algorithm(const void* ctx, int32_t Value);
 
@@ -5690,6 +5873,280 @@ extern "C" {
     */
     DSS_CAPI_DLL void ctx_Solution_Get_IncMatrixCols_GR(const void* ctx);
 
+    /*!
+    Enables/disables the collection of the solver profile for this DSS context.
+    When disabled (default), the instrumented code paths only check this flag.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL uint16_t ctx_Solution_Get_ProfileEnabled(const void* ctx);
+
+    /*!
+    Enables/disables the collection of the solver profile for this DSS context.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Set_ProfileEnabled(const void* ctx, uint16_t Value);
+
+    /*!
+    Zeroes all the solver profile counters and timers for this DSS context.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_ResetProfile(const void* ctx);
+
+    /*!
+    Solver profile accumulated since the last reset, as a 2-by-N matrix: for each
+    phase (see Solution_Get_ProfileNames), the number of calls and the total
+    time, in microseconds.
+
+    The phases are the full and incremental system Y builds, KLU factorization, 
+    refactorization (after an incremental update) and solve, PC injection currents, 
+    current summation, control sampling, control actions, and monitor and 
+    energy meter sampling. KLU factorizes the matrix within the first solve after 
+    a system Y build, so that solve (factorization included) is counted as the 
+    factorization or refactorization, and only the later solves as KLU solves.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Get_Profile(const void* ctx, double** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as Solution_Get_Profile but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Solution_Get_Profile_GR(const void* ctx);
+
+    /*!
+    Names of the phases reported in Solution_Get_Profile.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Get_ProfileNames(const void* ctx, char*** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as Solution_Get_ProfileNames but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Solution_Get_ProfileNames_GR(const void* ctx);
+
+    /*!
+    Number of primitive Y matrix (YPrim) recalculations done by the system Y 
+    builds, for each DSS class, in the same order as DSS_Get_Classes.
+    Collected only while the solver profile is enabled.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Get_ProfileYPrimCounts(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as Solution_Get_ProfileYPrimCounts but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Solution_Get_ProfileYPrimCounts_GR(const void* ctx);
+
+    /*!
+    If enabled, the MonteFault solution mode solves the circuit once without faults and
+    evaluates each fault case as a low-rank update of that solution, using the columns of
+    the inverse of the system Y matrix at the fault nodes. The system Y matrix is not 
+    rebuilt or refactorized for each case. The results match the full solution up to 
+    round-off. The faults remain disabled while the monitors take their samples, so the 
+    full solution is used if an enabled monitor is connected to a Fault object, as well 
+    as if any fault connects nodes that don't exist without it. Disabled by default.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL uint16_t ctx_Solution_Get_FastMonteFault(const void* ctx);
+
+    /*!
+    Enables/disables the fast evaluation of the faults in the MonteFault solution mode.
+    See Solution_Get_FastMonteFault.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Set_FastMonteFault(const void* ctx, uint16_t Value);
+
+    /*!
+    Number of time steps solved together in the Daily, Yearly and Duty modes (batched time
+    series). Disabled (0) by default; values below 2 also disable it.
+
+    It is only used when the system Y matrix is fixed across the steps: admittance load model
+    (`Set LoadModel=Admittance`), no enabled control elements, grid-forming inverters or
+    storage elements, no enabled faults unless the control mode is static, and no event
+    callbacks. Each step is then a direct solution where only the source injections change.
+    The injection vectors of a batch of steps are built first and solved together against the
+    same factorization, in parallel (see Solution_Get_BatchThreads), and the monitors and
+    energy meters take their samples for each step as in the step-by-step loop. Each step
+    reports an equal share of the time of its batch in Solution_Get_Process_Time. If the
+    system Y matrix changes while building a batch, the remaining steps use the step-by-step
+    loop.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_Solution_Get_BatchSize(const void* ctx);
+
+    /*!
+    Sets the number of time steps solved together. See Solution_Get_BatchSize.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Set_BatchSize(const void* ctx, int32_t Value);
+
+    /*!
+    Number of threads used to solve the batched time steps. Defaults to 0, all the logical CPUs.
+    See Solution_Get_BatchSize.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_Solution_Get_BatchThreads(const void* ctx);
+
+    /*!
+    Sets the number of threads used to solve the batched time steps. See Solution_Get_BatchThreads.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Set_BatchThreads(const void* ctx, int32_t Value);
+
+    /*!
+    Local error tolerance of the adaptive time step of the Dynamics mode. Disabled (0) by default,
+    which keeps the fixed step size.
+
+    When enabled, a solution in Dynamics mode still covers `Number * StepSize` seconds, but the
+    size of each step is chosen from the difference between the predicted and corrected states
+    of the PC elements in the previous step, within the limits of Solution_Get_DynamicsMinStep
+    and Solution_Get_DynamicsMaxStep. The step size is restored afterwards. Steps are not
+    repeated when the error exceeds the tolerance, so use a conservative value. The monitors
+    take a sample at every step.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL double ctx_Solution_Get_DynamicsTolerance(const void* ctx);
+
+    /*!
+    Sets the local error tolerance of the adaptive time step. See Solution_Get_DynamicsTolerance.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Set_DynamicsTolerance(const void* ctx, double Value);
+
+    /*!
+    Minimum step size of the adaptive time step, in seconds. Defaults (0) to 1/100 of the step size.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL double ctx_Solution_Get_DynamicsMinStep(const void* ctx);
+
+    /*!
+    Sets the minimum step size of the adaptive time step. See Solution_Get_DynamicsMinStep.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Set_DynamicsMinStep(const void* ctx, double Value);
+
+    /*!
+    Maximum step size of the adaptive time step, in seconds. Defaults (0) to 10 times the step size.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL double ctx_Solution_Get_DynamicsMaxStep(const void* ctx);
+
+    /*!
+    Sets the maximum step size of the adaptive time step. See Solution_Get_DynamicsMaxStep.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Set_DynamicsMaxStep(const void* ctx, double Value);
+
+    /*!
+    Number of threads used to integrate the states of the PC elements in the Dynamics mode.
+    Defaults to 1; use 0 for all the logical CPUs.
+
+    Only the Generator (except user-written models and dynamic expressions) and IndMach012
+    elements are integrated in parallel, in chunks of elements of the same class. The others
+    (e.g. PVSystem, Storage) are integrated afterwards in the calling thread.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_Solution_Get_DynamicsThreads(const void* ctx);
+
+    /*!
+    Sets the number of threads used to integrate the states. See Solution_Get_DynamicsThreads.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Set_DynamicsThreads(const void* ctx, int32_t Value);
+
+    /*!
+    Node voltages with each Fault object of the circuit applied alone, as a complex 
+    NumNodes-by-NumFaults matrix (column-major, one column per fault in definition order, 
+    nodes in the same order as Circuit_Get_YNodeOrder). Uses the admittance load model,
+    like the fault study.
+
+    The circuit is solved once without faults and each fault is evaluated as a low-rank 
+    update of that solution (see Solution_Get_FastMonteFault). The enabled state of the 
+    faults is restored afterwards.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Get_FastFaultVoltages(const void* ctx, double** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as Solution_Get_FastFaultVoltages but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Solution_Get_FastFaultVoltages_GR(const void* ctx);
+
+    /*!
+    Validates the fast fault evaluation against the full solution: for each Fault object,
+    compares the voltages from Solution_Get_FastFaultVoltages to a direct solution with 
+    only that fault enabled. Returns the largest node voltage difference, relative to the 
+    node voltage magnitude without faults (absolute, in volts, for nodes under 1 V), or -1 
+    if the fast evaluation is not applicable. The enabled state of the faults is restored 
+    afterwards.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL double ctx_Solution_ValidateFastFaults(const void* ctx);
+
+    /*!
+    With the Sweep solution algorithm, returns whether the last solution used the 
+    backward/forward sweep. If the circuit is not radial or has elements the sweep 
+    cannot handle, the Normal algorithm is used instead; see 
+    Solution_Get_SweepFallbackReason.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL uint16_t ctx_Solution_Get_SweepActive(const void* ctx);
+
+    /*!
+    Reason the Sweep solution algorithm could not be used in the last solution 
+    (e.g. a loop or an element with more than two terminals), or an empty string.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL const char* ctx_Solution_Get_SweepFallbackReason(const void* ctx);
+
+    /*!
+    Sensitivities of the voltage magnitudes to power injections, computed from the 
+    present factorization of the system Y matrix (one solve per bus, in parallel) 
+    instead of perturbed solutions. The circuit must be solved.
+
+    For each bus in `BusesPtr`, 1 kW (or 1 kvar) is injected, split evenly among its 
+    phase nodes (1-3). The output nodes are given as "bus.node" in `NodesPtr`; if 
+    `NodesCount` is zero, all nodes are used, in the order of Circuit_Get_YNodeOrder.
+
+    The result is a dense, column-major NumNodes-by-(2*NumBuses) matrix: the first 
+    NumBuses columns are dV/dP, in pu/kW, and the others dV/dQ, in pu/kvar. The 
+    injections are linearized around the present solution, with the loads and 
+    generators represented as in the system Y matrix.
+
+    `NumThreads` <= 0 uses all the logical CPUs.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Solution_Get_VoltageSensitivities(const void* ctx, double** ResultPtr, int32_t* ResultDims, const char** BusesPtr, int32_t BusesCount, const char** NodesPtr, int32_t NodesCount, int32_t NumThreads);
+
+    /*! 
+    Same as Solution_Get_VoltageSensitivities but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Solution_Get_VoltageSensitivities_GR(const void* ctx, const char** BusesPtr, int32_t BusesCount, const char** NodesPtr, int32_t NodesCount, int32_t NumThreads);
+
     /*! 
     Open or Close the switch. No effect if switch is locked.  However, Reset removes any lock and then closes the switch (shelf state).
     */
@@ -5805,22 +6262,68 @@ extern "C" {
     */
     DSS_CAPI_DLL const char* ctx_Text_Get_Result(const void* ctx);
 
-    /*! 
-    Number of loops
-    */
-    DSS_CAPI_DLL int32_t ctx_Topology_Get_NumLoops(const void* ctx);
+    /*!
+    Column names of the table of the last export written with the option `ExportFormat`
+    set to Binary or Memory.
 
-    /*! 
-    Returns index of the active branch
+    (API Extension)
     */
-    DSS_CAPI_DLL int32_t ctx_Topology_Get_ActiveBranch(const void* ctx);
+    DSS_CAPI_DLL void ctx_Text_Get_ExportColumnNames(const void* ctx, char*** ResultPtr, int32_t* ResultCount);
+    /*!
+    Same as Text_Get_ExportColumnNames but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Text_Get_ExportColumnNames_GR(const void* ctx);
 
-    /*! 
-    Array of all isolated branch names.
+    /*!
+    Values of a column (1-based) of the table of the last export. Text values are returned as NaN.
+
+    (API Extension)
     */
-    DSS_CAPI_DLL void ctx_Topology_Get_AllIsolatedBranches(const void* ctx, char*** ResultPtr, int32_t* ResultDims);
-    /*! 
-    Same as Topology_Get_AllIsolatedBranches but using the global buffer interface for results
+    DSS_CAPI_DLL void ctx_Text_Get_ExportColumn(const void* ctx, double** ResultPtr, int32_t* ResultCount, int32_t Column);
+    /*!
+    Same as Text_Get_ExportColumn but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Text_Get_ExportColumn_GR(const void* ctx, int32_t Column);
+
+    /*!
+    Values of a column (1-based) of the table of the last export, as text.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Text_Get_ExportColumnText(const void* ctx, char*** ResultPtr, int32_t* ResultCount, int32_t Column);
+    /*!
+    Same as Text_Get_ExportColumnText but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Text_Get_ExportColumnText_GR(const void* ctx, int32_t Column);
+
+    /*!
+    All columns of the table of the last export, as a column-major matrix with one
+    row per exported row (dimensions are rows, columns). Text values are returned as NaN.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_Text_Get_ExportData(const void* ctx, double** ResultPtr, int32_t* ResultCount);
+    /*!
+    Same as Text_Get_ExportData but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_Text_Get_ExportData_GR(const void* ctx);
+
+    /*! 
+    Number of loops
+    */
+    DSS_CAPI_DLL int32_t ctx_Topology_Get_NumLoops(const void* ctx);
+
+    /*! 
+    Returns index of the active branch
+    */
+    DSS_CAPI_DLL int32_t ctx_Topology_Get_ActiveBranch(const void* ctx);
+
+    /*! 
+    Array of all isolated branch names.
+    */
+    DSS_CAPI_DLL void ctx_Topology_Get_AllIsolatedBranches(const void* ctx, char*** ResultPtr, int32_t* ResultDims);
+    /*! 
+    Same as Topology_Get_AllIsolatedBranches but using the global buffer interface for results
     */
     DSS_CAPI_DLL void ctx_Topology_Get_AllIsolatedBranches_GR(const void* ctx);
 
@@ -6979,6 +7482,489 @@ extern "C" {
 
     DSS_CAPI_DLL void ctx_YMatrix_Set_SolverOptions(const void* ctx, uint64_t opts);
     DSS_CAPI_DLL uint64_t ctx_YMatrix_Get_SolverOptions(const void* ctx);
+
+    /*!
+    Maximum rank of the accumulated low-rank corrections (number of affected nodes) before
+    they are written to the system Y matrix, which is then refactorized. Only used with the
+    `SolverOptions_LowRankUpdates` flag. Defaults to 16.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_YMatrix_Get_LowRankThreshold(const void* ctx);
+    DSS_CAPI_DLL void ctx_YMatrix_Set_LowRankThreshold(const void* ctx, int32_t Value);
+
+    /*!
+    Rank of the low-rank corrections currently applied on top of the factorized system Y matrix.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_YMatrix_Get_LowRank(const void* ctx);
+
+    /*!
+    Returns a zero-copy view of the node voltage array of the active circuit's solution,
+    as `NumNodes` complex values (interleaved real and imaginary parts), in the same order
+    as `Circuit_Get_YNodeOrder`. The ground node is not included.
+
+    The pointer is owned by the engine. It remains valid only while `YMatrix_Get_ViewGeneration`
+    returns the same `Generation` value: the generation changes whenever the arrays are
+    reallocated (e.g. when the circuit changes and the system Y matrix is rebuilt with new
+    nodes), released, or when the system is solved and the values are updated.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_YMatrix_Get_NodeVView(const void* ctx, double **VvectorPtr, int32_t *NumNodes, uint64_t *Generation);
+
+    /*!
+    Same as `YMatrix_Get_NodeVView`, for the injection current array.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_YMatrix_Get_CurrentsView(const void* ctx, double **IvectorPtr, int32_t *NumNodes, uint64_t *Generation);
+
+    /*!
+    Current generation of the solution arrays. See `YMatrix_Get_NodeVView`.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL uint64_t ctx_YMatrix_Get_ViewGeneration(const void* ctx);
+
+    /*!
+    Returns a zero-copy view of the system Y matrix of the active circuit in compressed
+    sparse column (CSC) form: `NumNodes + 1` column pointers, and `NumNZ` row indices and
+    complex values (interleaved real and imaginary parts). Indices are 0-based and follow
+    `Circuit_Get_YNodeOrder`.
+
+    The arrays are a snapshot of the matrix, copied from the sparse solver only once after
+    each build. They are owned by the engine and remain valid only while
+    `YMatrix_Get_YGeneration` returns the same `Generation` value, i.e. until the next
+    build or update of the system Y matrix.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_YMatrix_Get_CSCView(const void* ctx, int32_t **ColPtr, int32_t **RowIdx, double **cVals, int32_t *NumNodes, int32_t *NumNZ, uint64_t *Generation);
+
+    /*!
+    Current generation of the system Y matrix. See `YMatrix_Get_CSCView`.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL uint64_t ctx_YMatrix_Get_YGeneration(const void* ctx);
+
+    /*!
+    Runs a static protection coordination study on the active circuit.
+
+    The fault study data (open-circuit voltages and short-circuit impedance matrices, as
+    in "solve mode=faultstudy") is used to compute the bolted fault currents at every bus,
+    for each fault type selected in `FaultTypes` (flags from the enumeration
+    ProtectionFaultTypes; 0 for all). The overcurrent Relay, Recloser and Fuse objects
+    upstream of the faulted bus are assumed to carry the fault current, and their operating
+    times are evaluated from their TCC curves, as in their first operation. Each pair of
+    consecutive devices towards the source is reported as a primary/backup pair and checked
+    against the coordination time interval `CTI`, in seconds. Load and DG contributions
+    are neglected.
+
+    The buses are processed in parallel using `NumThreads` threads (0 to use all logical CPUs).
+    The results are accessible column-wise through the ProtectionStudy_Get_* functions, one
+    element per row, ordered by bus. Returns the number of rows.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_ProtectionStudy_Run(const void* ctx, int32_t FaultTypes, double CTI, int32_t NumThreads);
+
+    /*!
+    Number of rows in the results of the last protection study.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_ProtectionStudy_Get_Count(const void* ctx);
+
+    /*!
+    Number of rows in the results of the last protection study with a status other than OK.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_ProtectionStudy_Get_NumViolations(const void* ctx);
+
+    /*!
+    Protection study results: Name of the faulted bus.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_BusNames(const void* ctx, char*** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ProtectionStudy_Get_BusNames but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_BusNames_GR(const void* ctx);
+
+    /*!
+    Protection study results: Fault type. See the enumeration ProtectionFaultTypes.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_FaultTypes(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ProtectionStudy_Get_FaultTypes but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_FaultTypes_GR(const void* ctx);
+
+    /*!
+    Protection study results: Full name of the primary device (e.g. "Fuse.f1").
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_PrimaryNames(const void* ctx, char*** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ProtectionStudy_Get_PrimaryNames but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_PrimaryNames_GR(const void* ctx);
+
+    /*!
+    Protection study results: Full name of the backup device, the next device towards the source.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_BackupNames(const void* ctx, char*** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ProtectionStudy_Get_BackupNames but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_BackupNames_GR(const void* ctx);
+
+    /*!
+    Protection study results: Fault current at the bus, in amperes (largest phase).
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_FaultAmps(const void* ctx, double** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ProtectionStudy_Get_FaultAmps but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_FaultAmps_GR(const void* ctx);
+
+    /*!
+    Protection study results: Operating time of the primary device, in seconds, or -1 if it doesn't operate.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_PrimaryTimes(const void* ctx, double** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ProtectionStudy_Get_PrimaryTimes but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_PrimaryTimes_GR(const void* ctx);
+
+    /*!
+    Protection study results: Operating time of the backup device, in seconds, or -1 if it doesn't operate.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_BackupTimes(const void* ctx, double** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ProtectionStudy_Get_BackupTimes but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_BackupTimes_GR(const void* ctx);
+
+    /*!
+    Protection study results: Coordination margin (backup time minus primary time), in seconds. NaN if either device doesn't operate.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_Margins(const void* ctx, double** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ProtectionStudy_Get_Margins but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_Margins_GR(const void* ctx);
+
+    /*!
+    Protection study results: Coordination status of the pair. See the enumeration ProtectionPairStatus.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_Status(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ProtectionStudy_Get_Status but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ProtectionStudy_Get_Status_GR(const void* ctx);
+
+    /*!
+    Runs an N-1/N-k contingency screening of branch outages on the active circuit, which must
+    be solved.
+
+    Each case is a string with the full names of the PD elements to remove, separated by spaces
+    or commas, e.g. "Line.L1 Line.L2". If `CasesCount` is 0, each enabled series PD element is
+    a case (N-1). The post-contingency voltages are computed as low-rank updates of the present
+    solution, using the factorization of the system Y matrix, keeping the injection currents
+    of the present solution (loads and generators are not re-solved). The voltages are checked
+    against the circuit normal voltage limits, and the terminal 1 currents of the PD elements
+    against their NormAmps and EmergAmps, as in the EnergyMeter reports.
+
+    The cases are processed in parallel using `NumThreads` threads (0 to use all logical CPUs).
+    The results are accessible column-wise through the ContingencyStudy_Get_* functions, one
+    element per case, in the input order. Returns the number of cases.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_ContingencyStudy_Run(const void* ctx, const char** CasesPtr, int32_t CasesCount, int32_t NumThreads);
+
+    /*!
+    Number of cases in the results of the last contingency study.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_ContingencyStudy_Get_Count(const void* ctx);
+
+    /*!
+    Number of cases in the results of the last contingency study that were not solved,
+    or have voltage violations or overloads (above NormAmps).
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_ContingencyStudy_Get_NumViolations(const void* ctx);
+
+    /*!
+    Contingency study results: Case specification, as given to ContingencyStudy_Run (the element name for the default N-1 cases).
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_CaseNames(const void* ctx, char*** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ContingencyStudy_Get_CaseNames but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_CaseNames_GR(const void* ctx);
+
+    /*!
+    Contingency study results: 1 if the post-contingency system could be solved, 0 otherwise (e.g. singular system). The other results of cases that were not solved are not meaningful.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_Converged(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ContingencyStudy_Get_Converged but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_Converged_GR(const void* ctx);
+
+    /*!
+    Contingency study results: Number of buses left without a path to a source by the outage.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_NumIsolatedBuses(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ContingencyStudy_Get_NumIsolatedBuses but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_NumIsolatedBuses_GR(const void* ctx);
+
+    /*!
+    Contingency study results: Number of energized buses with a node voltage below the circuit NormalMinVolts (pu).
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_NumUnderVoltages(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ContingencyStudy_Get_NumUnderVoltages but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_NumUnderVoltages_GR(const void* ctx);
+
+    /*!
+    Contingency study results: Number of energized buses with a node voltage above the circuit NormalMaxVolts (pu).
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_NumOverVoltages(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ContingencyStudy_Get_NumOverVoltages but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_NumOverVoltages_GR(const void* ctx);
+
+    /*!
+    Contingency study results: Minimum node voltage of the energized buses with a voltage base, in pu. Nodes below 0.1 pu (neutrals) are ignored.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_MinVoltages(const void* ctx, double** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ContingencyStudy_Get_MinVoltages but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_MinVoltages_GR(const void* ctx);
+
+    /*!
+    Contingency study results: Maximum node voltage of the energized buses with a voltage base, in pu.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_MaxVoltages(const void* ctx, double** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ContingencyStudy_Get_MaxVoltages but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_MaxVoltages_GR(const void* ctx);
+
+    /*!
+    Contingency study results: Number of PD elements with a terminal 1 phase current above NormAmps.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_NumOverloads(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ContingencyStudy_Get_NumOverloads but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_NumOverloads_GR(const void* ctx);
+
+    /*!
+    Contingency study results: Number of PD elements with a terminal 1 phase current above EmergAmps.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_NumEmergOverloads(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ContingencyStudy_Get_NumEmergOverloads but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_NumEmergOverloads_GR(const void* ctx);
+
+    /*!
+    Contingency study results: Maximum terminal 1 phase current of the PD elements, in percent of NormAmps.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_MaxLoadings(const void* ctx, double** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ContingencyStudy_Get_MaxLoadings but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_MaxLoadings_GR(const void* ctx);
+
+    /*!
+    Contingency study results: Full name of the PD element with the maximum loading (empty if none).
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_WorstElements(const void* ctx, char*** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as ContingencyStudy_Get_WorstElements but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_ContingencyStudy_Get_WorstElements_GR(const void* ctx);
+
+    /*!
+    Runs a hosting capacity analysis on the active circuit, which must be solved: the largest
+    PV (balanced, unity power factor) that each bus accepts, up to `MaxkW`, without overvoltage
+    (NormalMaxVolts of the circuit), thermal overloads (terminal 1 currents above NormAmps),
+    voltage deviations above `MaxDeviation` (pu, from the present solution; 0 to disable) or
+    a PV fault contribution (1.2 times its rated current) above `ReachFraction` of the bus
+    short-circuit current (0 to disable). Nodes and elements already above their limits only
+    count if they get worse.
+
+    The voltage sensitivities from the present factorization and the bus Zsc (from the last
+    fault study, or the driving point impedance) give a first estimate per bus, which is then
+    refined by bisection over approximate power flows: fixed-point iterations on the present
+    system Y matrix with the PV as a constant power injection and every other injection frozen
+    at its value in the present solution. These are not full solutions of the circuit: voltage
+    dependent loads, controls (e.g. regulators, capacitor controls) and the response of the
+    other PC elements are not included, so the capacities are approximations. Confirm critical
+    values with a regular solution including the PV. The circuit is not modified.
+    If `BusesCount` is 0, all buses with phase nodes are analyzed.
+
+    The buses are processed in parallel using `NumThreads` threads (0 to use all logical CPUs).
+    The results are accessible column-wise through the HostingCapacity_Get_* functions, one
+    element per bus, in the input order. Returns the number of buses.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_HostingCapacity_Run(const void* ctx, const char** BusesPtr, int32_t BusesCount, double MaxkW, double MaxDeviation, double ReachFraction, int32_t NumThreads);
+
+    /*!
+    Number of buses in the results of the last hosting capacity analysis.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL int32_t ctx_HostingCapacity_Get_Count(const void* ctx);
+
+    /*!
+    Hosting capacity results: Bus name.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_BusNames(const void* ctx, char*** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as HostingCapacity_Get_BusNames but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_BusNames_GR(const void* ctx);
+
+    /*!
+    Hosting capacity results: Hosting capacity, in kW: the largest PV size within all limits in the approximate power flows.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_Capacities(const void* ctx, double** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as HostingCapacity_Get_Capacities but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_Capacities_GR(const void* ctx);
+
+    /*!
+    Hosting capacity results: First estimate of the hosting capacity, in kW, from the sensitivities and the short-circuit data.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_Estimates(const void* ctx, double** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as HostingCapacity_Get_Estimates but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_Estimates_GR(const void* ctx);
+
+    /*!
+    Hosting capacity results: Binding constraint: 0 = none (MaxkW reached), 1 = overvoltage, 2 = thermal (NormAmps), 3 = voltage deviation, 4 = protection reach, 5 = the approximate power flow with the PV did not converge.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_Constraints(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as HostingCapacity_Get_Constraints but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_Constraints_GR(const void* ctx);
+
+    /*!
+    Hosting capacity results: Node ("bus.node") or full element name at the binding limit (the bus itself for the protection reach; empty if none).
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_LimitingElements(const void* ctx, char*** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as HostingCapacity_Get_LimitingElements but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_LimitingElements_GR(const void* ctx);
+
+    /*!
+    Hosting capacity results: Number of approximate power flows used by the bisection.
+
+    (API Extension)
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_NumSolutions(const void* ctx, int32_t** ResultPtr, int32_t* ResultDims);
+
+    /*! 
+    Same as HostingCapacity_Get_NumSolutions but using the global buffer interface for results
+    */
+    DSS_CAPI_DLL void ctx_HostingCapacity_Get_NumSolutions_GR(const void* ctx);
     
     DSS_CAPI_DLL void ctx_Text_CommandBlock(const void* ctx, const char* Value);
     DSS_CAPI_DLL void ctx_Text_CommandArray(const void* ctx, const char** ValuePtr, int32_t ValueCount);
@@ -7167,6 +8153,21 @@ extern "C" {
 
 
 
+    /*!
+    (the edit transaction), and returns the number of objects with changes.
+
+    While in a transaction, the properties of the objects can be set without recalculating
+    the objects after each change, and without invalidating the system Y matrix. On commit,
+    the objects changed are recalculated once, in the order they entered the transaction. The
+    changes to the primitive Y matrices are then applied together: if the solver options allow
+    incremental Y updates and the structure of the circuit is not changed, the system Y is
+    updated incrementally on the next solution; otherwise, it is rebuilt once.
+
+    of the batch leave the transaction.
+
+    (API Extension)
+    */
+
 
 
 
@@ -1877,6 +1877,35 @@ using namespace dss::capi;
         }
     };
 
+    ///
+    /// Channels of several monitors in a single array, see `IMonitors::ChannelMatrix`.
+    /// `monitor(i)` maps the block of the i-th monitor (samples-by-columns, the first
+    /// two columns being the time) without copying; the maps are valid while this
+    /// object exists.
+    ///
+    template <typename ScalarT>
+    struct MonitorChannelMatrix
+    {
+        typedef Eigen::Matrix<ScalarT, Eigen::Dynamic, Eigen::Dynamic> MatrixT;
+
+        Eigen::Matrix<ScalarT, Eigen::Dynamic, 1> data;
+        Eigen::Matrix<int32_t, Eigen::Dynamic, 1> index; ///< offset, samples and columns of each monitor
+
+        int32_t count() const
+        {
+            return int32_t(index.size() / 3);
+        }
+
+        Eigen::Map<const MatrixT> monitor(int32_t i) const
+        {
+            if (i < 0 || i >= count())
+            {
+                throw std::out_of_range("Invalid monitor index.");
+            }
+            return Eigen::Map<const MatrixT>(data.data() + index[3 * i], index[3 * i + 1], index[3 * i + 2]);
+        }
+    };
+
     class IMonitors: public ContextState
     {
     public:
@@ -1899,6 +1928,50 @@ using namespace dss::capi;
             return api_util->get_float64_gr_array<VectorT>();
         }
 
+        ///
+        /// All channels of the monitors in `names` (all monitors, if empty) in a single float64
+        /// array, filled in parallel across the monitors (`num_threads`, 0 for all CPUs).
+        /// A Save or SaveAll should be executed first.
+        ///
+        /// (API Extension)
+        ///
+        MonitorChannelMatrix<double> ChannelMatrix(const strings &names=strings(), int32_t num_threads=0)
+        {
+            std::vector<const char*> name_ptrs = channel_matrix_names(names);
+            MonitorChannelMatrix<double> res;
+            res.index = channel_matrix_index(name_ptrs);
+            ctx_Monitors_Get_ChannelMatrix_GR(ctx, name_ptrs.data(), int32_t(name_ptrs.size()), num_threads);
+            api_util->check_for_error();
+            if (*api_util->count_PDouble != 0)
+            {
+                res.data = api_util->get_float64_gr_array<Eigen::VectorXd>();
+            }
+            return res;
+        }
+
+        ///
+        /// Same as `ChannelMatrix`, keeping the float32 values stored by the monitors.
+        ///
+        /// (API Extension)
+        ///
+        MonitorChannelMatrix<float> ChannelMatrixSingle(const strings &names=strings(), int32_t num_threads=0)
+        {
+            std::vector<const char*> name_ptrs = channel_matrix_names(names);
+            MonitorChannelMatrix<float> res;
+            res.index = channel_matrix_index(name_ptrs);
+            float *data = nullptr;
+            int32_t dims[4] = {0, 0, 0, 0};
+            ctx_Monitors_Get_ChannelMatrixSingle(ctx, &data, dims, name_ptrs.data(), int32_t(name_ptrs.size()), num_threads);
+            res.data.resize(dims[0]);
+            if (dims[0] != 0)
+            {
+                memcpy(res.data.data(), data, sizeof(float) * dims[0]);
+            }
+            DSS_Dispose_PSingle(&data);
+            api_util->check_for_error();
+            return res;
+        }
+
         ///
         /// Array of strings with all Monitor names in the circuit.
         ///
@@ -2122,6 +2195,17 @@ using namespace dss::capi;
             return ctx_Monitors_Get_SampleCount(ctx);
         }
 
+        /// 
+        /// Memory used by the samples of the active monitor, in bytes, including the compressed store of monitors with compress=yes.
+        /// 
+        /// (API Extension)
+        /// 
+        uint64_t StorageSize() // getter
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            return ctx_Monitors_Get_StorageSize(ctx);
+        }
+
         /// 
         /// Terminal number of element being monitored.
         /// 
@@ -2158,6 +2242,28 @@ using namespace dss::capi;
             ctx_Monitors_Get_dblHour_GR(ctx);
             return api_util->get_float64_gr_array<VectorT>();
         }
+
+    private:
+        static std::vector<const char*> channel_matrix_names(const strings &names)
+        {
+            std::vector<const char*> name_ptrs(names.size());
+            for (size_t i = 0; i < names.size(); ++i)
+            {
+                name_ptrs[i] = names[i].c_str();
+            }
+            return name_ptrs;
+        }
+
+        Eigen::Matrix<int32_t, Eigen::Dynamic, 1> channel_matrix_index(std::vector<const char*> &name_ptrs)
+        {
+            ctx_Monitors_Get_ChannelMatrixIndex_GR(ctx, name_ptrs.data(), int32_t(name_ptrs.size()));
+            api_util->check_for_error();
+            if (*api_util->count_PInteger == 0)
+            {
+                return Eigen::Matrix<int32_t, Eigen::Dynamic, 1>();
+            }
+            return api_util->get_int32_gr_array<Eigen::Matrix<int32_t, Eigen::Dynamic, 1>>();
+        }
     };
 
     class IParser: public ContextState
@@ -2532,6 +2638,158 @@ using namespace dss::capi;
         }
     };
 
+    ///
+    /// Zero-copy, read-only view of one of the solution arrays (node voltages or
+    /// injection currents), as returned by IYMatrix::NodeVView and IYMatrix::CurrentsView.
+    ///
+    /// The data is owned by the engine. It is only valid while the solution generation
+    /// is unchanged, i.e. until the next solve or reallocation of the solution arrays.
+    /// `data()` throws if the view is stale; acquire a new view in that case.
+    ///
+    class SolutionView
+    {
+    public:
+        typedef Eigen::Map<const Eigen::VectorXcd> MapType;
+
+        SolutionView(void *ctx, const double *ptr, int32_t count, uint64_t generation) :
+            ctx_(ctx), ptr_(ptr), count_(count), generation_(generation)
+        {
+        }
+
+        ///
+        /// True if the view still points to the current solution data.
+        ///
+        bool valid() const
+        {
+            return (ptr_ != nullptr) && (ctx_YMatrix_Get_ViewGeneration(ctx_) == generation_);
+        }
+
+        uint64_t generation() const
+        {
+            return generation_;
+        }
+
+        ///
+        /// Number of nodes (complex values) in the view; follows the YNodeOrder.
+        ///
+        int32_t size() const
+        {
+            return count_;
+        }
+
+        ///
+        /// Maps the data as a complex Eigen vector, after checking that the view is still valid.
+        ///
+        MapType data() const
+        {
+            if (!valid())
+            {
+                throw std::runtime_error("The solution view is no longer valid; the solution arrays were updated or reallocated.");
+            }
+            return unchecked_data();
+        }
+
+        ///
+        /// Maps the data as a complex Eigen vector without checking the generation.
+        ///
+        MapType unchecked_data() const
+        {
+            return MapType(reinterpret_cast<const complex*>(ptr_), count_);
+        }
+
+    protected:
+        void *ctx_;
+        const double *ptr_;
+        int32_t count_;
+        uint64_t generation_;
+    };
+
+    ///
+    /// Zero-copy, read-only view of the system Y matrix in compressed sparse column form,
+    /// as returned by IYMatrix::CSCView. Indices are 0-based and follow the YNodeOrder.
+    ///
+    /// The data is owned by the engine. It is only valid until the next build or update
+    /// of the system Y matrix. The accessors throw if the view is stale.
+    ///
+    class SystemYView
+    {
+    public:
+        typedef Eigen::Map<const Eigen::Matrix<int32_t, Eigen::Dynamic, 1>> IndexMapType;
+        typedef Eigen::Map<const Eigen::VectorXcd> MapType;
+
+        SystemYView(void *ctx, const int32_t *col_ptr, const int32_t *row_idx, const double *values, int32_t num_nodes, int32_t num_nz, uint64_t generation) :
+            ctx_(ctx), col_ptr_(col_ptr), row_idx_(row_idx), values_(values), num_nodes_(num_nodes), num_nz_(num_nz), generation_(generation)
+        {
+        }
+
+        ///
+        /// True if the view still points to the current system Y matrix.
+        ///
+        bool valid() const
+        {
+            return (col_ptr_ != nullptr) && (ctx_YMatrix_Get_YGeneration(ctx_) == generation_);
+        }
+
+        uint64_t generation() const
+        {
+            return generation_;
+        }
+
+        int32_t num_nodes() const
+        {
+            return num_nodes_;
+        }
+
+        int32_t num_nz() const
+        {
+            return num_nz_;
+        }
+
+        ///
+        /// Column pointers (`num_nodes() + 1` values)
+        ///
+        IndexMapType col_ptr() const
+        {
+            check();
+            return IndexMapType(col_ptr_, num_nodes_ + 1);
+        }
+
+        ///
+        /// Row index of each non-zero
+        ///
+        IndexMapType row_idx() const
+        {
+            check();
+            return IndexMapType(row_idx_, num_nz_);
+        }
+
+        ///
+        /// Complex value of each non-zero
+        ///
+        MapType values() const
+        {
+            check();
+            return MapType(reinterpret_cast<const complex*>(values_), num_nz_);
+        }
+
+    protected:
+        void check() const
+        {
+            if (!valid())
+            {
+                throw std::runtime_error("The system Y view is no longer valid; the matrix was rebuilt or updated.");
+            }
+        }
+
+        void *ctx_;
+        const int32_t *col_ptr_;
+        const int32_t *row_idx_;
+        const double *values_;
+        int32_t num_nodes_;
+        int32_t num_nz_;
+        uint64_t generation_;
+    };
+
     class IYMatrix: public ContextState
     {
     public:
@@ -2650,6 +2908,74 @@ using namespace dss::capi;
             ctx_YMatrix_Set_Iteration(ctx, value);
             return *this;
         }
+
+        ///
+        /// Zero-copy view of the node voltages of the solution. See SolutionView.
+        ///
+        /// (API Extension)
+        ///
+        SolutionView NodeVView()
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            double *ptr = nullptr;
+            int32_t count = 0;
+            uint64_t generation = 0;
+            ctx_YMatrix_Get_NodeVView(ctx, &ptr, &count, &generation);
+            return SolutionView(ctx, ptr, count, generation);
+        }
+
+        ///
+        /// Zero-copy view of the injection currents of the solution. See SolutionView.
+        ///
+        /// (API Extension)
+        ///
+        SolutionView CurrentsView()
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            double *ptr = nullptr;
+            int32_t count = 0;
+            uint64_t generation = 0;
+            ctx_YMatrix_Get_CurrentsView(ctx, &ptr, &count, &generation);
+            return SolutionView(ctx, ptr, count, generation);
+        }
+
+        ///
+        /// Current generation of the solution arrays, incremented on every solve and reallocation.
+        ///
+        /// (API Extension)
+        ///
+        uint64_t ViewGeneration()
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            return ctx_YMatrix_Get_ViewGeneration(ctx);
+        }
+
+        ///
+        /// Zero-copy view of the system Y matrix in CSC form. See SystemYView.
+        ///
+        /// (API Extension)
+        ///
+        SystemYView CSCView()
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            int32_t *col_ptr = nullptr, *row_idx = nullptr;
+            double *values = nullptr;
+            int32_t num_nodes = 0, num_nz = 0;
+            uint64_t generation = 0;
+            ctx_YMatrix_Get_CSCView(ctx, &col_ptr, &row_idx, &values, &num_nodes, &num_nz, &generation);
+            return SystemYView(ctx, col_ptr, row_idx, values, num_nodes, num_nz, generation);
+        }
+
+        ///
+        /// Current generation of the system Y matrix, incremented on every build or update.
+        ///
+        /// (API Extension)
+        ///
+        uint64_t YGeneration()
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            return ctx_YMatrix_Get_YGeneration(ctx);
+        }
     };
 
     class IMeters: public ContextState
@@ -2670,6 +2996,54 @@ using namespace dss::capi;
             return api_util->get_string_array(ctx_Meters_Get_ZonePCE);
         }
 
+        ///
+        /// Column names of a demand interval table (see `MeterTables`), without the hour column.
+        ///
+        /// (API Extension)
+        ///
+        strings DIColumnNames(int32_t Table)
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            return api_util->get_string_array(ctx_Meters_Get_DIColumnNames, Table);
+        }
+
+        ///
+        /// Hours of the rows of a demand interval table.
+        ///
+        /// (API Extension)
+        ///
+        template <typename VectorT=Eigen::Matrix<double, Eigen::Dynamic, 1>>
+        VectorT DIHours(int32_t Table)
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            ctx_Meters_Get_DIHours_GR(ctx, Table);
+            return api_util->get_float64_gr_array<VectorT>();
+        }
+
+        ///
+        /// Values of a column (1-based) of a demand interval table.
+        ///
+        /// (API Extension)
+        ///
+        template <typename VectorT=Eigen::Matrix<double, Eigen::Dynamic, 1>>
+        VectorT DIColumn(int32_t Table, int32_t Column)
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            ctx_Meters_Get_DIColumn_GR(ctx, Table, Column);
+            return api_util->get_float64_gr_array<VectorT>();
+        }
+
+        ///
+        /// Values of a column (1-based) of a demand interval table, as text.
+        ///
+        /// (API Extension)
+        ///
+        strings DIColumnText(int32_t Table, int32_t Column)
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            return api_util->get_string_array(ctx_Meters_Get_DIColumnText, Table, Column);
+        }
+
         ///
         /// Array of strings with all Meter names in the circuit.
         ///
@@ -6219,6 +6593,41 @@ using namespace dss::capi;
             APIUtil::ErrorChecker error_checker(api_util);
             return ctx_Text_Get_Result(ctx);
         }
+
+        ///
+        /// Column names of the table of the last export written with ExportFormat=Binary or Memory.
+        ///
+        /// (API Extension)
+        ///
+        strings ExportColumnNames()
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            return api_util->get_string_array(ctx_Text_Get_ExportColumnNames);
+        }
+
+        ///
+        /// Values of a column (1-based) of the table of the last export.
+        ///
+        /// (API Extension)
+        ///
+        template <typename VectorT=Eigen::Matrix<double, Eigen::Dynamic, 1>>
+        VectorT ExportColumn(int32_t Column)
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            ctx_Text_Get_ExportColumn_GR(ctx, Column);
+            return api_util->get_float64_gr_array<VectorT>();
+        }
+
+        ///
+        /// Values of a column (1-based) of the table of the last export, as text.
+        ///
+        /// (API Extension)
+        ///
+        strings ExportColumnText(int32_t Column)
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            return api_util->get_string_array(ctx_Text_Get_ExportColumnText, Column);
+        }
     };
 
     class ITopology: public ContextState
@@ -11831,7 +12240,7 @@ using namespace dss::capi;
         }
 
         /// 
-        /// Base Solution algorithm: {dssNormalSolve | dssNewtonSolve}
+        /// Base Solution algorithm: {dssNormalSolve | dssNewtonSolve | dssSweepSolve}
         /// 
         int32_t Algorithm() // getter
         {
@@ -12425,6 +12834,92 @@ using namespace dss::capi;
             ctx_Solution_Get_Laplacian_GR(ctx);
             return api_util->get_int32_gr_array<VectorT>();
         }
+
+        ///
+        /// Voltage magnitude sensitivities to 1 kW/1 kvar balanced injections at `buses`,
+        /// from the present factorization. One row per output node ("bus.node"; all nodes, in
+        /// YNodeOrder, if `nodes` is empty); the first `buses.size()` columns are dV/dP (pu/kW),
+        /// the others dV/dQ (pu/kvar).
+        ///
+        /// (API Extension)
+        ///
+        template <typename MatrixT=Eigen::MatrixXd>
+        MatrixT VoltageSensitivities(const strings &buses, const strings &nodes=strings(), int32_t num_threads=0)
+        {
+            std::vector<const char*> bus_ptrs(buses.size()), node_ptrs(nodes.size());
+            for (size_t i = 0; i < buses.size(); ++i)
+            {
+                bus_ptrs[i] = buses[i].c_str();
+            }
+            for (size_t i = 0; i < nodes.size(); ++i)
+            {
+                node_ptrs[i] = nodes[i].c_str();
+            }
+            ctx_Solution_Get_VoltageSensitivities_GR(ctx, bus_ptrs.data(), int32_t(buses.size()), node_ptrs.data(), int32_t(nodes.size()), num_threads);
+            api_util->check_for_error();
+            int32_t cols = int32_t(2 * buses.size());
+            int32_t rows = (cols != 0) ? (*api_util->count_PDouble / cols) : 0;
+            return api_util->map_float64_gr_matrix(rows, cols);
+        }
+    };
+
+    ///
+    /// Parameters for the synthetic circuit generator, see `ICircuit::Generate`.
+    /// The defaults match the ones used by the engine.
+    ///
+    struct SyntheticCircuitParams
+    {
+        string Name = "synthetic";
+        double SourcekV = 115; ///< line-to-line, at the substation high side
+        double FeederkV = 12.47; ///< line-to-line
+        int32_t NumFeeders = 4;
+        int32_t MainSections = 100; ///< line sections in the main line of each feeder
+        int32_t LateralsPerFeeder = 10;
+        int32_t LateralSections = 10;
+        double SectionLength = 0.1; ///< km
+        double LoadDensity = 1.0; ///< probability of a bus having a load, 0 to 1
+        double LoadkW = 10; ///< average kW per phase
+        double LoadPF = 0.95;
+        double PVDensity = 0.2; ///< probability of a load having a PV system, 0 to 1
+        double PVkVA = 8;
+        double StorageDensity = 0.05; ///< probability of a load having a storage element, 0 to 1
+        double StoragekW = 5;
+        double StoragekWh = 13.5;
+        bool Regulators = true; ///< regulator (transformer + RegControl) at each feeder head
+        int32_t CapacitorsPerFeeder = 2;
+        double Capacitorkvar = 300;
+        bool CapControls = true;
+        int32_t NumLoadShapes = 4;
+        int32_t LoadShapeNpts = 24;
+        double LoadShapeInterval = 1; ///< hours
+        bool EnergyMeter = true; ///< at the substation transformer
+        bool SetVoltageBases = true;
+        uint32_t Seed = 1;
+
+        string to_json() const
+        {
+            string name;
+            for (char c: Name)
+            {
+                if (c == '"' || c == '\\')
+                    name += '\\';
+                name += c;
+            }
+            return fmt::format(
+                "{{\"Name\": \"{}\", \"SourcekV\": {}, \"FeederkV\": {}, \"NumFeeders\": {}, \"MainSections\": {}, "
+                "\"LateralsPerFeeder\": {}, \"LateralSections\": {}, \"SectionLength\": {}, \"LoadDensity\": {}, "
+                "\"LoadkW\": {}, \"LoadPF\": {}, \"PVDensity\": {}, \"PVkVA\": {}, \"StorageDensity\": {}, "
+                "\"StoragekW\": {}, \"StoragekWh\": {}, \"Regulators\": {}, \"CapacitorsPerFeeder\": {}, "
+                "\"Capacitorkvar\": {}, \"CapControls\": {}, \"NumLoadShapes\": {}, \"LoadShapeNpts\": {}, "
+                "\"LoadShapeInterval\": {}, \"EnergyMeter\": {}, \"SetVoltageBases\": {}, \"Seed\": {}}}",
+                name, SourcekV, FeederkV, NumFeeders, MainSections,
+                LateralsPerFeeder, LateralSections, SectionLength, LoadDensity,
+                LoadkW, LoadPF, PVDensity, PVkVA, StorageDensity,
+                StoragekW, StoragekWh, Regulators, CapacitorsPerFeeder,
+                Capacitorkvar, CapControls, NumLoadShapes, LoadShapeNpts,
+                LoadShapeInterval, EnergyMeter, SetVoltageBases, Seed
+            );
+        }
     };
 
     class ICircuit: public ContextState
@@ -12681,6 +13176,29 @@ using namespace dss::capi;
             APIUtil::ErrorChecker error_checker(api_util);
             ctx_Circuit_SaveSample(ctx);
         }
+
+        ///
+        /// Clears the engine and generates a synthetic distribution circuit, for scale
+        /// testing and benchmarks. The elements are created directly through the
+        /// batch API, without the text parser.
+        ///
+        /// (API Extension)
+        ///
+        void Generate(const SyntheticCircuitParams &params=SyntheticCircuitParams())
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            ctx_Circuit_Generate(ctx, params.to_json().c_str());
+        }
+
+        ///
+        /// Same as the other overload, using JSON-encoded parameters directly.
+        /// Missing keys use the default values.
+        ///
+        void Generate(const string &params_json)
+        {
+            APIUtil::ErrorChecker error_checker(api_util);
+            ctx_Circuit_Generate(ctx, params_json.c_str());
+        }
         int32_t SetActiveBus(const char *BusName)
         {
             APIUtil::ErrorChecker error_checker(api_util);
@@ -57,7 +57,7 @@ struct APIUtil
         if (!*error_ptr) return;
 
         int32_t error = *error_ptr;
-        char* error_msg = ctx_Error_Get_Description(ctx);
+        const char* error_msg = ctx_Error_Get_Description(ctx);
         *error_ptr = 0;
         throw std::runtime_error(error_msg);
     }
@@ -80,13 +80,13 @@ struct APIUtil
     {
         if (create_ctx)
         {
-            ctx = ctx_New();
+            ctx = (void*) ctx_New();
             owns_ctx = true;
         }
         else
         {
             owns_ctx = false;
-            ctx = ctx_Get_Prime();
+            ctx = (void*) ctx_Get_Prime();
         }
         ctx_DSS_Start(ctx, 0);
         error_ptr = ctx_Error_Get_NumberPtr(ctx);
@@ -201,6 +201,21 @@ struct APIUtil
         return res;
     }
 
+    /*
+    Maps the global result buffer of doubles as a column-major matrix, without
+    copying. The map is only valid until the next call that uses the buffer;
+    assign it to a matrix (e.g. Eigen::MatrixXd) to keep the values.
+    */
+    Eigen::Map<Eigen::MatrixXd> map_float64_gr_matrix(int32_t rows, int32_t cols)
+    {
+        check_for_error();
+        if (int64_t(rows) * cols != *count_PDouble)
+        {
+            throw std::runtime_error("Unexpected result size.");
+        }
+        return Eigen::Map<Eigen::MatrixXd>(*data_PDouble, rows, cols);
+    }
+
     template <typename VectorT=Eigen::Matrix<int32_t, Eigen::Dynamic, 1>, typename std::enable_if<std::is_same<typename VectorT::value_type, int32_t>::value>::type* = nullptr>
     VectorT get_int32_gr_array()
     {
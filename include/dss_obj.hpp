@@ -23,27 +23,27 @@ using namespace dss::capi;
 namespace detail {
     void obj_set_val(void *ptr, int32_t idx, int32_t value)
     {
-        Obj_SetInt32(ptr, idx, value);
+        Obj_SetInt32(ptr, idx, value, 0);
     }
 
     void obj_set_val(void *ptr, int32_t idx, double value)
     {
-        Obj_SetFloat64(ptr, idx, value);
+        Obj_SetFloat64(ptr, idx, value, 0);
     }
 
     void obj_set_val(void *ptr, int32_t idx, bool value)
     {
-        Obj_SetInt32(ptr, idx, value);
+        Obj_SetInt32(ptr, idx, value, 0);
     }
 
     void obj_set_val(void *ptr, int32_t idx, const string &value)
     {
-        Obj_SetString(ptr, idx, value.c_str());
+        Obj_SetString(ptr, idx, value.c_str(), 0);
     }
 
     void obj_set_val(void *ptr, int32_t idx, const char* value)
     {
-        Obj_SetString(ptr, idx, value);
+        Obj_SetString(ptr, idx, value, 0);
     }
 
     void obj_get_array(double** ResultPtr, int32_t* ResultCount, void *obj, int32_t Index)
@@ -88,53 +88,53 @@ namespace detail {
 
     void obj_set_array(void *obj, int32_t Index, double* Value, int32_t ValueCount)
     {
-        Obj_SetFloat64Array(obj, Index, Value, ValueCount);
+        Obj_SetFloat64Array(obj, Index, Value, ValueCount, 0);
     }
 
     void obj_set_array(void *obj, int32_t Index, int32_t* Value, int32_t ValueCount)
     {
-        Obj_SetInt32Array(obj, Index, Value, ValueCount);
+        Obj_SetInt32Array(obj, Index, Value, ValueCount, 0);
     }
 
     void obj_set_array(void *obj, int32_t Index, const char** Value, int32_t ValueCount)
     {
-        Obj_SetStringArray(obj, Index, Value, ValueCount);
+        Obj_SetStringArray(obj, Index, Value, ValueCount, 0);
     }
 
     void obj_set_array(void *obj, int32_t Index, void **Value, int32_t ValueCount)
     {
-        Obj_SetObjectArray(obj, Index, Value, ValueCount);
+        Obj_SetObjectArray(obj, Index, Value, ValueCount, 0);
     }
 
     void obj_set_val(void *obj, int32_t Index, complex Value)
     {
-        Obj_SetFloat64Array(obj, Index, (double*)&Value, 2);
+        Obj_SetFloat64Array(obj, Index, (double*)&Value, 2, 0);
     }
 
 
     void batch_set_val(void **ptr, int32_t cnt, int32_t idx, int32_t value)
     {
-        Batch_Int32(ptr, cnt, idx, BatchOperation_Set, value);
+        Batch_Int32(ptr, cnt, idx, BatchOperation_Set, value, 0);
     }
 
     void batch_set_val(void **ptr, int32_t cnt, int32_t idx, double value)
     {
-        Batch_Float64(ptr, cnt, idx, BatchOperation_Set, value);
+        Batch_Float64(ptr, cnt, idx, BatchOperation_Set, value, 0);
     }
 
     void batch_set_val(void **ptr, int32_t cnt, int32_t idx, bool value)
     {
-        Batch_Int32(ptr, cnt, idx, BatchOperation_Set, value);
+        Batch_Int32(ptr, cnt, idx, BatchOperation_Set, value, 0);
     }
 
     void batch_set_val(void **ptr, int32_t cnt, int32_t idx, const string &value)
     {
-        Batch_SetString(ptr, cnt, idx, value.c_str());
+        Batch_SetString(ptr, cnt, idx, value.c_str(), 0);
     }
 
     void batch_set_val(void **ptr, int32_t cnt, int32_t idx, const char* value)
     {
-        Batch_SetString(ptr, cnt, idx, value);
+        Batch_SetString(ptr, cnt, idx, value, 0);
     }
 
     void batch_set_val(void **ptr, int32_t cnt, int32_t idx, complex value)
@@ -149,12 +149,12 @@ namespace detail {
 
     void batch_op(void **ptr, int32_t cnt, int32_t idx, int32_t op, double value)
     {
-        Batch_Float64(ptr, cnt, idx, op, value);
+        Batch_Float64(ptr, cnt, idx, op, value, 0);
     }
 
     void batch_op(void **ptr, int32_t cnt, int32_t idx, int32_t op, int32_t value)
     {
-        Batch_Int32(ptr, cnt, idx, op, value);
+        Batch_Int32(ptr, cnt, idx, op, value, 0);
     }
 
     void batch_get_val(double** ResultPtr, int32_t* ResultCount, void **batch, int32_t batchSize, int32_t Index)
@@ -200,17 +200,17 @@ protected:
 
     void set_string(int32_t index, const string &value)
     {
-        Obj_SetString(ptr, index, value.c_str());
+        Obj_SetString(ptr, index, value.c_str(), 0);
     }
 
     void set_string(int32_t index, const char *value)
     {
-        Obj_SetString(ptr, index, value);
+        Obj_SetString(ptr, index, value, 0);
     }
 
     string get_prop_string(int32_t index)
     {
-        char* sc = Obj_GetString(ptr, index);
+        char* sc = (char*) Obj_GetString(ptr, index);
         string res(sc);
         DSS_Dispose_String(sc);
         return res;
@@ -231,7 +231,7 @@ protected:
 
     void set_complex(int32_t index, complex value)
     {
-        Obj_SetFloat64Array(ptr, index, (double*)(&value), 2);
+        Obj_SetFloat64Array(ptr, index, (double*)(&value), 2, 0);
     }
 
     void set_string_array(int32_t index, strings &value)
@@ -241,13 +241,13 @@ protected:
         {
             ptrs[i] = value[i].c_str();
         }
-        Obj_SetStringArray(ptr, index, &ptrs[0], int32_t(value.size()));
+        Obj_SetStringArray(ptr, index, &ptrs[0], int32_t(value.size()), 0);
         check_for_error();
     }
 
     void set_obj(int32_t index, DSSObj &value)
     {
-        Obj_SetObject(ptr, index, value.ptr);
+        Obj_SetObject(ptr, index, value.ptr, 0);
     }
 
     template <typename T>
@@ -506,7 +506,7 @@ protected:
         }
         for (size_t i = 0; i < values.size(); ++i)
         {
-            Obj_SetFloat64Array(*(pointer + i), index, (double*)(&values[i]), 2);
+            Obj_SetFloat64Array(*(pointer + i), index, (double*)(&values[i]), 2, 0);
         }
         check_for_error();
     }
@@ -1071,7 +1071,7 @@ public:
 
     LineCode& nphases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::nphases, value);
+        Obj_SetInt32(ptr, Properties::nphases, value, 0);
         return *this;
     }
 
@@ -1086,7 +1086,7 @@ public:
 
     LineCode& r1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::r1, value);
+        Obj_SetFloat64(ptr, Properties::r1, value, 0);
         return *this;
     }
 
@@ -1101,7 +1101,7 @@ public:
 
     LineCode& x1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::x1, value);
+        Obj_SetFloat64(ptr, Properties::x1, value, 0);
         return *this;
     }
 
@@ -1116,7 +1116,7 @@ public:
 
     LineCode& r0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::r0, value);
+        Obj_SetFloat64(ptr, Properties::r0, value, 0);
         return *this;
     }
 
@@ -1131,7 +1131,7 @@ public:
 
     LineCode& x0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::x0, value);
+        Obj_SetFloat64(ptr, Properties::x0, value, 0);
         return *this;
     }
 
@@ -1146,7 +1146,7 @@ public:
 
     LineCode& C1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::C1, value);
+        Obj_SetFloat64(ptr, Properties::C1, value, 0);
         return *this;
     }
 
@@ -1161,7 +1161,7 @@ public:
 
     LineCode& C0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::C0, value);
+        Obj_SetFloat64(ptr, Properties::C0, value, 0);
         return *this;
     }
 
@@ -1176,13 +1176,13 @@ public:
 
     LineCode& units(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::units, value);
+        Obj_SetInt32(ptr, Properties::units, value, 0);
         return *this;
     }
 
     LineCode& units(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::units, int32_t(value));
+        Obj_SetInt32(ptr, Properties::units, int32_t(value), 0);
         return *this;
     }
 
@@ -1273,7 +1273,7 @@ public:
 
     LineCode& baseFreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::baseFreq, value);
+        Obj_SetFloat64(ptr, Properties::baseFreq, value, 0);
         return *this;
     }
 
@@ -1288,7 +1288,7 @@ public:
 
     LineCode& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -1303,7 +1303,7 @@ public:
 
     LineCode& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -1318,7 +1318,7 @@ public:
 
     LineCode& faultrate(double value)
     {
-        Obj_SetFloat64(ptr, Properties::faultrate, value);
+        Obj_SetFloat64(ptr, Properties::faultrate, value, 0);
         return *this;
     }
 
@@ -1333,7 +1333,7 @@ public:
 
     LineCode& pctperm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctperm, value);
+        Obj_SetFloat64(ptr, Properties::pctperm, value, 0);
         return *this;
     }
 
@@ -1348,7 +1348,7 @@ public:
 
     LineCode& repair(double value)
     {
-        Obj_SetFloat64(ptr, Properties::repair, value);
+        Obj_SetFloat64(ptr, Properties::repair, value, 0);
         return *this;
     }
 
@@ -1358,7 +1358,7 @@ public:
     ///
     LineCode& Kron(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Kron, value);
+        Obj_SetInt32(ptr, Properties::Kron, value, 0);
         return *this;
     }
 
@@ -1373,7 +1373,7 @@ public:
 
     LineCode& Rg(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rg, value);
+        Obj_SetFloat64(ptr, Properties::Rg, value, 0);
         return *this;
     }
 
@@ -1388,7 +1388,7 @@ public:
 
     LineCode& Xg(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xg, value);
+        Obj_SetFloat64(ptr, Properties::Xg, value, 0);
         return *this;
     }
 
@@ -1403,7 +1403,7 @@ public:
 
     LineCode& rho(double value)
     {
-        Obj_SetFloat64(ptr, Properties::rho, value);
+        Obj_SetFloat64(ptr, Properties::rho, value, 0);
         return *this;
     }
 
@@ -1418,7 +1418,7 @@ public:
 
     LineCode& neutral(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::neutral, value);
+        Obj_SetInt32(ptr, Properties::neutral, value, 0);
         return *this;
     }
 
@@ -1433,7 +1433,7 @@ public:
 
     LineCode& B1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::B1, value);
+        Obj_SetFloat64(ptr, Properties::B1, value, 0);
         return *this;
     }
 
@@ -1448,7 +1448,7 @@ public:
 
     LineCode& B0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::B0, value);
+        Obj_SetFloat64(ptr, Properties::B0, value, 0);
         return *this;
     }
 
@@ -1463,7 +1463,7 @@ public:
 
     LineCode& Seasons(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Seasons, value);
+        Obj_SetInt32(ptr, Properties::Seasons, value, 0);
         return *this;
     }
 
@@ -1497,13 +1497,13 @@ public:
 
     LineCode& linetype(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::LineType, value);
+        Obj_SetInt32(ptr, Properties::LineType, value, 0);
         return *this;
     }
 
     LineCode& linetype(LineType value)
     {
-        Obj_SetInt32(ptr, Properties::LineType, int32_t(value));
+        Obj_SetInt32(ptr, Properties::LineType, int32_t(value), 0);
         return *this;
     }
 
@@ -1688,7 +1688,7 @@ public:
 
     LoadShape& npts(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::npts, value);
+        Obj_SetInt32(ptr, Properties::npts, value, 0);
         return *this;
     }
 
@@ -1705,7 +1705,7 @@ public:
 
     LoadShape& interval(double value)
     {
-        Obj_SetFloat64(ptr, Properties::interval, value);
+        Obj_SetFloat64(ptr, Properties::interval, value, 0);
         return *this;
     }
 
@@ -1764,7 +1764,7 @@ public:
 
     LoadShape& mean(double value)
     {
-        Obj_SetFloat64(ptr, Properties::mean, value);
+        Obj_SetFloat64(ptr, Properties::mean, value, 0);
         return *this;
     }
 
@@ -1781,7 +1781,7 @@ public:
 
     LoadShape& stddev(double value)
     {
-        Obj_SetFloat64(ptr, Properties::stddev, value);
+        Obj_SetFloat64(ptr, Properties::stddev, value, 0);
         return *this;
     }
 
@@ -1856,7 +1856,7 @@ public:
     ///
     LoadShape& action(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::action, value);
+        Obj_SetInt32(ptr, Properties::action, value, 0);
         return *this;
     }
 
@@ -1868,7 +1868,7 @@ public:
     ///
     LoadShape& action(LoadShapeAction value)
     {
-        Obj_SetInt32(ptr, Properties::action, int32_t(value));
+        Obj_SetInt32(ptr, Properties::action, int32_t(value), 0);
         return *this;
     }
 
@@ -1926,7 +1926,7 @@ public:
 
     LoadShape& UseActual(bool value)
     {
-        Obj_SetInt32(ptr, Properties::UseActual, value);
+        Obj_SetInt32(ptr, Properties::UseActual, value, 0);
         return *this;
     }
 
@@ -1941,7 +1941,7 @@ public:
 
     LoadShape& Pmax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Pmax, value);
+        Obj_SetFloat64(ptr, Properties::Pmax, value, 0);
         return *this;
     }
 
@@ -1956,7 +1956,7 @@ public:
 
     LoadShape& Qmax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Qmax, value);
+        Obj_SetFloat64(ptr, Properties::Qmax, value, 0);
         return *this;
     }
 
@@ -1971,7 +1971,7 @@ public:
 
     LoadShape& sinterval(double value)
     {
-        Obj_SetFloat64(ptr, Properties::sinterval, value);
+        Obj_SetFloat64(ptr, Properties::sinterval, value, 0);
         return *this;
     }
 
@@ -1986,7 +1986,7 @@ public:
 
     LoadShape& minterval(double value)
     {
-        Obj_SetFloat64(ptr, Properties::minterval, value);
+        Obj_SetFloat64(ptr, Properties::minterval, value, 0);
         return *this;
     }
 
@@ -2001,7 +2001,7 @@ public:
 
     LoadShape& Pbase(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Pbase, value);
+        Obj_SetFloat64(ptr, Properties::Pbase, value, 0);
         return *this;
     }
 
@@ -2016,7 +2016,7 @@ public:
 
     LoadShape& Qbase(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Qbase, value);
+        Obj_SetFloat64(ptr, Properties::Qbase, value, 0);
         return *this;
     }
 
@@ -2069,7 +2069,7 @@ public:
 
     LoadShape& MemoryMapping(bool value)
     {
-        Obj_SetInt32(ptr, Properties::MemoryMapping, value);
+        Obj_SetInt32(ptr, Properties::MemoryMapping, value, 0);
         return *this;
     }
 
@@ -2207,7 +2207,7 @@ public:
 
     TShape& npts(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::npts, value);
+        Obj_SetInt32(ptr, Properties::npts, value, 0);
         return *this;
     }
 
@@ -2224,7 +2224,7 @@ public:
 
     TShape& interval(double value)
     {
-        Obj_SetFloat64(ptr, Properties::interval, value);
+        Obj_SetFloat64(ptr, Properties::interval, value, 0);
         return *this;
     }
 
@@ -2277,7 +2277,7 @@ public:
 
     TShape& mean(double value)
     {
-        Obj_SetFloat64(ptr, Properties::mean, value);
+        Obj_SetFloat64(ptr, Properties::mean, value, 0);
         return *this;
     }
 
@@ -2294,7 +2294,7 @@ public:
 
     TShape& stddev(double value)
     {
-        Obj_SetFloat64(ptr, Properties::stddev, value);
+        Obj_SetFloat64(ptr, Properties::stddev, value, 0);
         return *this;
     }
 
@@ -2372,7 +2372,7 @@ public:
 
     TShape& sinterval(double value)
     {
-        Obj_SetFloat64(ptr, Properties::sinterval, value);
+        Obj_SetFloat64(ptr, Properties::sinterval, value, 0);
         return *this;
     }
 
@@ -2387,7 +2387,7 @@ public:
 
     TShape& minterval(double value)
     {
-        Obj_SetFloat64(ptr, Properties::minterval, value);
+        Obj_SetFloat64(ptr, Properties::minterval, value, 0);
         return *this;
     }
 
@@ -2397,7 +2397,7 @@ public:
     ///
     TShape& action(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::action, value);
+        Obj_SetInt32(ptr, Properties::action, value, 0);
         return *this;
     }
 
@@ -2407,7 +2407,7 @@ public:
     ///
     TShape& action(TShapeAction value)
     {
-        Obj_SetInt32(ptr, Properties::action, int32_t(value));
+        Obj_SetInt32(ptr, Properties::action, int32_t(value), 0);
         return *this;
     }
 
@@ -2565,7 +2565,7 @@ public:
 
     PriceShape& npts(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::npts, value);
+        Obj_SetInt32(ptr, Properties::npts, value, 0);
         return *this;
     }
 
@@ -2582,7 +2582,7 @@ public:
 
     PriceShape& interval(double value)
     {
-        Obj_SetFloat64(ptr, Properties::interval, value);
+        Obj_SetFloat64(ptr, Properties::interval, value, 0);
         return *this;
     }
 
@@ -2635,7 +2635,7 @@ public:
 
     PriceShape& mean(double value)
     {
-        Obj_SetFloat64(ptr, Properties::mean, value);
+        Obj_SetFloat64(ptr, Properties::mean, value, 0);
         return *this;
     }
 
@@ -2652,7 +2652,7 @@ public:
 
     PriceShape& stddev(double value)
     {
-        Obj_SetFloat64(ptr, Properties::stddev, value);
+        Obj_SetFloat64(ptr, Properties::stddev, value, 0);
         return *this;
     }
 
@@ -2730,7 +2730,7 @@ public:
 
     PriceShape& sinterval(double value)
     {
-        Obj_SetFloat64(ptr, Properties::sinterval, value);
+        Obj_SetFloat64(ptr, Properties::sinterval, value, 0);
         return *this;
     }
 
@@ -2745,7 +2745,7 @@ public:
 
     PriceShape& minterval(double value)
     {
-        Obj_SetFloat64(ptr, Properties::minterval, value);
+        Obj_SetFloat64(ptr, Properties::minterval, value, 0);
         return *this;
     }
 
@@ -2755,7 +2755,7 @@ public:
     ///
     PriceShape& action(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::action, value);
+        Obj_SetInt32(ptr, Properties::action, value, 0);
         return *this;
     }
 
@@ -2765,7 +2765,7 @@ public:
     ///
     PriceShape& action(PriceShapeAction value)
     {
-        Obj_SetInt32(ptr, Properties::action, int32_t(value));
+        Obj_SetInt32(ptr, Properties::action, int32_t(value), 0);
         return *this;
     }
 
@@ -2911,7 +2911,7 @@ public:
 
     XYcurve& npts(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::npts, value);
+        Obj_SetInt32(ptr, Properties::npts, value, 0);
         return *this;
     }
 
@@ -3048,7 +3048,7 @@ public:
 
     XYcurve& x(double value)
     {
-        Obj_SetFloat64(ptr, Properties::x, value);
+        Obj_SetFloat64(ptr, Properties::x, value, 0);
         return *this;
     }
 
@@ -3063,7 +3063,7 @@ public:
 
     XYcurve& y(double value)
     {
-        Obj_SetFloat64(ptr, Properties::y, value);
+        Obj_SetFloat64(ptr, Properties::y, value, 0);
         return *this;
     }
 
@@ -3078,7 +3078,7 @@ public:
 
     XYcurve& Xshift(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xshift, value);
+        Obj_SetFloat64(ptr, Properties::Xshift, value, 0);
         return *this;
     }
 
@@ -3093,7 +3093,7 @@ public:
 
     XYcurve& Yshift(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Yshift, value);
+        Obj_SetFloat64(ptr, Properties::Yshift, value, 0);
         return *this;
     }
 
@@ -3108,7 +3108,7 @@ public:
 
     XYcurve& Xscale(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xscale, value);
+        Obj_SetFloat64(ptr, Properties::Xscale, value, 0);
         return *this;
     }
 
@@ -3123,7 +3123,7 @@ public:
 
     XYcurve& Yscale(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Yscale, value);
+        Obj_SetFloat64(ptr, Properties::Yscale, value, 0);
         return *this;
     }
 
@@ -3242,7 +3242,7 @@ public:
 
     GrowthShape& npts(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::npts, value);
+        Obj_SetInt32(ptr, Properties::npts, value, 0);
         return *this;
     }
 
@@ -3458,7 +3458,7 @@ public:
 
     TCC_Curve& npts(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::npts, value);
+        Obj_SetInt32(ptr, Properties::npts, value, 0);
         return *this;
     }
 
@@ -3612,7 +3612,7 @@ public:
 
     Spectrum& NumHarm(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::NumHarm, value);
+        Obj_SetInt32(ptr, Properties::NumHarm, value, 0);
         return *this;
     }
 
@@ -3813,7 +3813,7 @@ public:
 
     WireData& Rdc(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rdc, value);
+        Obj_SetFloat64(ptr, Properties::Rdc, value, 0);
         return *this;
     }
 
@@ -3828,7 +3828,7 @@ public:
 
     WireData& Rac(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rac, value);
+        Obj_SetFloat64(ptr, Properties::Rac, value, 0);
         return *this;
     }
 
@@ -3843,13 +3843,13 @@ public:
 
     WireData& Runits(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Runits, value);
+        Obj_SetInt32(ptr, Properties::Runits, value, 0);
         return *this;
     }
 
     WireData& Runits(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::Runits, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Runits, int32_t(value), 0);
         return *this;
     }
 
@@ -3895,7 +3895,7 @@ public:
 
     WireData& GMRac(double value)
     {
-        Obj_SetFloat64(ptr, Properties::GMRac, value);
+        Obj_SetFloat64(ptr, Properties::GMRac, value, 0);
         return *this;
     }
 
@@ -3910,13 +3910,13 @@ public:
 
     WireData& GMRunits(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::GMRunits, value);
+        Obj_SetInt32(ptr, Properties::GMRunits, value, 0);
         return *this;
     }
 
     WireData& GMRunits(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::GMRunits, int32_t(value));
+        Obj_SetInt32(ptr, Properties::GMRunits, int32_t(value), 0);
         return *this;
     }
 
@@ -3962,7 +3962,7 @@ public:
 
     WireData& radius(double value)
     {
-        Obj_SetFloat64(ptr, Properties::radius, value);
+        Obj_SetFloat64(ptr, Properties::radius, value, 0);
         return *this;
     }
 
@@ -3977,13 +3977,13 @@ public:
 
     WireData& radunits(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::radunits, value);
+        Obj_SetInt32(ptr, Properties::radunits, value, 0);
         return *this;
     }
 
     WireData& radunits(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::radunits, int32_t(value));
+        Obj_SetInt32(ptr, Properties::radunits, int32_t(value), 0);
         return *this;
     }
 
@@ -4029,7 +4029,7 @@ public:
 
     WireData& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -4044,7 +4044,7 @@ public:
 
     WireData& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -4059,7 +4059,7 @@ public:
 
     WireData& diam(double value)
     {
-        Obj_SetFloat64(ptr, Properties::diam, value);
+        Obj_SetFloat64(ptr, Properties::diam, value, 0);
         return *this;
     }
 
@@ -4074,7 +4074,7 @@ public:
 
     WireData& Seasons(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Seasons, value);
+        Obj_SetInt32(ptr, Properties::Seasons, value, 0);
         return *this;
     }
 
@@ -4105,7 +4105,7 @@ public:
 
     WireData& Capradius(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Capradius, value);
+        Obj_SetFloat64(ptr, Properties::Capradius, value, 0);
         return *this;
     }
 
@@ -4239,7 +4239,7 @@ public:
 
     CNData& k(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::k, value);
+        Obj_SetInt32(ptr, Properties::k, value, 0);
         return *this;
     }
 
@@ -4254,7 +4254,7 @@ public:
 
     CNData& DiaStrand(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DiaStrand, value);
+        Obj_SetFloat64(ptr, Properties::DiaStrand, value, 0);
         return *this;
     }
 
@@ -4269,7 +4269,7 @@ public:
 
     CNData& GmrStrand(double value)
     {
-        Obj_SetFloat64(ptr, Properties::GmrStrand, value);
+        Obj_SetFloat64(ptr, Properties::GmrStrand, value, 0);
         return *this;
     }
 
@@ -4284,7 +4284,7 @@ public:
 
     CNData& Rstrand(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rstrand, value);
+        Obj_SetFloat64(ptr, Properties::Rstrand, value, 0);
         return *this;
     }
 
@@ -4299,7 +4299,7 @@ public:
 
     CNData& EpsR(double value)
     {
-        Obj_SetFloat64(ptr, Properties::EpsR, value);
+        Obj_SetFloat64(ptr, Properties::EpsR, value, 0);
         return *this;
     }
 
@@ -4314,7 +4314,7 @@ public:
 
     CNData& InsLayer(double value)
     {
-        Obj_SetFloat64(ptr, Properties::InsLayer, value);
+        Obj_SetFloat64(ptr, Properties::InsLayer, value, 0);
         return *this;
     }
 
@@ -4329,7 +4329,7 @@ public:
 
     CNData& DiaIns(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DiaIns, value);
+        Obj_SetFloat64(ptr, Properties::DiaIns, value, 0);
         return *this;
     }
 
@@ -4344,7 +4344,7 @@ public:
 
     CNData& DiaCable(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DiaCable, value);
+        Obj_SetFloat64(ptr, Properties::DiaCable, value, 0);
         return *this;
     }
 
@@ -4359,7 +4359,7 @@ public:
 
     CNData& Rdc(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rdc, value);
+        Obj_SetFloat64(ptr, Properties::Rdc, value, 0);
         return *this;
     }
 
@@ -4374,7 +4374,7 @@ public:
 
     CNData& Rac(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rac, value);
+        Obj_SetFloat64(ptr, Properties::Rac, value, 0);
         return *this;
     }
 
@@ -4389,13 +4389,13 @@ public:
 
     CNData& Runits(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Runits, value);
+        Obj_SetInt32(ptr, Properties::Runits, value, 0);
         return *this;
     }
 
     CNData& Runits(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::Runits, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Runits, int32_t(value), 0);
         return *this;
     }
 
@@ -4441,7 +4441,7 @@ public:
 
     CNData& GMRac(double value)
     {
-        Obj_SetFloat64(ptr, Properties::GMRac, value);
+        Obj_SetFloat64(ptr, Properties::GMRac, value, 0);
         return *this;
     }
 
@@ -4456,13 +4456,13 @@ public:
 
     CNData& GMRunits(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::GMRunits, value);
+        Obj_SetInt32(ptr, Properties::GMRunits, value, 0);
         return *this;
     }
 
     CNData& GMRunits(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::GMRunits, int32_t(value));
+        Obj_SetInt32(ptr, Properties::GMRunits, int32_t(value), 0);
         return *this;
     }
 
@@ -4508,7 +4508,7 @@ public:
 
     CNData& radius(double value)
     {
-        Obj_SetFloat64(ptr, Properties::radius, value);
+        Obj_SetFloat64(ptr, Properties::radius, value, 0);
         return *this;
     }
 
@@ -4523,13 +4523,13 @@ public:
 
     CNData& radunits(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::radunits, value);
+        Obj_SetInt32(ptr, Properties::radunits, value, 0);
         return *this;
     }
 
     CNData& radunits(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::radunits, int32_t(value));
+        Obj_SetInt32(ptr, Properties::radunits, int32_t(value), 0);
         return *this;
     }
 
@@ -4575,7 +4575,7 @@ public:
 
     CNData& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -4590,7 +4590,7 @@ public:
 
     CNData& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -4605,7 +4605,7 @@ public:
 
     CNData& diam(double value)
     {
-        Obj_SetFloat64(ptr, Properties::diam, value);
+        Obj_SetFloat64(ptr, Properties::diam, value, 0);
         return *this;
     }
 
@@ -4620,7 +4620,7 @@ public:
 
     CNData& Seasons(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Seasons, value);
+        Obj_SetInt32(ptr, Properties::Seasons, value, 0);
         return *this;
     }
 
@@ -4651,7 +4651,7 @@ public:
 
     CNData& Capradius(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Capradius, value);
+        Obj_SetFloat64(ptr, Properties::Capradius, value, 0);
         return *this;
     }
 
@@ -4784,7 +4784,7 @@ public:
 
     TSData& DiaShield(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DiaShield, value);
+        Obj_SetFloat64(ptr, Properties::DiaShield, value, 0);
         return *this;
     }
 
@@ -4799,7 +4799,7 @@ public:
 
     TSData& TapeLayer(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TapeLayer, value);
+        Obj_SetFloat64(ptr, Properties::TapeLayer, value, 0);
         return *this;
     }
 
@@ -4814,7 +4814,7 @@ public:
 
     TSData& TapeLap(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TapeLap, value);
+        Obj_SetFloat64(ptr, Properties::TapeLap, value, 0);
         return *this;
     }
 
@@ -4829,7 +4829,7 @@ public:
 
     TSData& EpsR(double value)
     {
-        Obj_SetFloat64(ptr, Properties::EpsR, value);
+        Obj_SetFloat64(ptr, Properties::EpsR, value, 0);
         return *this;
     }
 
@@ -4844,7 +4844,7 @@ public:
 
     TSData& InsLayer(double value)
     {
-        Obj_SetFloat64(ptr, Properties::InsLayer, value);
+        Obj_SetFloat64(ptr, Properties::InsLayer, value, 0);
         return *this;
     }
 
@@ -4859,7 +4859,7 @@ public:
 
     TSData& DiaIns(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DiaIns, value);
+        Obj_SetFloat64(ptr, Properties::DiaIns, value, 0);
         return *this;
     }
 
@@ -4874,7 +4874,7 @@ public:
 
     TSData& DiaCable(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DiaCable, value);
+        Obj_SetFloat64(ptr, Properties::DiaCable, value, 0);
         return *this;
     }
 
@@ -4889,7 +4889,7 @@ public:
 
     TSData& Rdc(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rdc, value);
+        Obj_SetFloat64(ptr, Properties::Rdc, value, 0);
         return *this;
     }
 
@@ -4904,7 +4904,7 @@ public:
 
     TSData& Rac(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rac, value);
+        Obj_SetFloat64(ptr, Properties::Rac, value, 0);
         return *this;
     }
 
@@ -4919,13 +4919,13 @@ public:
 
     TSData& Runits(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Runits, value);
+        Obj_SetInt32(ptr, Properties::Runits, value, 0);
         return *this;
     }
 
     TSData& Runits(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::Runits, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Runits, int32_t(value), 0);
         return *this;
     }
 
@@ -4971,7 +4971,7 @@ public:
 
     TSData& GMRac(double value)
     {
-        Obj_SetFloat64(ptr, Properties::GMRac, value);
+        Obj_SetFloat64(ptr, Properties::GMRac, value, 0);
         return *this;
     }
 
@@ -4986,13 +4986,13 @@ public:
 
     TSData& GMRunits(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::GMRunits, value);
+        Obj_SetInt32(ptr, Properties::GMRunits, value, 0);
         return *this;
     }
 
     TSData& GMRunits(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::GMRunits, int32_t(value));
+        Obj_SetInt32(ptr, Properties::GMRunits, int32_t(value), 0);
         return *this;
     }
 
@@ -5038,7 +5038,7 @@ public:
 
     TSData& radius(double value)
     {
-        Obj_SetFloat64(ptr, Properties::radius, value);
+        Obj_SetFloat64(ptr, Properties::radius, value, 0);
         return *this;
     }
 
@@ -5053,13 +5053,13 @@ public:
 
     TSData& radunits(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::radunits, value);
+        Obj_SetInt32(ptr, Properties::radunits, value, 0);
         return *this;
     }
 
     TSData& radunits(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::radunits, int32_t(value));
+        Obj_SetInt32(ptr, Properties::radunits, int32_t(value), 0);
         return *this;
     }
 
@@ -5105,7 +5105,7 @@ public:
 
     TSData& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -5120,7 +5120,7 @@ public:
 
     TSData& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -5135,7 +5135,7 @@ public:
 
     TSData& diam(double value)
     {
-        Obj_SetFloat64(ptr, Properties::diam, value);
+        Obj_SetFloat64(ptr, Properties::diam, value, 0);
         return *this;
     }
 
@@ -5150,7 +5150,7 @@ public:
 
     TSData& Seasons(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Seasons, value);
+        Obj_SetInt32(ptr, Properties::Seasons, value, 0);
         return *this;
     }
 
@@ -5181,7 +5181,7 @@ public:
 
     TSData& Capradius(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Capradius, value);
+        Obj_SetFloat64(ptr, Properties::Capradius, value, 0);
         return *this;
     }
 
@@ -5299,7 +5299,7 @@ public:
 
     LineSpacing& nconds(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::nconds, value);
+        Obj_SetInt32(ptr, Properties::nconds, value, 0);
         return *this;
     }
 
@@ -5314,7 +5314,7 @@ public:
 
     LineSpacing& nphases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::nphases, value);
+        Obj_SetInt32(ptr, Properties::nphases, value, 0);
         return *this;
     }
 
@@ -5359,13 +5359,13 @@ public:
 
     LineSpacing& units(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::units, value);
+        Obj_SetInt32(ptr, Properties::units, value, 0);
         return *this;
     }
 
     LineSpacing& units(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::units, int32_t(value));
+        Obj_SetInt32(ptr, Properties::units, int32_t(value), 0);
         return *this;
     }
 
@@ -5528,7 +5528,7 @@ public:
 
     LineGeometry& nconds(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::nconds, value);
+        Obj_SetInt32(ptr, Properties::nconds, value, 0);
         return *this;
     }
 
@@ -5543,7 +5543,7 @@ public:
 
     LineGeometry& nphases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::nphases, value);
+        Obj_SetInt32(ptr, Properties::nphases, value, 0);
         return *this;
     }
 
@@ -5558,7 +5558,7 @@ public:
 
     LineGeometry& cond(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::cond, value);
+        Obj_SetInt32(ptr, Properties::cond, value, 0);
         return *this;
     }
 
@@ -5643,13 +5643,13 @@ public:
 
     LineGeometry& units(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::units, value);
+        Obj_SetInt32(ptr, Properties::units, value, 0);
         return *this;
     }
 
     LineGeometry& units(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::units, int32_t(value));
+        Obj_SetInt32(ptr, Properties::units, int32_t(value), 0);
         return *this;
     }
 
@@ -5695,7 +5695,7 @@ public:
 
     LineGeometry& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -5710,7 +5710,7 @@ public:
 
     LineGeometry& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -5725,7 +5725,7 @@ public:
 
     LineGeometry& reduce(bool value)
     {
-        Obj_SetInt32(ptr, Properties::reduce, value);
+        Obj_SetInt32(ptr, Properties::reduce, value, 0);
         return *this;
     }
 
@@ -5982,7 +5982,7 @@ public:
 
     LineGeometry& Seasons(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Seasons, value);
+        Obj_SetInt32(ptr, Properties::Seasons, value, 0);
         return *this;
     }
 
@@ -6016,13 +6016,13 @@ public:
 
     LineGeometry& linetype(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::LineType, value);
+        Obj_SetInt32(ptr, Properties::LineType, value, 0);
         return *this;
     }
 
     LineGeometry& linetype(LineType value)
     {
-        Obj_SetInt32(ptr, Properties::LineType, int32_t(value));
+        Obj_SetInt32(ptr, Properties::LineType, int32_t(value), 0);
         return *this;
     }
 
@@ -6211,7 +6211,7 @@ public:
 
     XfmrCode& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -6226,7 +6226,7 @@ public:
 
     XfmrCode& windings(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::windings, value);
+        Obj_SetInt32(ptr, Properties::windings, value, 0);
         return *this;
     }
 
@@ -6241,7 +6241,7 @@ public:
 
     XfmrCode& wdg(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::wdg, value);
+        Obj_SetInt32(ptr, Properties::wdg, value, 0);
         return *this;
     }
 
@@ -6473,7 +6473,7 @@ public:
 
     XfmrCode& Xhl(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xhl, value);
+        Obj_SetFloat64(ptr, Properties::Xhl, value, 0);
         return *this;
     }
 
@@ -6488,7 +6488,7 @@ public:
 
     XfmrCode& Xht(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xht, value);
+        Obj_SetFloat64(ptr, Properties::Xht, value, 0);
         return *this;
     }
 
@@ -6503,7 +6503,7 @@ public:
 
     XfmrCode& Xlt(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xlt, value);
+        Obj_SetFloat64(ptr, Properties::Xlt, value, 0);
         return *this;
     }
 
@@ -6537,7 +6537,7 @@ public:
 
     XfmrCode& thermal(double value)
     {
-        Obj_SetFloat64(ptr, Properties::thermal, value);
+        Obj_SetFloat64(ptr, Properties::thermal, value, 0);
         return *this;
     }
 
@@ -6552,7 +6552,7 @@ public:
 
     XfmrCode& n(double value)
     {
-        Obj_SetFloat64(ptr, Properties::n, value);
+        Obj_SetFloat64(ptr, Properties::n, value, 0);
         return *this;
     }
 
@@ -6567,7 +6567,7 @@ public:
 
     XfmrCode& m(double value)
     {
-        Obj_SetFloat64(ptr, Properties::m, value);
+        Obj_SetFloat64(ptr, Properties::m, value, 0);
         return *this;
     }
 
@@ -6582,7 +6582,7 @@ public:
 
     XfmrCode& flrise(double value)
     {
-        Obj_SetFloat64(ptr, Properties::flrise, value);
+        Obj_SetFloat64(ptr, Properties::flrise, value, 0);
         return *this;
     }
 
@@ -6597,7 +6597,7 @@ public:
 
     XfmrCode& hsrise(double value)
     {
-        Obj_SetFloat64(ptr, Properties::hsrise, value);
+        Obj_SetFloat64(ptr, Properties::hsrise, value, 0);
         return *this;
     }
 
@@ -6612,7 +6612,7 @@ public:
 
     XfmrCode& pctloadloss(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctloadloss, value);
+        Obj_SetFloat64(ptr, Properties::pctloadloss, value, 0);
         return *this;
     }
 
@@ -6627,7 +6627,7 @@ public:
 
     XfmrCode& pctnoloadloss(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctnoloadloss, value);
+        Obj_SetFloat64(ptr, Properties::pctnoloadloss, value, 0);
         return *this;
     }
 
@@ -6642,7 +6642,7 @@ public:
 
     XfmrCode& normhkVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normhkVA, value);
+        Obj_SetFloat64(ptr, Properties::normhkVA, value, 0);
         return *this;
     }
 
@@ -6657,7 +6657,7 @@ public:
 
     XfmrCode& emerghkVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emerghkVA, value);
+        Obj_SetFloat64(ptr, Properties::emerghkVA, value, 0);
         return *this;
     }
 
@@ -6717,7 +6717,7 @@ public:
 
     XfmrCode& pctimag(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctimag, value);
+        Obj_SetFloat64(ptr, Properties::pctimag, value, 0);
         return *this;
     }
 
@@ -6732,7 +6732,7 @@ public:
 
     XfmrCode& ppm_antifloat(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ppm_antifloat, value);
+        Obj_SetFloat64(ptr, Properties::ppm_antifloat, value, 0);
         return *this;
     }
 
@@ -6764,7 +6764,7 @@ public:
 
     XfmrCode& X12(double value)
     {
-        Obj_SetFloat64(ptr, Properties::X12, value);
+        Obj_SetFloat64(ptr, Properties::X12, value, 0);
         return *this;
     }
 
@@ -6779,7 +6779,7 @@ public:
 
     XfmrCode& X13(double value)
     {
-        Obj_SetFloat64(ptr, Properties::X13, value);
+        Obj_SetFloat64(ptr, Properties::X13, value, 0);
         return *this;
     }
 
@@ -6794,7 +6794,7 @@ public:
 
     XfmrCode& X23(double value)
     {
-        Obj_SetFloat64(ptr, Properties::X23, value);
+        Obj_SetFloat64(ptr, Properties::X23, value, 0);
         return *this;
     }
 
@@ -6824,7 +6824,7 @@ public:
 
     XfmrCode& Seasons(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Seasons, value);
+        Obj_SetInt32(ptr, Properties::Seasons, value, 0);
         return *this;
     }
 
@@ -7073,7 +7073,7 @@ public:
 
     Line& length(double value)
     {
-        Obj_SetFloat64(ptr, Properties::length, value);
+        Obj_SetFloat64(ptr, Properties::length, value, 0);
         return *this;
     }
 
@@ -7088,7 +7088,7 @@ public:
 
     Line& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -7103,7 +7103,7 @@ public:
 
     Line& r1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::r1, value);
+        Obj_SetFloat64(ptr, Properties::r1, value, 0);
         return *this;
     }
 
@@ -7118,7 +7118,7 @@ public:
 
     Line& x1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::x1, value);
+        Obj_SetFloat64(ptr, Properties::x1, value, 0);
         return *this;
     }
 
@@ -7133,7 +7133,7 @@ public:
 
     Line& r0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::r0, value);
+        Obj_SetFloat64(ptr, Properties::r0, value, 0);
         return *this;
     }
 
@@ -7148,7 +7148,7 @@ public:
 
     Line& x0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::x0, value);
+        Obj_SetFloat64(ptr, Properties::x0, value, 0);
         return *this;
     }
 
@@ -7163,7 +7163,7 @@ public:
 
     Line& C1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::C1, value);
+        Obj_SetFloat64(ptr, Properties::C1, value, 0);
         return *this;
     }
 
@@ -7178,7 +7178,7 @@ public:
 
     Line& C0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::C0, value);
+        Obj_SetFloat64(ptr, Properties::C0, value, 0);
         return *this;
     }
 
@@ -7239,7 +7239,7 @@ public:
 
     Line& Switch(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Switch, value);
+        Obj_SetInt32(ptr, Properties::Switch, value, 0);
         return *this;
     }
 
@@ -7254,7 +7254,7 @@ public:
 
     Line& Rg(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rg, value);
+        Obj_SetFloat64(ptr, Properties::Rg, value, 0);
         return *this;
     }
 
@@ -7269,7 +7269,7 @@ public:
 
     Line& Xg(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xg, value);
+        Obj_SetFloat64(ptr, Properties::Xg, value, 0);
         return *this;
     }
 
@@ -7284,7 +7284,7 @@ public:
 
     Line& rho(double value)
     {
-        Obj_SetFloat64(ptr, Properties::rho, value);
+        Obj_SetFloat64(ptr, Properties::rho, value, 0);
         return *this;
     }
 
@@ -7335,13 +7335,13 @@ public:
 
     Line& units(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::units, value);
+        Obj_SetInt32(ptr, Properties::units, value, 0);
         return *this;
     }
 
     Line& units(DimensionUnits value)
     {
-        Obj_SetInt32(ptr, Properties::units, int32_t(value));
+        Obj_SetInt32(ptr, Properties::units, int32_t(value), 0);
         return *this;
     }
 
@@ -7469,13 +7469,13 @@ public:
 
     Line& earthmodel(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::EarthModel, value);
+        Obj_SetInt32(ptr, Properties::EarthModel, value, 0);
         return *this;
     }
 
     Line& earthmodel(EarthModel value)
     {
-        Obj_SetInt32(ptr, Properties::EarthModel, int32_t(value));
+        Obj_SetInt32(ptr, Properties::EarthModel, int32_t(value), 0);
         return *this;
     }
 
@@ -7605,7 +7605,7 @@ public:
 
     Line& B1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::B1, value);
+        Obj_SetFloat64(ptr, Properties::B1, value, 0);
         return *this;
     }
 
@@ -7620,7 +7620,7 @@ public:
 
     Line& B0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::B0, value);
+        Obj_SetFloat64(ptr, Properties::B0, value, 0);
         return *this;
     }
 
@@ -7635,7 +7635,7 @@ public:
 
     Line& Seasons(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Seasons, value);
+        Obj_SetInt32(ptr, Properties::Seasons, value, 0);
         return *this;
     }
 
@@ -7669,13 +7669,13 @@ public:
 
     Line& linetype(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::LineType, value);
+        Obj_SetInt32(ptr, Properties::LineType, value, 0);
         return *this;
     }
 
     Line& linetype(LineType value)
     {
-        Obj_SetInt32(ptr, Properties::LineType, int32_t(value));
+        Obj_SetInt32(ptr, Properties::LineType, int32_t(value), 0);
         return *this;
     }
 
@@ -7727,7 +7727,7 @@ public:
 
     Line& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -7742,7 +7742,7 @@ public:
 
     Line& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -7757,7 +7757,7 @@ public:
 
     Line& faultrate(double value)
     {
-        Obj_SetFloat64(ptr, Properties::faultrate, value);
+        Obj_SetFloat64(ptr, Properties::faultrate, value, 0);
         return *this;
     }
 
@@ -7772,7 +7772,7 @@ public:
 
     Line& pctperm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctperm, value);
+        Obj_SetFloat64(ptr, Properties::pctperm, value, 0);
         return *this;
     }
 
@@ -7787,7 +7787,7 @@ public:
 
     Line& repair(double value)
     {
-        Obj_SetFloat64(ptr, Properties::repair, value);
+        Obj_SetFloat64(ptr, Properties::repair, value, 0);
         return *this;
     }
 
@@ -7802,7 +7802,7 @@ public:
 
     Line& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -7817,7 +7817,7 @@ public:
 
     Line& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -8002,7 +8002,7 @@ public:
 
     Vsource& basekv(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basekv, value);
+        Obj_SetFloat64(ptr, Properties::basekv, value, 0);
         return *this;
     }
 
@@ -8018,7 +8018,7 @@ public:
 
     Vsource& pu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pu, value);
+        Obj_SetFloat64(ptr, Properties::pu, value, 0);
         return *this;
     }
 
@@ -8033,7 +8033,7 @@ public:
 
     Vsource& angle(double value)
     {
-        Obj_SetFloat64(ptr, Properties::angle, value);
+        Obj_SetFloat64(ptr, Properties::angle, value, 0);
         return *this;
     }
 
@@ -8048,7 +8048,7 @@ public:
 
     Vsource& frequency(double value)
     {
-        Obj_SetFloat64(ptr, Properties::frequency, value);
+        Obj_SetFloat64(ptr, Properties::frequency, value, 0);
         return *this;
     }
 
@@ -8063,7 +8063,7 @@ public:
 
     Vsource& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -8078,7 +8078,7 @@ public:
 
     Vsource& MVAsc3(double value)
     {
-        Obj_SetFloat64(ptr, Properties::MVAsc3, value);
+        Obj_SetFloat64(ptr, Properties::MVAsc3, value, 0);
         return *this;
     }
 
@@ -8093,7 +8093,7 @@ public:
 
     Vsource& MVAsc1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::MVAsc1, value);
+        Obj_SetFloat64(ptr, Properties::MVAsc1, value, 0);
         return *this;
     }
 
@@ -8108,7 +8108,7 @@ public:
 
     Vsource& x1r1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::x1r1, value);
+        Obj_SetFloat64(ptr, Properties::x1r1, value, 0);
         return *this;
     }
 
@@ -8123,7 +8123,7 @@ public:
 
     Vsource& x0r0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::x0r0, value);
+        Obj_SetFloat64(ptr, Properties::x0r0, value, 0);
         return *this;
     }
 
@@ -8139,7 +8139,7 @@ public:
 
     Vsource& Isc3(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Isc3, value);
+        Obj_SetFloat64(ptr, Properties::Isc3, value, 0);
         return *this;
     }
 
@@ -8155,7 +8155,7 @@ public:
 
     Vsource& Isc1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Isc1, value);
+        Obj_SetFloat64(ptr, Properties::Isc1, value, 0);
         return *this;
     }
 
@@ -8171,7 +8171,7 @@ public:
 
     Vsource& R1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::R1, value);
+        Obj_SetFloat64(ptr, Properties::R1, value, 0);
         return *this;
     }
 
@@ -8187,7 +8187,7 @@ public:
 
     Vsource& X1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::X1, value);
+        Obj_SetFloat64(ptr, Properties::X1, value, 0);
         return *this;
     }
 
@@ -8203,7 +8203,7 @@ public:
 
     Vsource& R0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::R0, value);
+        Obj_SetFloat64(ptr, Properties::R0, value, 0);
         return *this;
     }
 
@@ -8219,7 +8219,7 @@ public:
 
     Vsource& X0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::X0, value);
+        Obj_SetFloat64(ptr, Properties::X0, value, 0);
         return *this;
     }
 
@@ -8234,13 +8234,13 @@ public:
 
     Vsource& scantype(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::ScanType, value);
+        Obj_SetInt32(ptr, Properties::ScanType, value, 0);
         return *this;
     }
 
     Vsource& scantype(ScanType value)
     {
-        Obj_SetInt32(ptr, Properties::ScanType, int32_t(value));
+        Obj_SetInt32(ptr, Properties::ScanType, int32_t(value), 0);
         return *this;
     }
 
@@ -8286,13 +8286,13 @@ public:
 
     Vsource& Sequence(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Sequence, value);
+        Obj_SetInt32(ptr, Properties::Sequence, value, 0);
         return *this;
     }
 
     Vsource& Sequence(SequenceType value)
     {
-        Obj_SetInt32(ptr, Properties::Sequence, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Sequence, int32_t(value), 0);
         return *this;
     }
 
@@ -8465,7 +8465,7 @@ public:
 
     Vsource& baseMVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::baseMVA, value);
+        Obj_SetFloat64(ptr, Properties::baseMVA, value, 0);
         return *this;
     }
 
@@ -8612,13 +8612,13 @@ public:
 
     Vsource& Model(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Model, value);
+        Obj_SetInt32(ptr, Properties::Model, value, 0);
         return *this;
     }
 
     Vsource& Model(VSourceModel value)
     {
-        Obj_SetInt32(ptr, Properties::Model, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Model, int32_t(value), 0);
         return *this;
     }
 
@@ -8714,7 +8714,7 @@ public:
 
     Vsource& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -8729,7 +8729,7 @@ public:
 
     Vsource& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -8879,7 +8879,7 @@ public:
 
     Isource& amps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::amps, value);
+        Obj_SetFloat64(ptr, Properties::amps, value, 0);
         return *this;
     }
 
@@ -8895,7 +8895,7 @@ public:
 
     Isource& angle(double value)
     {
-        Obj_SetFloat64(ptr, Properties::angle, value);
+        Obj_SetFloat64(ptr, Properties::angle, value, 0);
         return *this;
     }
 
@@ -8910,7 +8910,7 @@ public:
 
     Isource& frequency(double value)
     {
-        Obj_SetFloat64(ptr, Properties::frequency, value);
+        Obj_SetFloat64(ptr, Properties::frequency, value, 0);
         return *this;
     }
 
@@ -8925,7 +8925,7 @@ public:
 
     Isource& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -8940,13 +8940,13 @@ public:
 
     Isource& scantype(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::scantype, value);
+        Obj_SetInt32(ptr, Properties::scantype, value, 0);
         return *this;
     }
 
     Isource& scantype(ScanType value)
     {
-        Obj_SetInt32(ptr, Properties::scantype, int32_t(value));
+        Obj_SetInt32(ptr, Properties::scantype, int32_t(value), 0);
         return *this;
     }
 
@@ -8992,13 +8992,13 @@ public:
 
     Isource& sequence(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::sequence, value);
+        Obj_SetInt32(ptr, Properties::sequence, value, 0);
         return *this;
     }
 
     Isource& sequence(SequenceType value)
     {
-        Obj_SetInt32(ptr, Properties::sequence, int32_t(value));
+        Obj_SetInt32(ptr, Properties::sequence, int32_t(value), 0);
         return *this;
     }
 
@@ -9237,7 +9237,7 @@ public:
 
     Isource& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -9252,7 +9252,7 @@ public:
 
     Isource& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -9404,7 +9404,7 @@ public:
 
     VCCS& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -9419,7 +9419,7 @@ public:
 
     VCCS& prated(double value)
     {
-        Obj_SetFloat64(ptr, Properties::prated, value);
+        Obj_SetFloat64(ptr, Properties::prated, value, 0);
         return *this;
     }
 
@@ -9434,7 +9434,7 @@ public:
 
     VCCS& vrated(double value)
     {
-        Obj_SetFloat64(ptr, Properties::vrated, value);
+        Obj_SetFloat64(ptr, Properties::vrated, value, 0);
         return *this;
     }
 
@@ -9449,7 +9449,7 @@ public:
 
     VCCS& ppct(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ppct, value);
+        Obj_SetFloat64(ptr, Properties::ppct, value, 0);
         return *this;
     }
 
@@ -9572,7 +9572,7 @@ public:
 
     VCCS& fsample(double value)
     {
-        Obj_SetFloat64(ptr, Properties::fsample, value);
+        Obj_SetFloat64(ptr, Properties::fsample, value, 0);
         return *this;
     }
 
@@ -9587,7 +9587,7 @@ public:
 
     VCCS& rmsmode(bool value)
     {
-        Obj_SetInt32(ptr, Properties::rmsmode, value);
+        Obj_SetInt32(ptr, Properties::rmsmode, value, 0);
         return *this;
     }
 
@@ -9602,7 +9602,7 @@ public:
 
     VCCS& imaxpu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::imaxpu, value);
+        Obj_SetFloat64(ptr, Properties::imaxpu, value, 0);
         return *this;
     }
 
@@ -9617,7 +9617,7 @@ public:
 
     VCCS& vrmstau(double value)
     {
-        Obj_SetFloat64(ptr, Properties::vrmstau, value);
+        Obj_SetFloat64(ptr, Properties::vrmstau, value, 0);
         return *this;
     }
 
@@ -9632,7 +9632,7 @@ public:
 
     VCCS& irmstau(double value)
     {
-        Obj_SetFloat64(ptr, Properties::irmstau, value);
+        Obj_SetFloat64(ptr, Properties::irmstau, value, 0);
         return *this;
     }
 
@@ -9683,7 +9683,7 @@ public:
 
     VCCS& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -9698,7 +9698,7 @@ public:
 
     VCCS& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -9882,7 +9882,7 @@ public:
 
     Load& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -9918,7 +9918,7 @@ public:
 
     Load& kV(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kV, value);
+        Obj_SetFloat64(ptr, Properties::kV, value, 0);
         return *this;
     }
 
@@ -9940,7 +9940,7 @@ public:
 
     Load& kW(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kW, value);
+        Obj_SetFloat64(ptr, Properties::kW, value, 0);
         return *this;
     }
 
@@ -9955,7 +9955,7 @@ public:
 
     Load& pf(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pf, value);
+        Obj_SetFloat64(ptr, Properties::pf, value, 0);
         return *this;
     }
 
@@ -9981,13 +9981,13 @@ public:
 
     Load& model(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::model, value);
+        Obj_SetInt32(ptr, Properties::model, value, 0);
         return *this;
     }
 
     Load& model(LoadModel value)
     {
-        Obj_SetInt32(ptr, Properties::model, int32_t(value));
+        Obj_SetInt32(ptr, Properties::model, int32_t(value), 0);
         return *this;
     }
 
@@ -10146,13 +10146,13 @@ public:
 
     Load& conn(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::conn, value);
+        Obj_SetInt32(ptr, Properties::conn, value, 0);
         return *this;
     }
 
     Load& conn(Connection value)
     {
-        Obj_SetInt32(ptr, Properties::conn, int32_t(value));
+        Obj_SetInt32(ptr, Properties::conn, int32_t(value), 0);
         return *this;
     }
 
@@ -10198,7 +10198,7 @@ public:
 
     Load& kvar(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvar, value);
+        Obj_SetFloat64(ptr, Properties::kvar, value, 0);
         return *this;
     }
 
@@ -10213,7 +10213,7 @@ public:
 
     Load& Rneut(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rneut, value);
+        Obj_SetFloat64(ptr, Properties::Rneut, value, 0);
         return *this;
     }
 
@@ -10228,7 +10228,7 @@ public:
 
     Load& Xneut(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xneut, value);
+        Obj_SetFloat64(ptr, Properties::Xneut, value, 0);
         return *this;
     }
 
@@ -10243,13 +10243,13 @@ public:
 
     Load& status(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::status, value);
+        Obj_SetInt32(ptr, Properties::status, value, 0);
         return *this;
     }
 
     Load& status(LoadStatus value)
     {
-        Obj_SetInt32(ptr, Properties::status, int32_t(value));
+        Obj_SetInt32(ptr, Properties::status, int32_t(value), 0);
         return *this;
     }
 
@@ -10295,7 +10295,7 @@ public:
 
     Load& cls(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::cls, value);
+        Obj_SetInt32(ptr, Properties::cls, value, 0);
         return *this;
     }
 
@@ -10310,7 +10310,7 @@ public:
 
     Load& Vminpu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vminpu, value);
+        Obj_SetFloat64(ptr, Properties::Vminpu, value, 0);
         return *this;
     }
 
@@ -10325,7 +10325,7 @@ public:
 
     Load& Vmaxpu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vmaxpu, value);
+        Obj_SetFloat64(ptr, Properties::Vmaxpu, value, 0);
         return *this;
     }
 
@@ -10340,7 +10340,7 @@ public:
 
     Load& Vminnorm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vminnorm, value);
+        Obj_SetFloat64(ptr, Properties::Vminnorm, value, 0);
         return *this;
     }
 
@@ -10355,7 +10355,7 @@ public:
 
     Load& Vminemerg(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vminemerg, value);
+        Obj_SetFloat64(ptr, Properties::Vminemerg, value, 0);
         return *this;
     }
 
@@ -10370,7 +10370,7 @@ public:
 
     Load& xfkVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::xfkVA, value);
+        Obj_SetFloat64(ptr, Properties::xfkVA, value, 0);
         return *this;
     }
 
@@ -10385,7 +10385,7 @@ public:
 
     Load& allocationfactor(double value)
     {
-        Obj_SetFloat64(ptr, Properties::allocationfactor, value);
+        Obj_SetFloat64(ptr, Properties::allocationfactor, value, 0);
         return *this;
     }
 
@@ -10407,7 +10407,7 @@ public:
 
     Load& kVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kVA, value);
+        Obj_SetFloat64(ptr, Properties::kVA, value, 0);
         return *this;
     }
 
@@ -10422,7 +10422,7 @@ public:
 
     Load& pctmean(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctmean, value);
+        Obj_SetFloat64(ptr, Properties::pctmean, value, 0);
         return *this;
     }
 
@@ -10437,7 +10437,7 @@ public:
 
     Load& pctstddev(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctstddev, value);
+        Obj_SetFloat64(ptr, Properties::pctstddev, value, 0);
         return *this;
     }
 
@@ -10454,7 +10454,7 @@ public:
 
     Load& CVRwatts(double value)
     {
-        Obj_SetFloat64(ptr, Properties::CVRwatts, value);
+        Obj_SetFloat64(ptr, Properties::CVRwatts, value, 0);
         return *this;
     }
 
@@ -10471,7 +10471,7 @@ public:
 
     Load& CVRvars(double value)
     {
-        Obj_SetFloat64(ptr, Properties::CVRvars, value);
+        Obj_SetFloat64(ptr, Properties::CVRvars, value, 0);
         return *this;
     }
 
@@ -10486,7 +10486,7 @@ public:
 
     Load& kwh(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kwh, value);
+        Obj_SetFloat64(ptr, Properties::kwh, value, 0);
         return *this;
     }
 
@@ -10501,7 +10501,7 @@ public:
 
     Load& kwhdays(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kwhdays, value);
+        Obj_SetFloat64(ptr, Properties::kwhdays, value, 0);
         return *this;
     }
 
@@ -10516,7 +10516,7 @@ public:
 
     Load& Cfactor(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Cfactor, value);
+        Obj_SetFloat64(ptr, Properties::Cfactor, value, 0);
         return *this;
     }
 
@@ -10567,7 +10567,7 @@ public:
 
     Load& NumCust(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::NumCust, value);
+        Obj_SetInt32(ptr, Properties::NumCust, value, 0);
         return *this;
     }
 
@@ -10602,7 +10602,7 @@ public:
 
     Load& pctSeriesRL(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctSeriesRL, value);
+        Obj_SetFloat64(ptr, Properties::pctSeriesRL, value, 0);
         return *this;
     }
 
@@ -10619,7 +10619,7 @@ public:
 
     Load& RelWeight(double value)
     {
-        Obj_SetFloat64(ptr, Properties::RelWeight, value);
+        Obj_SetFloat64(ptr, Properties::RelWeight, value, 0);
         return *this;
     }
 
@@ -10634,7 +10634,7 @@ public:
 
     Load& Vlowpu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vlowpu, value);
+        Obj_SetFloat64(ptr, Properties::Vlowpu, value, 0);
         return *this;
     }
 
@@ -10653,7 +10653,7 @@ public:
 
     Load& puXharm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::puXharm, value);
+        Obj_SetFloat64(ptr, Properties::puXharm, value, 0);
         return *this;
     }
 
@@ -10668,7 +10668,7 @@ public:
 
     Load& XRharm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::XRharm, value);
+        Obj_SetFloat64(ptr, Properties::XRharm, value, 0);
         return *this;
     }
 
@@ -10719,7 +10719,7 @@ public:
 
     Load& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -10734,7 +10734,7 @@ public:
 
     Load& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -10903,7 +10903,7 @@ public:
 
     Transformer& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -10918,7 +10918,7 @@ public:
 
     Transformer& windings(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::windings, value);
+        Obj_SetInt32(ptr, Properties::windings, value, 0);
         return *this;
     }
 
@@ -10933,7 +10933,7 @@ public:
 
     Transformer& wdg(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::wdg, value);
+        Obj_SetInt32(ptr, Properties::wdg, value, 0);
         return *this;
     }
 
@@ -11197,7 +11197,7 @@ public:
 
     Transformer& XHL(double value)
     {
-        Obj_SetFloat64(ptr, Properties::XHL, value);
+        Obj_SetFloat64(ptr, Properties::XHL, value, 0);
         return *this;
     }
 
@@ -11212,7 +11212,7 @@ public:
 
     Transformer& XHT(double value)
     {
-        Obj_SetFloat64(ptr, Properties::XHT, value);
+        Obj_SetFloat64(ptr, Properties::XHT, value, 0);
         return *this;
     }
 
@@ -11227,7 +11227,7 @@ public:
 
     Transformer& XLT(double value)
     {
-        Obj_SetFloat64(ptr, Properties::XLT, value);
+        Obj_SetFloat64(ptr, Properties::XLT, value, 0);
         return *this;
     }
 
@@ -11261,7 +11261,7 @@ public:
 
     Transformer& thermal(double value)
     {
-        Obj_SetFloat64(ptr, Properties::thermal, value);
+        Obj_SetFloat64(ptr, Properties::thermal, value, 0);
         return *this;
     }
 
@@ -11276,7 +11276,7 @@ public:
 
     Transformer& n(double value)
     {
-        Obj_SetFloat64(ptr, Properties::n, value);
+        Obj_SetFloat64(ptr, Properties::n, value, 0);
         return *this;
     }
 
@@ -11291,7 +11291,7 @@ public:
 
     Transformer& m(double value)
     {
-        Obj_SetFloat64(ptr, Properties::m, value);
+        Obj_SetFloat64(ptr, Properties::m, value, 0);
         return *this;
     }
 
@@ -11306,7 +11306,7 @@ public:
 
     Transformer& flrise(double value)
     {
-        Obj_SetFloat64(ptr, Properties::flrise, value);
+        Obj_SetFloat64(ptr, Properties::flrise, value, 0);
         return *this;
     }
 
@@ -11321,7 +11321,7 @@ public:
 
     Transformer& hsrise(double value)
     {
-        Obj_SetFloat64(ptr, Properties::hsrise, value);
+        Obj_SetFloat64(ptr, Properties::hsrise, value, 0);
         return *this;
     }
 
@@ -11336,7 +11336,7 @@ public:
 
     Transformer& pctloadloss(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctloadloss, value);
+        Obj_SetFloat64(ptr, Properties::pctloadloss, value, 0);
         return *this;
     }
 
@@ -11351,7 +11351,7 @@ public:
 
     Transformer& pctnoloadloss(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctnoloadloss, value);
+        Obj_SetFloat64(ptr, Properties::pctnoloadloss, value, 0);
         return *this;
     }
 
@@ -11366,7 +11366,7 @@ public:
 
     Transformer& normhkVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normhkVA, value);
+        Obj_SetFloat64(ptr, Properties::normhkVA, value, 0);
         return *this;
     }
 
@@ -11381,7 +11381,7 @@ public:
 
     Transformer& emerghkVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emerghkVA, value);
+        Obj_SetFloat64(ptr, Properties::emerghkVA, value, 0);
         return *this;
     }
 
@@ -11396,7 +11396,7 @@ public:
 
     Transformer& sub(bool value)
     {
-        Obj_SetInt32(ptr, Properties::sub, value);
+        Obj_SetInt32(ptr, Properties::sub, value, 0);
         return *this;
     }
 
@@ -11477,7 +11477,7 @@ public:
 
     Transformer& pctimag(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctimag, value);
+        Obj_SetFloat64(ptr, Properties::pctimag, value, 0);
         return *this;
     }
 
@@ -11492,7 +11492,7 @@ public:
 
     Transformer& ppm_antifloat(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ppm_antifloat, value);
+        Obj_SetFloat64(ptr, Properties::ppm_antifloat, value, 0);
         return *this;
     }
 
@@ -11581,7 +11581,7 @@ public:
 
     Transformer& XRConst(bool value)
     {
-        Obj_SetInt32(ptr, Properties::XRConst, value);
+        Obj_SetInt32(ptr, Properties::XRConst, value, 0);
         return *this;
     }
 
@@ -11596,7 +11596,7 @@ public:
 
     Transformer& X12(double value)
     {
-        Obj_SetFloat64(ptr, Properties::X12, value);
+        Obj_SetFloat64(ptr, Properties::X12, value, 0);
         return *this;
     }
 
@@ -11611,7 +11611,7 @@ public:
 
     Transformer& X13(double value)
     {
-        Obj_SetFloat64(ptr, Properties::X13, value);
+        Obj_SetFloat64(ptr, Properties::X13, value, 0);
         return *this;
     }
 
@@ -11626,7 +11626,7 @@ public:
 
     Transformer& X23(double value)
     {
-        Obj_SetFloat64(ptr, Properties::X23, value);
+        Obj_SetFloat64(ptr, Properties::X23, value, 0);
         return *this;
     }
 
@@ -11641,13 +11641,13 @@ public:
 
     Transformer& LeadLag(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::LeadLag, value);
+        Obj_SetInt32(ptr, Properties::LeadLag, value, 0);
         return *this;
     }
 
     Transformer& LeadLag(PhaseSequence value)
     {
-        Obj_SetInt32(ptr, Properties::LeadLag, int32_t(value));
+        Obj_SetInt32(ptr, Properties::LeadLag, int32_t(value), 0);
         return *this;
     }
 
@@ -11704,13 +11704,13 @@ public:
 
     Transformer& Core(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Core, value);
+        Obj_SetInt32(ptr, Properties::Core, value, 0);
         return *this;
     }
 
     Transformer& Core(CoreType value)
     {
-        Obj_SetInt32(ptr, Properties::Core, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Core, int32_t(value), 0);
         return *this;
     }
 
@@ -11771,7 +11771,7 @@ public:
 
     Transformer& Seasons(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Seasons, value);
+        Obj_SetInt32(ptr, Properties::Seasons, value, 0);
         return *this;
     }
 
@@ -11802,7 +11802,7 @@ public:
 
     Transformer& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -11817,7 +11817,7 @@ public:
 
     Transformer& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -11832,7 +11832,7 @@ public:
 
     Transformer& faultrate(double value)
     {
-        Obj_SetFloat64(ptr, Properties::faultrate, value);
+        Obj_SetFloat64(ptr, Properties::faultrate, value, 0);
         return *this;
     }
 
@@ -11847,7 +11847,7 @@ public:
 
     Transformer& pctperm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctperm, value);
+        Obj_SetFloat64(ptr, Properties::pctperm, value, 0);
         return *this;
     }
 
@@ -11862,7 +11862,7 @@ public:
 
     Transformer& repair(double value)
     {
-        Obj_SetFloat64(ptr, Properties::repair, value);
+        Obj_SetFloat64(ptr, Properties::repair, value, 0);
         return *this;
     }
 
@@ -11877,7 +11877,7 @@ public:
 
     Transformer& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -11892,7 +11892,7 @@ public:
 
     Transformer& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -12073,7 +12073,7 @@ public:
 
     Capacitor& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -12103,7 +12103,7 @@ public:
 
     Capacitor& kv(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kv, value);
+        Obj_SetFloat64(ptr, Properties::kv, value, 0);
         return *this;
     }
 
@@ -12118,13 +12118,13 @@ public:
 
     Capacitor& conn(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::conn, value);
+        Obj_SetInt32(ptr, Properties::conn, value, 0);
         return *this;
     }
 
     Capacitor& conn(Connection value)
     {
-        Obj_SetInt32(ptr, Properties::conn, int32_t(value));
+        Obj_SetInt32(ptr, Properties::conn, int32_t(value), 0);
         return *this;
     }
 
@@ -12250,7 +12250,7 @@ public:
 
     Capacitor& Numsteps(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Numsteps, value);
+        Obj_SetInt32(ptr, Properties::Numsteps, value, 0);
         return *this;
     }
 
@@ -12280,7 +12280,7 @@ public:
 
     Capacitor& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -12295,7 +12295,7 @@ public:
 
     Capacitor& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -12310,7 +12310,7 @@ public:
 
     Capacitor& faultrate(double value)
     {
-        Obj_SetFloat64(ptr, Properties::faultrate, value);
+        Obj_SetFloat64(ptr, Properties::faultrate, value, 0);
         return *this;
     }
 
@@ -12325,7 +12325,7 @@ public:
 
     Capacitor& pctperm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctperm, value);
+        Obj_SetFloat64(ptr, Properties::pctperm, value, 0);
         return *this;
     }
 
@@ -12340,7 +12340,7 @@ public:
 
     Capacitor& repair(double value)
     {
-        Obj_SetFloat64(ptr, Properties::repair, value);
+        Obj_SetFloat64(ptr, Properties::repair, value, 0);
         return *this;
     }
 
@@ -12355,7 +12355,7 @@ public:
 
     Capacitor& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -12370,7 +12370,7 @@ public:
 
     Capacitor& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -12557,7 +12557,7 @@ public:
 
     Reactor& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -12572,7 +12572,7 @@ public:
 
     Reactor& kvar(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvar, value);
+        Obj_SetFloat64(ptr, Properties::kvar, value, 0);
         return *this;
     }
 
@@ -12587,7 +12587,7 @@ public:
 
     Reactor& kv(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kv, value);
+        Obj_SetFloat64(ptr, Properties::kv, value, 0);
         return *this;
     }
 
@@ -12602,13 +12602,13 @@ public:
 
     Reactor& conn(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::conn, value);
+        Obj_SetInt32(ptr, Properties::conn, value, 0);
         return *this;
     }
 
     Reactor& conn(Connection value)
     {
-        Obj_SetInt32(ptr, Properties::conn, int32_t(value));
+        Obj_SetInt32(ptr, Properties::conn, int32_t(value), 0);
         return *this;
     }
 
@@ -12684,7 +12684,7 @@ public:
 
     Reactor& Parallel(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Parallel, value);
+        Obj_SetInt32(ptr, Properties::Parallel, value, 0);
         return *this;
     }
 
@@ -12699,7 +12699,7 @@ public:
 
     Reactor& R(double value)
     {
-        Obj_SetFloat64(ptr, Properties::R, value);
+        Obj_SetFloat64(ptr, Properties::R, value, 0);
         return *this;
     }
 
@@ -12714,7 +12714,7 @@ public:
 
     Reactor& X(double value)
     {
-        Obj_SetFloat64(ptr, Properties::X, value);
+        Obj_SetFloat64(ptr, Properties::X, value, 0);
         return *this;
     }
 
@@ -12729,7 +12729,7 @@ public:
 
     Reactor& Rp(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rp, value);
+        Obj_SetFloat64(ptr, Properties::Rp, value, 0);
         return *this;
     }
 
@@ -12892,7 +12892,7 @@ public:
 
     Reactor& LmH(double value)
     {
-        Obj_SetFloat64(ptr, Properties::LmH, value);
+        Obj_SetFloat64(ptr, Properties::LmH, value, 0);
         return *this;
     }
 
@@ -12907,7 +12907,7 @@ public:
 
     Reactor& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -12922,7 +12922,7 @@ public:
 
     Reactor& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -12937,7 +12937,7 @@ public:
 
     Reactor& faultrate(double value)
     {
-        Obj_SetFloat64(ptr, Properties::faultrate, value);
+        Obj_SetFloat64(ptr, Properties::faultrate, value, 0);
         return *this;
     }
 
@@ -12952,7 +12952,7 @@ public:
 
     Reactor& pctperm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctperm, value);
+        Obj_SetFloat64(ptr, Properties::pctperm, value, 0);
         return *this;
     }
 
@@ -12967,7 +12967,7 @@ public:
 
     Reactor& repair(double value)
     {
-        Obj_SetFloat64(ptr, Properties::repair, value);
+        Obj_SetFloat64(ptr, Properties::repair, value, 0);
         return *this;
     }
 
@@ -12982,7 +12982,7 @@ public:
 
     Reactor& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -12997,7 +12997,7 @@ public:
 
     Reactor& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -13186,7 +13186,7 @@ public:
 
     CapControl& terminal(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::terminal, value);
+        Obj_SetInt32(ptr, Properties::terminal, value, 0);
         return *this;
     }
 
@@ -13241,13 +13241,13 @@ public:
 
     CapControl& type(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::type, value);
+        Obj_SetInt32(ptr, Properties::type, value, 0);
         return *this;
     }
 
     CapControl& type(CapControlType value)
     {
-        Obj_SetInt32(ptr, Properties::type, int32_t(value));
+        Obj_SetInt32(ptr, Properties::type, int32_t(value), 0);
         return *this;
     }
 
@@ -13293,7 +13293,7 @@ public:
 
     CapControl& PTratio(double value)
     {
-        Obj_SetFloat64(ptr, Properties::PTratio, value);
+        Obj_SetFloat64(ptr, Properties::PTratio, value, 0);
         return *this;
     }
 
@@ -13308,7 +13308,7 @@ public:
 
     CapControl& CTratio(double value)
     {
-        Obj_SetFloat64(ptr, Properties::CTratio, value);
+        Obj_SetFloat64(ptr, Properties::CTratio, value, 0);
         return *this;
     }
 
@@ -13331,7 +13331,7 @@ public:
 
     CapControl& ONsetting(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ONsetting, value);
+        Obj_SetFloat64(ptr, Properties::ONsetting, value, 0);
         return *this;
     }
 
@@ -13346,7 +13346,7 @@ public:
 
     CapControl& OFFsetting(double value)
     {
-        Obj_SetFloat64(ptr, Properties::OFFsetting, value);
+        Obj_SetFloat64(ptr, Properties::OFFsetting, value, 0);
         return *this;
     }
 
@@ -13361,7 +13361,7 @@ public:
 
     CapControl& Delay(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Delay, value);
+        Obj_SetFloat64(ptr, Properties::Delay, value, 0);
         return *this;
     }
 
@@ -13376,7 +13376,7 @@ public:
 
     CapControl& VoltOverride(bool value)
     {
-        Obj_SetInt32(ptr, Properties::VoltOverride, value);
+        Obj_SetInt32(ptr, Properties::VoltOverride, value, 0);
         return *this;
     }
 
@@ -13391,7 +13391,7 @@ public:
 
     CapControl& Vmax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vmax, value);
+        Obj_SetFloat64(ptr, Properties::Vmax, value, 0);
         return *this;
     }
 
@@ -13406,7 +13406,7 @@ public:
 
     CapControl& Vmin(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vmin, value);
+        Obj_SetFloat64(ptr, Properties::Vmin, value, 0);
         return *this;
     }
 
@@ -13421,7 +13421,7 @@ public:
 
     CapControl& DelayOFF(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DelayOFF, value);
+        Obj_SetFloat64(ptr, Properties::DelayOFF, value, 0);
         return *this;
     }
 
@@ -13436,7 +13436,7 @@ public:
 
     CapControl& DeadTime(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DeadTime, value);
+        Obj_SetFloat64(ptr, Properties::DeadTime, value, 0);
         return *this;
     }
 
@@ -13451,13 +13451,13 @@ public:
 
     CapControl& CTPhase(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::CTPhase, value);
+        Obj_SetInt32(ptr, Properties::CTPhase, value, 0);
         return *this;
     }
 
     CapControl& CTPhase(MonitoredPhase value)
     {
-        Obj_SetInt32(ptr, Properties::CTPhase, int32_t(value));
+        Obj_SetInt32(ptr, Properties::CTPhase, int32_t(value), 0);
         return *this;
     }
 
@@ -13503,13 +13503,13 @@ public:
 
     CapControl& PTPhase(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::PTPhase, value);
+        Obj_SetInt32(ptr, Properties::PTPhase, value, 0);
         return *this;
     }
 
     CapControl& PTPhase(MonitoredPhase value)
     {
-        Obj_SetInt32(ptr, Properties::PTPhase, int32_t(value));
+        Obj_SetInt32(ptr, Properties::PTPhase, int32_t(value), 0);
         return *this;
     }
 
@@ -13576,7 +13576,7 @@ public:
 
     CapControl& EventLog(bool value)
     {
-        Obj_SetInt32(ptr, Properties::EventLog, value);
+        Obj_SetInt32(ptr, Properties::EventLog, value, 0);
         return *this;
     }
 
@@ -13633,7 +13633,7 @@ public:
 
     CapControl& pctMinkvar(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctMinkvar, value);
+        Obj_SetFloat64(ptr, Properties::pctMinkvar, value, 0);
         return *this;
     }
 
@@ -13643,7 +13643,7 @@ public:
     ///
     CapControl& Reset(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Reset, value);
+        Obj_SetInt32(ptr, Properties::Reset, value, 0);
         return *this;
     }
 
@@ -13658,7 +13658,7 @@ public:
 
     CapControl& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -13673,7 +13673,7 @@ public:
 
     CapControl& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -13851,7 +13851,7 @@ public:
 
     Fault& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -13866,7 +13866,7 @@ public:
 
     Fault& r(double value)
     {
-        Obj_SetFloat64(ptr, Properties::r, value);
+        Obj_SetFloat64(ptr, Properties::r, value, 0);
         return *this;
     }
 
@@ -13881,7 +13881,7 @@ public:
 
     Fault& pctstddev(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctstddev, value);
+        Obj_SetFloat64(ptr, Properties::pctstddev, value, 0);
         return *this;
     }
 
@@ -13911,7 +13911,7 @@ public:
 
     Fault& ONtime(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ONtime, value);
+        Obj_SetFloat64(ptr, Properties::ONtime, value, 0);
         return *this;
     }
 
@@ -13926,7 +13926,7 @@ public:
 
     Fault& temporary(bool value)
     {
-        Obj_SetInt32(ptr, Properties::temporary, value);
+        Obj_SetInt32(ptr, Properties::temporary, value, 0);
         return *this;
     }
 
@@ -13941,7 +13941,7 @@ public:
 
     Fault& MinAmps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::MinAmps, value);
+        Obj_SetFloat64(ptr, Properties::MinAmps, value, 0);
         return *this;
     }
 
@@ -13956,7 +13956,7 @@ public:
 
     Fault& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -13971,7 +13971,7 @@ public:
 
     Fault& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -13986,7 +13986,7 @@ public:
 
     Fault& faultrate(double value)
     {
-        Obj_SetFloat64(ptr, Properties::faultrate, value);
+        Obj_SetFloat64(ptr, Properties::faultrate, value, 0);
         return *this;
     }
 
@@ -14001,7 +14001,7 @@ public:
 
     Fault& pctperm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctperm, value);
+        Obj_SetFloat64(ptr, Properties::pctperm, value, 0);
         return *this;
     }
 
@@ -14016,7 +14016,7 @@ public:
 
     Fault& repair(double value)
     {
-        Obj_SetFloat64(ptr, Properties::repair, value);
+        Obj_SetFloat64(ptr, Properties::repair, value, 0);
         return *this;
     }
 
@@ -14031,7 +14031,7 @@ public:
 
     Fault& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -14046,7 +14046,7 @@ public:
 
     Fault& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -14228,7 +14228,7 @@ public:
 
     Generator& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -14264,7 +14264,7 @@ public:
 
     Generator& kv(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kv, value);
+        Obj_SetFloat64(ptr, Properties::kv, value, 0);
         return *this;
     }
 
@@ -14280,7 +14280,7 @@ public:
 
     Generator& kW(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kW, value);
+        Obj_SetFloat64(ptr, Properties::kW, value, 0);
         return *this;
     }
 
@@ -14298,7 +14298,7 @@ public:
 
     Generator& pf(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pf, value);
+        Obj_SetFloat64(ptr, Properties::pf, value, 0);
         return *this;
     }
 
@@ -14313,7 +14313,7 @@ public:
 
     Generator& kvar(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvar, value);
+        Obj_SetFloat64(ptr, Properties::kvar, value, 0);
         return *this;
     }
 
@@ -14336,7 +14336,7 @@ public:
 
     Generator& model(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::model, value);
+        Obj_SetInt32(ptr, Properties::model, value, 0);
         return *this;
     }
 
@@ -14351,7 +14351,7 @@ public:
 
     Generator& Vminpu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vminpu, value);
+        Obj_SetFloat64(ptr, Properties::Vminpu, value, 0);
         return *this;
     }
 
@@ -14366,7 +14366,7 @@ public:
 
     Generator& Vmaxpu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vmaxpu, value);
+        Obj_SetFloat64(ptr, Properties::Vmaxpu, value, 0);
         return *this;
     }
 
@@ -14489,13 +14489,13 @@ public:
 
     Generator& dispmode(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::dispmode, value);
+        Obj_SetInt32(ptr, Properties::dispmode, value, 0);
         return *this;
     }
 
     Generator& dispmode(GeneratorDispatchMode value)
     {
-        Obj_SetInt32(ptr, Properties::dispmode, int32_t(value));
+        Obj_SetInt32(ptr, Properties::dispmode, int32_t(value), 0);
         return *this;
     }
 
@@ -14543,7 +14543,7 @@ public:
 
     Generator& dispvalue(double value)
     {
-        Obj_SetFloat64(ptr, Properties::dispvalue, value);
+        Obj_SetFloat64(ptr, Properties::dispvalue, value, 0);
         return *this;
     }
 
@@ -14558,13 +14558,13 @@ public:
 
     Generator& conn(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::conn, value);
+        Obj_SetInt32(ptr, Properties::conn, value, 0);
         return *this;
     }
 
     Generator& conn(Connection value)
     {
-        Obj_SetInt32(ptr, Properties::conn, int32_t(value));
+        Obj_SetInt32(ptr, Properties::conn, int32_t(value), 0);
         return *this;
     }
 
@@ -14610,13 +14610,13 @@ public:
 
     Generator& status(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::status, value);
+        Obj_SetInt32(ptr, Properties::status, value, 0);
         return *this;
     }
 
     Generator& status(GeneratorStatus value)
     {
-        Obj_SetInt32(ptr, Properties::status, int32_t(value));
+        Obj_SetInt32(ptr, Properties::status, int32_t(value), 0);
         return *this;
     }
 
@@ -14662,7 +14662,7 @@ public:
 
     Generator& cls(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::cls, value);
+        Obj_SetInt32(ptr, Properties::cls, value, 0);
         return *this;
     }
 
@@ -14677,7 +14677,7 @@ public:
 
     Generator& Vpu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vpu, value);
+        Obj_SetFloat64(ptr, Properties::Vpu, value, 0);
         return *this;
     }
 
@@ -14692,7 +14692,7 @@ public:
 
     Generator& maxkvar(double value)
     {
-        Obj_SetFloat64(ptr, Properties::maxkvar, value);
+        Obj_SetFloat64(ptr, Properties::maxkvar, value, 0);
         return *this;
     }
 
@@ -14707,7 +14707,7 @@ public:
 
     Generator& minkvar(double value)
     {
-        Obj_SetFloat64(ptr, Properties::minkvar, value);
+        Obj_SetFloat64(ptr, Properties::minkvar, value, 0);
         return *this;
     }
 
@@ -14722,7 +14722,7 @@ public:
 
     Generator& pvfactor(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pvfactor, value);
+        Obj_SetFloat64(ptr, Properties::pvfactor, value, 0);
         return *this;
     }
 
@@ -14737,7 +14737,7 @@ public:
 
     Generator& forceon(bool value)
     {
-        Obj_SetInt32(ptr, Properties::forceon, value);
+        Obj_SetInt32(ptr, Properties::forceon, value, 0);
         return *this;
     }
 
@@ -14752,7 +14752,7 @@ public:
 
     Generator& kVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kVA, value);
+        Obj_SetFloat64(ptr, Properties::kVA, value, 0);
         return *this;
     }
 
@@ -14767,7 +14767,7 @@ public:
 
     Generator& MVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::MVA, value);
+        Obj_SetFloat64(ptr, Properties::MVA, value, 0);
         return *this;
     }
 
@@ -14782,7 +14782,7 @@ public:
 
     Generator& Xd(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xd, value);
+        Obj_SetFloat64(ptr, Properties::Xd, value, 0);
         return *this;
     }
 
@@ -14797,7 +14797,7 @@ public:
 
     Generator& Xdp(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xdp, value);
+        Obj_SetFloat64(ptr, Properties::Xdp, value, 0);
         return *this;
     }
 
@@ -14812,7 +14812,7 @@ public:
 
     Generator& Xdpp(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xdpp, value);
+        Obj_SetFloat64(ptr, Properties::Xdpp, value, 0);
         return *this;
     }
 
@@ -14827,7 +14827,7 @@ public:
 
     Generator& H(double value)
     {
-        Obj_SetFloat64(ptr, Properties::H, value);
+        Obj_SetFloat64(ptr, Properties::H, value, 0);
         return *this;
     }
 
@@ -14842,7 +14842,7 @@ public:
 
     Generator& D(double value)
     {
-        Obj_SetFloat64(ptr, Properties::D, value);
+        Obj_SetFloat64(ptr, Properties::D, value, 0);
         return *this;
     }
 
@@ -14941,7 +14941,7 @@ public:
 
     Generator& DutyStart(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DutyStart, value);
+        Obj_SetFloat64(ptr, Properties::DutyStart, value, 0);
         return *this;
     }
 
@@ -14956,7 +14956,7 @@ public:
 
     Generator& debugtrace(bool value)
     {
-        Obj_SetInt32(ptr, Properties::debugtrace, value);
+        Obj_SetInt32(ptr, Properties::debugtrace, value, 0);
         return *this;
     }
 
@@ -14971,7 +14971,7 @@ public:
 
     Generator& Balanced(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Balanced, value);
+        Obj_SetInt32(ptr, Properties::Balanced, value, 0);
         return *this;
     }
 
@@ -14986,7 +14986,7 @@ public:
 
     Generator& XRdp(double value)
     {
-        Obj_SetFloat64(ptr, Properties::XRdp, value);
+        Obj_SetFloat64(ptr, Properties::XRdp, value, 0);
         return *this;
     }
 
@@ -15001,7 +15001,7 @@ public:
 
     Generator& UseFuel(bool value)
     {
-        Obj_SetInt32(ptr, Properties::UseFuel, value);
+        Obj_SetInt32(ptr, Properties::UseFuel, value, 0);
         return *this;
     }
 
@@ -15016,7 +15016,7 @@ public:
 
     Generator& FuelkWh(double value)
     {
-        Obj_SetFloat64(ptr, Properties::FuelkWh, value);
+        Obj_SetFloat64(ptr, Properties::FuelkWh, value, 0);
         return *this;
     }
 
@@ -15031,7 +15031,7 @@ public:
 
     Generator& pctFuel(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctFuel, value);
+        Obj_SetFloat64(ptr, Properties::pctFuel, value, 0);
         return *this;
     }
 
@@ -15046,7 +15046,7 @@ public:
 
     Generator& pctReserve(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctReserve, value);
+        Obj_SetFloat64(ptr, Properties::pctReserve, value, 0);
         return *this;
     }
 
@@ -15056,7 +15056,7 @@ public:
     ///
     Generator& Refuel(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Refuel, value);
+        Obj_SetInt32(ptr, Properties::Refuel, value, 0);
         return *this;
     }
 
@@ -15107,7 +15107,7 @@ public:
 
     Generator& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -15122,7 +15122,7 @@ public:
 
     Generator& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -15280,7 +15280,7 @@ public:
 
     GenDispatcher& Terminal(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Terminal, value);
+        Obj_SetInt32(ptr, Properties::Terminal, value, 0);
         return *this;
     }
 
@@ -15295,7 +15295,7 @@ public:
 
     GenDispatcher& kWLimit(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWLimit, value);
+        Obj_SetFloat64(ptr, Properties::kWLimit, value, 0);
         return *this;
     }
 
@@ -15310,7 +15310,7 @@ public:
 
     GenDispatcher& kWBand(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWBand, value);
+        Obj_SetFloat64(ptr, Properties::kWBand, value, 0);
         return *this;
     }
 
@@ -15325,7 +15325,7 @@ public:
 
     GenDispatcher& kvarlimit(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvarlimit, value);
+        Obj_SetFloat64(ptr, Properties::kvarlimit, value, 0);
         return *this;
     }
 
@@ -15370,7 +15370,7 @@ public:
 
     GenDispatcher& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -15385,7 +15385,7 @@ public:
 
     GenDispatcher& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -15578,7 +15578,7 @@ public:
 
     Storage& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -15618,7 +15618,7 @@ public:
 
     Storage& kv(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kv, value);
+        Obj_SetFloat64(ptr, Properties::kv, value, 0);
         return *this;
     }
 
@@ -15633,13 +15633,13 @@ public:
 
     Storage& conn(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::conn, value);
+        Obj_SetInt32(ptr, Properties::conn, value, 0);
         return *this;
     }
 
     Storage& conn(Connection value)
     {
-        Obj_SetInt32(ptr, Properties::conn, int32_t(value));
+        Obj_SetInt32(ptr, Properties::conn, int32_t(value), 0);
         return *this;
     }
 
@@ -15685,7 +15685,7 @@ public:
 
     Storage& kW(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kW, value);
+        Obj_SetFloat64(ptr, Properties::kW, value, 0);
         return *this;
     }
 
@@ -15700,7 +15700,7 @@ public:
 
     Storage& kvar(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvar, value);
+        Obj_SetFloat64(ptr, Properties::kvar, value, 0);
         return *this;
     }
 
@@ -15719,7 +15719,7 @@ public:
 
     Storage& pf(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pf, value);
+        Obj_SetFloat64(ptr, Properties::pf, value, 0);
         return *this;
     }
 
@@ -15734,7 +15734,7 @@ public:
 
     Storage& kVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kVA, value);
+        Obj_SetFloat64(ptr, Properties::kVA, value, 0);
         return *this;
     }
 
@@ -15749,7 +15749,7 @@ public:
 
     Storage& pctCutin(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctCutin, value);
+        Obj_SetFloat64(ptr, Properties::pctCutin, value, 0);
         return *this;
     }
 
@@ -15764,7 +15764,7 @@ public:
 
     Storage& pctCutout(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctCutout, value);
+        Obj_SetFloat64(ptr, Properties::pctCutout, value, 0);
         return *this;
     }
 
@@ -15815,7 +15815,7 @@ public:
 
     Storage& VarFollowInverter(bool value)
     {
-        Obj_SetInt32(ptr, Properties::VarFollowInverter, value);
+        Obj_SetInt32(ptr, Properties::VarFollowInverter, value, 0);
         return *this;
     }
 
@@ -15830,7 +15830,7 @@ public:
 
     Storage& kvarMax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvarMax, value);
+        Obj_SetFloat64(ptr, Properties::kvarMax, value, 0);
         return *this;
     }
 
@@ -15845,7 +15845,7 @@ public:
 
     Storage& kvarMaxAbs(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvarMaxAbs, value);
+        Obj_SetFloat64(ptr, Properties::kvarMaxAbs, value, 0);
         return *this;
     }
 
@@ -15860,7 +15860,7 @@ public:
 
     Storage& WattPriority(bool value)
     {
-        Obj_SetInt32(ptr, Properties::WattPriority, value);
+        Obj_SetInt32(ptr, Properties::WattPriority, value, 0);
         return *this;
     }
 
@@ -15875,7 +15875,7 @@ public:
 
     Storage& PFPriority(bool value)
     {
-        Obj_SetInt32(ptr, Properties::PFPriority, value);
+        Obj_SetInt32(ptr, Properties::PFPriority, value, 0);
         return *this;
     }
 
@@ -15890,7 +15890,7 @@ public:
 
     Storage& pctPminNoVars(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctPminNoVars, value);
+        Obj_SetFloat64(ptr, Properties::pctPminNoVars, value, 0);
         return *this;
     }
 
@@ -15905,7 +15905,7 @@ public:
 
     Storage& pctPminkvarMax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctPminkvarMax, value);
+        Obj_SetFloat64(ptr, Properties::pctPminkvarMax, value, 0);
         return *this;
     }
 
@@ -15920,7 +15920,7 @@ public:
 
     Storage& kWrated(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWrated, value);
+        Obj_SetFloat64(ptr, Properties::kWrated, value, 0);
         return *this;
     }
 
@@ -15935,7 +15935,7 @@ public:
 
     Storage& pctkWrated(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctkWrated, value);
+        Obj_SetFloat64(ptr, Properties::pctkWrated, value, 0);
         return *this;
     }
 
@@ -15950,7 +15950,7 @@ public:
 
     Storage& kWhrated(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWhrated, value);
+        Obj_SetFloat64(ptr, Properties::kWhrated, value, 0);
         return *this;
     }
 
@@ -15965,7 +15965,7 @@ public:
 
     Storage& kWhstored(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWhstored, value);
+        Obj_SetFloat64(ptr, Properties::kWhstored, value, 0);
         return *this;
     }
 
@@ -15980,7 +15980,7 @@ public:
 
     Storage& pctstored(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctstored, value);
+        Obj_SetFloat64(ptr, Properties::pctstored, value, 0);
         return *this;
     }
 
@@ -15996,7 +15996,7 @@ public:
 
     Storage& pctreserve(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctreserve, value);
+        Obj_SetFloat64(ptr, Properties::pctreserve, value, 0);
         return *this;
     }
 
@@ -16011,13 +16011,13 @@ public:
 
     Storage& State(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::State, value);
+        Obj_SetInt32(ptr, Properties::State, value, 0);
         return *this;
     }
 
     Storage& State(StorageState value)
     {
-        Obj_SetInt32(ptr, Properties::State, int32_t(value));
+        Obj_SetInt32(ptr, Properties::State, int32_t(value), 0);
         return *this;
     }
 
@@ -16063,7 +16063,7 @@ public:
 
     Storage& pctDischarge(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctDischarge, value);
+        Obj_SetFloat64(ptr, Properties::pctDischarge, value, 0);
         return *this;
     }
 
@@ -16078,7 +16078,7 @@ public:
 
     Storage& pctCharge(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctCharge, value);
+        Obj_SetFloat64(ptr, Properties::pctCharge, value, 0);
         return *this;
     }
 
@@ -16093,7 +16093,7 @@ public:
 
     Storage& pctEffCharge(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctEffCharge, value);
+        Obj_SetFloat64(ptr, Properties::pctEffCharge, value, 0);
         return *this;
     }
 
@@ -16108,7 +16108,7 @@ public:
 
     Storage& pctEffDischarge(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctEffDischarge, value);
+        Obj_SetFloat64(ptr, Properties::pctEffDischarge, value, 0);
         return *this;
     }
 
@@ -16123,7 +16123,7 @@ public:
 
     Storage& pctIdlingkW(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctIdlingkW, value);
+        Obj_SetFloat64(ptr, Properties::pctIdlingkW, value, 0);
         return *this;
     }
 
@@ -16138,7 +16138,7 @@ public:
 
     Storage& pctR(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctR, value);
+        Obj_SetFloat64(ptr, Properties::pctR, value, 0);
         return *this;
     }
 
@@ -16153,7 +16153,7 @@ public:
 
     Storage& pctX(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctX, value);
+        Obj_SetFloat64(ptr, Properties::pctX, value, 0);
         return *this;
     }
 
@@ -16172,7 +16172,7 @@ public:
 
     Storage& model(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::model, value);
+        Obj_SetInt32(ptr, Properties::model, value, 0);
         return *this;
     }
 
@@ -16187,7 +16187,7 @@ public:
 
     Storage& Vminpu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vminpu, value);
+        Obj_SetFloat64(ptr, Properties::Vminpu, value, 0);
         return *this;
     }
 
@@ -16202,7 +16202,7 @@ public:
 
     Storage& Vmaxpu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vmaxpu, value);
+        Obj_SetFloat64(ptr, Properties::Vmaxpu, value, 0);
         return *this;
     }
 
@@ -16217,7 +16217,7 @@ public:
 
     Storage& Balanced(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Balanced, value);
+        Obj_SetInt32(ptr, Properties::Balanced, value, 0);
         return *this;
     }
 
@@ -16232,7 +16232,7 @@ public:
 
     Storage& LimitCurrent(bool value)
     {
-        Obj_SetInt32(ptr, Properties::LimitCurrent, value);
+        Obj_SetInt32(ptr, Properties::LimitCurrent, value, 0);
         return *this;
     }
 
@@ -16371,13 +16371,13 @@ public:
 
     Storage& DispMode(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::DispMode, value);
+        Obj_SetInt32(ptr, Properties::DispMode, value, 0);
         return *this;
     }
 
     Storage& DispMode(StorageDispatchMode value)
     {
-        Obj_SetInt32(ptr, Properties::DispMode, int32_t(value));
+        Obj_SetInt32(ptr, Properties::DispMode, int32_t(value), 0);
         return *this;
     }
 
@@ -16441,7 +16441,7 @@ public:
 
     Storage& DischargeTrigger(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DischargeTrigger, value);
+        Obj_SetFloat64(ptr, Properties::DischargeTrigger, value, 0);
         return *this;
     }
 
@@ -16460,7 +16460,7 @@ public:
 
     Storage& ChargeTrigger(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ChargeTrigger, value);
+        Obj_SetFloat64(ptr, Properties::ChargeTrigger, value, 0);
         return *this;
     }
 
@@ -16475,7 +16475,7 @@ public:
 
     Storage& TimeChargeTrig(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TimeChargeTrig, value);
+        Obj_SetFloat64(ptr, Properties::TimeChargeTrig, value, 0);
         return *this;
     }
 
@@ -16490,7 +16490,7 @@ public:
 
     Storage& cls(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::cls, value);
+        Obj_SetInt32(ptr, Properties::cls, value, 0);
         return *this;
     }
 
@@ -16589,7 +16589,7 @@ public:
 
     Storage& debugtrace(bool value)
     {
-        Obj_SetInt32(ptr, Properties::debugtrace, value);
+        Obj_SetInt32(ptr, Properties::debugtrace, value, 0);
         return *this;
     }
 
@@ -16640,7 +16640,7 @@ public:
 
     Storage& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -16655,7 +16655,7 @@ public:
 
     Storage& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -16873,7 +16873,7 @@ public:
 
     StorageController& Terminal(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Terminal, value);
+        Obj_SetInt32(ptr, Properties::Terminal, value, 0);
         return *this;
     }
 
@@ -16888,13 +16888,13 @@ public:
 
     StorageController& MonPhase(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::MonPhase, value);
+        Obj_SetInt32(ptr, Properties::MonPhase, value, 0);
         return *this;
     }
 
     StorageController& MonPhase(MonitoredPhase value)
     {
-        Obj_SetInt32(ptr, Properties::MonPhase, int32_t(value));
+        Obj_SetInt32(ptr, Properties::MonPhase, int32_t(value), 0);
         return *this;
     }
 
@@ -16940,7 +16940,7 @@ public:
 
     StorageController& kWTarget(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWTarget, value);
+        Obj_SetFloat64(ptr, Properties::kWTarget, value, 0);
         return *this;
     }
 
@@ -16955,7 +16955,7 @@ public:
 
     StorageController& kWTargetLow(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWTargetLow, value);
+        Obj_SetFloat64(ptr, Properties::kWTargetLow, value, 0);
         return *this;
     }
 
@@ -16970,7 +16970,7 @@ public:
 
     StorageController& pctkWBand(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctkWBand, value);
+        Obj_SetFloat64(ptr, Properties::pctkWBand, value, 0);
         return *this;
     }
 
@@ -16985,7 +16985,7 @@ public:
 
     StorageController& kWBand(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWBand, value);
+        Obj_SetFloat64(ptr, Properties::kWBand, value, 0);
         return *this;
     }
 
@@ -17000,7 +17000,7 @@ public:
 
     StorageController& pctkWBandLow(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctkWBandLow, value);
+        Obj_SetFloat64(ptr, Properties::pctkWBandLow, value, 0);
         return *this;
     }
 
@@ -17015,7 +17015,7 @@ public:
 
     StorageController& kWBandLow(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWBandLow, value);
+        Obj_SetFloat64(ptr, Properties::kWBandLow, value, 0);
         return *this;
     }
 
@@ -17074,13 +17074,13 @@ public:
 
     StorageController& ModeDischarge(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::ModeDischarge, value);
+        Obj_SetInt32(ptr, Properties::ModeDischarge, value, 0);
         return *this;
     }
 
     StorageController& ModeDischarge(StorageControllerDischargemode value)
     {
-        Obj_SetInt32(ptr, Properties::ModeDischarge, int32_t(value));
+        Obj_SetInt32(ptr, Properties::ModeDischarge, int32_t(value), 0);
         return *this;
     }
 
@@ -17162,13 +17162,13 @@ public:
 
     StorageController& ModeCharge(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::ModeCharge, value);
+        Obj_SetInt32(ptr, Properties::ModeCharge, value, 0);
         return *this;
     }
 
     StorageController& ModeCharge(StorageControllerChargemode value)
     {
-        Obj_SetInt32(ptr, Properties::ModeCharge, int32_t(value));
+        Obj_SetInt32(ptr, Properties::ModeCharge, int32_t(value), 0);
         return *this;
     }
 
@@ -17230,7 +17230,7 @@ public:
 
     StorageController& TimeDischargeTrigger(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TimeDischargeTrigger, value);
+        Obj_SetFloat64(ptr, Properties::TimeDischargeTrigger, value, 0);
         return *this;
     }
 
@@ -17245,7 +17245,7 @@ public:
 
     StorageController& TimeChargeTrigger(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TimeChargeTrigger, value);
+        Obj_SetFloat64(ptr, Properties::TimeChargeTrigger, value, 0);
         return *this;
     }
 
@@ -17260,7 +17260,7 @@ public:
 
     StorageController& pctRatekW(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctRatekW, value);
+        Obj_SetFloat64(ptr, Properties::pctRatekW, value, 0);
         return *this;
     }
 
@@ -17275,7 +17275,7 @@ public:
 
     StorageController& pctRateCharge(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctRateCharge, value);
+        Obj_SetFloat64(ptr, Properties::pctRateCharge, value, 0);
         return *this;
     }
 
@@ -17290,7 +17290,7 @@ public:
 
     StorageController& pctReserve(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctReserve, value);
+        Obj_SetFloat64(ptr, Properties::pctReserve, value, 0);
         return *this;
     }
 
@@ -17305,7 +17305,7 @@ public:
 
     StorageController& kWhTotal(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWhTotal, value);
+        Obj_SetFloat64(ptr, Properties::kWhTotal, value, 0);
         return *this;
     }
 
@@ -17320,7 +17320,7 @@ public:
 
     StorageController& kWTotal(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWTotal, value);
+        Obj_SetFloat64(ptr, Properties::kWTotal, value, 0);
         return *this;
     }
 
@@ -17335,7 +17335,7 @@ public:
 
     StorageController& kWhActual(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWhActual, value);
+        Obj_SetFloat64(ptr, Properties::kWhActual, value, 0);
         return *this;
     }
 
@@ -17350,7 +17350,7 @@ public:
 
     StorageController& kWActual(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWActual, value);
+        Obj_SetFloat64(ptr, Properties::kWActual, value, 0);
         return *this;
     }
 
@@ -17365,7 +17365,7 @@ public:
 
     StorageController& kWneed(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWneed, value);
+        Obj_SetFloat64(ptr, Properties::kWneed, value, 0);
         return *this;
     }
 
@@ -17488,7 +17488,7 @@ public:
 
     StorageController& EventLog(bool value)
     {
-        Obj_SetInt32(ptr, Properties::EventLog, value);
+        Obj_SetInt32(ptr, Properties::EventLog, value, 0);
         return *this;
     }
 
@@ -17503,7 +17503,7 @@ public:
 
     StorageController& InhibitTime(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::InhibitTime, value);
+        Obj_SetInt32(ptr, Properties::InhibitTime, value, 0);
         return *this;
     }
 
@@ -17518,7 +17518,7 @@ public:
 
     StorageController& Tup(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Tup, value);
+        Obj_SetFloat64(ptr, Properties::Tup, value, 0);
         return *this;
     }
 
@@ -17533,7 +17533,7 @@ public:
 
     StorageController& TFlat(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TFlat, value);
+        Obj_SetFloat64(ptr, Properties::TFlat, value, 0);
         return *this;
     }
 
@@ -17548,7 +17548,7 @@ public:
 
     StorageController& Tdn(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Tdn, value);
+        Obj_SetFloat64(ptr, Properties::Tdn, value, 0);
         return *this;
     }
 
@@ -17563,7 +17563,7 @@ public:
 
     StorageController& kWThreshold(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWThreshold, value);
+        Obj_SetFloat64(ptr, Properties::kWThreshold, value, 0);
         return *this;
     }
 
@@ -17580,7 +17580,7 @@ public:
 
     StorageController& DispFactor(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DispFactor, value);
+        Obj_SetFloat64(ptr, Properties::DispFactor, value, 0);
         return *this;
     }
 
@@ -17595,7 +17595,7 @@ public:
 
     StorageController& ResetLevel(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ResetLevel, value);
+        Obj_SetFloat64(ptr, Properties::ResetLevel, value, 0);
         return *this;
     }
 
@@ -17610,7 +17610,7 @@ public:
 
     StorageController& Seasons(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Seasons, value);
+        Obj_SetInt32(ptr, Properties::Seasons, value, 0);
         return *this;
     }
 
@@ -17655,7 +17655,7 @@ public:
 
     StorageController& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -17670,7 +17670,7 @@ public:
 
     StorageController& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -17912,7 +17912,7 @@ public:
 
     Relay& MonitoredTerm(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::MonitoredTerm, value);
+        Obj_SetInt32(ptr, Properties::MonitoredTerm, value, 0);
         return *this;
     }
 
@@ -17963,7 +17963,7 @@ public:
 
     Relay& SwitchedTerm(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::SwitchedTerm, value);
+        Obj_SetInt32(ptr, Properties::SwitchedTerm, value, 0);
         return *this;
     }
 
@@ -17989,13 +17989,13 @@ public:
 
     Relay& type(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::type, value);
+        Obj_SetInt32(ptr, Properties::type, value, 0);
         return *this;
     }
 
     Relay& type(RelayType value)
     {
-        Obj_SetInt32(ptr, Properties::type, int32_t(value));
+        Obj_SetInt32(ptr, Properties::type, int32_t(value), 0);
         return *this;
     }
 
@@ -18135,7 +18135,7 @@ public:
 
     Relay& PhaseTrip(double value)
     {
-        Obj_SetFloat64(ptr, Properties::PhaseTrip, value);
+        Obj_SetFloat64(ptr, Properties::PhaseTrip, value, 0);
         return *this;
     }
 
@@ -18150,7 +18150,7 @@ public:
 
     Relay& GroundTrip(double value)
     {
-        Obj_SetFloat64(ptr, Properties::GroundTrip, value);
+        Obj_SetFloat64(ptr, Properties::GroundTrip, value, 0);
         return *this;
     }
 
@@ -18165,7 +18165,7 @@ public:
 
     Relay& TDPhase(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TDPhase, value);
+        Obj_SetFloat64(ptr, Properties::TDPhase, value, 0);
         return *this;
     }
 
@@ -18180,7 +18180,7 @@ public:
 
     Relay& TDGround(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TDGround, value);
+        Obj_SetFloat64(ptr, Properties::TDGround, value, 0);
         return *this;
     }
 
@@ -18195,7 +18195,7 @@ public:
 
     Relay& PhaseInst(double value)
     {
-        Obj_SetFloat64(ptr, Properties::PhaseInst, value);
+        Obj_SetFloat64(ptr, Properties::PhaseInst, value, 0);
         return *this;
     }
 
@@ -18210,7 +18210,7 @@ public:
 
     Relay& GroundInst(double value)
     {
-        Obj_SetFloat64(ptr, Properties::GroundInst, value);
+        Obj_SetFloat64(ptr, Properties::GroundInst, value, 0);
         return *this;
     }
 
@@ -18225,7 +18225,7 @@ public:
 
     Relay& Reset(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Reset, value);
+        Obj_SetFloat64(ptr, Properties::Reset, value, 0);
         return *this;
     }
 
@@ -18240,7 +18240,7 @@ public:
 
     Relay& Shots(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Shots, value);
+        Obj_SetInt32(ptr, Properties::Shots, value, 0);
         return *this;
     }
 
@@ -18270,7 +18270,7 @@ public:
 
     Relay& Delay(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Delay, value);
+        Obj_SetFloat64(ptr, Properties::Delay, value, 0);
         return *this;
     }
 
@@ -18357,7 +18357,7 @@ public:
 
     Relay& kvbase(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvbase, value);
+        Obj_SetFloat64(ptr, Properties::kvbase, value, 0);
         return *this;
     }
 
@@ -18372,7 +18372,7 @@ public:
 
     Relay& pctPickup47(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctPickup47, value);
+        Obj_SetFloat64(ptr, Properties::pctPickup47, value, 0);
         return *this;
     }
 
@@ -18387,7 +18387,7 @@ public:
 
     Relay& BaseAmps46(double value)
     {
-        Obj_SetFloat64(ptr, Properties::BaseAmps46, value);
+        Obj_SetFloat64(ptr, Properties::BaseAmps46, value, 0);
         return *this;
     }
 
@@ -18402,7 +18402,7 @@ public:
 
     Relay& pctPickup46(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctPickup46, value);
+        Obj_SetFloat64(ptr, Properties::pctPickup46, value, 0);
         return *this;
     }
 
@@ -18417,7 +18417,7 @@ public:
 
     Relay& isqt46(double value)
     {
-        Obj_SetFloat64(ptr, Properties::isqt46, value);
+        Obj_SetFloat64(ptr, Properties::isqt46, value, 0);
         return *this;
     }
 
@@ -18453,7 +18453,7 @@ public:
 
     Relay& overtrip(double value)
     {
-        Obj_SetFloat64(ptr, Properties::overtrip, value);
+        Obj_SetFloat64(ptr, Properties::overtrip, value, 0);
         return *this;
     }
 
@@ -18468,7 +18468,7 @@ public:
 
     Relay& undertrip(double value)
     {
-        Obj_SetFloat64(ptr, Properties::undertrip, value);
+        Obj_SetFloat64(ptr, Properties::undertrip, value, 0);
         return *this;
     }
 
@@ -18483,7 +18483,7 @@ public:
 
     Relay& Breakertime(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Breakertime, value);
+        Obj_SetFloat64(ptr, Properties::Breakertime, value, 0);
         return *this;
     }
 
@@ -18498,13 +18498,13 @@ public:
 
     Relay& action(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::action, value);
+        Obj_SetInt32(ptr, Properties::action, value, 0);
         return *this;
     }
 
     Relay& action(RelayAction value)
     {
-        Obj_SetInt32(ptr, Properties::action, int32_t(value));
+        Obj_SetInt32(ptr, Properties::action, int32_t(value), 0);
         return *this;
     }
 
@@ -18550,7 +18550,7 @@ public:
 
     Relay& Z1mag(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Z1mag, value);
+        Obj_SetFloat64(ptr, Properties::Z1mag, value, 0);
         return *this;
     }
 
@@ -18565,7 +18565,7 @@ public:
 
     Relay& Z1ang(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Z1ang, value);
+        Obj_SetFloat64(ptr, Properties::Z1ang, value, 0);
         return *this;
     }
 
@@ -18580,7 +18580,7 @@ public:
 
     Relay& Z0mag(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Z0mag, value);
+        Obj_SetFloat64(ptr, Properties::Z0mag, value, 0);
         return *this;
     }
 
@@ -18595,7 +18595,7 @@ public:
 
     Relay& Z0ang(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Z0ang, value);
+        Obj_SetFloat64(ptr, Properties::Z0ang, value, 0);
         return *this;
     }
 
@@ -18610,7 +18610,7 @@ public:
 
     Relay& Mphase(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Mphase, value);
+        Obj_SetFloat64(ptr, Properties::Mphase, value, 0);
         return *this;
     }
 
@@ -18625,7 +18625,7 @@ public:
 
     Relay& Mground(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Mground, value);
+        Obj_SetFloat64(ptr, Properties::Mground, value, 0);
         return *this;
     }
 
@@ -18640,7 +18640,7 @@ public:
 
     Relay& EventLog(bool value)
     {
-        Obj_SetInt32(ptr, Properties::EventLog, value);
+        Obj_SetInt32(ptr, Properties::EventLog, value, 0);
         return *this;
     }
 
@@ -18655,7 +18655,7 @@ public:
 
     Relay& DebugTrace(bool value)
     {
-        Obj_SetInt32(ptr, Properties::DebugTrace, value);
+        Obj_SetInt32(ptr, Properties::DebugTrace, value, 0);
         return *this;
     }
 
@@ -18670,7 +18670,7 @@ public:
 
     Relay& DistReverse(bool value)
     {
-        Obj_SetInt32(ptr, Properties::DistReverse, value);
+        Obj_SetInt32(ptr, Properties::DistReverse, value, 0);
         return *this;
     }
 
@@ -18685,13 +18685,13 @@ public:
 
     Relay& Normal(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Normal, value);
+        Obj_SetInt32(ptr, Properties::Normal, value, 0);
         return *this;
     }
 
     Relay& Normal(RelayState value)
     {
-        Obj_SetInt32(ptr, Properties::Normal, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Normal, int32_t(value), 0);
         return *this;
     }
 
@@ -18737,13 +18737,13 @@ public:
 
     Relay& State(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::State, value);
+        Obj_SetInt32(ptr, Properties::State, value, 0);
         return *this;
     }
 
     Relay& State(RelayState value)
     {
-        Obj_SetInt32(ptr, Properties::State, int32_t(value));
+        Obj_SetInt32(ptr, Properties::State, int32_t(value), 0);
         return *this;
     }
 
@@ -18789,7 +18789,7 @@ public:
 
     Relay& DOC_TiltAngleLow(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DOC_TiltAngleLow, value);
+        Obj_SetFloat64(ptr, Properties::DOC_TiltAngleLow, value, 0);
         return *this;
     }
 
@@ -18804,7 +18804,7 @@ public:
 
     Relay& DOC_TiltAngleHigh(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DOC_TiltAngleHigh, value);
+        Obj_SetFloat64(ptr, Properties::DOC_TiltAngleHigh, value, 0);
         return *this;
     }
 
@@ -18819,7 +18819,7 @@ public:
 
     Relay& DOC_TripSettingLow(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DOC_TripSettingLow, value);
+        Obj_SetFloat64(ptr, Properties::DOC_TripSettingLow, value, 0);
         return *this;
     }
 
@@ -18834,7 +18834,7 @@ public:
 
     Relay& DOC_TripSettingHigh(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DOC_TripSettingHigh, value);
+        Obj_SetFloat64(ptr, Properties::DOC_TripSettingHigh, value, 0);
         return *this;
     }
 
@@ -18849,7 +18849,7 @@ public:
 
     Relay& DOC_TripSettingMag(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DOC_TripSettingMag, value);
+        Obj_SetFloat64(ptr, Properties::DOC_TripSettingMag, value, 0);
         return *this;
     }
 
@@ -18864,7 +18864,7 @@ public:
 
     Relay& DOC_DelayInner(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DOC_DelayInner, value);
+        Obj_SetFloat64(ptr, Properties::DOC_DelayInner, value, 0);
         return *this;
     }
 
@@ -18879,7 +18879,7 @@ public:
 
     Relay& DOC_PhaseCurveInner(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DOC_PhaseCurveInner, value);
+        Obj_SetFloat64(ptr, Properties::DOC_PhaseCurveInner, value, 0);
         return *this;
     }
 
@@ -18894,7 +18894,7 @@ public:
 
     Relay& DOC_PhaseTripInner(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DOC_PhaseTripInner, value);
+        Obj_SetFloat64(ptr, Properties::DOC_PhaseTripInner, value, 0);
         return *this;
     }
 
@@ -18945,7 +18945,7 @@ public:
 
     Relay& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -18960,7 +18960,7 @@ public:
 
     Relay& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -19160,7 +19160,7 @@ public:
 
     Recloser& MonitoredTerm(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::MonitoredTerm, value);
+        Obj_SetInt32(ptr, Properties::MonitoredTerm, value, 0);
         return *this;
     }
 
@@ -19211,7 +19211,7 @@ public:
 
     Recloser& SwitchedTerm(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::SwitchedTerm, value);
+        Obj_SetInt32(ptr, Properties::SwitchedTerm, value, 0);
         return *this;
     }
 
@@ -19226,7 +19226,7 @@ public:
 
     Recloser& NumFast(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::NumFast, value);
+        Obj_SetInt32(ptr, Properties::NumFast, value, 0);
         return *this;
     }
 
@@ -19385,7 +19385,7 @@ public:
 
     Recloser& PhaseTrip(double value)
     {
-        Obj_SetFloat64(ptr, Properties::PhaseTrip, value);
+        Obj_SetFloat64(ptr, Properties::PhaseTrip, value, 0);
         return *this;
     }
 
@@ -19400,7 +19400,7 @@ public:
 
     Recloser& GroundTrip(double value)
     {
-        Obj_SetFloat64(ptr, Properties::GroundTrip, value);
+        Obj_SetFloat64(ptr, Properties::GroundTrip, value, 0);
         return *this;
     }
 
@@ -19415,7 +19415,7 @@ public:
 
     Recloser& PhaseInst(double value)
     {
-        Obj_SetFloat64(ptr, Properties::PhaseInst, value);
+        Obj_SetFloat64(ptr, Properties::PhaseInst, value, 0);
         return *this;
     }
 
@@ -19430,7 +19430,7 @@ public:
 
     Recloser& GroundInst(double value)
     {
-        Obj_SetFloat64(ptr, Properties::GroundInst, value);
+        Obj_SetFloat64(ptr, Properties::GroundInst, value, 0);
         return *this;
     }
 
@@ -19445,7 +19445,7 @@ public:
 
     Recloser& Reset(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Reset, value);
+        Obj_SetFloat64(ptr, Properties::Reset, value, 0);
         return *this;
     }
 
@@ -19460,7 +19460,7 @@ public:
 
     Recloser& Shots(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Shots, value);
+        Obj_SetInt32(ptr, Properties::Shots, value, 0);
         return *this;
     }
 
@@ -19490,7 +19490,7 @@ public:
 
     Recloser& Delay(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Delay, value);
+        Obj_SetFloat64(ptr, Properties::Delay, value, 0);
         return *this;
     }
 
@@ -19505,13 +19505,13 @@ public:
 
     Recloser& Action(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Action, value);
+        Obj_SetInt32(ptr, Properties::Action, value, 0);
         return *this;
     }
 
     Recloser& Action(RecloserAction value)
     {
-        Obj_SetInt32(ptr, Properties::Action, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Action, int32_t(value), 0);
         return *this;
     }
 
@@ -19557,7 +19557,7 @@ public:
 
     Recloser& TDPhFast(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TDPhFast, value);
+        Obj_SetFloat64(ptr, Properties::TDPhFast, value, 0);
         return *this;
     }
 
@@ -19572,7 +19572,7 @@ public:
 
     Recloser& TDGrFast(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TDGrFast, value);
+        Obj_SetFloat64(ptr, Properties::TDGrFast, value, 0);
         return *this;
     }
 
@@ -19587,7 +19587,7 @@ public:
 
     Recloser& TDPhDelayed(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TDPhDelayed, value);
+        Obj_SetFloat64(ptr, Properties::TDPhDelayed, value, 0);
         return *this;
     }
 
@@ -19602,7 +19602,7 @@ public:
 
     Recloser& TDGrDelayed(double value)
     {
-        Obj_SetFloat64(ptr, Properties::TDGrDelayed, value);
+        Obj_SetFloat64(ptr, Properties::TDGrDelayed, value, 0);
         return *this;
     }
 
@@ -19617,13 +19617,13 @@ public:
 
     Recloser& Normal(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Normal, value);
+        Obj_SetInt32(ptr, Properties::Normal, value, 0);
         return *this;
     }
 
     Recloser& Normal(RecloserState value)
     {
-        Obj_SetInt32(ptr, Properties::Normal, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Normal, int32_t(value), 0);
         return *this;
     }
 
@@ -19669,13 +19669,13 @@ public:
 
     Recloser& State(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::State, value);
+        Obj_SetInt32(ptr, Properties::State, value, 0);
         return *this;
     }
 
     Recloser& State(RecloserState value)
     {
-        Obj_SetInt32(ptr, Properties::State, int32_t(value));
+        Obj_SetInt32(ptr, Properties::State, int32_t(value), 0);
         return *this;
     }
 
@@ -19721,7 +19721,7 @@ public:
 
     Recloser& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -19736,7 +19736,7 @@ public:
 
     Recloser& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -19920,7 +19920,7 @@ public:
 
     Fuse& MonitoredTerm(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::MonitoredTerm, value);
+        Obj_SetInt32(ptr, Properties::MonitoredTerm, value, 0);
         return *this;
     }
 
@@ -19971,7 +19971,7 @@ public:
 
     Fuse& SwitchedTerm(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::SwitchedTerm, value);
+        Obj_SetInt32(ptr, Properties::SwitchedTerm, value, 0);
         return *this;
     }
 
@@ -20022,7 +20022,7 @@ public:
 
     Fuse& RatedCurrent(double value)
     {
-        Obj_SetFloat64(ptr, Properties::RatedCurrent, value);
+        Obj_SetFloat64(ptr, Properties::RatedCurrent, value, 0);
         return *this;
     }
 
@@ -20037,7 +20037,7 @@ public:
 
     Fuse& Delay(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Delay, value);
+        Obj_SetFloat64(ptr, Properties::Delay, value, 0);
         return *this;
     }
 
@@ -20047,7 +20047,7 @@ public:
     ///
     Fuse& Action(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Action, value);
+        Obj_SetInt32(ptr, Properties::Action, value, 0);
         return *this;
     }
 
@@ -20057,7 +20057,7 @@ public:
     ///
     Fuse& Action(FuseAction value)
     {
-        Obj_SetInt32(ptr, Properties::Action, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Action, int32_t(value), 0);
         return *this;
     }
 
@@ -20164,7 +20164,7 @@ public:
 
     Fuse& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -20179,7 +20179,7 @@ public:
 
     Fuse& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -20361,7 +20361,7 @@ public:
 
     SwtControl& SwitchedTerm(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::SwitchedTerm, value);
+        Obj_SetInt32(ptr, Properties::SwitchedTerm, value, 0);
         return *this;
     }
 
@@ -20376,13 +20376,13 @@ public:
 
     SwtControl& Action(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Action, value);
+        Obj_SetInt32(ptr, Properties::Action, value, 0);
         return *this;
     }
 
     SwtControl& Action(SwtControlAction value)
     {
-        Obj_SetInt32(ptr, Properties::Action, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Action, int32_t(value), 0);
         return *this;
     }
 
@@ -20428,7 +20428,7 @@ public:
 
     SwtControl& Lock(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Lock, value);
+        Obj_SetInt32(ptr, Properties::Lock, value, 0);
         return *this;
     }
 
@@ -20443,7 +20443,7 @@ public:
 
     SwtControl& Delay(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Delay, value);
+        Obj_SetFloat64(ptr, Properties::Delay, value, 0);
         return *this;
     }
 
@@ -20458,13 +20458,13 @@ public:
 
     SwtControl& Normal(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Normal, value);
+        Obj_SetInt32(ptr, Properties::Normal, value, 0);
         return *this;
     }
 
     SwtControl& Normal(SwtControlState value)
     {
-        Obj_SetInt32(ptr, Properties::Normal, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Normal, int32_t(value), 0);
         return *this;
     }
 
@@ -20510,13 +20510,13 @@ public:
 
     SwtControl& State(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::State, value);
+        Obj_SetInt32(ptr, Properties::State, value, 0);
         return *this;
     }
 
     SwtControl& State(SwtControlState value)
     {
-        Obj_SetInt32(ptr, Properties::State, int32_t(value));
+        Obj_SetInt32(ptr, Properties::State, int32_t(value), 0);
         return *this;
     }
 
@@ -20557,7 +20557,7 @@ public:
     ///
     SwtControl& Reset(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Reset, value);
+        Obj_SetInt32(ptr, Properties::Reset, value, 0);
         return *this;
     }
 
@@ -20572,7 +20572,7 @@ public:
 
     SwtControl& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -20587,7 +20587,7 @@ public:
 
     SwtControl& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -20743,7 +20743,7 @@ public:
 
     PVSystem& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -20779,7 +20779,7 @@ public:
 
     PVSystem& kv(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kv, value);
+        Obj_SetFloat64(ptr, Properties::kv, value, 0);
         return *this;
     }
 
@@ -20794,7 +20794,7 @@ public:
 
     PVSystem& irradiance(double value)
     {
-        Obj_SetFloat64(ptr, Properties::irradiance, value);
+        Obj_SetFloat64(ptr, Properties::irradiance, value, 0);
         return *this;
     }
 
@@ -20809,7 +20809,7 @@ public:
 
     PVSystem& Pmpp(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Pmpp, value);
+        Obj_SetFloat64(ptr, Properties::Pmpp, value, 0);
         return *this;
     }
 
@@ -20824,7 +20824,7 @@ public:
 
     PVSystem& pctPmpp(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctPmpp, value);
+        Obj_SetFloat64(ptr, Properties::pctPmpp, value, 0);
         return *this;
     }
 
@@ -20839,7 +20839,7 @@ public:
 
     PVSystem& Temperature(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Temperature, value);
+        Obj_SetFloat64(ptr, Properties::Temperature, value, 0);
         return *this;
     }
 
@@ -20856,7 +20856,7 @@ public:
 
     PVSystem& pf(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pf, value);
+        Obj_SetFloat64(ptr, Properties::pf, value, 0);
         return *this;
     }
 
@@ -20871,13 +20871,13 @@ public:
 
     PVSystem& conn(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::conn, value);
+        Obj_SetInt32(ptr, Properties::conn, value, 0);
         return *this;
     }
 
     PVSystem& conn(Connection value)
     {
-        Obj_SetInt32(ptr, Properties::conn, int32_t(value));
+        Obj_SetInt32(ptr, Properties::conn, int32_t(value), 0);
         return *this;
     }
 
@@ -20923,7 +20923,7 @@ public:
 
     PVSystem& kvar(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvar, value);
+        Obj_SetFloat64(ptr, Properties::kvar, value, 0);
         return *this;
     }
 
@@ -20938,7 +20938,7 @@ public:
 
     PVSystem& kVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kVA, value);
+        Obj_SetFloat64(ptr, Properties::kVA, value, 0);
         return *this;
     }
 
@@ -20953,7 +20953,7 @@ public:
 
     PVSystem& pctCutin(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctCutin, value);
+        Obj_SetFloat64(ptr, Properties::pctCutin, value, 0);
         return *this;
     }
 
@@ -20968,7 +20968,7 @@ public:
 
     PVSystem& pctCutout(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctCutout, value);
+        Obj_SetFloat64(ptr, Properties::pctCutout, value, 0);
         return *this;
     }
 
@@ -21055,7 +21055,7 @@ public:
 
     PVSystem& pctR(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctR, value);
+        Obj_SetFloat64(ptr, Properties::pctR, value, 0);
         return *this;
     }
 
@@ -21070,7 +21070,7 @@ public:
 
     PVSystem& pctX(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctX, value);
+        Obj_SetFloat64(ptr, Properties::pctX, value, 0);
         return *this;
     }
 
@@ -21089,7 +21089,7 @@ public:
 
     PVSystem& model(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::model, value);
+        Obj_SetInt32(ptr, Properties::model, value, 0);
         return *this;
     }
 
@@ -21104,7 +21104,7 @@ public:
 
     PVSystem& Vminpu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vminpu, value);
+        Obj_SetFloat64(ptr, Properties::Vminpu, value, 0);
         return *this;
     }
 
@@ -21119,7 +21119,7 @@ public:
 
     PVSystem& Vmaxpu(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vmaxpu, value);
+        Obj_SetFloat64(ptr, Properties::Vmaxpu, value, 0);
         return *this;
     }
 
@@ -21134,7 +21134,7 @@ public:
 
     PVSystem& Balanced(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Balanced, value);
+        Obj_SetInt32(ptr, Properties::Balanced, value, 0);
         return *this;
     }
 
@@ -21149,7 +21149,7 @@ public:
 
     PVSystem& LimitCurrent(bool value)
     {
-        Obj_SetInt32(ptr, Properties::LimitCurrent, value);
+        Obj_SetInt32(ptr, Properties::LimitCurrent, value, 0);
         return *this;
     }
 
@@ -21380,7 +21380,7 @@ public:
 
     PVSystem& cls(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::cls, value);
+        Obj_SetInt32(ptr, Properties::cls, value, 0);
         return *this;
     }
 
@@ -21437,7 +21437,7 @@ public:
 
     PVSystem& debugtrace(bool value)
     {
-        Obj_SetInt32(ptr, Properties::debugtrace, value);
+        Obj_SetInt32(ptr, Properties::debugtrace, value, 0);
         return *this;
     }
 
@@ -21452,7 +21452,7 @@ public:
 
     PVSystem& VarFollowInverter(bool value)
     {
-        Obj_SetInt32(ptr, Properties::VarFollowInverter, value);
+        Obj_SetInt32(ptr, Properties::VarFollowInverter, value, 0);
         return *this;
     }
 
@@ -21467,7 +21467,7 @@ public:
 
     PVSystem& DutyStart(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DutyStart, value);
+        Obj_SetFloat64(ptr, Properties::DutyStart, value, 0);
         return *this;
     }
 
@@ -21482,7 +21482,7 @@ public:
 
     PVSystem& WattPriority(bool value)
     {
-        Obj_SetInt32(ptr, Properties::WattPriority, value);
+        Obj_SetInt32(ptr, Properties::WattPriority, value, 0);
         return *this;
     }
 
@@ -21497,7 +21497,7 @@ public:
 
     PVSystem& PFPriority(bool value)
     {
-        Obj_SetInt32(ptr, Properties::PFPriority, value);
+        Obj_SetInt32(ptr, Properties::PFPriority, value, 0);
         return *this;
     }
 
@@ -21512,7 +21512,7 @@ public:
 
     PVSystem& pctPminNoVars(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctPminNoVars, value);
+        Obj_SetFloat64(ptr, Properties::pctPminNoVars, value, 0);
         return *this;
     }
 
@@ -21527,7 +21527,7 @@ public:
 
     PVSystem& pctPminkvarMax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctPminkvarMax, value);
+        Obj_SetFloat64(ptr, Properties::pctPminkvarMax, value, 0);
         return *this;
     }
 
@@ -21542,7 +21542,7 @@ public:
 
     PVSystem& kvarMax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvarMax, value);
+        Obj_SetFloat64(ptr, Properties::kvarMax, value, 0);
         return *this;
     }
 
@@ -21557,7 +21557,7 @@ public:
 
     PVSystem& kvarMaxAbs(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvarMaxAbs, value);
+        Obj_SetFloat64(ptr, Properties::kvarMaxAbs, value, 0);
         return *this;
     }
 
@@ -21608,7 +21608,7 @@ public:
 
     PVSystem& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -21623,7 +21623,7 @@ public:
 
     PVSystem& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -21803,7 +21803,7 @@ public:
 
     UPFC& refkv(double value)
     {
-        Obj_SetFloat64(ptr, Properties::refkv, value);
+        Obj_SetFloat64(ptr, Properties::refkv, value, 0);
         return *this;
     }
 
@@ -21818,7 +21818,7 @@ public:
 
     UPFC& pf(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pf, value);
+        Obj_SetFloat64(ptr, Properties::pf, value, 0);
         return *this;
     }
 
@@ -21833,7 +21833,7 @@ public:
 
     UPFC& frequency(double value)
     {
-        Obj_SetFloat64(ptr, Properties::frequency, value);
+        Obj_SetFloat64(ptr, Properties::frequency, value, 0);
         return *this;
     }
 
@@ -21848,7 +21848,7 @@ public:
 
     UPFC& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -21863,7 +21863,7 @@ public:
 
     UPFC& Xs(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xs, value);
+        Obj_SetFloat64(ptr, Properties::Xs, value, 0);
         return *this;
     }
 
@@ -21879,7 +21879,7 @@ public:
 
     UPFC& Tol1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Tol1, value);
+        Obj_SetFloat64(ptr, Properties::Tol1, value, 0);
         return *this;
     }
 
@@ -21901,7 +21901,7 @@ public:
 
     UPFC& Mode(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Mode, value);
+        Obj_SetInt32(ptr, Properties::Mode, value, 0);
         return *this;
     }
 
@@ -21916,7 +21916,7 @@ public:
 
     UPFC& VpqMax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::VpqMax, value);
+        Obj_SetFloat64(ptr, Properties::VpqMax, value, 0);
         return *this;
     }
 
@@ -21967,7 +21967,7 @@ public:
 
     UPFC& VHLimit(double value)
     {
-        Obj_SetFloat64(ptr, Properties::VHLimit, value);
+        Obj_SetFloat64(ptr, Properties::VHLimit, value, 0);
         return *this;
     }
 
@@ -21982,7 +21982,7 @@ public:
 
     UPFC& VLLimit(double value)
     {
-        Obj_SetFloat64(ptr, Properties::VLLimit, value);
+        Obj_SetFloat64(ptr, Properties::VLLimit, value, 0);
         return *this;
     }
 
@@ -21997,7 +21997,7 @@ public:
 
     UPFC& CLimit(double value)
     {
-        Obj_SetFloat64(ptr, Properties::CLimit, value);
+        Obj_SetFloat64(ptr, Properties::CLimit, value, 0);
         return *this;
     }
 
@@ -22014,7 +22014,7 @@ public:
 
     UPFC& refkv2(double value)
     {
-        Obj_SetFloat64(ptr, Properties::refkv2, value);
+        Obj_SetFloat64(ptr, Properties::refkv2, value, 0);
         return *this;
     }
 
@@ -22029,7 +22029,7 @@ public:
 
     UPFC& kvarLimit(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvarLimit, value);
+        Obj_SetFloat64(ptr, Properties::kvarLimit, value, 0);
         return *this;
     }
 
@@ -22080,7 +22080,7 @@ public:
 
     UPFC& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -22095,7 +22095,7 @@ public:
 
     UPFC& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -22226,7 +22226,7 @@ public:
 
     UPFCControl& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -22241,7 +22241,7 @@ public:
 
     UPFCControl& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -22416,7 +22416,7 @@ public:
 
     ESPVLControl& Terminal(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Terminal, value);
+        Obj_SetInt32(ptr, Properties::Terminal, value, 0);
         return *this;
     }
 
@@ -22431,13 +22431,13 @@ public:
 
     ESPVLControl& Type(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Type, value);
+        Obj_SetInt32(ptr, Properties::Type, value, 0);
         return *this;
     }
 
     ESPVLControl& Type(ESPVLControlType value)
     {
-        Obj_SetInt32(ptr, Properties::Type, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Type, int32_t(value), 0);
         return *this;
     }
 
@@ -22483,7 +22483,7 @@ public:
 
     ESPVLControl& kWBand(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kWBand, value);
+        Obj_SetFloat64(ptr, Properties::kWBand, value, 0);
         return *this;
     }
 
@@ -22498,7 +22498,7 @@ public:
 
     ESPVLControl& kvarlimit(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvarlimit, value);
+        Obj_SetFloat64(ptr, Properties::kvarlimit, value, 0);
         return *this;
     }
 
@@ -22603,7 +22603,7 @@ public:
 
     ESPVLControl& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -22618,7 +22618,7 @@ public:
 
     ESPVLControl& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -22768,7 +22768,7 @@ public:
 
     IndMach012& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -22804,7 +22804,7 @@ public:
 
     IndMach012& kv(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kv, value);
+        Obj_SetFloat64(ptr, Properties::kv, value, 0);
         return *this;
     }
 
@@ -22820,7 +22820,7 @@ public:
 
     IndMach012& kW(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kW, value);
+        Obj_SetFloat64(ptr, Properties::kW, value, 0);
         return *this;
     }
 
@@ -22835,7 +22835,7 @@ public:
 
     IndMach012& pf(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pf, value);
+        Obj_SetFloat64(ptr, Properties::pf, value, 0);
         return *this;
     }
 
@@ -22850,13 +22850,13 @@ public:
 
     IndMach012& conn(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::conn, value);
+        Obj_SetInt32(ptr, Properties::conn, value, 0);
         return *this;
     }
 
     IndMach012& conn(Connection value)
     {
-        Obj_SetInt32(ptr, Properties::conn, int32_t(value));
+        Obj_SetInt32(ptr, Properties::conn, int32_t(value), 0);
         return *this;
     }
 
@@ -22902,7 +22902,7 @@ public:
 
     IndMach012& kVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kVA, value);
+        Obj_SetFloat64(ptr, Properties::kVA, value, 0);
         return *this;
     }
 
@@ -22917,7 +22917,7 @@ public:
 
     IndMach012& H(double value)
     {
-        Obj_SetFloat64(ptr, Properties::H, value);
+        Obj_SetFloat64(ptr, Properties::H, value, 0);
         return *this;
     }
 
@@ -22932,7 +22932,7 @@ public:
 
     IndMach012& D(double value)
     {
-        Obj_SetFloat64(ptr, Properties::D, value);
+        Obj_SetFloat64(ptr, Properties::D, value, 0);
         return *this;
     }
 
@@ -22947,7 +22947,7 @@ public:
 
     IndMach012& puRs(double value)
     {
-        Obj_SetFloat64(ptr, Properties::puRs, value);
+        Obj_SetFloat64(ptr, Properties::puRs, value, 0);
         return *this;
     }
 
@@ -22962,7 +22962,7 @@ public:
 
     IndMach012& puXs(double value)
     {
-        Obj_SetFloat64(ptr, Properties::puXs, value);
+        Obj_SetFloat64(ptr, Properties::puXs, value, 0);
         return *this;
     }
 
@@ -22977,7 +22977,7 @@ public:
 
     IndMach012& puRr(double value)
     {
-        Obj_SetFloat64(ptr, Properties::puRr, value);
+        Obj_SetFloat64(ptr, Properties::puRr, value, 0);
         return *this;
     }
 
@@ -22992,7 +22992,7 @@ public:
 
     IndMach012& puXr(double value)
     {
-        Obj_SetFloat64(ptr, Properties::puXr, value);
+        Obj_SetFloat64(ptr, Properties::puXr, value, 0);
         return *this;
     }
 
@@ -23007,7 +23007,7 @@ public:
 
     IndMach012& puXm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::puXm, value);
+        Obj_SetFloat64(ptr, Properties::puXm, value, 0);
         return *this;
     }
 
@@ -23022,7 +23022,7 @@ public:
 
     IndMach012& Slip(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Slip, value);
+        Obj_SetFloat64(ptr, Properties::Slip, value, 0);
         return *this;
     }
 
@@ -23037,7 +23037,7 @@ public:
 
     IndMach012& MaxSlip(double value)
     {
-        Obj_SetFloat64(ptr, Properties::MaxSlip, value);
+        Obj_SetFloat64(ptr, Properties::MaxSlip, value, 0);
         return *this;
     }
 
@@ -23052,13 +23052,13 @@ public:
 
     IndMach012& SlipOption(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::SlipOption, value);
+        Obj_SetInt32(ptr, Properties::SlipOption, value, 0);
         return *this;
     }
 
     IndMach012& SlipOption(IndMach012SlipOption value)
     {
-        Obj_SetInt32(ptr, Properties::SlipOption, int32_t(value));
+        Obj_SetInt32(ptr, Properties::SlipOption, int32_t(value), 0);
         return *this;
     }
 
@@ -23212,7 +23212,7 @@ public:
 
     IndMach012& Debugtrace(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Debugtrace, value);
+        Obj_SetInt32(ptr, Properties::Debugtrace, value, 0);
         return *this;
     }
 
@@ -23263,7 +23263,7 @@ public:
 
     IndMach012& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -23278,7 +23278,7 @@ public:
 
     IndMach012& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -23412,7 +23412,7 @@ public:
 
     GICsource& Volts(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Volts, value);
+        Obj_SetFloat64(ptr, Properties::Volts, value, 0);
         return *this;
     }
 
@@ -23427,7 +23427,7 @@ public:
 
     GICsource& angle(double value)
     {
-        Obj_SetFloat64(ptr, Properties::angle, value);
+        Obj_SetFloat64(ptr, Properties::angle, value, 0);
         return *this;
     }
 
@@ -23442,7 +23442,7 @@ public:
 
     GICsource& frequency(double value)
     {
-        Obj_SetFloat64(ptr, Properties::frequency, value);
+        Obj_SetFloat64(ptr, Properties::frequency, value, 0);
         return *this;
     }
 
@@ -23457,7 +23457,7 @@ public:
 
     GICsource& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -23472,7 +23472,7 @@ public:
 
     GICsource& EN(double value)
     {
-        Obj_SetFloat64(ptr, Properties::EN, value);
+        Obj_SetFloat64(ptr, Properties::EN, value, 0);
         return *this;
     }
 
@@ -23487,7 +23487,7 @@ public:
 
     GICsource& EE(double value)
     {
-        Obj_SetFloat64(ptr, Properties::EE, value);
+        Obj_SetFloat64(ptr, Properties::EE, value, 0);
         return *this;
     }
 
@@ -23502,7 +23502,7 @@ public:
 
     GICsource& Lat1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Lat1, value);
+        Obj_SetFloat64(ptr, Properties::Lat1, value, 0);
         return *this;
     }
 
@@ -23517,7 +23517,7 @@ public:
 
     GICsource& Lon1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Lon1, value);
+        Obj_SetFloat64(ptr, Properties::Lon1, value, 0);
         return *this;
     }
 
@@ -23532,7 +23532,7 @@ public:
 
     GICsource& Lat2(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Lat2, value);
+        Obj_SetFloat64(ptr, Properties::Lat2, value, 0);
         return *this;
     }
 
@@ -23547,7 +23547,7 @@ public:
 
     GICsource& Lon2(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Lon2, value);
+        Obj_SetFloat64(ptr, Properties::Lon2, value, 0);
         return *this;
     }
 
@@ -23598,7 +23598,7 @@ public:
 
     GICsource& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -23613,7 +23613,7 @@ public:
 
     GICsource& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -23790,7 +23790,7 @@ public:
 
     AutoTrans& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -23805,7 +23805,7 @@ public:
 
     AutoTrans& windings(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::windings, value);
+        Obj_SetInt32(ptr, Properties::windings, value, 0);
         return *this;
     }
 
@@ -23820,7 +23820,7 @@ public:
 
     AutoTrans& wdg(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::wdg, value);
+        Obj_SetInt32(ptr, Properties::wdg, value, 0);
         return *this;
     }
 
@@ -23965,13 +23965,13 @@ public:
 
     AutoTrans& Core(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Core, value);
+        Obj_SetInt32(ptr, Properties::Core, value, 0);
         return *this;
     }
 
     AutoTrans& Core(CoreType value)
     {
-        Obj_SetInt32(ptr, Properties::Core, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Core, int32_t(value), 0);
         return *this;
     }
 
@@ -24125,7 +24125,7 @@ public:
 
     AutoTrans& XHX(double value)
     {
-        Obj_SetFloat64(ptr, Properties::XHX, value);
+        Obj_SetFloat64(ptr, Properties::XHX, value, 0);
         return *this;
     }
 
@@ -24140,7 +24140,7 @@ public:
 
     AutoTrans& XHT(double value)
     {
-        Obj_SetFloat64(ptr, Properties::XHT, value);
+        Obj_SetFloat64(ptr, Properties::XHT, value, 0);
         return *this;
     }
 
@@ -24155,7 +24155,7 @@ public:
 
     AutoTrans& XXT(double value)
     {
-        Obj_SetFloat64(ptr, Properties::XXT, value);
+        Obj_SetFloat64(ptr, Properties::XXT, value, 0);
         return *this;
     }
 
@@ -24189,7 +24189,7 @@ public:
 
     AutoTrans& thermal(double value)
     {
-        Obj_SetFloat64(ptr, Properties::thermal, value);
+        Obj_SetFloat64(ptr, Properties::thermal, value, 0);
         return *this;
     }
 
@@ -24204,7 +24204,7 @@ public:
 
     AutoTrans& n(double value)
     {
-        Obj_SetFloat64(ptr, Properties::n, value);
+        Obj_SetFloat64(ptr, Properties::n, value, 0);
         return *this;
     }
 
@@ -24219,7 +24219,7 @@ public:
 
     AutoTrans& m(double value)
     {
-        Obj_SetFloat64(ptr, Properties::m, value);
+        Obj_SetFloat64(ptr, Properties::m, value, 0);
         return *this;
     }
 
@@ -24234,7 +24234,7 @@ public:
 
     AutoTrans& flrise(double value)
     {
-        Obj_SetFloat64(ptr, Properties::flrise, value);
+        Obj_SetFloat64(ptr, Properties::flrise, value, 0);
         return *this;
     }
 
@@ -24249,7 +24249,7 @@ public:
 
     AutoTrans& hsrise(double value)
     {
-        Obj_SetFloat64(ptr, Properties::hsrise, value);
+        Obj_SetFloat64(ptr, Properties::hsrise, value, 0);
         return *this;
     }
 
@@ -24264,7 +24264,7 @@ public:
 
     AutoTrans& pctloadloss(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctloadloss, value);
+        Obj_SetFloat64(ptr, Properties::pctloadloss, value, 0);
         return *this;
     }
 
@@ -24279,7 +24279,7 @@ public:
 
     AutoTrans& pctnoloadloss(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctnoloadloss, value);
+        Obj_SetFloat64(ptr, Properties::pctnoloadloss, value, 0);
         return *this;
     }
 
@@ -24294,7 +24294,7 @@ public:
 
     AutoTrans& normhkVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normhkVA, value);
+        Obj_SetFloat64(ptr, Properties::normhkVA, value, 0);
         return *this;
     }
 
@@ -24309,7 +24309,7 @@ public:
 
     AutoTrans& emerghkVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emerghkVA, value);
+        Obj_SetFloat64(ptr, Properties::emerghkVA, value, 0);
         return *this;
     }
 
@@ -24324,7 +24324,7 @@ public:
 
     AutoTrans& sub(bool value)
     {
-        Obj_SetInt32(ptr, Properties::sub, value);
+        Obj_SetInt32(ptr, Properties::sub, value, 0);
         return *this;
     }
 
@@ -24405,7 +24405,7 @@ public:
 
     AutoTrans& pctimag(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctimag, value);
+        Obj_SetFloat64(ptr, Properties::pctimag, value, 0);
         return *this;
     }
 
@@ -24420,7 +24420,7 @@ public:
 
     AutoTrans& ppm_antifloat(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ppm_antifloat, value);
+        Obj_SetFloat64(ptr, Properties::ppm_antifloat, value, 0);
         return *this;
     }
 
@@ -24452,7 +24452,7 @@ public:
 
     AutoTrans& XRConst(bool value)
     {
-        Obj_SetInt32(ptr, Properties::XRConst, value);
+        Obj_SetInt32(ptr, Properties::XRConst, value, 0);
         return *this;
     }
 
@@ -24467,13 +24467,13 @@ public:
 
     AutoTrans& LeadLag(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::LeadLag, value);
+        Obj_SetInt32(ptr, Properties::LeadLag, value, 0);
         return *this;
     }
 
     AutoTrans& LeadLag(PhaseSequence value)
     {
-        Obj_SetInt32(ptr, Properties::LeadLag, int32_t(value));
+        Obj_SetInt32(ptr, Properties::LeadLag, int32_t(value), 0);
         return *this;
     }
 
@@ -24530,7 +24530,7 @@ public:
 
     AutoTrans& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -24545,7 +24545,7 @@ public:
 
     AutoTrans& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -24560,7 +24560,7 @@ public:
 
     AutoTrans& faultrate(double value)
     {
-        Obj_SetFloat64(ptr, Properties::faultrate, value);
+        Obj_SetFloat64(ptr, Properties::faultrate, value, 0);
         return *this;
     }
 
@@ -24575,7 +24575,7 @@ public:
 
     AutoTrans& pctperm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctperm, value);
+        Obj_SetFloat64(ptr, Properties::pctperm, value, 0);
         return *this;
     }
 
@@ -24590,7 +24590,7 @@ public:
 
     AutoTrans& repair(double value)
     {
-        Obj_SetFloat64(ptr, Properties::repair, value);
+        Obj_SetFloat64(ptr, Properties::repair, value, 0);
         return *this;
     }
 
@@ -24605,7 +24605,7 @@ public:
 
     AutoTrans& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -24620,7 +24620,7 @@ public:
 
     AutoTrans& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -24820,7 +24820,7 @@ public:
 
     RegControl& winding(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::winding, value);
+        Obj_SetInt32(ptr, Properties::winding, value, 0);
         return *this;
     }
 
@@ -24835,7 +24835,7 @@ public:
 
     RegControl& vreg(double value)
     {
-        Obj_SetFloat64(ptr, Properties::vreg, value);
+        Obj_SetFloat64(ptr, Properties::vreg, value, 0);
         return *this;
     }
 
@@ -24850,7 +24850,7 @@ public:
 
     RegControl& band(double value)
     {
-        Obj_SetFloat64(ptr, Properties::band, value);
+        Obj_SetFloat64(ptr, Properties::band, value, 0);
         return *this;
     }
 
@@ -24865,7 +24865,7 @@ public:
 
     RegControl& ptratio(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ptratio, value);
+        Obj_SetFloat64(ptr, Properties::ptratio, value, 0);
         return *this;
     }
 
@@ -24880,7 +24880,7 @@ public:
 
     RegControl& CTprim(double value)
     {
-        Obj_SetFloat64(ptr, Properties::CTprim, value);
+        Obj_SetFloat64(ptr, Properties::CTprim, value, 0);
         return *this;
     }
 
@@ -24895,7 +24895,7 @@ public:
 
     RegControl& R(double value)
     {
-        Obj_SetFloat64(ptr, Properties::R, value);
+        Obj_SetFloat64(ptr, Properties::R, value, 0);
         return *this;
     }
 
@@ -24910,7 +24910,7 @@ public:
 
     RegControl& X(double value)
     {
-        Obj_SetFloat64(ptr, Properties::X, value);
+        Obj_SetFloat64(ptr, Properties::X, value, 0);
         return *this;
     }
 
@@ -24946,7 +24946,7 @@ public:
 
     RegControl& delay(double value)
     {
-        Obj_SetFloat64(ptr, Properties::delay, value);
+        Obj_SetFloat64(ptr, Properties::delay, value, 0);
         return *this;
     }
 
@@ -24961,7 +24961,7 @@ public:
 
     RegControl& reversible(bool value)
     {
-        Obj_SetInt32(ptr, Properties::reversible, value);
+        Obj_SetInt32(ptr, Properties::reversible, value, 0);
         return *this;
     }
 
@@ -24976,7 +24976,7 @@ public:
 
     RegControl& revvreg(double value)
     {
-        Obj_SetFloat64(ptr, Properties::revvreg, value);
+        Obj_SetFloat64(ptr, Properties::revvreg, value, 0);
         return *this;
     }
 
@@ -24991,7 +24991,7 @@ public:
 
     RegControl& revband(double value)
     {
-        Obj_SetFloat64(ptr, Properties::revband, value);
+        Obj_SetFloat64(ptr, Properties::revband, value, 0);
         return *this;
     }
 
@@ -25006,7 +25006,7 @@ public:
 
     RegControl& revR(double value)
     {
-        Obj_SetFloat64(ptr, Properties::revR, value);
+        Obj_SetFloat64(ptr, Properties::revR, value, 0);
         return *this;
     }
 
@@ -25021,7 +25021,7 @@ public:
 
     RegControl& revX(double value)
     {
-        Obj_SetFloat64(ptr, Properties::revX, value);
+        Obj_SetFloat64(ptr, Properties::revX, value, 0);
         return *this;
     }
 
@@ -25036,7 +25036,7 @@ public:
 
     RegControl& tapdelay(double value)
     {
-        Obj_SetFloat64(ptr, Properties::tapdelay, value);
+        Obj_SetFloat64(ptr, Properties::tapdelay, value, 0);
         return *this;
     }
 
@@ -25051,7 +25051,7 @@ public:
 
     RegControl& debugtrace(bool value)
     {
-        Obj_SetInt32(ptr, Properties::debugtrace, value);
+        Obj_SetInt32(ptr, Properties::debugtrace, value, 0);
         return *this;
     }
 
@@ -25070,7 +25070,7 @@ public:
 
     RegControl& maxtapchange(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::maxtapchange, value);
+        Obj_SetInt32(ptr, Properties::maxtapchange, value, 0);
         return *this;
     }
 
@@ -25085,7 +25085,7 @@ public:
 
     RegControl& inversetime(bool value)
     {
-        Obj_SetInt32(ptr, Properties::inversetime, value);
+        Obj_SetInt32(ptr, Properties::inversetime, value, 0);
         return *this;
     }
 
@@ -25100,7 +25100,7 @@ public:
 
     RegControl& tapwinding(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::tapwinding, value);
+        Obj_SetInt32(ptr, Properties::tapwinding, value, 0);
         return *this;
     }
 
@@ -25115,7 +25115,7 @@ public:
 
     RegControl& vlimit(double value)
     {
-        Obj_SetFloat64(ptr, Properties::vlimit, value);
+        Obj_SetFloat64(ptr, Properties::vlimit, value, 0);
         return *this;
     }
 
@@ -25130,13 +25130,13 @@ public:
 
     RegControl& PTphase(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::PTphase, value);
+        Obj_SetInt32(ptr, Properties::PTphase, value, 0);
         return *this;
     }
 
     RegControl& PTphase(RegControlPhaseSelection value)
     {
-        Obj_SetInt32(ptr, Properties::PTphase, int32_t(value));
+        Obj_SetInt32(ptr, Properties::PTphase, int32_t(value), 0);
         return *this;
     }
 
@@ -25182,7 +25182,7 @@ public:
 
     RegControl& revThreshold(double value)
     {
-        Obj_SetFloat64(ptr, Properties::revThreshold, value);
+        Obj_SetFloat64(ptr, Properties::revThreshold, value, 0);
         return *this;
     }
 
@@ -25197,7 +25197,7 @@ public:
 
     RegControl& revDelay(double value)
     {
-        Obj_SetFloat64(ptr, Properties::revDelay, value);
+        Obj_SetFloat64(ptr, Properties::revDelay, value, 0);
         return *this;
     }
 
@@ -25212,7 +25212,7 @@ public:
 
     RegControl& revNeutral(bool value)
     {
-        Obj_SetInt32(ptr, Properties::revNeutral, value);
+        Obj_SetInt32(ptr, Properties::revNeutral, value, 0);
         return *this;
     }
 
@@ -25227,7 +25227,7 @@ public:
 
     RegControl& EventLog(bool value)
     {
-        Obj_SetInt32(ptr, Properties::EventLog, value);
+        Obj_SetInt32(ptr, Properties::EventLog, value, 0);
         return *this;
     }
 
@@ -25242,7 +25242,7 @@ public:
 
     RegControl& RemotePTRatio(double value)
     {
-        Obj_SetFloat64(ptr, Properties::RemotePTRatio, value);
+        Obj_SetFloat64(ptr, Properties::RemotePTRatio, value, 0);
         return *this;
     }
 
@@ -25257,7 +25257,7 @@ public:
 
     RegControl& TapNum(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::TapNum, value);
+        Obj_SetInt32(ptr, Properties::TapNum, value, 0);
         return *this;
     }
 
@@ -25267,7 +25267,7 @@ public:
     ///
     RegControl& Reset(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Reset, value);
+        Obj_SetInt32(ptr, Properties::Reset, value, 0);
         return *this;
     }
 
@@ -25282,7 +25282,7 @@ public:
 
     RegControl& LDC_Z(double value)
     {
-        Obj_SetFloat64(ptr, Properties::LDC_Z, value);
+        Obj_SetFloat64(ptr, Properties::LDC_Z, value, 0);
         return *this;
     }
 
@@ -25297,7 +25297,7 @@ public:
 
     RegControl& rev_Z(double value)
     {
-        Obj_SetFloat64(ptr, Properties::rev_Z, value);
+        Obj_SetFloat64(ptr, Properties::rev_Z, value, 0);
         return *this;
     }
 
@@ -25312,7 +25312,7 @@ public:
 
     RegControl& Cogen(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Cogen, value);
+        Obj_SetInt32(ptr, Properties::Cogen, value, 0);
         return *this;
     }
 
@@ -25327,7 +25327,7 @@ public:
 
     RegControl& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -25342,7 +25342,7 @@ public:
 
     RegControl& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -25590,13 +25590,13 @@ public:
 
     InvControl& Mode(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Mode, value);
+        Obj_SetInt32(ptr, Properties::Mode, value, 0);
         return *this;
     }
 
     InvControl& Mode(InvControlControlMode value)
     {
-        Obj_SetInt32(ptr, Properties::Mode, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Mode, int32_t(value), 0);
         return *this;
     }
 
@@ -25675,13 +25675,13 @@ public:
 
     InvControl& CombiMode(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::CombiMode, value);
+        Obj_SetInt32(ptr, Properties::CombiMode, value, 0);
         return *this;
     }
 
     InvControl& CombiMode(InvControlCombiMode value)
     {
-        Obj_SetInt32(ptr, Properties::CombiMode, int32_t(value));
+        Obj_SetInt32(ptr, Properties::CombiMode, int32_t(value), 0);
         return *this;
     }
 
@@ -25797,7 +25797,7 @@ public:
 
     InvControl& hysteresis_offset(double value)
     {
-        Obj_SetFloat64(ptr, Properties::hysteresis_offset, value);
+        Obj_SetFloat64(ptr, Properties::hysteresis_offset, value, 0);
         return *this;
     }
 
@@ -25822,13 +25822,13 @@ public:
 
     InvControl& voltage_curvex_ref(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::voltage_curvex_ref, value);
+        Obj_SetInt32(ptr, Properties::voltage_curvex_ref, value, 0);
         return *this;
     }
 
     InvControl& voltage_curvex_ref(InvControlVoltageCurveXRef value)
     {
-        Obj_SetInt32(ptr, Properties::voltage_curvex_ref, int32_t(value));
+        Obj_SetInt32(ptr, Properties::voltage_curvex_ref, int32_t(value), 0);
         return *this;
     }
 
@@ -25902,7 +25902,7 @@ public:
 
     InvControl& avgwindowlen(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::avgwindowlen, value);
+        Obj_SetInt32(ptr, Properties::avgwindowlen, value, 0);
         return *this;
     }
 
@@ -25967,7 +25967,7 @@ public:
 
     InvControl& DbVMin(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DbVMin, value);
+        Obj_SetFloat64(ptr, Properties::DbVMin, value, 0);
         return *this;
     }
 
@@ -25984,7 +25984,7 @@ public:
 
     InvControl& DbVMax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DbVMax, value);
+        Obj_SetFloat64(ptr, Properties::DbVMax, value, 0);
         return *this;
     }
 
@@ -26005,7 +26005,7 @@ public:
 
     InvControl& ArGraLowV(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ArGraLowV, value);
+        Obj_SetFloat64(ptr, Properties::ArGraLowV, value, 0);
         return *this;
     }
 
@@ -26026,7 +26026,7 @@ public:
 
     InvControl& ArGraHiV(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ArGraHiV, value);
+        Obj_SetFloat64(ptr, Properties::ArGraHiV, value, 0);
         return *this;
     }
 
@@ -26049,7 +26049,7 @@ public:
 
     InvControl& DynReacavgwindowlen(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::DynReacavgwindowlen, value);
+        Obj_SetInt32(ptr, Properties::DynReacavgwindowlen, value, 0);
         return *this;
     }
 
@@ -26073,7 +26073,7 @@ public:
 
     InvControl& deltaQ_Factor(double value)
     {
-        Obj_SetFloat64(ptr, Properties::deltaQ_Factor, value);
+        Obj_SetFloat64(ptr, Properties::deltaQ_Factor, value, 0);
         return *this;
     }
 
@@ -26094,7 +26094,7 @@ public:
 
     InvControl& VoltageChangeTolerance(double value)
     {
-        Obj_SetFloat64(ptr, Properties::VoltageChangeTolerance, value);
+        Obj_SetFloat64(ptr, Properties::VoltageChangeTolerance, value, 0);
         return *this;
     }
 
@@ -26115,7 +26115,7 @@ public:
 
     InvControl& VarChangeTolerance(double value)
     {
-        Obj_SetFloat64(ptr, Properties::VarChangeTolerance, value);
+        Obj_SetFloat64(ptr, Properties::VarChangeTolerance, value, 0);
         return *this;
     }
 
@@ -26140,13 +26140,13 @@ public:
 
     InvControl& VoltwattYAxis(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::VoltwattYAxis, value);
+        Obj_SetInt32(ptr, Properties::VoltwattYAxis, value, 0);
         return *this;
     }
 
     InvControl& VoltwattYAxis(InvControlVoltWattYAxis value)
     {
-        Obj_SetInt32(ptr, Properties::VoltwattYAxis, int32_t(value));
+        Obj_SetInt32(ptr, Properties::VoltwattYAxis, int32_t(value), 0);
         return *this;
     }
 
@@ -26220,13 +26220,13 @@ public:
 
     InvControl& RateofChangeMode(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::RateofChangeMode, value);
+        Obj_SetInt32(ptr, Properties::RateofChangeMode, value, 0);
         return *this;
     }
 
     InvControl& RateofChangeMode(InvControlRateOfChangeMode value)
     {
-        Obj_SetInt32(ptr, Properties::RateofChangeMode, int32_t(value));
+        Obj_SetInt32(ptr, Properties::RateofChangeMode, int32_t(value), 0);
         return *this;
     }
 
@@ -26290,7 +26290,7 @@ public:
 
     InvControl& LPFTau(double value)
     {
-        Obj_SetFloat64(ptr, Properties::LPFTau, value);
+        Obj_SetFloat64(ptr, Properties::LPFTau, value, 0);
         return *this;
     }
 
@@ -26307,7 +26307,7 @@ public:
 
     InvControl& RiseFallLimit(double value)
     {
-        Obj_SetFloat64(ptr, Properties::RiseFallLimit, value);
+        Obj_SetFloat64(ptr, Properties::RiseFallLimit, value, 0);
         return *this;
     }
 
@@ -26331,7 +26331,7 @@ public:
 
     InvControl& deltaP_Factor(double value)
     {
-        Obj_SetFloat64(ptr, Properties::deltaP_Factor, value);
+        Obj_SetFloat64(ptr, Properties::deltaP_Factor, value, 0);
         return *this;
     }
 
@@ -26346,7 +26346,7 @@ public:
 
     InvControl& EventLog(bool value)
     {
-        Obj_SetInt32(ptr, Properties::EventLog, value);
+        Obj_SetInt32(ptr, Properties::EventLog, value, 0);
         return *this;
     }
 
@@ -26367,13 +26367,13 @@ public:
 
     InvControl& RefReactivePower(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::RefReactivePower, value);
+        Obj_SetInt32(ptr, Properties::RefReactivePower, value, 0);
         return *this;
     }
 
     InvControl& RefReactivePower(InvControlReactivePowerReference value)
     {
-        Obj_SetInt32(ptr, Properties::RefReactivePower, int32_t(value));
+        Obj_SetInt32(ptr, Properties::RefReactivePower, int32_t(value), 0);
         return *this;
     }
 
@@ -26437,7 +26437,7 @@ public:
 
     InvControl& ActivePChangeTolerance(double value)
     {
-        Obj_SetFloat64(ptr, Properties::ActivePChangeTolerance, value);
+        Obj_SetFloat64(ptr, Properties::ActivePChangeTolerance, value, 0);
         return *this;
     }
 
@@ -26452,13 +26452,13 @@ public:
 
     InvControl& monVoltageCalc(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::monVoltageCalc, value);
+        Obj_SetInt32(ptr, Properties::monVoltageCalc, value, 0);
         return *this;
     }
 
     InvControl& monVoltageCalc(MonitoredPhase value)
     {
-        Obj_SetInt32(ptr, Properties::monVoltageCalc, int32_t(value));
+        Obj_SetInt32(ptr, Properties::monVoltageCalc, int32_t(value), 0);
         return *this;
     }
 
@@ -26709,7 +26709,7 @@ public:
 
     InvControl& Vsetpoint(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vsetpoint, value);
+        Obj_SetFloat64(ptr, Properties::Vsetpoint, value, 0);
         return *this;
     }
 
@@ -26724,7 +26724,7 @@ public:
 
     InvControl& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -26739,7 +26739,7 @@ public:
 
     InvControl& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -26887,7 +26887,7 @@ public:
 
     ExpControl& Vreg(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vreg, value);
+        Obj_SetFloat64(ptr, Properties::Vreg, value, 0);
         return *this;
     }
 
@@ -26904,7 +26904,7 @@ public:
 
     ExpControl& Slope(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Slope, value);
+        Obj_SetFloat64(ptr, Properties::Slope, value, 0);
         return *this;
     }
 
@@ -26921,7 +26921,7 @@ public:
 
     ExpControl& VregTau(double value)
     {
-        Obj_SetFloat64(ptr, Properties::VregTau, value);
+        Obj_SetFloat64(ptr, Properties::VregTau, value, 0);
         return *this;
     }
 
@@ -26938,7 +26938,7 @@ public:
 
     ExpControl& Qbias(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Qbias, value);
+        Obj_SetFloat64(ptr, Properties::Qbias, value, 0);
         return *this;
     }
 
@@ -26953,7 +26953,7 @@ public:
 
     ExpControl& VregMin(double value)
     {
-        Obj_SetFloat64(ptr, Properties::VregMin, value);
+        Obj_SetFloat64(ptr, Properties::VregMin, value, 0);
         return *this;
     }
 
@@ -26968,7 +26968,7 @@ public:
 
     ExpControl& VregMax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::VregMax, value);
+        Obj_SetFloat64(ptr, Properties::VregMax, value, 0);
         return *this;
     }
 
@@ -26985,7 +26985,7 @@ public:
 
     ExpControl& QmaxLead(double value)
     {
-        Obj_SetFloat64(ptr, Properties::QmaxLead, value);
+        Obj_SetFloat64(ptr, Properties::QmaxLead, value, 0);
         return *this;
     }
 
@@ -27002,7 +27002,7 @@ public:
 
     ExpControl& QmaxLag(double value)
     {
-        Obj_SetFloat64(ptr, Properties::QmaxLag, value);
+        Obj_SetFloat64(ptr, Properties::QmaxLag, value, 0);
         return *this;
     }
 
@@ -27017,7 +27017,7 @@ public:
 
     ExpControl& EventLog(bool value)
     {
-        Obj_SetInt32(ptr, Properties::EventLog, value);
+        Obj_SetInt32(ptr, Properties::EventLog, value, 0);
         return *this;
     }
 
@@ -27034,7 +27034,7 @@ public:
 
     ExpControl& DeltaQ_factor(double value)
     {
-        Obj_SetFloat64(ptr, Properties::DeltaQ_factor, value);
+        Obj_SetFloat64(ptr, Properties::DeltaQ_factor, value, 0);
         return *this;
     }
 
@@ -27051,7 +27051,7 @@ public:
 
     ExpControl& PreferQ(bool value)
     {
-        Obj_SetInt32(ptr, Properties::PreferQ, value);
+        Obj_SetInt32(ptr, Properties::PreferQ, value, 0);
         return *this;
     }
 
@@ -27068,7 +27068,7 @@ public:
 
     ExpControl& Tresponse(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Tresponse, value);
+        Obj_SetFloat64(ptr, Properties::Tresponse, value, 0);
         return *this;
     }
 
@@ -27100,7 +27100,7 @@ public:
 
     ExpControl& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -27115,7 +27115,7 @@ public:
 
     ExpControl& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -27302,7 +27302,7 @@ public:
 
     GICLine& Volts(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Volts, value);
+        Obj_SetFloat64(ptr, Properties::Volts, value, 0);
         return *this;
     }
 
@@ -27317,7 +27317,7 @@ public:
 
     GICLine& Angle(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Angle, value);
+        Obj_SetFloat64(ptr, Properties::Angle, value, 0);
         return *this;
     }
 
@@ -27332,7 +27332,7 @@ public:
 
     GICLine& frequency(double value)
     {
-        Obj_SetFloat64(ptr, Properties::frequency, value);
+        Obj_SetFloat64(ptr, Properties::frequency, value, 0);
         return *this;
     }
 
@@ -27347,7 +27347,7 @@ public:
 
     GICLine& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -27362,7 +27362,7 @@ public:
 
     GICLine& R(double value)
     {
-        Obj_SetFloat64(ptr, Properties::R, value);
+        Obj_SetFloat64(ptr, Properties::R, value, 0);
         return *this;
     }
 
@@ -27377,7 +27377,7 @@ public:
 
     GICLine& X(double value)
     {
-        Obj_SetFloat64(ptr, Properties::X, value);
+        Obj_SetFloat64(ptr, Properties::X, value, 0);
         return *this;
     }
 
@@ -27392,7 +27392,7 @@ public:
 
     GICLine& C(double value)
     {
-        Obj_SetFloat64(ptr, Properties::C, value);
+        Obj_SetFloat64(ptr, Properties::C, value, 0);
         return *this;
     }
 
@@ -27407,7 +27407,7 @@ public:
 
     GICLine& EN(double value)
     {
-        Obj_SetFloat64(ptr, Properties::EN, value);
+        Obj_SetFloat64(ptr, Properties::EN, value, 0);
         return *this;
     }
 
@@ -27422,7 +27422,7 @@ public:
 
     GICLine& EE(double value)
     {
-        Obj_SetFloat64(ptr, Properties::EE, value);
+        Obj_SetFloat64(ptr, Properties::EE, value, 0);
         return *this;
     }
 
@@ -27437,7 +27437,7 @@ public:
 
     GICLine& Lat1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Lat1, value);
+        Obj_SetFloat64(ptr, Properties::Lat1, value, 0);
         return *this;
     }
 
@@ -27452,7 +27452,7 @@ public:
 
     GICLine& Lon1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Lon1, value);
+        Obj_SetFloat64(ptr, Properties::Lon1, value, 0);
         return *this;
     }
 
@@ -27467,7 +27467,7 @@ public:
 
     GICLine& Lat2(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Lat2, value);
+        Obj_SetFloat64(ptr, Properties::Lat2, value, 0);
         return *this;
     }
 
@@ -27482,7 +27482,7 @@ public:
 
     GICLine& Lon2(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Lon2, value);
+        Obj_SetFloat64(ptr, Properties::Lon2, value, 0);
         return *this;
     }
 
@@ -27533,7 +27533,7 @@ public:
 
     GICLine& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -27548,7 +27548,7 @@ public:
 
     GICLine& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -27783,7 +27783,7 @@ public:
 
     GICTransformer& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -27798,13 +27798,13 @@ public:
 
     GICTransformer& Type(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Type, value);
+        Obj_SetInt32(ptr, Properties::Type, value, 0);
         return *this;
     }
 
     GICTransformer& Type(GICTransformerType value)
     {
-        Obj_SetInt32(ptr, Properties::Type, int32_t(value));
+        Obj_SetInt32(ptr, Properties::Type, int32_t(value), 0);
         return *this;
     }
 
@@ -27850,7 +27850,7 @@ public:
 
     GICTransformer& R1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::R1, value);
+        Obj_SetFloat64(ptr, Properties::R1, value, 0);
         return *this;
     }
 
@@ -27865,7 +27865,7 @@ public:
 
     GICTransformer& R2(double value)
     {
-        Obj_SetFloat64(ptr, Properties::R2, value);
+        Obj_SetFloat64(ptr, Properties::R2, value, 0);
         return *this;
     }
 
@@ -27880,7 +27880,7 @@ public:
 
     GICTransformer& KVLL1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::KVLL1, value);
+        Obj_SetFloat64(ptr, Properties::KVLL1, value, 0);
         return *this;
     }
 
@@ -27895,7 +27895,7 @@ public:
 
     GICTransformer& KVLL2(double value)
     {
-        Obj_SetFloat64(ptr, Properties::KVLL2, value);
+        Obj_SetFloat64(ptr, Properties::KVLL2, value, 0);
         return *this;
     }
 
@@ -27910,7 +27910,7 @@ public:
 
     GICTransformer& MVA(double value)
     {
-        Obj_SetFloat64(ptr, Properties::MVA, value);
+        Obj_SetFloat64(ptr, Properties::MVA, value, 0);
         return *this;
     }
 
@@ -27963,7 +27963,7 @@ public:
 
     GICTransformer& pctR1(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctR1, value);
+        Obj_SetFloat64(ptr, Properties::pctR1, value, 0);
         return *this;
     }
 
@@ -27980,7 +27980,7 @@ public:
 
     GICTransformer& pctR2(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctR2, value);
+        Obj_SetFloat64(ptr, Properties::pctR2, value, 0);
         return *this;
     }
 
@@ -27999,7 +27999,7 @@ public:
 
     GICTransformer& K(double value)
     {
-        Obj_SetFloat64(ptr, Properties::K, value);
+        Obj_SetFloat64(ptr, Properties::K, value, 0);
         return *this;
     }
 
@@ -28014,7 +28014,7 @@ public:
 
     GICTransformer& normamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::normamps, value);
+        Obj_SetFloat64(ptr, Properties::normamps, value, 0);
         return *this;
     }
 
@@ -28029,7 +28029,7 @@ public:
 
     GICTransformer& emergamps(double value)
     {
-        Obj_SetFloat64(ptr, Properties::emergamps, value);
+        Obj_SetFloat64(ptr, Properties::emergamps, value, 0);
         return *this;
     }
 
@@ -28044,7 +28044,7 @@ public:
 
     GICTransformer& faultrate(double value)
     {
-        Obj_SetFloat64(ptr, Properties::faultrate, value);
+        Obj_SetFloat64(ptr, Properties::faultrate, value, 0);
         return *this;
     }
 
@@ -28059,7 +28059,7 @@ public:
 
     GICTransformer& pctperm(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctperm, value);
+        Obj_SetFloat64(ptr, Properties::pctperm, value, 0);
         return *this;
     }
 
@@ -28074,7 +28074,7 @@ public:
 
     GICTransformer& repair(double value)
     {
-        Obj_SetFloat64(ptr, Properties::repair, value);
+        Obj_SetFloat64(ptr, Properties::repair, value, 0);
         return *this;
     }
 
@@ -28089,7 +28089,7 @@ public:
 
     GICTransformer& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -28104,7 +28104,7 @@ public:
 
     GICTransformer& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -28255,7 +28255,7 @@ public:
 
     VSConverter& phases(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::phases, value);
+        Obj_SetInt32(ptr, Properties::phases, value, 0);
         return *this;
     }
 
@@ -28291,7 +28291,7 @@ public:
 
     VSConverter& kVac(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kVac, value);
+        Obj_SetFloat64(ptr, Properties::kVac, value, 0);
         return *this;
     }
 
@@ -28306,7 +28306,7 @@ public:
 
     VSConverter& kVdc(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kVdc, value);
+        Obj_SetFloat64(ptr, Properties::kVdc, value, 0);
         return *this;
     }
 
@@ -28321,7 +28321,7 @@ public:
 
     VSConverter& kW(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kW, value);
+        Obj_SetFloat64(ptr, Properties::kW, value, 0);
         return *this;
     }
 
@@ -28336,7 +28336,7 @@ public:
 
     VSConverter& Ndc(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Ndc, value);
+        Obj_SetInt32(ptr, Properties::Ndc, value, 0);
         return *this;
     }
 
@@ -28352,7 +28352,7 @@ public:
 
     VSConverter& Rac(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Rac, value);
+        Obj_SetFloat64(ptr, Properties::Rac, value, 0);
         return *this;
     }
 
@@ -28368,7 +28368,7 @@ public:
 
     VSConverter& Xac(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Xac, value);
+        Obj_SetFloat64(ptr, Properties::Xac, value, 0);
         return *this;
     }
 
@@ -28383,7 +28383,7 @@ public:
 
     VSConverter& m0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::m0, value);
+        Obj_SetFloat64(ptr, Properties::m0, value, 0);
         return *this;
     }
 
@@ -28398,7 +28398,7 @@ public:
 
     VSConverter& d0(double value)
     {
-        Obj_SetFloat64(ptr, Properties::d0, value);
+        Obj_SetFloat64(ptr, Properties::d0, value, 0);
         return *this;
     }
 
@@ -28413,7 +28413,7 @@ public:
 
     VSConverter& Mmin(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Mmin, value);
+        Obj_SetFloat64(ptr, Properties::Mmin, value, 0);
         return *this;
     }
 
@@ -28428,7 +28428,7 @@ public:
 
     VSConverter& Mmax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Mmax, value);
+        Obj_SetFloat64(ptr, Properties::Mmax, value, 0);
         return *this;
     }
 
@@ -28443,7 +28443,7 @@ public:
 
     VSConverter& Iacmax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Iacmax, value);
+        Obj_SetFloat64(ptr, Properties::Iacmax, value, 0);
         return *this;
     }
 
@@ -28458,7 +28458,7 @@ public:
 
     VSConverter& Idcmax(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Idcmax, value);
+        Obj_SetFloat64(ptr, Properties::Idcmax, value, 0);
         return *this;
     }
 
@@ -28474,7 +28474,7 @@ public:
 
     VSConverter& Vacref(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vacref, value);
+        Obj_SetFloat64(ptr, Properties::Vacref, value, 0);
         return *this;
     }
 
@@ -28490,7 +28490,7 @@ public:
 
     VSConverter& Pacref(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Pacref, value);
+        Obj_SetFloat64(ptr, Properties::Pacref, value, 0);
         return *this;
     }
 
@@ -28506,7 +28506,7 @@ public:
 
     VSConverter& Qacref(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Qacref, value);
+        Obj_SetFloat64(ptr, Properties::Qacref, value, 0);
         return *this;
     }
 
@@ -28522,7 +28522,7 @@ public:
 
     VSConverter& Vdcref(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Vdcref, value);
+        Obj_SetFloat64(ptr, Properties::Vdcref, value, 0);
         return *this;
     }
 
@@ -28537,13 +28537,13 @@ public:
 
     VSConverter& VscMode(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::VscMode, value);
+        Obj_SetInt32(ptr, Properties::VscMode, value, 0);
         return *this;
     }
 
     VSConverter& VscMode(VSConverterControlMode value)
     {
-        Obj_SetInt32(ptr, Properties::VscMode, int32_t(value));
+        Obj_SetInt32(ptr, Properties::VscMode, int32_t(value), 0);
         return *this;
     }
 
@@ -28625,7 +28625,7 @@ public:
 
     VSConverter& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -28640,7 +28640,7 @@ public:
 
     VSConverter& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -28685,9 +28685,10 @@ public:
             residual = 5,
             VIPolar = 6,
             PPolar = 7,
-            basefreq = 8,
-            enabled = 9,
-            like = 10,
+            compress = 8,
+            basefreq = 9,
+            enabled = 10,
+            like = 11,
         };
     };
 
@@ -28814,7 +28815,7 @@ public:
 
     Monitor& terminal(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::terminal, value);
+        Obj_SetInt32(ptr, Properties::terminal, value, 0);
         return *this;
     }
 
@@ -28853,7 +28854,7 @@ public:
 
     Monitor& mode(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::mode, value);
+        Obj_SetInt32(ptr, Properties::mode, value, 0);
         return *this;
     }
 
@@ -28868,7 +28869,7 @@ public:
     ///
     Monitor& action(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::action, value);
+        Obj_SetInt32(ptr, Properties::action, value, 0);
         return *this;
     }
 
@@ -28883,7 +28884,7 @@ public:
     ///
     Monitor& action(MonitorAction value)
     {
-        Obj_SetInt32(ptr, Properties::action, int32_t(value));
+        Obj_SetInt32(ptr, Properties::action, int32_t(value), 0);
         return *this;
     }
 
@@ -28928,7 +28929,7 @@ public:
 
     Monitor& residual(bool value)
     {
-        Obj_SetInt32(ptr, Properties::residual, value);
+        Obj_SetInt32(ptr, Properties::residual, value, 0);
         return *this;
     }
 
@@ -28943,7 +28944,7 @@ public:
 
     Monitor& VIPolar(bool value)
     {
-        Obj_SetInt32(ptr, Properties::VIPolar, value);
+        Obj_SetInt32(ptr, Properties::VIPolar, value, 0);
         return *this;
     }
 
@@ -28958,13 +28959,28 @@ public:
 
     Monitor& PPolar(bool value)
     {
-        Obj_SetInt32(ptr, Properties::PPolar, value);
+        Obj_SetInt32(ptr, Properties::PPolar, value, 0);
+        return *this;
+    }
+
+    /// {Yes/True | No/False} Default = No. Keep the samples in a lossless compressed store in memory instead of the plain stream of float32 values. The records are encoded per channel in blocks of 1024 samples; all the functions that read the monitor (ByteStream, Channel, export/show) return the same data as the default storage. Changing this property resets the monitor.
+    ///
+    /// DSS property name: compress, DSS property index: 8
+    ///
+    bool compress()
+    {
+        return Obj_GetInt32(ptr, Properties::compress) != 0;
+    }
+
+    Monitor& compress(bool value)
+    {
+        Obj_SetInt32(ptr, Properties::compress, value, 0);
         return *this;
     }
 
     /// Base Frequency for ratings.
     ///
-    /// DSS property name: basefreq, DSS property index: 8
+    /// DSS property name: basefreq, DSS property index: 9
     ///
     double basefreq()
     {
@@ -28973,13 +28989,13 @@ public:
 
     Monitor& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
     /// {Yes|No or True|False} Indicates whether this element is enabled.
     ///
-    /// DSS property name: enabled, DSS property index: 9
+    /// DSS property name: enabled, DSS property index: 10
     ///
     bool enabled()
     {
@@ -28988,7 +29004,7 @@ public:
 
     Monitor& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -28996,7 +29012,7 @@ public:
     ///
     /// New Capacitor.C2 like=c1  ...
     ///
-    /// DSS property name: like, DSS property index: 10
+    /// DSS property name: like, DSS property index: 11
     ///
     Monitor& like(const string &value)
     {
@@ -29008,7 +29024,7 @@ public:
     ///
     /// New Capacitor.C2 like=c1  ...
     ///
-    /// DSS property name: like, DSS property index: 10
+    /// DSS property name: like, DSS property index: 11
     ///
     Monitor& like(const char *value)
     {
@@ -29180,7 +29196,7 @@ public:
 
     EnergyMeter& terminal(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::terminal, value);
+        Obj_SetInt32(ptr, Properties::terminal, value, 0);
         return *this;
     }
 
@@ -29199,7 +29215,7 @@ public:
     ///
     EnergyMeter& action(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::action, value);
+        Obj_SetInt32(ptr, Properties::action, value, 0);
         return *this;
     }
 
@@ -29218,7 +29234,7 @@ public:
     ///
     EnergyMeter& action(EnergyMeterAction value)
     {
-        Obj_SetInt32(ptr, Properties::action, int32_t(value));
+        Obj_SetInt32(ptr, Properties::action, int32_t(value), 0);
         return *this;
     }
 
@@ -29295,7 +29311,7 @@ public:
 
     EnergyMeter& kVAnormal(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kVAnormal, value);
+        Obj_SetFloat64(ptr, Properties::kVAnormal, value, 0);
         return *this;
     }
 
@@ -29310,7 +29326,7 @@ public:
 
     EnergyMeter& kVAemerg(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kVAemerg, value);
+        Obj_SetFloat64(ptr, Properties::kVAemerg, value, 0);
         return *this;
     }
 
@@ -29358,7 +29374,7 @@ public:
 
     EnergyMeter& LocalOnly(bool value)
     {
-        Obj_SetInt32(ptr, Properties::LocalOnly, value);
+        Obj_SetInt32(ptr, Properties::LocalOnly, value, 0);
         return *this;
     }
 
@@ -29388,7 +29404,7 @@ public:
 
     EnergyMeter& Losses(bool value)
     {
-        Obj_SetInt32(ptr, Properties::Losses, value);
+        Obj_SetInt32(ptr, Properties::Losses, value, 0);
         return *this;
     }
 
@@ -29403,7 +29419,7 @@ public:
 
     EnergyMeter& LineLosses(bool value)
     {
-        Obj_SetInt32(ptr, Properties::LineLosses, value);
+        Obj_SetInt32(ptr, Properties::LineLosses, value, 0);
         return *this;
     }
 
@@ -29418,7 +29434,7 @@ public:
 
     EnergyMeter& XfmrLosses(bool value)
     {
-        Obj_SetInt32(ptr, Properties::XfmrLosses, value);
+        Obj_SetInt32(ptr, Properties::XfmrLosses, value, 0);
         return *this;
     }
 
@@ -29433,7 +29449,7 @@ public:
 
     EnergyMeter& SeqLosses(bool value)
     {
-        Obj_SetInt32(ptr, Properties::SeqLosses, value);
+        Obj_SetInt32(ptr, Properties::SeqLosses, value, 0);
         return *this;
     }
 
@@ -29448,7 +29464,7 @@ public:
 
     EnergyMeter& threePaseLosses(bool value)
     {
-        Obj_SetInt32(ptr, Properties::threePaseLosses, value);
+        Obj_SetInt32(ptr, Properties::threePaseLosses, value, 0);
         return *this;
     }
 
@@ -29463,7 +29479,7 @@ public:
 
     EnergyMeter& VbaseLosses(bool value)
     {
-        Obj_SetInt32(ptr, Properties::VbaseLosses, value);
+        Obj_SetInt32(ptr, Properties::VbaseLosses, value, 0);
         return *this;
     }
 
@@ -29478,7 +29494,7 @@ public:
 
     EnergyMeter& PhaseVoltageReport(bool value)
     {
-        Obj_SetInt32(ptr, Properties::PhaseVoltageReport, value);
+        Obj_SetInt32(ptr, Properties::PhaseVoltageReport, value, 0);
         return *this;
     }
 
@@ -29493,7 +29509,7 @@ public:
 
     EnergyMeter& Int_Rate(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Int_Rate, value);
+        Obj_SetFloat64(ptr, Properties::Int_Rate, value, 0);
         return *this;
     }
 
@@ -29508,7 +29524,7 @@ public:
 
     EnergyMeter& Int_Duration(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Int_Duration, value);
+        Obj_SetFloat64(ptr, Properties::Int_Duration, value, 0);
         return *this;
     }
 
@@ -29523,7 +29539,7 @@ public:
 
     EnergyMeter& SAIFI(double value)
     {
-        Obj_SetFloat64(ptr, Properties::SAIFI, value);
+        Obj_SetFloat64(ptr, Properties::SAIFI, value, 0);
         return *this;
     }
 
@@ -29538,7 +29554,7 @@ public:
 
     EnergyMeter& SAIFIkW(double value)
     {
-        Obj_SetFloat64(ptr, Properties::SAIFIkW, value);
+        Obj_SetFloat64(ptr, Properties::SAIFIkW, value, 0);
         return *this;
     }
 
@@ -29553,7 +29569,7 @@ public:
 
     EnergyMeter& SAIDI(double value)
     {
-        Obj_SetFloat64(ptr, Properties::SAIDI, value);
+        Obj_SetFloat64(ptr, Properties::SAIDI, value, 0);
         return *this;
     }
 
@@ -29568,7 +29584,7 @@ public:
 
     EnergyMeter& CAIDI(double value)
     {
-        Obj_SetFloat64(ptr, Properties::CAIDI, value);
+        Obj_SetFloat64(ptr, Properties::CAIDI, value, 0);
         return *this;
     }
 
@@ -29583,7 +29599,7 @@ public:
 
     EnergyMeter& CustInterrupts(double value)
     {
-        Obj_SetFloat64(ptr, Properties::CustInterrupts, value);
+        Obj_SetFloat64(ptr, Properties::CustInterrupts, value, 0);
         return *this;
     }
 
@@ -29598,7 +29614,7 @@ public:
 
     EnergyMeter& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -29613,7 +29629,7 @@ public:
 
     EnergyMeter& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -29776,7 +29792,7 @@ public:
 
     Sensor& terminal(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::terminal, value);
+        Obj_SetInt32(ptr, Properties::terminal, value, 0);
         return *this;
     }
 
@@ -29792,7 +29808,7 @@ public:
 
     Sensor& kvbase(double value)
     {
-        Obj_SetFloat64(ptr, Properties::kvbase, value);
+        Obj_SetFloat64(ptr, Properties::kvbase, value, 0);
         return *this;
     }
 
@@ -29807,7 +29823,7 @@ public:
 
     Sensor& clear(bool value)
     {
-        Obj_SetInt32(ptr, Properties::clear, value);
+        Obj_SetInt32(ptr, Properties::clear, value, 0);
         return *this;
     }
 
@@ -29885,13 +29901,13 @@ public:
 
     Sensor& conn(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::conn, value);
+        Obj_SetInt32(ptr, Properties::conn, value, 0);
         return *this;
     }
 
     Sensor& conn(Connection value)
     {
-        Obj_SetInt32(ptr, Properties::conn, int32_t(value));
+        Obj_SetInt32(ptr, Properties::conn, int32_t(value), 0);
         return *this;
     }
 
@@ -29941,7 +29957,7 @@ public:
 
     Sensor& Deltadirection(int32_t value)
     {
-        Obj_SetInt32(ptr, Properties::Deltadirection, value);
+        Obj_SetInt32(ptr, Properties::Deltadirection, value, 0);
         return *this;
     }
 
@@ -29956,7 +29972,7 @@ public:
 
     Sensor& pctError(double value)
     {
-        Obj_SetFloat64(ptr, Properties::pctError, value);
+        Obj_SetFloat64(ptr, Properties::pctError, value, 0);
         return *this;
     }
 
@@ -29971,7 +29987,7 @@ public:
 
     Sensor& Weight(double value)
     {
-        Obj_SetFloat64(ptr, Properties::Weight, value);
+        Obj_SetFloat64(ptr, Properties::Weight, value, 0);
         return *this;
     }
 
@@ -29986,7 +30002,7 @@ public:
 
     Sensor& basefreq(double value)
     {
-        Obj_SetFloat64(ptr, Properties::basefreq, value);
+        Obj_SetFloat64(ptr, Properties::basefreq, value, 0);
         return *this;
     }
 
@@ -30001,7 +30017,7 @@ public:
 
     Sensor& enabled(bool value)
     {
-        Obj_SetInt32(ptr, Properties::enabled, value);
+        Obj_SetInt32(ptr, Properties::enabled, value, 0);
         return *this;
     }
 
@@ -65527,9 +65543,30 @@ public:
         return *this;
     }
 
+    /// {Yes/True | No/False} Default = No. Keep the samples in a lossless compressed store in memory instead of the plain stream of float32 values. The records are encoded per channel in blocks of 1024 samples; all the functions that read the monitor (ByteStream, Channel, export/show) return the same data as the default storage. Changing this property resets the monitor.
+    ///
+    /// DSS property name: compress, DSS property index: 8
+    ///
+    bools compress()
+    {
+        return get_batch_val<bools>(Properties::compress);
+    }
+
+    MonitorBatch& compress(bool value)
+    {
+        set_batch_val(Properties::compress, int32_t(value));
+        return *this;
+    }
+
+    MonitorBatch& compress(bools &value)
+    {
+        set_batch_val_for_each<std::vector<int32_t>>(Properties::compress, value.begin(), value.end());
+        return *this;
+    }
+
     /// Base Frequency for ratings.
     ///
-    /// DSS property name: basefreq, DSS property index: 8
+    /// DSS property name: basefreq, DSS property index: 9
     ///
     BatchFloat64ArrayProxy basefreq()
     {
@@ -65558,7 +65595,7 @@ public:
 
     /// {Yes|No or True|False} Indicates whether this element is enabled.
     ///
-    /// DSS property name: enabled, DSS property index: 9
+    /// DSS property name: enabled, DSS property index: 10
     ///
     bools enabled()
     {
@@ -65581,7 +65618,7 @@ public:
     ///
     /// New Capacitor.C2 like=c1  ...
     ///
-    /// DSS property name: like, DSS property index: 10
+    /// DSS property name: like, DSS property index: 11
     ///
     MonitorBatch& like(const string &value)
     {
@@ -65593,7 +65630,7 @@ public:
     ///
     /// New Capacitor.C2 like=c1  ...
     ///
-    /// DSS property name: like, DSS property index: 10
+    /// DSS property name: like, DSS property index: 11
     ///
     MonitorBatch& like(const char *value)
     {
@@ -36,6 +36,7 @@ uses
     ControlClass,
     CAPI_Obj,
     DSSObjectHelper,
+    DSSJSONWriter,
     fpjson,
     sysutils;
 
@@ -156,7 +157,7 @@ end;
 //------------------------------------------------------------------------------
 function ActiveClass_ToJSON(joptions: Integer): PAnsiChar; CDECL;
 var
-    json: TJSONArray = NIL;
+    W: TDSSJSONWriter = NIL;
     cls: TDSSClass = NIL;
     objlist: TDSSObjectPtr = NIL;
     i: Integer;
@@ -166,7 +167,8 @@ begin
         Exit;
 
     try
-        json := TJSONArray.Create([]);
+        W := TDSSJSONWriter.Create(NIL, (Integer(DSSJSONOptions.Pretty) and joptions) <> 0);
+        W.BeginArray();
         cls := DSSPrime.ActiveDSSClass;
         objlist := TDSSObjectPtr(cls.ElementList.InternalPointer);    
         if cls.ElementList.Count <> 0 then
@@ -175,7 +177,7 @@ begin
             begin
                 for i := 1 to cls.ElementList.Count do 
                 begin
-                    json.Add(Obj_ToJSONData(objlist^, joptions));
+                    Obj_WriteJSON(objlist^, joptions, W);
                     inc(objlist);
                 end;
             end
@@ -184,23 +186,18 @@ begin
                 for i := 1 to cls.ElementList.Count do 
                 begin
                     if TDSSCktElement(objlist^).Enabled then
-                        json.Add(Obj_ToJSONData(objlist^, joptions));
+                        Obj_WriteJSON(objlist^, joptions, W);
                     inc(objlist);
                 end;
             end;
         end;
-        if json <> NIL then
-        begin
-            if (Integer(DSSJSONOptions.Pretty) and joptions) <> 0 then
-                Result := DSS_GetAsPAnsiChar(DSSPrime, json.FormatJSON([], 2))
-            else
-                Result := DSS_GetAsPAnsiChar(DSSPrime, json.FormatJSON([foSingleLineArray, foSingleLineObject, foskipWhiteSpace], 0));
-        end;
+        W.EndArray();
+        Result := DSS_GetAsPAnsiChar(DSSPrime, W.Text());
     except 
     on E: Exception do
         DoSimpleMsg(DSSPrime, 'Error converting to JSON: %s', [E.Message], 20231030);
     end;
-    FreeAndNil(json);
+    FreeAndNil(W);
 end;
 //------------------------------------------------------------------------------
 function ActiveClass_Get_Pointer(): Pointer; CDECL;
@@ -13,6 +13,7 @@ uses
     Bus,
     ControlledTransformer,
     EnergyMeter,
+    MeterTable,
     CAPI_Types,
     fpjson;
 
@@ -143,6 +144,9 @@ procedure Alt_Meter_Get_EndElements(var ResultPtr: PPointer; ResultCount: PAPISi
 procedure Alt_Meter_Get_BranchesInZone(var ResultPtr: PPointer; ResultCount: PAPISize; elem: TEnergyMeterObj); CDECL;
 procedure Alt_Meter_Get_SequenceList(var ResultPtr: PPointer; ResultCount: PAPISize; elem: TEnergyMeterObj); CDECL;
 procedure Alt_Meter_Get_Loads(var ResultPtr: PPointer; ResultCount: PAPISize; elem: TEnergyMeterObj); CDECL;
+procedure Alt_Meter_Get_DIColumnNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; elem: TEnergyMeterObj; Table: Integer); CDECL;
+procedure Alt_Meter_Get_DIHours(var ResultPtr: PDouble; ResultCount: PAPISize; elem: TEnergyMeterObj; Table: Integer); CDECL;
+procedure Alt_Meter_Get_DIData(var ResultPtr: PDouble; ResultCount: PAPISize; elem: TEnergyMeterObj; Table: Integer); CDECL;
 //MeterSection
 function Alt_MeterSection_AvgRepairTime(elem: TEnergyMeterObj; idx: Integer): Double; CDECL;
 function Alt_MeterSection_FaultRateXRepairHours(elem: TEnergyMeterObj; idx: Integer): Double; CDECL;
@@ -207,6 +211,17 @@ procedure _Alt_PDEBatch_Get_x(var ResultPtr: PDouble; ResultCount: PAPISize; bat
 // Used in CAPI_Obj
 function alt_Bus_ToJSON_(DSS: TDSSContext; bus: TDSSBus; joptions: Integer): TJSONObject;
 
+// Used in CAPI_Meters; Column is 1-based, 0 for all the columns (column-major)
+procedure _Alt_Meter_Get_DIColumnNames(DSS: TDSSContext; var ResultPtr: PPAnsiChar; ResultCount: PAPISize; elem: TEnergyMeterObj; Table: Integer);
+procedure _Alt_Meter_Get_DIHours(DSS: TDSSContext; var ResultPtr: PDouble; ResultCount: PAPISize; elem: TEnergyMeterObj; Table: Integer);
+procedure _Alt_Meter_Get_DIColumn(DSS: TDSSContext; var ResultPtr: PDouble; ResultCount: PAPISize; elem: TEnergyMeterObj; Table, Column: Integer);
+procedure _Alt_Meter_Get_DIColumnText(DSS: TDSSContext; var ResultPtr: PPAnsiChar; ResultCount: PAPISize; elem: TEnergyMeterObj; Table, Column: Integer);
+
+// Used in CAPI_Text; same as above for a given table, which can be NIL (no data)
+procedure _Alt_Table_Get_ColumnNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; tbl: TMeterTable);
+procedure _Alt_Table_Get_Column(DSS: TDSSContext; var ResultPtr: PDouble; ResultCount: PAPISize; tbl: TMeterTable; Column: Integer);
+procedure _Alt_Table_Get_ColumnText(DSS: TDSSContext; var ResultPtr: PPAnsiChar; ResultCount: PAPISize; tbl: TMeterTable; Column: Integer);
+
 implementation
 
 uses
@@ -1469,10 +1484,9 @@ end;
 //------------------------------------------------------------------------------
 procedure Alt_Monitor_Get_ByteStream(var ResultPtr: PByte; ResultCount: PAPISize; pmon: TMonitorObj); CDECL;
 begin
-    DSS_RecreateArray_PByte(ResultPtr, ResultCount, pmon.MonitorStream.Size);
-    pmon.MonitorStream.Seek(0, soFromBeginning);
-    pmon.MonitorStream.Read(ResultPtr^, pmon.MonitorStream.Size);   // Move it all over
-    // leaves stream at the end
+    DSS_RecreateArray_PByte(ResultPtr, ResultCount, pmon.RawSize());
+    pmon.CopyRaw(ResultPtr); // Move it all over, decompressing the records if required
+    pmon.MonitorStream.Seek(0, soFromEnd); // leaves stream at the end
 end;
 //------------------------------------------------------------------------------
 function Alt_Monitor_Get_SampleCount(pmon: TMonitorObj): Integer; CDECL;
@@ -1518,6 +1532,11 @@ begin
         Exit;
     end;
     Result := DSS_RecreateArray_PDouble(ResultPtr, ResultCount, pmon.SampleCount);
+    if pmon.Compressed then
+    begin
+        pmon.ReadColumn(Index + 1, Result); // Skip Hour and Second fields
+        Exit;
+    end;
 
     AllocSize := Sizeof(Single) * (pmon.RecordSize + 2); // Include Hour and Second fields
     Index := Index + 2; // Skip Hour and Second fields
@@ -1543,6 +1562,7 @@ var
     MonitorStream: TMemoryStream;
     FirstColTarget: String;
     smult: Double;
+    SecHarm: ArrayOfDouble;
 begin
     DefaultResult(ResultPtr, ResultCount);
     if pmon.SampleCount <= 0 then
@@ -1570,6 +1590,15 @@ begin
     end;
 
     Result := DSS_RecreateArray_PDouble(ResultPtr, ResultCount, pmon.SampleCount);
+    if pmon.Compressed then
+    begin
+        SetLength(SecHarm, pmon.SampleCount);
+        pmon.ReadColumn(0, Result);
+        pmon.ReadColumn(1, PDoubleArray0(@SecHarm[0]));
+        for i := 0 to pmon.SampleCount - 1 do
+            Result[i] := Result[i] + SecHarm[i] * smult;
+        Exit;
+    end;
     AllocSize := Sizeof(Single) * pmon.RecordSize;
     SngBuffer := Allocmem(AllocSize);
     k := 0;
@@ -1954,6 +1983,160 @@ begin
     Move(elem.LoadList.InternalPointer^, ResultPtr^, ResultCount^ * SizeOf(Pointer));
 end;
 //------------------------------------------------------------------------------
+function _MeterTable(DSS: TDSSContext; elem: TEnergyMeterObj; Table: Integer; out Found: Boolean): TMeterTable;
+// Found is false for an invalid table; the result is NIL if the table has no
+// data (e.g. DemandInterval is off, or the files were closed without DIMemory)
+begin
+    Result := NIL;
+    Found := (Table >= ord(Low(TMeterTableID))) and (Table <= ord(High(TMeterTableID)));
+    if not Found then
+    begin
+        DoSimpleMsg(DSS, 'Invalid meter table (%d).', [Table], 20240762);
+        Exit;
+    end;
+    Result := DSS.EnergyMeterClass.GetTable(elem, TMeterTableID(Table));
+end;
+
+procedure _Alt_Table_Get_ColumnNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; tbl: TMeterTable);
+var
+    Result: PPAnsiCharArray0;
+    names: ArrayOfString;
+    i: Integer;
+begin
+    if tbl = NIL then
+    begin
+        DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, 0);
+        Exit;
+    end;
+    names := tbl.ColumnNames();
+    Result := DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, Length(names));
+    for i := 0 to High(names) do
+        Result[i] := DSS_CopyStringAsPChar(names[i]);
+end;
+
+procedure _Alt_Table_Get_Column(DSS: TDSSContext; var ResultPtr: PDouble; ResultCount: PAPISize; tbl: TMeterTable; Column: Integer);
+var
+    Result: PDoubleArray0;
+    c: Integer;
+begin
+    if (tbl = NIL) or (tbl.NumColumns <= 0) then
+    begin
+        DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 0);
+        Exit;
+    end;
+    if Column = 0 then
+    begin
+        Result := DSS_RecreateArray_PDouble(ResultPtr, ResultCount, Int64(tbl.NumRows) * tbl.NumColumns, tbl.NumRows, tbl.NumColumns);
+        for c := 0 to tbl.NumColumns - 1 do
+            tbl.CopyColumn(c, PDoubleArray0(@Result[Int64(c) * tbl.NumRows]));
+        Exit;
+    end;
+    if (Column < 1) or (Column > tbl.NumColumns) then
+    begin
+        DoSimpleMsg(DSS, 'Invalid column index (%d) for the table; it has %d columns.', [Column, tbl.NumColumns], 20240763);
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    tbl.CopyColumn(Column - 1, DSS_RecreateArray_PDouble(ResultPtr, ResultCount, tbl.NumRows));
+end;
+
+procedure _Alt_Table_Get_ColumnText(DSS: TDSSContext; var ResultPtr: PPAnsiChar; ResultCount: PAPISize; tbl: TMeterTable; Column: Integer);
+var
+    Result: PPAnsiCharArray0;
+    i: Integer;
+begin
+    if (tbl = NIL) or (tbl.NumColumns <= 0) then
+    begin
+        DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, 0);
+        Exit;
+    end;
+    if (Column < 1) or (Column > tbl.NumColumns) then
+    begin
+        DoSimpleMsg(DSS, 'Invalid column index (%d) for the table; it has %d columns.', [Column, tbl.NumColumns], 20240763);
+        DefaultResult(ResultPtr, ResultCount, '');
+        Exit;
+    end;
+    Result := DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, tbl.NumRows);
+    for i := 0 to tbl.NumRows - 1 do
+        Result[i] := DSS_CopyStringAsPChar(tbl.GetText(i, Column - 1));
+end;
+
+procedure _Alt_Meter_Get_DIColumnNames(DSS: TDSSContext; var ResultPtr: PPAnsiChar; ResultCount: PAPISize; elem: TEnergyMeterObj; Table: Integer);
+var
+    tbl: TMeterTable;
+    Found: Boolean;
+begin
+    tbl := _MeterTable(DSS, elem, Table, Found);
+    if not Found then
+    begin
+        DefaultResult(ResultPtr, ResultCount, '');
+        Exit;
+    end;
+    _Alt_Table_Get_ColumnNames(ResultPtr, ResultCount, tbl);
+end;
+
+procedure _Alt_Meter_Get_DIHours(DSS: TDSSContext; var ResultPtr: PDouble; ResultCount: PAPISize; elem: TEnergyMeterObj; Table: Integer);
+var
+    tbl: TMeterTable;
+    Found: Boolean;
+begin
+    tbl := _MeterTable(DSS, elem, Table, Found);
+    if not Found then
+    begin
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    if (tbl = NIL) or (not tbl.HasTime) then
+    begin
+        DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 0);
+        Exit;
+    end;
+    tbl.CopyHours(DSS_RecreateArray_PDouble(ResultPtr, ResultCount, tbl.NumRows));
+end;
+
+procedure _Alt_Meter_Get_DIColumn(DSS: TDSSContext; var ResultPtr: PDouble; ResultCount: PAPISize; elem: TEnergyMeterObj; Table, Column: Integer);
+var
+    tbl: TMeterTable;
+    Found: Boolean;
+begin
+    tbl := _MeterTable(DSS, elem, Table, Found);
+    if not Found then
+    begin
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    _Alt_Table_Get_Column(DSS, ResultPtr, ResultCount, tbl, Column);
+end;
+
+procedure _Alt_Meter_Get_DIColumnText(DSS: TDSSContext; var ResultPtr: PPAnsiChar; ResultCount: PAPISize; elem: TEnergyMeterObj; Table, Column: Integer);
+var
+    tbl: TMeterTable;
+    Found: Boolean;
+begin
+    tbl := _MeterTable(DSS, elem, Table, Found);
+    if not Found then
+    begin
+        DefaultResult(ResultPtr, ResultCount, '');
+        Exit;
+    end;
+    _Alt_Table_Get_ColumnText(DSS, ResultPtr, ResultCount, tbl, Column);
+end;
+//------------------------------------------------------------------------------
+procedure Alt_Meter_Get_DIColumnNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; elem: TEnergyMeterObj; Table: Integer); CDECL;
+begin
+    _Alt_Meter_Get_DIColumnNames(elem.DSS, ResultPtr, ResultCount, elem, Table);
+end;
+//------------------------------------------------------------------------------
+procedure Alt_Meter_Get_DIHours(var ResultPtr: PDouble; ResultCount: PAPISize; elem: TEnergyMeterObj; Table: Integer); CDECL;
+begin
+    _Alt_Meter_Get_DIHours(elem.DSS, ResultPtr, ResultCount, elem, Table);
+end;
+//------------------------------------------------------------------------------
+procedure Alt_Meter_Get_DIData(var ResultPtr: PDouble; ResultCount: PAPISize; elem: TEnergyMeterObj; Table: Integer); CDECL;
+begin
+    _Alt_Meter_Get_DIColumn(elem.DSS, ResultPtr, ResultCount, elem, Table, 0);
+end;
+//------------------------------------------------------------------------------
 procedure Alt_CEBatch_Get_Losses(var resultPtr: PDouble; resultCount: PAPISize; batch: TDSSCktElementPtr; batchSize: TAPISize); CDECL;
 var
     Result: PDoubleArray0;
@@ -78,7 +78,11 @@ procedure Circuit_SetCktElementName(const Value: PAnsiChar); CDECL;
 procedure Circuit_Get_ElementLosses(var ResultPtr: PDouble; ResultCount: PAPISize; ElementsPtr: PInteger; ElementsCount: TAPISize); CDECL;
 procedure Circuit_Get_ElementLosses_GR(ElementsPtr: PInteger; ElementsCount: TAPISize); CDECL;
 function Circuit_ToJSON(options: Integer): PAnsiChar; CDECL;
+procedure Circuit_ToJSONFile(FileName: PAnsiChar; options: Integer); CDECL;
+function Circuit_Diff(Other: TDSSContext; options: Integer): PAnsiChar; CDECL;
+function Circuit_DiffJSON(snapshot: PAnsiChar; options: Integer): PAnsiChar; CDECL;
 procedure Circuit_FromJSON(circStr: PAnsiChar; options: Integer); CDECL;
+procedure Circuit_Generate(paramsStr: PAnsiChar); CDECL;
 function Circuit_Save(dirfilepath: PAnsiChar; saveFlags: DSSSaveFlags): PAnsiChar; CDECL;
 
 implementation
@@ -107,6 +111,12 @@ uses
     CAPI_ActiveClass,
     CAPI_Obj,
     Circuit,
+    SyntheticCircuit,
+    DSSJSONWriter,
+    DSSObjectHelper,
+    CircuitDiff,
+    Classes,
+    BufStream,
     fpjson;
 
 //------------------------------------------------------------------------------
@@ -632,6 +642,9 @@ begin
         DefaultResult(ResultPtr, ResultCount);
         Exit;
     end;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    ApplyLowRankUpdates(DSSPrime); // the matrix must include any pending low-rank corrections
+{$ENDIF}
     hY := DSSPrime.ActiveCircuit.Solution.hY;
 
     // get the compressed columns out of KLU
@@ -1111,6 +1124,99 @@ begin
     Result := Obj_Circuit_ToJSON_(DSSPrime.ActiveCircuit, options);
 end;
 //------------------------------------------------------------------------------
+procedure Circuit_ToJSONFile(FileName: PAnsiChar; options: Integer); CDECL;
+var
+    F: TStream = NIL;
+    W: TDSSJSONWriter = NIL;
+begin
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+
+    try
+        F := TBufferedFileStream.Create(FileName, fmCreate);
+        W := TDSSJSONWriter.Create(F, True);
+        Obj_Circuit_WriteJSON_(DSSPrime.ActiveCircuit, options, W);
+        W.Finish();
+    except
+        on E: Exception do
+            DoSimpleMsg(DSSPrime, 'Error writing the circuit to "%s" as JSON: %s', [FileName, E.message], 20240766);
+    end;
+    FreeAndNil(W);
+    FreeAndNil(F);
+end;
+//------------------------------------------------------------------------------
+function Circuit_Diff_(DSS, Other: TDSSContext; options: Integer): PAnsiChar;
+var
+    diff: TJSONObject = NIL;
+begin
+    Result := NIL;
+    try
+        diff := DiffCircuits(DSS, Other, options);
+        if (Integer(DSSJSONOptions.Pretty) and options) <> 0 then
+            Result := DSS_GetAsPAnsiChar(DSS, diff.FormatJSON([], 2))
+        else
+            Result := DSS_GetAsPAnsiChar(DSS, diff.FormatJSON([foSingleLineArray, foSingleLineObject, foskipWhiteSpace], 0));
+    except
+        on E: Exception do
+            DoSimpleMsg(DSS, 'Error comparing the circuits: %s', [E.message], 20240767);
+    end;
+    FreeAndNil(diff);
+end;
+
+function Circuit_Diff(Other: TDSSContext; options: Integer): PAnsiChar; CDECL;
+begin
+    Result := NIL;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    if Other = NIL then
+        Other := DSSPrime;
+    if Other.ActiveCircuit = NIL then
+    begin
+        DoSimpleMsg(DSSPrime, 'There is no active circuit in the other DSS context.', 20240768);
+        Exit;
+    end;
+
+    Result := Circuit_Diff_(DSSPrime, Other, options);
+end;
+//------------------------------------------------------------------------------
+function Circuit_DiffJSON(snapshot: PAnsiChar; options: Integer): PAnsiChar; CDECL;
+var
+    genericData: TJSONData = NIL;
+    other: TDSSContext = NIL;
+    errorMsg: String = '';
+begin
+    Result := NIL;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+
+    // The snapshot is loaded in a temporary context
+    try
+        genericData := GetJSON(snapshot);
+        if not (genericData is TJSONObject) then
+            errorMsg := 'Invalid JSON type, expected an object for the circuit.'
+        else
+        begin
+            other := TDSSContext.Create(NIL, False);
+            Obj_Circuit_FromJSON_(other, genericData as TJSONObject, options);
+            if other.ErrorNumber <> 0 then
+                errorMsg := other.LastErrorMessage
+            else if other.ActiveCircuit = NIL then
+                errorMsg := 'No circuit was loaded.';
+        end;
+    except
+    on E: Exception do
+        errorMsg := E.message;
+    end;
+    FreeAndNil(genericData);
+
+    if errorMsg <> '' then
+        DoSimpleMsg(DSSPrime, 'Error loading the JSON snapshot: %s', [errorMsg], 20240769)
+    else
+        Result := Circuit_Diff_(DSSPrime, other, options);
+
+    FreeAndNil(other);
+end;
+//------------------------------------------------------------------------------
 procedure Circuit_FromJSON(circStr: PAnsiChar; options: Integer); CDECL;
 var
     genericData: TJSONData = NIL;
@@ -1137,6 +1243,34 @@ begin
         DoSimpleMsg(DSSPrime, 'Error converting data from JSON: %s', [errorMsg], 20230919);
 end;
 //------------------------------------------------------------------------------
+procedure Circuit_Generate(paramsStr: PAnsiChar); CDECL;
+var
+    genericData: TJSONData = NIL;
+    errorMsg: String = '';
+    params: TSyntheticCircuitParams;
+begin
+    SyntheticCircuitDefaults(params);
+    try
+        if (paramsStr <> NIL) and (paramsStr^ <> #0) then
+        begin
+            genericData := GetJSON(paramsStr);
+            if not (genericData is TJSONObject) then
+                raise Exception.Create('Invalid JSON type, expected an object for the parameters.');
+
+            SyntheticCircuitParamsFromJSON(params, genericData as TJSONObject);
+        end;
+        GenerateSyntheticCircuit(DSSPrime, params);
+    except
+    on E: Exception do
+        errorMsg := E.message;
+    end;
+    if genericData <> NIL then
+        genericData.Free();
+
+    if errorMsg <> '' then
+        DoSimpleMsg(DSSPrime, 'Error generating synthetic circuit: %s', [errorMsg], 20240601);
+end;
+//------------------------------------------------------------------------------
 function Circuit_Save(dirfilepath: PAnsiChar; saveFlags: DSSSaveFlags): PAnsiChar; CDECL;
 var
     res: String;
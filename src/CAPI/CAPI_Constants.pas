@@ -39,6 +39,7 @@ const
     dssAdmittance = $00000002;
     dssNormalSolve = $00000000;
     dssNewtonSolve = $00000001;
+    dssSweepSolve = $00000002;
     dssStatic = $00000000;
     dssEvent = $00000001;
     dssTime = $00000002;
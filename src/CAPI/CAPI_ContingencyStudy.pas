@@ -0,0 +1,271 @@
+unit CAPI_ContingencyStudy;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+interface
+
+uses
+    CAPI_Utils,
+    CAPI_Types;
+
+function ContingencyStudy_Run(CasesPtr: PPAnsiChar; CasesCount: TAPISize; NumThreads: Integer): Integer; CDECL;
+function ContingencyStudy_Get_Count(): Integer; CDECL;
+function ContingencyStudy_Get_NumViolations(): Integer; CDECL;
+procedure ContingencyStudy_Get_CaseNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+procedure ContingencyStudy_Get_CaseNames_GR(); CDECL;
+procedure ContingencyStudy_Get_Converged(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+procedure ContingencyStudy_Get_Converged_GR(); CDECL;
+procedure ContingencyStudy_Get_NumIsolatedBuses(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+procedure ContingencyStudy_Get_NumIsolatedBuses_GR(); CDECL;
+procedure ContingencyStudy_Get_NumUnderVoltages(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+procedure ContingencyStudy_Get_NumUnderVoltages_GR(); CDECL;
+procedure ContingencyStudy_Get_NumOverVoltages(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+procedure ContingencyStudy_Get_NumOverVoltages_GR(); CDECL;
+procedure ContingencyStudy_Get_MinVoltages(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure ContingencyStudy_Get_MinVoltages_GR(); CDECL;
+procedure ContingencyStudy_Get_MaxVoltages(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure ContingencyStudy_Get_MaxVoltages_GR(); CDECL;
+procedure ContingencyStudy_Get_NumOverloads(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+procedure ContingencyStudy_Get_NumOverloads_GR(); CDECL;
+procedure ContingencyStudy_Get_NumEmergOverloads(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+procedure ContingencyStudy_Get_NumEmergOverloads_GR(); CDECL;
+procedure ContingencyStudy_Get_MaxLoadings(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure ContingencyStudy_Get_MaxLoadings_GR(); CDECL;
+procedure ContingencyStudy_Get_WorstElements(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+procedure ContingencyStudy_Get_WorstElements_GR(); CDECL;
+
+implementation
+
+uses
+    SysUtils,
+    DSSGlobals,
+    DSSClass,
+    DSSHelper,
+    ContingencyStudy;
+
+type
+    TStudy = TContingencyStudyResults;
+
+//------------------------------------------------------------------------------
+function _results(DSS: TDSSContext; out res: TStudy): Boolean; inline;
+begin
+    res := TStudy(DSS.ContingencyResults);
+    Result := (res <> NIL);
+end;
+
+//------------------------------------------------------------------------------
+function ContingencyStudy_Run(CasesPtr: PPAnsiChar; CasesCount: TAPISize; NumThreads: Integer): Integer; CDECL;
+var
+    CaseSpecs: PPAnsiCharArray0;
+    Cases: Array of String;
+    i: Integer;
+begin
+    Result := 0;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    CaseSpecs := PPAnsiCharArray0(CasesPtr);
+    SetLength(Cases, CasesCount);
+    for i := 0 to CasesCount - 1 do
+        Cases[i] := CaseSpecs[i];
+    if RunContingencyStudy(DSSPrime, Cases, NumThreads) then
+        Result := TStudy(DSSPrime.ContingencyResults).Count;
+end;
+//------------------------------------------------------------------------------
+function ContingencyStudy_Get_Count(): Integer; CDECL;
+var
+    res: TStudy;
+begin
+    Result := 0;
+    if _results(DSSPrime, res) then
+        Result := res.Count;
+end;
+//------------------------------------------------------------------------------
+function ContingencyStudy_Get_NumViolations(): Integer; CDECL;
+var
+    res: TStudy;
+begin
+    Result := 0;
+    if _results(DSSPrime, res) then
+        Result := res.NumViolations();
+end;
+//------------------------------------------------------------------------------
+procedure ContingencyStudy_Get_CaseNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PPAnsiChar(ResultPtr, ResultCount, res.CaseNames, res.Count)
+    else
+        DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, 0);
+end;
+
+procedure ContingencyStudy_Get_CaseNames_GR(); CDECL;
+// Same as ContingencyStudy_Get_CaseNames but uses global result (GR) pointers
+begin
+    ContingencyStudy_Get_CaseNames(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0])
+end;
+//------------------------------------------------------------------------------
+procedure ContingencyStudy_Get_Converged(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PInteger(ResultPtr, ResultCount, res.Converged, res.Count)
+    else
+        DSS_RecreateArray_PInteger(ResultPtr, ResultCount, 0);
+end;
+
+procedure ContingencyStudy_Get_Converged_GR(); CDECL;
+// Same as ContingencyStudy_Get_Converged but uses global result (GR) pointers
+begin
+    ContingencyStudy_Get_Converged(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0])
+end;
+//------------------------------------------------------------------------------
+procedure ContingencyStudy_Get_NumIsolatedBuses(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PInteger(ResultPtr, ResultCount, res.NumIsolatedBuses, res.Count)
+    else
+        DSS_RecreateArray_PInteger(ResultPtr, ResultCount, 0);
+end;
+
+procedure ContingencyStudy_Get_NumIsolatedBuses_GR(); CDECL;
+// Same as ContingencyStudy_Get_NumIsolatedBuses but uses global result (GR) pointers
+begin
+    ContingencyStudy_Get_NumIsolatedBuses(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0])
+end;
+//------------------------------------------------------------------------------
+procedure ContingencyStudy_Get_NumUnderVoltages(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PInteger(ResultPtr, ResultCount, res.NumUnderVoltages, res.Count)
+    else
+        DSS_RecreateArray_PInteger(ResultPtr, ResultCount, 0);
+end;
+
+procedure ContingencyStudy_Get_NumUnderVoltages_GR(); CDECL;
+// Same as ContingencyStudy_Get_NumUnderVoltages but uses global result (GR) pointers
+begin
+    ContingencyStudy_Get_NumUnderVoltages(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0])
+end;
+//------------------------------------------------------------------------------
+procedure ContingencyStudy_Get_NumOverVoltages(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PInteger(ResultPtr, ResultCount, res.NumOverVoltages, res.Count)
+    else
+        DSS_RecreateArray_PInteger(ResultPtr, ResultCount, 0);
+end;
+
+procedure ContingencyStudy_Get_NumOverVoltages_GR(); CDECL;
+// Same as ContingencyStudy_Get_NumOverVoltages but uses global result (GR) pointers
+begin
+    ContingencyStudy_Get_NumOverVoltages(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0])
+end;
+//------------------------------------------------------------------------------
+procedure ContingencyStudy_Get_MinVoltages(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PDouble(ResultPtr, ResultCount, res.MinVoltages, res.Count)
+    else
+        DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 0);
+end;
+
+procedure ContingencyStudy_Get_MinVoltages_GR(); CDECL;
+// Same as ContingencyStudy_Get_MinVoltages but uses global result (GR) pointers
+begin
+    ContingencyStudy_Get_MinVoltages(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+//------------------------------------------------------------------------------
+procedure ContingencyStudy_Get_MaxVoltages(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PDouble(ResultPtr, ResultCount, res.MaxVoltages, res.Count)
+    else
+        DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 0);
+end;
+
+procedure ContingencyStudy_Get_MaxVoltages_GR(); CDECL;
+// Same as ContingencyStudy_Get_MaxVoltages but uses global result (GR) pointers
+begin
+    ContingencyStudy_Get_MaxVoltages(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+//------------------------------------------------------------------------------
+procedure ContingencyStudy_Get_NumOverloads(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PInteger(ResultPtr, ResultCount, res.NumOverloads, res.Count)
+    else
+        DSS_RecreateArray_PInteger(ResultPtr, ResultCount, 0);
+end;
+
+procedure ContingencyStudy_Get_NumOverloads_GR(); CDECL;
+// Same as ContingencyStudy_Get_NumOverloads but uses global result (GR) pointers
+begin
+    ContingencyStudy_Get_NumOverloads(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0])
+end;
+//------------------------------------------------------------------------------
+procedure ContingencyStudy_Get_NumEmergOverloads(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PInteger(ResultPtr, ResultCount, res.NumEmergOverloads, res.Count)
+    else
+        DSS_RecreateArray_PInteger(ResultPtr, ResultCount, 0);
+end;
+
+procedure ContingencyStudy_Get_NumEmergOverloads_GR(); CDECL;
+// Same as ContingencyStudy_Get_NumEmergOverloads but uses global result (GR) pointers
+begin
+    ContingencyStudy_Get_NumEmergOverloads(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0])
+end;
+//------------------------------------------------------------------------------
+procedure ContingencyStudy_Get_MaxLoadings(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PDouble(ResultPtr, ResultCount, res.MaxLoadings, res.Count)
+    else
+        DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 0);
+end;
+
+procedure ContingencyStudy_Get_MaxLoadings_GR(); CDECL;
+// Same as ContingencyStudy_Get_MaxLoadings but uses global result (GR) pointers
+begin
+    ContingencyStudy_Get_MaxLoadings(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+//------------------------------------------------------------------------------
+procedure ContingencyStudy_Get_WorstElements(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PPAnsiChar(ResultPtr, ResultCount, res.WorstElements, res.Count)
+    else
+        DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, 0);
+end;
+
+procedure ContingencyStudy_Get_WorstElements_GR(); CDECL;
+// Same as ContingencyStudy_Get_WorstElements but uses global result (GR) pointers
+begin
+    ContingencyStudy_Get_WorstElements(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0])
+end;
+//------------------------------------------------------------------------------
+end.
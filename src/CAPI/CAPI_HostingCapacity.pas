@@ -0,0 +1,171 @@
+unit CAPI_HostingCapacity;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+interface
+
+uses
+    CAPI_Utils,
+    CAPI_Types;
+
+function HostingCapacity_Run(BusesPtr: PPAnsiChar; BusesCount: TAPISize; MaxkW, MaxDeviation, ReachFraction: Double; NumThreads: Integer): Integer; CDECL;
+function HostingCapacity_Get_Count(): Integer; CDECL;
+procedure HostingCapacity_Get_BusNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+procedure HostingCapacity_Get_BusNames_GR(); CDECL;
+procedure HostingCapacity_Get_Capacities(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure HostingCapacity_Get_Capacities_GR(); CDECL;
+procedure HostingCapacity_Get_Estimates(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure HostingCapacity_Get_Estimates_GR(); CDECL;
+procedure HostingCapacity_Get_Constraints(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+procedure HostingCapacity_Get_Constraints_GR(); CDECL;
+procedure HostingCapacity_Get_LimitingElements(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+procedure HostingCapacity_Get_LimitingElements_GR(); CDECL;
+procedure HostingCapacity_Get_NumSolutions(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+procedure HostingCapacity_Get_NumSolutions_GR(); CDECL;
+
+implementation
+
+uses
+    SysUtils,
+    DSSGlobals,
+    DSSClass,
+    DSSHelper,
+    HostingCapacity;
+
+type
+    TStudy = THostingCapacityResults;
+
+//------------------------------------------------------------------------------
+function _results(DSS: TDSSContext; out res: TStudy): Boolean; inline;
+begin
+    res := TStudy(DSS.HostingCapacityResults);
+    Result := (res <> NIL);
+end;
+
+//------------------------------------------------------------------------------
+function HostingCapacity_Run(BusesPtr: PPAnsiChar; BusesCount: TAPISize; MaxkW, MaxDeviation, ReachFraction: Double; NumThreads: Integer): Integer; CDECL;
+var
+    BusSpecs: PPAnsiCharArray0;
+    Buses: Array of String;
+    i: Integer;
+begin
+    Result := 0;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    BusSpecs := PPAnsiCharArray0(BusesPtr);
+    SetLength(Buses, BusesCount);
+    for i := 0 to BusesCount - 1 do
+        Buses[i] := BusSpecs[i];
+    if RunHostingCapacity(DSSPrime, Buses, MaxkW, MaxDeviation, ReachFraction, NumThreads) then
+        Result := TStudy(DSSPrime.HostingCapacityResults).Count;
+end;
+//------------------------------------------------------------------------------
+function HostingCapacity_Get_Count(): Integer; CDECL;
+var
+    res: TStudy;
+begin
+    Result := 0;
+    if _results(DSSPrime, res) then
+        Result := res.Count;
+end;
+//------------------------------------------------------------------------------
+procedure HostingCapacity_Get_BusNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PPAnsiChar(ResultPtr, ResultCount, res.BusNames, res.Count)
+    else
+        DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, 0);
+end;
+
+procedure HostingCapacity_Get_BusNames_GR(); CDECL;
+// Same as HostingCapacity_Get_BusNames but uses global result (GR) pointers
+begin
+    HostingCapacity_Get_BusNames(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0])
+end;
+//------------------------------------------------------------------------------
+procedure HostingCapacity_Get_Capacities(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PDouble(ResultPtr, ResultCount, res.Capacities, res.Count)
+    else
+        DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 0);
+end;
+
+procedure HostingCapacity_Get_Capacities_GR(); CDECL;
+// Same as HostingCapacity_Get_Capacities but uses global result (GR) pointers
+begin
+    HostingCapacity_Get_Capacities(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+//------------------------------------------------------------------------------
+procedure HostingCapacity_Get_Estimates(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PDouble(ResultPtr, ResultCount, res.Estimates, res.Count)
+    else
+        DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 0);
+end;
+
+procedure HostingCapacity_Get_Estimates_GR(); CDECL;
+// Same as HostingCapacity_Get_Estimates but uses global result (GR) pointers
+begin
+    HostingCapacity_Get_Estimates(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+//------------------------------------------------------------------------------
+procedure HostingCapacity_Get_Constraints(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PInteger(ResultPtr, ResultCount, res.Constraints, res.Count)
+    else
+        DSS_RecreateArray_PInteger(ResultPtr, ResultCount, 0);
+end;
+
+procedure HostingCapacity_Get_Constraints_GR(); CDECL;
+// Same as HostingCapacity_Get_Constraints but uses global result (GR) pointers
+begin
+    HostingCapacity_Get_Constraints(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0])
+end;
+//------------------------------------------------------------------------------
+procedure HostingCapacity_Get_LimitingElements(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PPAnsiChar(ResultPtr, ResultCount, res.LimitingElements, res.Count)
+    else
+        DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, 0);
+end;
+
+procedure HostingCapacity_Get_LimitingElements_GR(); CDECL;
+// Same as HostingCapacity_Get_LimitingElements but uses global result (GR) pointers
+begin
+    HostingCapacity_Get_LimitingElements(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0])
+end;
+//------------------------------------------------------------------------------
+procedure HostingCapacity_Get_NumSolutions(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PInteger(ResultPtr, ResultCount, res.NumSolutions, res.Count)
+    else
+        DSS_RecreateArray_PInteger(ResultPtr, ResultCount, 0);
+end;
+
+procedure HostingCapacity_Get_NumSolutions_GR(); CDECL;
+// Same as HostingCapacity_Get_NumSolutions but uses global result (GR) pointers
+begin
+    HostingCapacity_Get_NumSolutions(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0])
+end;
+//------------------------------------------------------------------------------
+end.
@@ -72,6 +72,16 @@ procedure Meters_Get_ZonePCE(var ResultPtr: PPAnsiChar; ResultCount: PAPISize);
 function Meters_Get_idx(): Integer; CDECL;
 procedure Meters_Set_idx(Value: Integer); CDECL;
 function Meters_Get_Pointer(): Pointer; CDECL;
+procedure Meters_Get_DIColumnNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; Table: Integer); CDECL;
+procedure Meters_Get_DIColumnNames_GR(Table: Integer); CDECL;
+procedure Meters_Get_DIHours(var ResultPtr: PDouble; ResultCount: PAPISize; Table: Integer); CDECL;
+procedure Meters_Get_DIHours_GR(Table: Integer); CDECL;
+procedure Meters_Get_DIColumn(var ResultPtr: PDouble; ResultCount: PAPISize; Table, Column: Integer); CDECL;
+procedure Meters_Get_DIColumn_GR(Table, Column: Integer); CDECL;
+procedure Meters_Get_DIColumnText(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; Table, Column: Integer); CDECL;
+procedure Meters_Get_DIColumnText_GR(Table, Column: Integer); CDECL;
+procedure Meters_Get_DIData(var ResultPtr: PDouble; ResultCount: PAPISize; Table: Integer); CDECL;
+procedure Meters_Get_DIData_GR(Table: Integer); CDECL;
 
 implementation
 
@@ -906,4 +916,113 @@ begin
     Result := DSSPrime.ActiveCircuit.EnergyMeters.Active
 end;
 //------------------------------------------------------------------------------
+function _tableMeter(DSS: TDSSContext; Table: Integer; out obj: TEnergyMeterObj): Boolean;
+// The tables of a meter need an active meter; the others only a circuit
+begin
+    if (Table = ord(TMeterTableID.Meter)) or (Table = ord(TMeterTableID.PhaseVoltageReport)) then
+    begin
+        Result := _activeObj(DSS, obj);
+        Exit;
+    end;
+    obj := NIL;
+    Result := not InvalidCircuit(DSS);
+end;
+//------------------------------------------------------------------------------
+procedure Meters_Get_DIColumnNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; Table: Integer); CDECL;
+var
+    pMeterObj: TEnergyMeterObj;
+begin
+    if not _tableMeter(DSSPrime, Table, pMeterObj) then
+    begin
+        DefaultResult(ResultPtr, ResultCount, '');
+        Exit;
+    end;
+    _Alt_Meter_Get_DIColumnNames(DSSPrime, ResultPtr, ResultCount, pMeterObj, Table);
+end;
+
+procedure Meters_Get_DIColumnNames_GR(Table: Integer); CDECL;
+// Same as Meters_Get_DIColumnNames but uses global result (GR) pointers
+begin
+    Meters_Get_DIColumnNames(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0], Table)
+end;
+//------------------------------------------------------------------------------
+procedure Meters_Get_DIHours(var ResultPtr: PDouble; ResultCount: PAPISize; Table: Integer); CDECL;
+var
+    pMeterObj: TEnergyMeterObj;
+begin
+    if not _tableMeter(DSSPrime, Table, pMeterObj) then
+    begin
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    _Alt_Meter_Get_DIHours(DSSPrime, ResultPtr, ResultCount, pMeterObj, Table);
+end;
+
+procedure Meters_Get_DIHours_GR(Table: Integer); CDECL;
+// Same as Meters_Get_DIHours but uses global result (GR) pointers
+begin
+    Meters_Get_DIHours(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0], Table)
+end;
+//------------------------------------------------------------------------------
+procedure Meters_Get_DIColumn(var ResultPtr: PDouble; ResultCount: PAPISize; Table, Column: Integer); CDECL;
+var
+    pMeterObj: TEnergyMeterObj;
+begin
+    if not _tableMeter(DSSPrime, Table, pMeterObj) then
+    begin
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    if Column = 0 then
+    begin
+        // 0 (all the columns) is used by Meters_Get_DIData
+        DoSimpleMsg(DSSPrime, 'Invalid column index (%d) for the meter table; the columns start at 1.', [Column], 20240774);
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    _Alt_Meter_Get_DIColumn(DSSPrime, ResultPtr, ResultCount, pMeterObj, Table, Column);
+end;
+
+procedure Meters_Get_DIColumn_GR(Table, Column: Integer); CDECL;
+// Same as Meters_Get_DIColumn but uses global result (GR) pointers
+begin
+    Meters_Get_DIColumn(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0], Table, Column)
+end;
+//------------------------------------------------------------------------------
+procedure Meters_Get_DIColumnText(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; Table, Column: Integer); CDECL;
+var
+    pMeterObj: TEnergyMeterObj;
+begin
+    if not _tableMeter(DSSPrime, Table, pMeterObj) then
+    begin
+        DefaultResult(ResultPtr, ResultCount, '');
+        Exit;
+    end;
+    _Alt_Meter_Get_DIColumnText(DSSPrime, ResultPtr, ResultCount, pMeterObj, Table, Column);
+end;
+
+procedure Meters_Get_DIColumnText_GR(Table, Column: Integer); CDECL;
+// Same as Meters_Get_DIColumnText but uses global result (GR) pointers
+begin
+    Meters_Get_DIColumnText(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0], Table, Column)
+end;
+//------------------------------------------------------------------------------
+procedure Meters_Get_DIData(var ResultPtr: PDouble; ResultCount: PAPISize; Table: Integer); CDECL;
+var
+    pMeterObj: TEnergyMeterObj;
+begin
+    if not _tableMeter(DSSPrime, Table, pMeterObj) then
+    begin
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    _Alt_Meter_Get_DIColumn(DSSPrime, ResultPtr, ResultCount, pMeterObj, Table, 0);
+end;
+
+procedure Meters_Get_DIData_GR(Table: Integer); CDECL;
+// Same as Meters_Get_DIData but uses global result (GR) pointers
+begin
+    Meters_Get_DIData(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0], Table)
+end;
+//------------------------------------------------------------------------------
 end.
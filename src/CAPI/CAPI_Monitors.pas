@@ -48,6 +48,12 @@ procedure Monitors_Set_Terminal(Value: Integer); CDECL;
 function Monitors_Get_idx(): Integer; CDECL;
 procedure Monitors_Set_idx(Value: Integer); CDECL;
 function Monitors_Get_Pointer(): Pointer; CDECL;
+procedure Monitors_Get_ChannelMatrix(var ResultPtr: PDouble; ResultCount: PAPISize; NamesPtr: PPAnsiChar; NamesCount: TAPISize; NumThreads: Integer); CDECL;
+procedure Monitors_Get_ChannelMatrix_GR(NamesPtr: PPAnsiChar; NamesCount: TAPISize; NumThreads: Integer); CDECL;
+procedure Monitors_Get_ChannelMatrixSingle(var ResultPtr: PSingle; ResultCount: PAPISize; NamesPtr: PPAnsiChar; NamesCount: TAPISize; NumThreads: Integer); CDECL;
+procedure Monitors_Get_ChannelMatrixIndex(var ResultPtr: PInteger; ResultCount: PAPISize; NamesPtr: PPAnsiChar; NamesCount: TAPISize); CDECL;
+procedure Monitors_Get_ChannelMatrixIndex_GR(NamesPtr: PPAnsiChar; NamesCount: TAPISize); CDECL;
+function Monitors_Get_StorageSize(): UInt64; CDECL;
 
 implementation
 
@@ -61,12 +67,26 @@ uses
     DSSClass,
     DSSHelper,
     DSSObjectHelper,
+    ParallelLoop,
     CAPI_Alt;
 
 type
     SingleArray = array[1..100] of Single;
     pSingleArray = ^SingleArray;
 
+    // Copies the channels of the selected monitors into the blocks of the
+    // matrix returned by Monitors_Get_ChannelMatrix(Single), one monitor per item
+    TChannelMatrixFiller = class(TObject)
+    public
+        Monitors: Array of TMonitorObj;
+        Offsets: Array of Int64;
+        Total: Int64;
+        DestDouble: PDoubleArray0;
+        DestSingle: PSingleArray0;
+
+        procedure Fill(Index, Worker: Integer);
+    end;
+
 //------------------------------------------------------------------------------
 function _activeObj(DSSPrime: TDSSContext; out obj: TMonitorObj): Boolean; inline;
 begin
@@ -230,10 +250,9 @@ begin
         Exit;
     end;
 
-    DSS_RecreateArray_PByte(ResultPtr, ResultCount, pmon.MonitorStream.Size);
-    pmon.MonitorStream.Seek(0, soFromBeginning);
-    pmon.MonitorStream.Read(ResultPtr^, pmon.MonitorStream.Size);   // Move it all over
-    // leaves stream at the end
+    DSS_RecreateArray_PByte(ResultPtr, ResultCount, pmon.RawSize());
+    pmon.CopyRaw(ResultPtr); // Move it all over, decompressing the records if required
+    pmon.MonitorStream.Seek(0, soFromEnd); // leaves stream at the end
 end;
 
 procedure Monitors_Get_ByteStream_GR(); CDECL;
@@ -319,6 +338,11 @@ begin
         Exit;
     end;
     Result := DSS_RecreateArray_PDouble(ResultPtr, ResultCount, pMon.SampleCount);
+    if pMon.Compressed then
+    begin
+        pMon.ReadColumn(Index + 1, Result); // Skip Hour and Second fields
+        Exit;
+    end;
 
     AllocSize := Sizeof(Single) * (pMon.RecordSize + 2); // Include Hour and Second fields
     Index := Index + 2; // Skip Hour and Second fields
@@ -519,4 +543,161 @@ begin
     Result := DSSPrime.ActiveCircuit.Monitors.Active
 end;
 //------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+procedure TChannelMatrixFiller.Fill(Index, Worker: Integer);
+begin
+    if DestDouble <> NIL then
+        Monitors[Index].CopyChannels(PDoubleArray0(@DestDouble[Offsets[Index]]))
+    else
+        Monitors[Index].CopyChannels(PSingleArray0(@DestSingle[Offsets[Index]]));
+end;
+
+function _selectMonitors(DSSPrime: TDSSContext; NamesPtr: PPAnsiChar; NamesCount: TAPISize): TChannelMatrixFiller;
+// Monitors given by name (all of them, if none), with the offsets of their blocks
+var
+    Names: PPAnsiCharArray0;
+    pMon: TMonitorObj;
+    i: Integer;
+begin
+    Result := NIL;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+
+    Result := TChannelMatrixFiller.Create();
+    if NamesCount <= 0 then
+    begin
+        SetLength(Result.Monitors, DSSPrime.ActiveCircuit.Monitors.Count);
+        i := 0;
+        for pMon in DSSPrime.ActiveCircuit.Monitors do
+        begin
+            Result.Monitors[i] := pMon;
+            Inc(i);
+        end;
+    end
+    else
+    begin
+        Names := PPAnsiCharArray0(NamesPtr);
+        SetLength(Result.Monitors, NamesCount);
+        for i := 0 to NamesCount - 1 do
+        begin
+            pMon := TMonitorObj(DSSPrime.MonitorClass.Find(Names[i], False));
+            if pMon = NIL then
+            begin
+                DoSimpleMsg(DSSPrime, 'Monitors.ChannelMatrix: monitor "%s" not found.', [Names[i]], 20240760);
+                FreeAndNil(Result);
+                Exit;
+            end;
+            Result.Monitors[i] := pMon;
+        end;
+    end;
+
+    SetLength(Result.Offsets, Length(Result.Monitors));
+    Result.Total := 0;
+    for i := 0 to High(Result.Monitors) do
+    begin
+        pMon := Result.Monitors[i];
+        Result.Offsets[i] := Result.Total;
+        Result.Total := Result.Total + Int64(pMon.StoredSampleCount()) * (pMon.RecordSize + 2);
+    end;
+    if Result.Total > High(Integer) then
+    begin
+        DoSimpleMsg(DSSPrime, 'Monitors.ChannelMatrix: the data of the selected monitors is too large (%d values) for a single matrix; select fewer monitors.', [Result.Total], 20240761);
+        FreeAndNil(Result);
+    end;
+end;
+
+procedure Monitors_Get_ChannelMatrix(var ResultPtr: PDouble; ResultCount: PAPISize; NamesPtr: PPAnsiChar; NamesCount: TAPISize; NumThreads: Integer); CDECL;
+// All channels of the selected monitors (all monitors if NamesCount is 0) in a
+// single array; see Monitors_Get_ChannelMatrixIndex for the layout
+var
+    Filler: TChannelMatrixFiller;
+begin
+    Filler := _selectMonitors(DSSPrime, NamesPtr, NamesCount);
+    if Filler = NIL then
+    begin
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    try
+        Filler.DestDouble := DSS_RecreateArray_PDouble(ResultPtr, ResultCount, Filler.Total);
+        Filler.DestSingle := NIL;
+        ParallelFor(Length(Filler.Monitors), Filler.Fill, NumThreads);
+    finally
+        Filler.Free;
+    end;
+end;
+
+procedure Monitors_Get_ChannelMatrix_GR(NamesPtr: PPAnsiChar; NamesCount: TAPISize; NumThreads: Integer); CDECL;
+// Same as Monitors_Get_ChannelMatrix but uses global result (GR) pointers
+begin
+    Monitors_Get_ChannelMatrix(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0], NamesPtr, NamesCount, NumThreads)
+end;
+
+//------------------------------------------------------------------------------
+procedure Monitors_Get_ChannelMatrixSingle(var ResultPtr: PSingle; ResultCount: PAPISize; NamesPtr: PPAnsiChar; NamesCount: TAPISize; NumThreads: Integer); CDECL;
+// Same as Monitors_Get_ChannelMatrix, keeping the float32 values of the monitor
+// streams. There are no global result pointers for float32.
+var
+    Filler: TChannelMatrixFiller;
+begin
+    Filler := _selectMonitors(DSSPrime, NamesPtr, NamesCount);
+    if Filler = NIL then
+    begin
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    try
+        Filler.DestSingle := DSS_RecreateArray_PSingle(ResultPtr, ResultCount, Filler.Total);
+        Filler.DestDouble := NIL;
+        ParallelFor(Length(Filler.Monitors), Filler.Fill, NumThreads);
+    finally
+        Filler.Free;
+    end;
+end;
+
+//------------------------------------------------------------------------------
+procedure Monitors_Get_ChannelMatrixIndex(var ResultPtr: PInteger; ResultCount: PAPISize; NamesPtr: PPAnsiChar; NamesCount: TAPISize); CDECL;
+// For each selected monitor: offset of its block in Monitors_Get_ChannelMatrix,
+// number of samples (rows) and number of columns (channels + 2)
+var
+    Result: PIntegerArray0;
+    Filler: TChannelMatrixFiller;
+    i: Integer;
+begin
+    Filler := _selectMonitors(DSSPrime, NamesPtr, NamesCount);
+    if Filler = NIL then
+    begin
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    try
+        Result := DSS_RecreateArray_PInteger(ResultPtr, ResultCount, 3 * Length(Filler.Monitors), 3, Length(Filler.Monitors));
+        for i := 0 to High(Filler.Monitors) do
+        begin
+            Result[3 * i] := Filler.Offsets[i];
+            Result[3 * i + 1] := Filler.Monitors[i].StoredSampleCount();
+            Result[3 * i + 2] := Filler.Monitors[i].RecordSize + 2;
+        end;
+    finally
+        Filler.Free;
+    end;
+end;
+
+procedure Monitors_Get_ChannelMatrixIndex_GR(NamesPtr: PPAnsiChar; NamesCount: TAPISize); CDECL;
+// Same as Monitors_Get_ChannelMatrixIndex but uses global result (GR) pointers
+begin
+    Monitors_Get_ChannelMatrixIndex(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0], NamesPtr, NamesCount)
+end;
+
+//------------------------------------------------------------------------------
+function Monitors_Get_StorageSize(): UInt64; CDECL;
+var
+    pMon: TMonitorObj;
+begin
+    Result := 0;
+    if not _activeObj(DSSPrime, pMon) then
+        Exit;
+    Result := pMon.StorageSize();
+end;
+
 end.
@@ -37,7 +37,8 @@ uses
     DSSObject,
     fpjson,
     Circuit,
-    DSSClass;
+    DSSClass,
+    DSSJSONWriter;
 
 type
     dss_obj_float64_function_t = function (obj: Pointer): Double; CDECL;
@@ -115,12 +116,14 @@ procedure Obj_SetObjectArray(obj: TDSSObject; Index: Integer; Value: TDSSObjectP
 // internal functions
 function Obj_ToJSON_(obj: TDSSObject; joptions: Integer): String;
 function Obj_ToJSONData(obj: TDSSObject; joptions: Integer): TJSONData;
+procedure Obj_WriteJSON(obj: TDSSObject; joptions: Integer; W: TDSSJSONWriter);
 
 // Batch: creation and state setup
 procedure Batch_CreateFromNew(DSS: TDSSContext; var ResultPtr: TDSSObjectPtr; ResultCount: PAPISize; ClsIdx: Integer; Names: PPAnsiChar; Count: Integer; BeginEdit: TAltAPIBoolean); CDECL;
 procedure Batch_Dispose(batch: Pointer); CDECL;
 procedure Batch_BeginEdit(batch: TDSSObjectPtr; batchSize: Integer); CDECL;
 procedure Batch_EndEdit(batch: TDSSObjectPtr; batchSize: Integer; NumEdits: Integer); CDECL;
+function Batch_Commit(DSS: TDSSContext): Integer; CDECL;
 procedure Batch_GetPropSeq(var ResultPtr: PInteger; ResultCount: PAPISize; batch: TDSSObjectPtr; batchSize: Integer); CDECL;
 
 // Batch -- using class and property indices
@@ -188,6 +191,7 @@ procedure Batch_SetObjectArrayS(batch: TDSSObjectPtr; batchSize: Integer; Name:
 
 // JSON functions, internal
 function Obj_Circuit_ToJSON_(ckt: TDSSCircuit; joptions: Integer): PAnsiChar;
+procedure Obj_Circuit_WriteJSON_(ckt: TDSSCircuit; joptions: Integer; W: TDSSJSONWriter);
 procedure Obj_Circuit_FromJSON_(DSS: TDSSContext; jckt: TJSONObject; joptions: Integer);
 
 implementation
@@ -214,7 +218,8 @@ uses
     jsonparser,
     Bus,
     DateUtils,
-    DynEqPCE;
+    DynEqPCE,
+    EditTransaction;
 
 procedure DSS_Dispose_String(S: PAnsiChar); CDECL;
 begin
@@ -623,51 +628,20 @@ begin
     obj.GetObjects(Index, ResultPtr, ResultCount);
 end;
 
-function Obj_ToJSONData(obj: TDSSObject; joptions: Integer): TJSONData;
+function Obj_JSONProperties(obj: TDSSObject; joptions: Integer): ArrayOfInteger;
+// Indices of the properties written to the JSON output of the object, in order
 var
-    iProp, iPropNext, iPropNext2: Integer;
-    jvalue: TJSONData = NIL;
+    iProp, iPropNext, iPropNext2, n: Integer;
     cls: TDSSClass;
     done: array of Boolean;
-    resObj: TJSONObject;
-    pnames: pStringArray;
-    dynObj: TDynEqPCE;
 begin
-    Result := NIL;
-    if obj = NIL then
-        Exit;
-
     cls := obj.ParentClass;
-
-    if (joptions and Integer(DSSJSONOptions.LowercaseKeys)) = 0 then
-    begin
-        pnames := cls.PropertyNameJSON;
-    end
-    else
-    begin
-        pnames := cls.PropertyNameLowercase;
-    end;
-
-    if (joptions and Integer(DSSJSONOptions.IncludeDSSClass)) <> 0 then
-    begin
-        if (joptions and Integer(DSSJSONOptions.LowercaseKeys)) = 0 then
-            Result := TJSONObject.Create(['DSSClass', cls.Name, 'Name', obj.Name])
-        else
-            Result := TJSONObject.Create(['dssclass', cls.Name, 'Name', obj.Name]);
-    end
-    else
-        Result := TJSONObject.Create(['Name', obj.Name]);
-
-    SetLength(done, cls.NumProperties);
-
-    resObj := Result as TJSONObject;
+    SetLength(Result, cls.NumProperties);
+    SetLength(done, cls.NumProperties + 1);
+    n := 0;
 
     if (joptions and Integer(DSSJSONOptions.Full)) = 0 then
     begin
-        // Clear done status
-        SetLength(done, 0);
-        SetLength(done, cls.NumProperties);
-
         // Return only filled properties, but adjust some odd ones
         iPropNext := obj.GetNextPropertySet(-9999999);
         iPropNext2 := 0;
@@ -728,8 +702,8 @@ begin
                 (TPropertyFlag.IntegerStructIndex in cls.PropertyFlags[iProp]) then
                 continue;
 
-            if cls.GetObjPropertyJSONValue(Pointer(obj), iProp, joptions, jvalue, True) then
-                resObj.Add(pnames[iProp], jvalue);
+            Result[n] := iProp;
+            Inc(n);
         end;
     end
     else
@@ -745,10 +719,55 @@ begin
                 (TPropertyFlag.IntegerStructIndex in cls.PropertyFlags[iProp]) then
                 continue;
 
-            if cls.GetObjPropertyJSONValue(Pointer(obj), iProp, joptions, jvalue, True) then
-                resObj.Add(pnames[iProp], jvalue);
+            Result[n] := iProp;
+            Inc(n);
         end;
     end;
+    SetLength(Result, n);
+end;
+
+function Obj_ToJSONData(obj: TDSSObject; joptions: Integer): TJSONData;
+var
+    iProp: Integer;
+    jvalue: TJSONData = NIL;
+    cls: TDSSClass;
+    resObj: TJSONObject;
+    pnames: pStringArray;
+    dynObj: TDynEqPCE;
+begin
+    Result := NIL;
+    if obj = NIL then
+        Exit;
+
+    cls := obj.ParentClass;
+
+    if (joptions and Integer(DSSJSONOptions.LowercaseKeys)) = 0 then
+    begin
+        pnames := cls.PropertyNameJSON;
+    end
+    else
+    begin
+        pnames := cls.PropertyNameLowercase;
+    end;
+
+    if (joptions and Integer(DSSJSONOptions.IncludeDSSClass)) <> 0 then
+    begin
+        if (joptions and Integer(DSSJSONOptions.LowercaseKeys)) = 0 then
+            Result := TJSONObject.Create(['DSSClass', cls.Name, 'Name', obj.Name])
+        else
+            Result := TJSONObject.Create(['dssclass', cls.Name, 'Name', obj.Name]);
+    end
+    else
+        Result := TJSONObject.Create(['Name', obj.Name]);
+
+    resObj := Result as TJSONObject;
+
+    for iProp in Obj_JSONProperties(obj, joptions) do
+    begin
+        if cls.GetObjPropertyJSONValue(Pointer(obj), iProp, joptions, jvalue, True) then
+            resObj.Add(pnames[iProp], jvalue);
+    end;
+
     if not (obj is TDynEqPCE) then
         Exit;
     
@@ -759,28 +778,71 @@ begin
     resObj.Add('DynInit', dynObj.UserDynInit.Clone());
 end;
 
+procedure Obj_WriteJSON(obj: TDSSObject; joptions: Integer; W: TDSSJSONWriter);
+// Same output as Obj_ToJSONData, written directly by W
+var
+    iProp: Integer;
+    cls: TDSSClass;
+    pnames: pStringArray;
+    dynObj: TDynEqPCE;
+begin
+    if obj = NIL then
+        Exit;
+
+    cls := obj.ParentClass;
+
+    if (joptions and Integer(DSSJSONOptions.LowercaseKeys)) = 0 then
+        pnames := cls.PropertyNameJSON
+    else
+        pnames := cls.PropertyNameLowercase;
+
+    W.BeginObject();
+    if (joptions and Integer(DSSJSONOptions.IncludeDSSClass)) <> 0 then
+    begin
+        if (joptions and Integer(DSSJSONOptions.LowercaseKeys)) = 0 then
+            W.Key('DSSClass')
+        else
+            W.Key('dssclass');
+        W.AddStr(cls.Name);
+    end;
+    W.Key('Name');
+    W.AddStr(obj.Name);
+
+    for iProp in Obj_JSONProperties(obj, joptions) do
+    begin
+        W.Key(pnames[iProp]);
+        cls.WriteObjPropertyJSON(Pointer(obj), iProp, joptions, W);
+    end;
+
+    if obj is TDynEqPCE then
+    begin
+        dynObj := obj as TDynEqPCE;
+        if dynObj.UserDynInit <> NIL then
+        begin
+            W.Key('DynInit');
+            W.AddData(dynObj.UserDynInit);
+        end;
+    end;
+    W.EndObject();
+end;
+
 function Obj_ToJSON_(obj: TDSSObject; joptions: Integer): String;
 var
-    json: TJSONData = NIL;
+    W: TDSSJSONWriter = NIL;
 begin
     Result := '';
     if obj = NIL then
         Exit;
 
     try
-        json := Obj_ToJSONData(obj, joptions);
-        if json <> NIL then
-        begin
-            if (Integer(DSSJSONOptions.Pretty) and joptions) <> 0 then
-                Result := json.FormatJSON([], 2)
-            else
-                Result := json.FormatJSON([foSingleLineArray, foSingleLineObject, foskipWhiteSpace], 0);
-        end;
+        W := TDSSJSONWriter.Create(NIL, (Integer(DSSJSONOptions.Pretty) and joptions) <> 0);
+        Obj_WriteJSON(obj, joptions, W);
+        Result := W.Text();
     except
         on E: Exception do
             obj.DoSimpleMsg('Error converting object data to JSON: %s', [E.message], 5020);
     end;
-    FreeAndNil(json);
+    FreeAndNil(W);
 end;
 
 function Obj_ToJSON(obj: TDSSObject; joptions: Integer): PAnsiChar; CDECL;
@@ -796,35 +858,19 @@ begin
 end;
 
 procedure Batch_BeginEdit(batch: TDSSObjectPtr; batchSize: Integer); CDECL;
-var
-    i: Integer;
-    cls: TDSSClass;
 begin
-    if (batch = NIL) or (batch^ = NIL) or (batchSize <= 0) then
-        Exit;
-
-    cls := batch^.ParentClass;
-    for i := 1 to batchSize do
-    begin
-        cls.BeginEdit(batch^, False);
-        inc(batch);
-    end;
+    TransactionBeginEdit(batch, batchSize);
 end;
 
 procedure Batch_EndEdit(batch: TDSSObjectPtr; batchSize: Integer; NumEdits: Integer); CDECL;
-var
-    i: Integer;
-    cls: TDSSClass;
 begin
-    if (batch = NIL) or (batch^ = NIL) or (batchSize <= 0) then
-        Exit;
+    TransactionEndEdit(batch, batchSize, NumEdits);
+end;
 
-    cls := batch^.ParentClass;
-    for i := 1 to batchSize do
-    begin
-        cls.EndEdit(batch^, NumEdits);
-        inc(batch);
-    end;
+function Batch_Commit(DSS: TDSSContext): Integer; CDECL;
+begin
+    if DSS = NIL then DSS := DSSPrime;
+    Result := TransactionCommit(DSS);
 end;
 
 procedure ensureBatchSize(maxSize: Integer; var ResultPtr: TDSSObjectPtr; ResultCount: PAPISize);
@@ -1200,7 +1246,7 @@ end;
 
 function Batch_ToJSON(batch: TDSSObjectPtr; batchSize: Integer; joptions: Integer): PAnsiChar; CDECL;
 var
-    json: TJSONArray = NIL;
+    W: TDSSJSONWriter = NIL;
     i: Integer;
     exportDefaultObjs: Boolean;
 begin
@@ -1216,13 +1262,14 @@ begin
     end;
 
     try
-        json := TJSONArray.Create([]);
+        W := TDSSJSONWriter.Create(NIL, (Integer(DSSJSONOptions.Pretty) and joptions) <> 0);
+        W.BeginArray();
         if ((joptions and Integer(DSSJSONOptions.ExcludeDisabled)) = 0) or not (batch^ is TDSSCktElement) then
         begin
             for i := 1 to batchSize do
             begin
                 if (not (Flg.DefaultAndUnedited in batch^.Flags)) or exportDefaultObjs then
-                    json.Add(Obj_ToJSONData(batch^, joptions));
+                    Obj_WriteJSON(batch^, joptions, W);
 
                 inc(batch);
             end;
@@ -1234,23 +1281,18 @@ begin
                 // NOTE: Default objects are circuit elements, so we can skip the check here.
                 // if ((not (Flg.DefaultAndUnedited in batch^.Flags)) or exportDefaultObjs) and
                 if TDSSCktElement(batch^).Enabled then
-                    json.Add(Obj_ToJSONData(batch^, joptions));
+                    Obj_WriteJSON(batch^, joptions, W);
 
                 inc(batch);
             end;
         end;
-        if json <> NIL then
-        begin
-            if (Integer(DSSJSONOptions.Pretty) and joptions) <> 0 then
-                Result := DSS_CopyStringAsPChar(json.FormatJSON([], 2))
-            else
-                Result := DSS_CopyStringAsPChar(json.FormatJSON([foSingleLineArray, foSingleLineObject, foskipWhiteSpace], 0));
-        end;
+        W.EndArray();
+        Result := DSS_CopyStringAsPChar(W.Text());
     except
         on E: Exception do
             batch^.DoSimpleMsg('Error converting batch data to JSON: %s', [E.message], 5020);
     end;
-    FreeAndNil(json);
+    FreeAndNil(W);
 end;
 
 procedure Batch_GetFloat64(var ResultPtr: PDouble; ResultCount: PAPISize; batch: TDSSObjectPtr; batchSize: Integer; Index: Integer); CDECL;
@@ -2467,7 +2509,7 @@ begin
 end;
 
 //------------------------------------------------------------------------------
-procedure saveOpenTerminalsJSON(ckt: TDSSCircuit; var cmds: TJSONArray);
+procedure saveOpenTerminalsJSON(ckt: TDSSCircuit; W: TDSSJSONWriter);
 // Equivalent of TDSSCircuit.SaveOpenTerminals
 var
     elem: TDSSCktElement;
@@ -2494,7 +2536,7 @@ begin
             if numCondOpen = elem.NConds then
             begin   
                 // Open all conductors in the terminal, easy path
-                cmds.Add(Format('Open %s %d', [name, termIdx + 1]));
+                W.AddStr(Format('Open %s %d', [name, termIdx + 1]));
                 continue;
             end;
 
@@ -2504,171 +2546,157 @@ begin
                 if elem.Terminals[termIdx].ConductorsClosed[i] then
                     continue;
 
-                cmds.Add(Format('Open %s %d %d', [name, termIdx + 1, i + 1]));
+                W.AddStr(Format('Open %s %d %d', [name, termIdx + 1, i + 1]));
             end;
         end;
     end;
 end;
 
-function Obj_Circuit_ToJSON_(ckt: TDSSCircuit; joptions: Integer): PAnsiChar;
+function Obj_Circuit_HasObjects(cls: TDSSClass; exportDefaultObjs: Boolean): Boolean;
+var
+    obj: TDSSObject;
+begin
+    Result := False;
+    for obj in cls do
+    begin
+        if exportDefaultObjs or not (Flg.DefaultAndUnedited in obj.Flags) then
+        begin
+            Result := True;
+            Exit;
+        end;
+    end;
+end;
+
+procedure Obj_Circuit_WriteJSON_(ckt: TDSSCircuit; joptions: Integer; W: TDSSJSONWriter);
+// The objects are written one by one as they are visited, so only the JSON
+// of the current object is kept as a tree (for the complex properties).
 var
-    circ: TJSONObject = NIL;
-    busArray: TJSONArray = NIL;
-    clsArray: TJSONArray = NIL;
-    cmds: TJSONArray = NIL;
-    // vsrc: TVSourceObj = NIL;
     cls: TDSSClass;
     obj: TDSSObject;
-    first: Boolean;
-    // vsrccls: TDSSClass;
-    bus: TDSSBus;
+    busData: TJSONObject;
     i: Integer;
     exportDefaultObjs: Boolean;
     DSS: TDSSContext;
 begin
     DSS := ckt.DSS;
     exportDefaultObjs := (joptions and Integer(DSSJSONOptions.IncludeDefaultObjs)) <> 0;
-    Result := NIL;
-    try
-        cmds := TJSONArray.Create();
-        if (joptions and Integer(DSSJSONOptions.SkipTimestamp)) = 0 then
-            cmds.Add(Format('! Last saved by AltDSS/%s on %s',  [VersionString, DateToISO8601(Now())]));
-        if ckt.PositiveSequence then
-            cmds.Add(Format('Set CktModel=%s', [ckt.DSS.CktModelEnum.OrdinalToString(Integer(ckt.PositiveSequence))]));
-        if ckt.DuplicatesAllowed then
-            cmds.Add('Set AllowDuplicates=True');
-        if ckt.LongLineCorrection then
-            cmds.Add('Set LongLineCorrection=True');
-
-        cmds.Add('Set EarthModel=' + ckt.DSS.EarthModelEnum.OrdinalToString(ckt.DSS.DefaultEarthModel));
-        cmds.Add('Set VoltageBases=' + GetDSSArray(ckt.LegalVoltageBases));
-        if (joptions and Integer(DSSJSONOptions.SkipBuses)) = 0 then
-        begin
-            busArray := TJSONArray.Create();
-            for i := 1 to ckt.NumBuses do
-            begin
-                busArray.Add(alt_Bus_ToJSON_(ckt.DSS, ckt.Buses[i], joptions));
-            end;
-        end;
 
-        circ := TJSONObject.Create([
-            '$schema', ALTDSS_SCHEMA_ID,
-            'Name', ckt.Name,
-            'DefaultBaseFreq', ckt.DSS.DefaultBaseFreq,
-            'PreCommands', cmds
-            // MakeBusList as a PostCommand is implicit
-        ]);
-        if busArray <> NIL then
+    W.BeginObject();
+    W.Key('$schema');
+    W.AddStr(ALTDSS_SCHEMA_ID);
+    W.Key('Name');
+    W.AddStr(ckt.Name);
+    W.Key('DefaultBaseFreq');
+    W.Add(DSS.DefaultBaseFreq);
+
+    W.Key('PreCommands');
+    W.BeginArray();
+    if (joptions and Integer(DSSJSONOptions.SkipTimestamp)) = 0 then
+        W.AddStr(Format('! Last saved by AltDSS/%s on %s',  [VersionString, DateToISO8601(Now())]));
+    if ckt.PositiveSequence then
+        W.AddStr(Format('Set CktModel=%s', [DSS.CktModelEnum.OrdinalToString(Integer(ckt.PositiveSequence))]));
+    if ckt.DuplicatesAllowed then
+        W.AddStr('Set AllowDuplicates=True');
+    if ckt.LongLineCorrection then
+        W.AddStr('Set LongLineCorrection=True');
+
+    W.AddStr('Set EarthModel=' + DSS.EarthModelEnum.OrdinalToString(DSS.DefaultEarthModel));
+    W.AddStr('Set VoltageBases=' + GetDSSArray(ckt.LegalVoltageBases));
+    // MakeBusList as a PostCommand is implicit
+    W.EndArray();
+
+    if (joptions and Integer(DSSJSONOptions.SkipBuses)) = 0 then
+    begin
+        W.Key('Bus');
+        W.BeginArray();
+        for i := 1 to ckt.NumBuses do
         begin
-            circ.Add('Bus', busArray);
-            busArray := NIL;
+            busData := alt_Bus_ToJSON_(DSS, ckt.Buses[i], joptions);
+            try
+                W.AddData(busData);
+            finally
+                busData.Free();
+            end;
         end;
+        W.EndArray();
+    end;
+
+    // This will be automated later
+    W.Key('PostCommands');
+    W.BeginArray();
+    // W.AddStr('Set Mode=' + DSS.SolveModeEnum.OrdinalToString(ord(ckt.Solution.mode)));
+    W.AddStr('Set ControlMode=' + DSS.ControlModeEnum.OrdinalToString(ckt.Solution.Controlmode));
+    W.AddStr('Set Random=' + DSS.RandomModeEnum.OrdinalToString(ckt.Solution.RandomType));
+    W.AddStr('Set frequency=' + Format('%-g', [ckt.Solution.Frequency]));
+    W.AddStr('Set stepsize=' + Format('%-g', [ckt.Solution.DynaVars.h]));
+    W.AddStr('Set number=' + IntToStr(ckt.Solution.NumberOfTimes));
+    W.AddStr('Set tolerance=' + Format('%-g', [ckt.Solution.ConvergenceTolerance]));
+    W.AddStr('Set maxiterations=' + IntToStr(ckt.Solution.MaxIterations));
+    W.AddStr('Set miniterations=' + IntToStr(ckt.Solution.MinIterations));
+    W.AddStr('Set loadmodel=' + DSS.DefaultLoadModelEnum.OrdinalToString(ckt.Solution.LoadModel));
+    W.AddStr('Set loadmult=' + Format('%-g', [ckt.LoadMultiplier]));
+    W.AddStr('Set Normvminpu=' + Format('%-g', [ckt.NormalMinVolts]));
+    W.AddStr('Set Normvmaxpu=' + Format('%-g', [ckt.NormalMaxVolts]));
+    W.AddStr('Set Emergvminpu=' + Format('%-g', [ckt.EmergMinVolts]));
+    W.AddStr('Set Emergvmaxpu=' + Format('%-g', [ckt.EmergMaxVolts]));
+    W.AddStr('Set %mean=' + Format('%-.4g', [ckt.DefaultDailyShapeObj.Mean * 100.0]));
+    W.AddStr('Set %stddev=' + Format('%-.4g', [ckt.DefaultDailyShapeObj.StdDev * 100.0]));
+    W.AddStr('Set LDCurve=' + NameIfNotNil(ckt.LoadDurCurveObj));
+    W.AddStr('Set %growth=' + Format('%-.4g', [((ckt.DefaultGrowthRate - 1.0) * 100.0)]));  // default growth rate
+    W.AddStr('Set genkw=' + Format('%-g', [ckt.AutoAddObj.GenkW]));
+    W.AddStr('Set genpf=' + Format('%-g', [ckt.AutoAddObj.GenPF]));
+    W.AddStr('Set capkvar=' + Format('%-g', [ckt.AutoAddObj.Capkvar]));
+    W.AddStr('Set addtype=' + DSS.AddTypeEnum.OrdinalToString(DSS.ActiveCircuit.AutoAddObj.AddType));
+    W.AddStr('Set zonelock=' + StrYorN(ckt.ZonesLocked));
+    W.AddStr(Format('Set ueweight=%8.2f', [ckt.UEWeight]));
+    W.AddStr(Format('Set lossweight=%8.2f', [ckt.LossWeight]));
+    W.AddStr('Set ueregs=' + IntArraytoString(ckt.UEregs));
+    W.AddStr('Set lossregs=' + IntArraytoString(ckt.Lossregs));
+    W.AddStr('Set algorithm=' + DSS.SolveAlgEnum.OrdinalToString(ckt.Solution.Algorithm));
+    W.AddStr('Set Trapezoidal=' + StrYorN(ckt.TrapezoidalIntegration));
+    W.AddStr('Set genmult=' + Format('%-g', [ckt.GenMultiplier]));
+    W.AddStr('Set Basefrequency=' + Format('%-g', [ckt.Fundamental]));
+    if ckt.Solution.DoAllHarmonics then
+        W.AddStr('Set harmonics=ALL')
+    else
+        W.AddStr('Set harmonics=' + GetDSSArray(ckt.Solution.HarmonicList));
+    W.AddStr('Set maxcontroliter=' + IntToStr(ckt.Solution.MaxControlIterations));
 
-        // This will be automated later
-        cmds := TJSONArray.Create();
-        // cmds.Add('Set Mode=' + DSS.SolveModeEnum.OrdinalToString(ord(ckt.Solution.mode)));
-        cmds.Add('Set ControlMode=' + DSS.ControlModeEnum.OrdinalToString(ckt.Solution.Controlmode));
-        cmds.Add('Set Random=' + DSS.RandomModeEnum.OrdinalToString(ckt.Solution.RandomType));
-        cmds.Add('Set frequency=' + Format('%-g', [ckt.Solution.Frequency]));
-        cmds.Add('Set stepsize=' + Format('%-g', [ckt.Solution.DynaVars.h]));
-        cmds.Add('Set number=' + IntToStr(ckt.Solution.NumberOfTimes));
-        cmds.Add('Set tolerance=' + Format('%-g', [ckt.Solution.ConvergenceTolerance]));
-        cmds.Add('Set maxiterations=' + IntToStr(ckt.Solution.MaxIterations));
-        cmds.Add('Set miniterations=' + IntToStr(ckt.Solution.MinIterations));
-        cmds.Add('Set loadmodel=' + DSS.DefaultLoadModelEnum.OrdinalToString(ckt.Solution.LoadModel));
-        cmds.Add('Set loadmult=' + Format('%-g', [ckt.LoadMultiplier]));
-        cmds.Add('Set Normvminpu=' + Format('%-g', [ckt.NormalMinVolts]));
-        cmds.Add('Set Normvmaxpu=' + Format('%-g', [ckt.NormalMaxVolts]));
-        cmds.Add('Set Emergvminpu=' + Format('%-g', [ckt.EmergMinVolts]));
-        cmds.Add('Set Emergvmaxpu=' + Format('%-g', [ckt.EmergMaxVolts]));
-        cmds.Add('Set %mean=' + Format('%-.4g', [ckt.DefaultDailyShapeObj.Mean * 100.0]));
-        cmds.Add('Set %stddev=' + Format('%-.4g', [ckt.DefaultDailyShapeObj.StdDev * 100.0]));
-        cmds.Add('Set LDCurve=' + NameIfNotNil(ckt.LoadDurCurveObj));
-        cmds.Add('Set %growth=' + Format('%-.4g', [((ckt.DefaultGrowthRate - 1.0) * 100.0)]));  // default growth rate
-        cmds.Add('Set genkw=' + Format('%-g', [ckt.AutoAddObj.GenkW]));
-        cmds.Add('Set genpf=' + Format('%-g', [ckt.AutoAddObj.GenPF]));
-        cmds.Add('Set capkvar=' + Format('%-g', [ckt.AutoAddObj.Capkvar]));
-        cmds.Add('Set addtype=' + DSS.AddTypeEnum.OrdinalToString(DSS.ActiveCircuit.AutoAddObj.AddType));
-        cmds.Add('Set zonelock=' + StrYorN(ckt.ZonesLocked));
-        cmds.Add(Format('Set ueweight=%8.2f', [ckt.UEWeight]));
-        cmds.Add(Format('Set lossweight=%8.2f', [ckt.LossWeight]));
-        cmds.Add('Set ueregs=' + IntArraytoString(ckt.UEregs));
-        cmds.Add('Set lossregs=' + IntArraytoString(ckt.Lossregs));
-        cmds.Add('Set algorithm=' + DSS.SolveAlgEnum.OrdinalToString(ckt.Solution.Algorithm));
-        cmds.Add('Set Trapezoidal=' + StrYorN(ckt.TrapezoidalIntegration));
-        cmds.Add('Set genmult=' + Format('%-g', [ckt.GenMultiplier]));
-        cmds.Add('Set Basefrequency=' + Format('%-g', [ckt.Fundamental]));
-        if ckt.Solution.DoAllHarmonics then
-            cmds.Add('Set harmonics=ALL')
-        else
-            cmds.Add('Set harmonics=' + GetDSSArray(ckt.Solution.HarmonicList));
-        cmds.Add('Set maxcontroliter=' + IntToStr(ckt.Solution.MaxControlIterations));
-
-        saveOpenTerminalsJSON(ckt, cmds);
+    saveOpenTerminalsJSON(ckt, W);
+    W.EndArray();
 
-        circ.Add('PostCommands', cmds);
-        cmds := NIL;
+    for cls in DSS.DSSClassList do
+    begin
+        // Classes without objects to write are not included
+        if not Obj_Circuit_HasObjects(cls, exportDefaultObjs) then
+            continue;
 
-        // vsrccls := ckt.DSS.VSourceClass;
-        for cls in ckt.DSS.DSSClassList do
+        W.Key(cls.Name);
+        W.BeginArray();
+        for obj in cls do
         begin
-            clsArray := TJSONArray.Create();
-            // if cls = vsrccls then
-            // begin
-            //     first := True;
-            //     for obj in cls do
-            //     begin
-            //         if first then
-            //         begin
-            //             vsrc := TSourceObj(obj);
-            //             first := false;
-            //             continue;
-            //         end;
-            //         clsArray.Add(Obj_ToJSONData(obj, joptions));
-            //     end;
-            //     circ.Add('circuitVsource', Obj_ToJSONData(vsrc, joptions));
-            // end;
-            // else
-            // begin
-            if exportDefaultObjs then
-            begin
-                for obj in cls do
-                begin
-                    clsArray.Add(Obj_ToJSONData(obj, joptions));
-                end;
-            end
-            else
-            begin
-                for obj in cls do
-                begin
-                    if not (Flg.DefaultAndUnedited in obj.Flags) then
-                        clsArray.Add(Obj_ToJSONData(obj, joptions));
-                end;
-            end;
-            // end;
-            if clsArray.Count <> 0 then
-                circ.Add(cls.Name, clsArray)
-            else
-                clsArray.Free();
-            clsArray := NIL;
+            if exportDefaultObjs or not (Flg.DefaultAndUnedited in obj.Flags) then
+                Obj_WriteJSON(obj, joptions, W);
         end;
+        W.EndArray();
+    end;
+    W.EndObject();
+end;
 
-        Result := DSS_GetAsPAnsiChar(ckt.DSS, circ.FormatJSON());
+function Obj_Circuit_ToJSON_(ckt: TDSSCircuit; joptions: Integer): PAnsiChar;
+var
+    W: TDSSJSONWriter = NIL;
+begin
+    Result := NIL;
+    try
+        W := TDSSJSONWriter.Create(NIL, True);
+        Obj_Circuit_WriteJSON_(ckt, joptions, W);
+        Result := DSS_GetAsPAnsiChar(ckt.DSS, W.Text());
     except
         on E: Exception do
             DoSimpleMsg(ckt.DSS, 'Error converting data to JSON: %s', [E.message], 5020);
     end;
-
-    if cmds <> NIL then
-        cmds.Free();
-    if circ <> NIL then
-        circ.Free();
-    if busArray <> NIL then
-        busArray.Free();
-    if clsArray <> NIL then
-        clsArray.Free();
-    // if vsrc <> NIL then
-    //     vsrc.Free();
+    FreeAndNil(W);
 end;
 
 procedure loadClassFromJSON(DSS: TDSSContext; cls: TDSSClass; jcls: TJSONData; joptions: Integer);
@@ -0,0 +1,227 @@
+unit CAPI_ProtectionStudy;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+interface
+
+uses
+    CAPI_Utils,
+    CAPI_Types;
+
+function ProtectionStudy_Run(FaultTypes: Integer; CTI: Double; NumThreads: Integer): Integer; CDECL;
+function ProtectionStudy_Get_Count(): Integer; CDECL;
+function ProtectionStudy_Get_NumViolations(): Integer; CDECL;
+procedure ProtectionStudy_Get_BusNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+procedure ProtectionStudy_Get_BusNames_GR(); CDECL;
+procedure ProtectionStudy_Get_FaultTypes(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+procedure ProtectionStudy_Get_FaultTypes_GR(); CDECL;
+procedure ProtectionStudy_Get_PrimaryNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+procedure ProtectionStudy_Get_PrimaryNames_GR(); CDECL;
+procedure ProtectionStudy_Get_BackupNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+procedure ProtectionStudy_Get_BackupNames_GR(); CDECL;
+procedure ProtectionStudy_Get_FaultAmps(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure ProtectionStudy_Get_FaultAmps_GR(); CDECL;
+procedure ProtectionStudy_Get_PrimaryTimes(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure ProtectionStudy_Get_PrimaryTimes_GR(); CDECL;
+procedure ProtectionStudy_Get_BackupTimes(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure ProtectionStudy_Get_BackupTimes_GR(); CDECL;
+procedure ProtectionStudy_Get_Margins(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure ProtectionStudy_Get_Margins_GR(); CDECL;
+procedure ProtectionStudy_Get_Status(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+procedure ProtectionStudy_Get_Status_GR(); CDECL;
+
+implementation
+
+uses
+    SysUtils,
+    DSSGlobals,
+    DSSClass,
+    DSSHelper,
+    ProtectionStudy;
+
+type
+    TStudy = TProtectionStudyResults;
+
+//------------------------------------------------------------------------------
+function _results(DSS: TDSSContext; out res: TStudy): Boolean; inline;
+begin
+    res := TStudy(DSS.ProtectionResults);
+    Result := (res <> NIL);
+end;
+
+//------------------------------------------------------------------------------
+function ProtectionStudy_Run(FaultTypes: Integer; CTI: Double; NumThreads: Integer): Integer; CDECL;
+begin
+    Result := 0;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    if RunProtectionStudy(DSSPrime, FaultTypes, CTI, NumThreads) then
+        Result := TStudy(DSSPrime.ProtectionResults).Count;
+end;
+//------------------------------------------------------------------------------
+function ProtectionStudy_Get_Count(): Integer; CDECL;
+var
+    res: TStudy;
+begin
+    Result := 0;
+    if _results(DSSPrime, res) then
+        Result := res.Count;
+end;
+//------------------------------------------------------------------------------
+function ProtectionStudy_Get_NumViolations(): Integer; CDECL;
+var
+    res: TStudy;
+begin
+    Result := 0;
+    if _results(DSSPrime, res) then
+        Result := res.NumViolations();
+end;
+//------------------------------------------------------------------------------
+procedure ProtectionStudy_Get_BusNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PPAnsiChar(ResultPtr, ResultCount, res.BusNames, res.Count)
+    else
+        DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, 0);
+end;
+
+procedure ProtectionStudy_Get_BusNames_GR(); CDECL;
+// Same as ProtectionStudy_Get_BusNames but uses global result (GR) pointers
+begin
+    ProtectionStudy_Get_BusNames(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0])
+end;
+//------------------------------------------------------------------------------
+procedure ProtectionStudy_Get_FaultTypes(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PInteger(ResultPtr, ResultCount, res.FaultTypes, res.Count)
+    else
+        DSS_RecreateArray_PInteger(ResultPtr, ResultCount, 0);
+end;
+
+procedure ProtectionStudy_Get_FaultTypes_GR(); CDECL;
+// Same as ProtectionStudy_Get_FaultTypes but uses global result (GR) pointers
+begin
+    ProtectionStudy_Get_FaultTypes(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0])
+end;
+//------------------------------------------------------------------------------
+procedure ProtectionStudy_Get_PrimaryNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PPAnsiChar(ResultPtr, ResultCount, res.PrimaryNames, res.Count)
+    else
+        DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, 0);
+end;
+
+procedure ProtectionStudy_Get_PrimaryNames_GR(); CDECL;
+// Same as ProtectionStudy_Get_PrimaryNames but uses global result (GR) pointers
+begin
+    ProtectionStudy_Get_PrimaryNames(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0])
+end;
+//------------------------------------------------------------------------------
+procedure ProtectionStudy_Get_BackupNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PPAnsiChar(ResultPtr, ResultCount, res.BackupNames, res.Count)
+    else
+        DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, 0);
+end;
+
+procedure ProtectionStudy_Get_BackupNames_GR(); CDECL;
+// Same as ProtectionStudy_Get_BackupNames but uses global result (GR) pointers
+begin
+    ProtectionStudy_Get_BackupNames(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0])
+end;
+//------------------------------------------------------------------------------
+procedure ProtectionStudy_Get_FaultAmps(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PDouble(ResultPtr, ResultCount, res.FaultAmps, res.Count)
+    else
+        DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 0);
+end;
+
+procedure ProtectionStudy_Get_FaultAmps_GR(); CDECL;
+// Same as ProtectionStudy_Get_FaultAmps but uses global result (GR) pointers
+begin
+    ProtectionStudy_Get_FaultAmps(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+//------------------------------------------------------------------------------
+procedure ProtectionStudy_Get_PrimaryTimes(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PDouble(ResultPtr, ResultCount, res.PrimaryTimes, res.Count)
+    else
+        DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 0);
+end;
+
+procedure ProtectionStudy_Get_PrimaryTimes_GR(); CDECL;
+// Same as ProtectionStudy_Get_PrimaryTimes but uses global result (GR) pointers
+begin
+    ProtectionStudy_Get_PrimaryTimes(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+//------------------------------------------------------------------------------
+procedure ProtectionStudy_Get_BackupTimes(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PDouble(ResultPtr, ResultCount, res.BackupTimes, res.Count)
+    else
+        DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 0);
+end;
+
+procedure ProtectionStudy_Get_BackupTimes_GR(); CDECL;
+// Same as ProtectionStudy_Get_BackupTimes but uses global result (GR) pointers
+begin
+    ProtectionStudy_Get_BackupTimes(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+//------------------------------------------------------------------------------
+procedure ProtectionStudy_Get_Margins(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PDouble(ResultPtr, ResultCount, res.Margins, res.Count)
+    else
+        DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 0);
+end;
+
+procedure ProtectionStudy_Get_Margins_GR(); CDECL;
+// Same as ProtectionStudy_Get_Margins but uses global result (GR) pointers
+begin
+    ProtectionStudy_Get_Margins(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+//------------------------------------------------------------------------------
+procedure ProtectionStudy_Get_Status(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+var
+    res: TStudy;
+begin
+    if _results(DSSPrime, res) then
+        DSS_CopyArray_PInteger(ResultPtr, ResultCount, res.Status, res.Count)
+    else
+        DSS_RecreateArray_PInteger(ResultPtr, ResultCount, 0);
+end;
+
+procedure ProtectionStudy_Get_Status_GR(); CDECL;
+// Same as ProtectionStudy_Get_Status but uses global result (GR) pointers
+begin
+    ProtectionStudy_Get_Status(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0])
+end;
+//------------------------------------------------------------------------------
+end.
@@ -105,6 +105,36 @@ procedure Solution_Get_IncMatrixRows(var ResultPtr: PPAnsiChar; ResultCount: PAP
 procedure Solution_Get_IncMatrixRows_GR(); CDECL;
 procedure Solution_Get_IncMatrixCols(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
 procedure Solution_Get_IncMatrixCols_GR(); CDECL;
+function Solution_Get_ProfileEnabled(): TAPIBoolean; CDECL;
+procedure Solution_Set_ProfileEnabled(Value: TAPIBoolean); CDECL;
+procedure Solution_ResetProfile(); CDECL;
+procedure Solution_Get_Profile(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure Solution_Get_Profile_GR(); CDECL;
+procedure Solution_Get_ProfileNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+procedure Solution_Get_ProfileNames_GR(); CDECL;
+procedure Solution_Get_ProfileYPrimCounts(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+procedure Solution_Get_ProfileYPrimCounts_GR(); CDECL;
+function Solution_Get_FastMonteFault(): TAPIBoolean; CDECL;
+procedure Solution_Set_FastMonteFault(Value: TAPIBoolean); CDECL;
+function Solution_Get_BatchSize(): Integer; CDECL;
+procedure Solution_Set_BatchSize(Value: Integer); CDECL;
+function Solution_Get_BatchThreads(): Integer; CDECL;
+procedure Solution_Set_BatchThreads(Value: Integer); CDECL;
+function Solution_Get_DynamicsTolerance(): Double; CDECL;
+procedure Solution_Set_DynamicsTolerance(Value: Double); CDECL;
+function Solution_Get_DynamicsMinStep(): Double; CDECL;
+procedure Solution_Set_DynamicsMinStep(Value: Double); CDECL;
+function Solution_Get_DynamicsMaxStep(): Double; CDECL;
+procedure Solution_Set_DynamicsMaxStep(Value: Double); CDECL;
+function Solution_Get_DynamicsThreads(): Integer; CDECL;
+procedure Solution_Set_DynamicsThreads(Value: Integer); CDECL;
+procedure Solution_Get_FastFaultVoltages(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure Solution_Get_FastFaultVoltages_GR(); CDECL;
+function Solution_ValidateFastFaults(): Double; CDECL;
+function Solution_Get_SweepActive(): TAPIBoolean; CDECL;
+function Solution_Get_SweepFallbackReason(): PAnsiChar; CDECL;
+procedure Solution_Get_VoltageSensitivities(var ResultPtr: PDouble; ResultCount: PAPISize; BusesPtr: PPAnsiChar; BusesCount: TAPISize; NodesPtr: PPAnsiChar; NodesCount: TAPISize; NumThreads: Integer); CDECL;
+procedure Solution_Get_VoltageSensitivities_GR(BusesPtr: PPAnsiChar; BusesCount: TAPISize; NodesPtr: PPAnsiChar; NodesCount: TAPISize; NumThreads: Integer); CDECL;
 
 implementation
 
@@ -122,7 +152,10 @@ uses
     Sparse_Math,
     Dynamics,
     DSSClass,
-    DSSHelper;
+    DSSHelper,
+    ArrayDef,
+    SolverProfile,
+    VoltageSensitivity;
 
 //------------------------------------------------------------------------------
 function Solution_Get_Frequency(): Double; CDECL;
@@ -1025,5 +1058,284 @@ begin
     Solution_Get_IncMatrixCols(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0])
 end;
 
+//------------------------------------------------------------------------------
+function Solution_Get_ProfileEnabled(): TAPIBoolean; CDECL;
+begin
+    Result := DSSPrime.SolverProfile.Enabled;
+end;
+//------------------------------------------------------------------------------
+procedure Solution_Set_ProfileEnabled(Value: TAPIBoolean); CDECL;
+begin
+    DSSPrime.SolverProfile.Enabled := Value;
+end;
+//------------------------------------------------------------------------------
+procedure Solution_ResetProfile(); CDECL;
+begin
+    DSSPrime.SolverProfile.Reset();
+end;
+//------------------------------------------------------------------------------
+procedure Solution_Get_Profile(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+// Pairs of (number of calls, accumulated time in microseconds), one per phase
+var
+    Result: PDoubleArray0;
+    phase: TSolverProfilePhase;
+    i: Integer;
+begin
+    Result := DSS_RecreateArray_PDouble(ResultPtr, ResultCount, 2 * (ord(High(TSolverProfilePhase)) + 1), 2, ord(High(TSolverProfilePhase)) + 1);
+    i := 0;
+    for phase := Low(TSolverProfilePhase) to High(TSolverProfilePhase) do
+    begin
+        Result[i] := DSSPrime.SolverProfile.Counts[phase];
+        Result[i + 1] := ProfileTicksToMicroseconds(DSSPrime.SolverProfile.Ticks[phase]);
+        Inc(i, 2);
+    end;
+end;
+
+procedure Solution_Get_Profile_GR(); CDECL;
+// Same as Solution_Get_Profile but uses global result (GR) pointers
+begin
+    Solution_Get_Profile(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+
+//------------------------------------------------------------------------------
+procedure Solution_Get_ProfileNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+var
+    Result: PPAnsiCharArray0;
+    phase: TSolverProfilePhase;
+begin
+    Result := DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, ord(High(TSolverProfilePhase)) + 1);
+    for phase := Low(TSolverProfilePhase) to High(TSolverProfilePhase) do
+        Result[ord(phase)] := DSS_CopyStringAsPChar(SolverProfilePhaseNames[phase]);
+end;
+
+procedure Solution_Get_ProfileNames_GR(); CDECL;
+// Same as Solution_Get_ProfileNames but uses global result (GR) pointers
+begin
+    Solution_Get_ProfileNames(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0])
+end;
+
+//------------------------------------------------------------------------------
+procedure Solution_Get_ProfileYPrimCounts(var ResultPtr: PInteger; ResultCount: PAPISize); CDECL;
+// Number of YPrim recalculations for each DSS class, in the same order as DSS_Get_Classes
+var
+    Result: PIntegerArray0;
+    i, NumClasses: Integer;
+    cnt: Int64;
+begin
+    NumClasses := DSSPrime.NumIntrinsicClasses;
+    Result := DSS_RecreateArray_PInteger(ResultPtr, ResultCount, NumClasses);
+    for i := 1 to Min(NumClasses, High(DSSPrime.SolverProfile.YPrimCounts)) do
+    begin
+        cnt := DSSPrime.SolverProfile.YPrimCounts[i];
+        if cnt > High(Integer) then
+            cnt := High(Integer);
+        Result[i - 1] := cnt;
+    end;
+end;
+
+procedure Solution_Get_ProfileYPrimCounts_GR(); CDECL;
+// Same as Solution_Get_ProfileYPrimCounts but uses global result (GR) pointers
+begin
+    Solution_Get_ProfileYPrimCounts(DSSPrime.GR_DataPtr_PInteger, @DSSPrime.GR_Counts_PInteger[0])
+end;
+
+//------------------------------------------------------------------------------
+function Solution_Get_FastMonteFault(): TAPIBoolean; CDECL;
+begin
+    Result := False;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    Result := DSSPrime.ActiveCircuit.Solution.FastMonteFault;
+end;
+//------------------------------------------------------------------------------
+procedure Solution_Set_FastMonteFault(Value: TAPIBoolean); CDECL;
+begin
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    DSSPrime.ActiveCircuit.Solution.FastMonteFault := Value;
+end;
+//------------------------------------------------------------------------------
+function Solution_Get_BatchSize(): Integer; CDECL;
+begin
+    Result := 0;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    Result := DSSPrime.ActiveCircuit.Solution.BatchSize;
+end;
+//------------------------------------------------------------------------------
+procedure Solution_Set_BatchSize(Value: Integer); CDECL;
+begin
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    DSSPrime.ActiveCircuit.Solution.BatchSize := Value;
+end;
+//------------------------------------------------------------------------------
+function Solution_Get_BatchThreads(): Integer; CDECL;
+begin
+    Result := 0;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    Result := DSSPrime.ActiveCircuit.Solution.BatchThreads;
+end;
+//------------------------------------------------------------------------------
+procedure Solution_Set_BatchThreads(Value: Integer); CDECL;
+begin
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    DSSPrime.ActiveCircuit.Solution.BatchThreads := Value;
+end;
+//------------------------------------------------------------------------------
+function Solution_Get_DynamicsTolerance(): Double; CDECL;
+begin
+    Result := 0.0;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    Result := DSSPrime.ActiveCircuit.Solution.DynamicsTolerance;
+end;
+//------------------------------------------------------------------------------
+procedure Solution_Set_DynamicsTolerance(Value: Double); CDECL;
+begin
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    DSSPrime.ActiveCircuit.Solution.DynamicsTolerance := Value;
+end;
+//------------------------------------------------------------------------------
+function Solution_Get_DynamicsMinStep(): Double; CDECL;
+begin
+    Result := 0.0;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    Result := DSSPrime.ActiveCircuit.Solution.DynamicsMinStep;
+end;
+//------------------------------------------------------------------------------
+procedure Solution_Set_DynamicsMinStep(Value: Double); CDECL;
+begin
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    DSSPrime.ActiveCircuit.Solution.DynamicsMinStep := Value;
+end;
+//------------------------------------------------------------------------------
+function Solution_Get_DynamicsMaxStep(): Double; CDECL;
+begin
+    Result := 0.0;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    Result := DSSPrime.ActiveCircuit.Solution.DynamicsMaxStep;
+end;
+//------------------------------------------------------------------------------
+procedure Solution_Set_DynamicsMaxStep(Value: Double); CDECL;
+begin
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    DSSPrime.ActiveCircuit.Solution.DynamicsMaxStep := Value;
+end;
+//------------------------------------------------------------------------------
+function Solution_Get_DynamicsThreads(): Integer; CDECL;
+begin
+    Result := 0;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    Result := DSSPrime.ActiveCircuit.Solution.DynamicsThreads;
+end;
+//------------------------------------------------------------------------------
+procedure Solution_Set_DynamicsThreads(Value: Integer); CDECL;
+begin
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    DSSPrime.ActiveCircuit.Solution.DynamicsThreads := Value;
+end;
+//------------------------------------------------------------------------------
+procedure Solution_Get_FastFaultVoltages(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+// Node voltages (complex) with each fault applied alone, NumNodes-by-NumFaults
+var
+    Result: PDoubleArray0;
+    Voltages: ArrayOfDouble;
+    NumNodes, NumFaults: Integer;
+begin
+    if InvalidCircuit(DSSPrime) then
+    begin
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    NumFaults := DSSPrime.ActiveCircuit.Faults.Count;
+    if (NumFaults = 0) or not DSSPrime.ActiveCircuit.Solution.FastFaultVoltages(Voltages) then
+    begin
+        if NumFaults <> 0 then
+            DoSimpleMsg(DSSPrime, _('The faults cannot be evaluated from the solution without faults; a fault may connect nodes that do not exist without it.'), 20240710);
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    NumNodes := Length(Voltages) div (2 * NumFaults);
+    Result := DSS_RecreateArray_PDouble(ResultPtr, ResultCount, Length(Voltages), NumNodes, NumFaults);
+    Move(Voltages[0], Result[0], Length(Voltages) * SizeOf(Double));
+end;
+
+procedure Solution_Get_FastFaultVoltages_GR(); CDECL;
+// Same as Solution_Get_FastFaultVoltages but uses global result (GR) pointers
+begin
+    Solution_Get_FastFaultVoltages(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+//------------------------------------------------------------------------------
+function Solution_ValidateFastFaults(): Double; CDECL;
+begin
+    Result := -1;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    Result := DSSPrime.ActiveCircuit.Solution.ValidateFastFaults();
+end;
+//------------------------------------------------------------------------------
+function Solution_Get_SweepActive(): TAPIBoolean; CDECL;
+begin
+    Result := False;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    Result := DSSPrime.ActiveCircuit.Solution.SweepActive;
+end;
+//------------------------------------------------------------------------------
+function Solution_Get_SweepFallbackReason(): PAnsiChar; CDECL;
+begin
+    Result := NIL;
+    if InvalidCircuit(DSSPrime) then
+        Exit;
+    Result := DSS_GetAsPAnsiChar(DSSPrime, DSSPrime.ActiveCircuit.Solution.Sweep.FallbackReason);
+end;
+//------------------------------------------------------------------------------
+procedure Solution_Get_VoltageSensitivities(var ResultPtr: PDouble; ResultCount: PAPISize; BusesPtr: PPAnsiChar; BusesCount: TAPISize; NodesPtr: PPAnsiChar; NodesCount: TAPISize; NumThreads: Integer); CDECL;
+var
+    Result: PDoubleArray0;
+    BusNames, NodeNames: PPAnsiCharArray0;
+    Buses, Nodes: Array of String;
+    Sens: ArrayOfDouble;
+    i, NumRows: Integer;
+begin
+    if InvalidCircuit(DSSPrime) then
+    begin
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    BusNames := PPAnsiCharArray0(BusesPtr);
+    SetLength(Buses, BusesCount);
+    for i := 0 to BusesCount - 1 do
+        Buses[i] := BusNames[i];
+    NodeNames := PPAnsiCharArray0(NodesPtr);
+    SetLength(Nodes, NodesCount);
+    for i := 0 to NodesCount - 1 do
+        Nodes[i] := NodeNames[i];
+
+    if not ComputeVoltageSensitivities(DSSPrime, Buses, Nodes, NumThreads, Sens, NumRows) then
+    begin
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    Result := DSS_RecreateArray_PDouble(ResultPtr, ResultCount, Length(Sens), NumRows, 2 * BusesCount);
+    if Length(Sens) > 0 then
+        Move(Sens[0], Result[0], Length(Sens) * SizeOf(Double));
+end;
+
+procedure Solution_Get_VoltageSensitivities_GR(BusesPtr: PPAnsiChar; BusesCount: TAPISize; NodesPtr: PPAnsiChar; NodesCount: TAPISize; NumThreads: Integer); CDECL;
+// Same as Solution_Get_VoltageSensitivities but uses global result (GR) pointers
+begin
+    Solution_Get_VoltageSensitivities(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0], BusesPtr, BusesCount, NodesPtr, NodesCount, NumThreads)
+end;
 //------------------------------------------------------------------------------
 end.
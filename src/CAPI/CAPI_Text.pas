@@ -11,6 +11,14 @@ procedure Text_Set_Command(const Value: PAnsiChar); CDECL;
 function Text_Get_Result(): PAnsiChar; CDECL;
 procedure Text_CommandBlock(const Value: PAnsiChar); CDECL;
 procedure Text_CommandArray(const Value: PPAnsiChar; ValueCount: TAPISize); CDECL;
+procedure Text_Get_ExportColumnNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+procedure Text_Get_ExportColumnNames_GR(); CDECL;
+procedure Text_Get_ExportColumn(var ResultPtr: PDouble; ResultCount: PAPISize; Column: Integer); CDECL;
+procedure Text_Get_ExportColumn_GR(Column: Integer); CDECL;
+procedure Text_Get_ExportColumnText(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; Column: Integer); CDECL;
+procedure Text_Get_ExportColumnText_GR(Column: Integer); CDECL;
+procedure Text_Get_ExportData(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+procedure Text_Get_ExportData_GR(); CDECL;
 
 implementation
 
@@ -22,7 +30,9 @@ uses
     SysUtils,
     ExecHelper,
     DSSClass,
-    DSSHelper;
+    DSSHelper,
+    MeterTable,
+    CAPI_Alt;
 
 //------------------------------------------------------------------------------
 function Text_Get_Command(): PAnsiChar; CDECL;
@@ -104,4 +114,54 @@ begin
     // from operations where the result is voluminous.
 end;
 //------------------------------------------------------------------------------
+procedure Text_Get_ExportColumnNames(var ResultPtr: PPAnsiChar; ResultCount: PAPISize); CDECL;
+begin
+    _Alt_Table_Get_ColumnNames(ResultPtr, ResultCount, TMeterTable(DSSPrime.ExportTable));
+end;
+
+procedure Text_Get_ExportColumnNames_GR(); CDECL;
+// Same as Text_Get_ExportColumnNames but uses global result (GR) pointers
+begin
+    Text_Get_ExportColumnNames(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0])
+end;
+//------------------------------------------------------------------------------
+procedure Text_Get_ExportColumn(var ResultPtr: PDouble; ResultCount: PAPISize; Column: Integer); CDECL;
+begin
+    if Column = 0 then
+    begin
+        DoSimpleMsg(DSSPrime, 'Invalid column index (%d) for the table.', [Column], 20240775);
+        DefaultResult(ResultPtr, ResultCount);
+        Exit;
+    end;
+    _Alt_Table_Get_Column(DSSPrime, ResultPtr, ResultCount, TMeterTable(DSSPrime.ExportTable), Column);
+end;
+
+procedure Text_Get_ExportColumn_GR(Column: Integer); CDECL;
+// Same as Text_Get_ExportColumn but uses global result (GR) pointers
+begin
+    Text_Get_ExportColumn(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0], Column)
+end;
+//------------------------------------------------------------------------------
+procedure Text_Get_ExportColumnText(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; Column: Integer); CDECL;
+begin
+    _Alt_Table_Get_ColumnText(DSSPrime, ResultPtr, ResultCount, TMeterTable(DSSPrime.ExportTable), Column);
+end;
+
+procedure Text_Get_ExportColumnText_GR(Column: Integer); CDECL;
+// Same as Text_Get_ExportColumnText but uses global result (GR) pointers
+begin
+    Text_Get_ExportColumnText(DSSPrime.GR_DataPtr_PPAnsiChar, @DSSPrime.GR_Counts_PPAnsiChar[0], Column)
+end;
+//------------------------------------------------------------------------------
+procedure Text_Get_ExportData(var ResultPtr: PDouble; ResultCount: PAPISize); CDECL;
+begin
+    _Alt_Table_Get_Column(DSSPrime, ResultPtr, ResultCount, TMeterTable(DSSPrime.ExportTable), 0);
+end;
+
+procedure Text_Get_ExportData_GR(); CDECL;
+// Same as Text_Get_ExportData but uses global result (GR) pointers
+begin
+    Text_Get_ExportData(DSSPrime.GR_DataPtr_PDouble, @DSSPrime.GR_Counts_PDouble[0])
+end;
+//------------------------------------------------------------------------------
 end.
@@ -96,6 +96,10 @@ function DSS_RecreateArray_PDouble(var p: PDouble; cnt: PAPISize; const incount:
 function DSS_RecreateArray_PInteger(var p: PInteger; cnt: PAPISize; const incount: TAPISize; const nr: TAPISize=0; const nc: TAPISize=0): PIntegerArray0;
 function DSS_RecreateArray_PPAnsiChar(var p: PPAnsiChar; cnt: PAPISize; const incount: TAPISize): PPAnsiCharArray0;
 function DSS_RecreateArray_PPointer(var p: PPointer; cnt: PAPISize; const incount: TAPISize; preserve: Boolean=false): PPointerArray0;
+// Recreate the array and copy the first Count values
+procedure DSS_CopyArray_PPAnsiChar(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; const Values: Array of String; Count: Integer);
+procedure DSS_CopyArray_PDouble(var ResultPtr: PDouble; ResultCount: PAPISize; const Values: Array of Double; Count: Integer);
+procedure DSS_CopyArray_PInteger(var ResultPtr: PInteger; ResultCount: PAPISize; const Values: Array of Integer; Count: Integer);
 // MATLAB doesn't handle pointers that well,
 // this just gets a single string from the pointer of strings
 function DSS_Get_PAnsiChar(var p: Pointer; Index: TAPISize): PAnsiChar; CDECL;
@@ -557,6 +561,31 @@ begin
     res := DSS_RecreateArray_PByte(p, cnt, incount);
 end;
 
+//------------------------------------------------------------------------------
+procedure DSS_CopyArray_PPAnsiChar(var ResultPtr: PPAnsiChar; ResultCount: PAPISize; const Values: Array of String; Count: Integer);
+var
+    Result: PPAnsiCharArray0;
+    i: Integer;
+begin
+    Result := DSS_RecreateArray_PPAnsiChar(ResultPtr, ResultCount, Count);
+    for i := 0 to Count - 1 do
+        Result[i] := DSS_CopyStringAsPChar(Values[i]);
+end;
+
+procedure DSS_CopyArray_PDouble(var ResultPtr: PDouble; ResultCount: PAPISize; const Values: Array of Double; Count: Integer);
+begin
+    DSS_RecreateArray_PDouble(ResultPtr, ResultCount, Count);
+    if Count > 0 then
+        Move(Values[0], ResultPtr^, Count * SizeOf(Double));
+end;
+
+procedure DSS_CopyArray_PInteger(var ResultPtr: PInteger; ResultCount: PAPISize; const Values: Array of Integer; Count: Integer);
+begin
+    DSS_RecreateArray_PInteger(ResultPtr, ResultCount, Count);
+    if Count > 0 then
+        Move(Values[0], ResultPtr^, Count * SizeOf(Integer));
+end;
+
 //------------------------------------------------------------------------------
 procedure ctx_DSS_GetGRPointers(
     DSS: TDSSContext;
@@ -36,6 +36,14 @@ procedure YMatrix_SetGeneratordQdV(); CDECL;
 function YMatrix_Get_Handle(): NativeUInt; CDECL;
 procedure YMatrix_Set_SolverOptions(opts: UInt64); CDECL;
 function YMatrix_Get_SolverOptions(): UInt64; CDECL;
+function YMatrix_Get_LowRankThreshold(): Integer; CDECL;
+procedure YMatrix_Set_LowRankThreshold(Value: Integer); CDECL;
+function YMatrix_Get_LowRank(): Integer; CDECL;
+procedure YMatrix_Get_NodeVView(var VvectorPtr: PDouble; NumNodes: PInteger; Generation: PUInt64); CDECL;
+procedure YMatrix_Get_CurrentsView(var IvectorPtr: PDouble; NumNodes: PInteger; Generation: PUInt64); CDECL;
+function YMatrix_Get_ViewGeneration(): UInt64; CDECL;
+procedure YMatrix_Get_CSCView(var ColPtr, RowIdx: PInteger; var cVals: PDouble; NumNodes, NumNZ: PInteger; Generation: PUInt64); CDECL;
+function YMatrix_Get_YGeneration(): UInt64; CDECL;
 
 implementation
 
@@ -45,6 +53,7 @@ uses
     KLUSolve,
     DSSClass,
     DSSHelper,
+    SparseExport,
     SysUtils;
 
 procedure YMatrix_GetCompressedYMatrix(factor: TAPIBoolean; var nBus, nNz: Longword; var ColPtr, RowIdxPtr: pInteger; var cValsPtr: PDouble); CDECL;
@@ -56,6 +65,9 @@ var
 begin
     if MissingSolution(DSSPrime) then
         Exit;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    ApplyLowRankUpdates(DSSPrime); // the matrix must include any pending low-rank corrections
+{$ENDIF}
     Yhandle := DSSPrime.ActiveCircuit.Solution.hY;
     if Yhandle <= 0 then
     begin
@@ -270,5 +282,101 @@ begin
     Result := DSSPrime.ActiveCircuit.Solution.SolverOptions;
 end;
 
+function YMatrix_Get_LowRankThreshold(): Integer; CDECL;
+begin
+    Result := 0;
+    if InvalidCircuit(DSSPrime) then Exit;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    Result := DSSPrime.ActiveCircuit.Solution.LowRankThreshold;
+{$ENDIF}
+end;
+
+procedure YMatrix_Set_LowRankThreshold(Value: Integer); CDECL;
+begin
+    if InvalidCircuit(DSSPrime) then Exit;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    if Value < 0 then
+    begin
+        DoSimpleMsg(DSSPrime, _('The low-rank update threshold cannot be negative.'), 20240711);
+        Exit;
+    end;
+    DSSPrime.ActiveCircuit.Solution.LowRankThreshold := Value;
+{$ELSE}
+    DoSimpleMsg(DSSPrime, _('This version of DSS C-API was not compiled with extended solver options.'), 7074);
+{$ENDIF}
+end;
+
+function YMatrix_Get_LowRank(): Integer; CDECL;
+begin
+    Result := 0;
+    if InvalidCircuit(DSSPrime) then Exit;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    Result := DSSPrime.ActiveCircuit.Solution.LowRank.Rank;
+{$ENDIF}
+end;
+
 //---------------------------------------------------------------------------------
+procedure GetSolutionView(DSS: TDSSContext; UseCurrents: Boolean; var VectorPtr: PDouble; NumNodes: PInteger; Generation: PUInt64);
+begin
+    VectorPtr := NIL;
+    NumNodes^ := 0;
+    Generation^ := DSS.SolutionGeneration;
+    if MissingSolution(DSS) then
+        Exit;
+
+    // Node 0 (ground) is skipped; the elements follow the YNodeOrder
+    if UseCurrents then
+        VectorPtr := PDouble(@DSS.ActiveCircuit.Solution.Currents[1])
+    else
+        VectorPtr := PDouble(@DSS.ActiveCircuit.Solution.NodeV[1]);
+    NumNodes^ := DSS.ActiveCircuit.NumNodes;
+end;
+
+procedure YMatrix_Get_NodeVView(var VvectorPtr: PDouble; NumNodes: PInteger; Generation: PUInt64); CDECL;
+begin
+    GetSolutionView(DSSPrime, False, VvectorPtr, NumNodes, Generation);
+end;
+
+procedure YMatrix_Get_CurrentsView(var IvectorPtr: PDouble; NumNodes: PInteger; Generation: PUInt64); CDECL;
+begin
+    GetSolutionView(DSSPrime, True, IvectorPtr, NumNodes, Generation);
+end;
+
+function YMatrix_Get_ViewGeneration(): UInt64; CDECL;
+begin
+    Result := DSSPrime.SolutionGeneration;
+end;
+
+//---------------------------------------------------------------------------------
+procedure YMatrix_Get_CSCView(var ColPtr, RowIdx: PInteger; var cVals: PDouble; NumNodes, NumNZ: PInteger; Generation: PUInt64); CDECL;
+var
+    Snapshot: TSystemYSnapshot;
+begin
+    ColPtr := NIL;
+    RowIdx := NIL;
+    cVals := NIL;
+    NumNodes^ := 0;
+    NumNZ^ := 0;
+    Generation^ := DSSPrime.YGeneration;
+    if MissingSolution(DSSPrime) then
+        Exit;
+
+    // The snapshot is only copied from KLU again after the matrix changes
+    Snapshot := GetSystemYSnapshot(DSSPrime);
+    if Snapshot = NIL then
+        Exit;
+
+    ColPtr := PInteger(@Snapshot.ColPtr[0]);
+    RowIdx := PInteger(@Snapshot.RowIdx[0]);
+    cVals := PDouble(@Snapshot.Values[0]);
+    NumNodes^ := Snapshot.NumNodes;
+    NumNZ^ := Snapshot.NumNZ;
+    Generation^ := DSSPrime.YGeneration;
+end;
+
+function YMatrix_Get_YGeneration(): UInt64; CDECL;
+begin
+    Result := DSSPrime.YGeneration;
+end;
+
 end.
@@ -0,0 +1,124 @@
+unit BatchSolve;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Solutions of several right-hand sides with a fixed system Y matrix, for the
+// batched time series of the Daily, Yearly and Duty modes (see
+// TSolutionAlgs.SolveBatchedSteps).
+//
+// With the admittance load model, each step of these modes is a direct
+// solution (SolveDirect): the system Y matrix does not change between steps and
+// only the injection currents of the sources follow their shapes. The
+// injection vectors of a batch of steps are built first and then solved
+// together, distributed among the workers of a ParallelFor. Worker 0 uses the
+// factorization of the circuit, the others a copy of the system Y matrix
+// (NewSystemYCopy), so the matrix is only factorized once per worker.
+
+interface
+
+uses
+    UComplex,
+    DSSUcomplex,
+    ArrayDef,
+    DSSClass;
+
+type
+    TBatchSolver = class(TObject)
+    private
+        DSS: TDSSContext;
+        NumNodes: Integer;
+        hY: Array of NativeUInt; // per worker; hY[0] is the matrix of the circuit
+
+        procedure SolveStep(Index, Worker: Integer);
+    public
+        B, X: Array of ArrayOfComplex; // per step, injection currents and voltages, as Currents and NodeV
+
+        constructor Create(dssContext: TDSSContext);
+        destructor Destroy; override;
+
+        // Allocates the buffers for BatchSize steps and the solvers for up to
+        // NumThreads workers (all logical CPUs if <= 0). The system Y matrix
+        // must be built. Raises EEsolv32Problem on errors.
+        procedure Prepare(BatchSize, NumThreads: Integer);
+        procedure FreeSolvers();
+        function Prepared(): Boolean;
+
+        // Solves the first Count steps of B into X. Raises EEsolv32Problem on errors.
+        procedure Solve(Count: Integer);
+    end;
+
+implementation
+
+uses
+    SysUtils,
+    Math,
+    DSSGlobals,
+    Solution,
+    YMatrix,
+    KLUSolve,
+    ParallelLoop,
+    DSSHelper;
+
+constructor TBatchSolver.Create(dssContext: TDSSContext);
+begin
+    inherited Create();
+    DSS := dssContext;
+    NumNodes := 0;
+end;
+
+destructor TBatchSolver.Destroy;
+begin
+    FreeSolvers();
+    inherited Destroy;
+end;
+
+procedure TBatchSolver.FreeSolvers();
+var
+    w: Integer;
+begin
+    for w := 1 to High(hY) do
+        if hY[w] <> 0 then
+            DeleteSparseSet(hY[w]);
+    SetLength(hY, 0);
+end;
+
+function TBatchSolver.Prepared(): Boolean;
+begin
+    Result := Length(hY) <> 0;
+end;
+
+procedure TBatchSolver.Prepare(BatchSize, NumThreads: Integer);
+var
+    i, w: Integer;
+begin
+    FreeSolvers();
+    NumNodes := DSS.ActiveCircuit.NumNodes;
+    SetLength(B, BatchSize);
+    SetLength(X, BatchSize);
+    for i := 0 to BatchSize - 1 do
+    begin
+        SetLength(B[i], NumNodes + 1);
+        SetLength(X[i], NumNodes + 1);
+    end;
+
+    SetLength(hY, ParallelLoopWorkers(NumThreads, BatchSize));
+    hY[0] := DSS.ActiveCircuit.Solution.hYsystem;
+    for w := 1 to High(hY) do
+        hY[w] := NewSystemYCopy(DSS);
+end;
+
+procedure TBatchSolver.SolveStep(Index, Worker: Integer);
+begin
+    if SolveSparseSet(hY[Worker], pComplexArray(@X[Index][1]), pComplexArray(@B[Index][1])) < 1 then
+        raise EEsolv32Problem.Create('Error Solving System Y Matrix in TBatchSolver. Problem with Sparse matrix solver.');
+end;
+
+procedure TBatchSolver.Solve(Count: Integer);
+begin
+    ParallelFor(Count, SolveStep, Length(hY));
+end;
+
+end.
@@ -90,7 +90,6 @@ type
         function SaveOpenTerminals(circF: TStream; saveFlags: DSSSaveFlags): Boolean;
         function SaveVoltageBases(circF: TStream; saveFlags: DSSSaveFlags): Boolean;
 
-        procedure ReallocDeviceList;
         procedure Set_CaseName(const Value: String);
 
         function Get_Name: String;
@@ -106,7 +105,7 @@ type
 
         BusList,
         AutoAddBusList: TBusHashListType;
-        DeviceList: THashList;
+        DeviceList: TDeviceHashListType;
 
         // lists of pointers to different elements by class
         Faults,
@@ -403,7 +402,7 @@ begin
 
      // Allocate some nominal sizes
     BusList := TBusHashListType.Create(900);  // Bus name list Nominal size to start; gets reallocated
-    DeviceList := THashList.Create(900);
+    DeviceList := TDeviceHashListType.Create(900);
     AutoAddBusList := TBusHashListType.Create(100);
 
     NumBuses := 0;  // Eventually allocate a single source
@@ -2067,9 +2066,7 @@ begin
     // Update lists that keep track of individual circuit elements
     Inc(NumDevices);
 
-    // Resize DeviceList if no. of devices greatly exceeds allocation
-    if Cardinal(NumDevices) > 2 * DeviceList.InitialAllocation then
-        ReAllocDeviceList;
+    // The device list grows by itself, keeping its load factor low
     DeviceList.Add(Obj.Name);
     CktElements.Add(Obj);
 
@@ -2987,25 +2984,6 @@ begin
         FreeAndNil(F);
 end;
 
-procedure TDSSCircuit.ReallocDeviceList;
-var
-    TempList: THashList;
-    i: Integer;
-begin
-    // Reallocate the device list to improve the performance of searches
-    if LogEvents then
-        DSS.LogThisEvent(_('Reallocating Device List'));
-    TempList := THashList.Create(2 * NumDevices);
-
-    for i := 1 to DeviceList.Count do
-    begin
-        Templist.Add(DeviceList.NameOfIndex(i));
-    end;
-
-    DeviceList.Free; // Throw away the old one.
-    Devicelist := TempList;
-end;
-
 procedure TDSSCircuit.Set_CaseName(const Value: String);
 begin
     FCaseName := Value;
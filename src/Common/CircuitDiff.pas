@@ -0,0 +1,239 @@
+unit CircuitDiff;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Object-by-object comparison of the circuits of two DSS contexts, using the
+// property metadata of the DSS classes.
+//
+// The objects are matched by class and name. The property values are
+// compared as JSON values, as given by GetObjPropertyJSONValue (arrays are
+// preferred, so the properties of windings, wires, etc. are all compared).
+// The same properties as a "Full" JSON export are compared, without the
+// redundant ones.
+//
+// The result is a JSON object with an entry for each class with differences,
+// in the order of the classes:
+//
+//     {"Line": {
+//         "Added": [{"Name": "...", <properties set in the other circuit>}],
+//         "Removed": [{"Name": "...", <properties set in this circuit>}],
+//         "Changed": [{"Name": "...", "<property>": [<this value>, <other value>], ...}]
+//     }, ...}
+//
+// The classes are compared on the calling thread: the property getters used
+// by GetObjPropertyJSONValue are not thread-safe (some update the state of the
+// objects or of their classes while formatting the values).
+
+interface
+
+uses
+    fpjson,
+    DSSClass;
+
+function DiffCircuits(DSS, Other: TDSSContext; joptions: Integer): TJSONObject;
+
+implementation
+
+uses
+    SysUtils,
+    DSSObject,
+    DSSObjectHelper,
+    HashList;
+
+type
+    TCircuitDiff = class(TObject)
+    public
+        joptions: Integer;
+        ThisClasses, OtherClasses: Array of TDSSClass;
+        Results: Array of TJSONObject;
+
+        procedure DiffClass(Index: Integer);
+    end;
+
+function IsCompared(cls: TDSSClass; iProp: Integer): Boolean;
+begin
+    Result := not (
+        (cls.PropertyType[iProp] = TPropertyType.MakeLikeProperty) or
+        (TPropertyFlag.Redundant in cls.PropertyFlags[iProp]) or
+        (TPropertyFlag.SuppressJSON in cls.PropertyFlags[iProp]) or
+        (TPropertyFlag.AltIndex in cls.PropertyFlags[iProp]) or
+        (TPropertyFlag.IntegerStructIndex in cls.PropertyFlags[iProp])
+    );
+end;
+
+function PropertyNames(cls: TDSSClass; joptions: Integer): pStringArray;
+begin
+    if (joptions and Integer(DSSJSONOptions.LowercaseKeys)) = 0 then
+        Result := cls.PropertyNameJSON
+    else
+        Result := cls.PropertyNameLowercase;
+end;
+
+// The properties set by the user, for added and removed objects
+function SetPropertiesJSON(obj: TDSSObject; joptions: Integer): TJSONObject;
+var
+    cls: TDSSClass;
+    pnames: pStringArray;
+    iProp: Integer;
+    jvalue: TJSONData = NIL;
+begin
+    cls := obj.ParentClass;
+    pnames := PropertyNames(cls, joptions);
+    Result := TJSONObject.Create(['Name', obj.Name]);
+    iProp := obj.GetNextPropertySet(-9999999);
+    while iProp > 0 do
+    begin
+        if IsCompared(cls, iProp) and cls.GetObjPropertyJSONValue(Pointer(obj), iProp, joptions, jvalue, True) then
+            Result.Add(pnames[iProp], jvalue);
+        iProp := obj.GetNextPropertySet(iProp);
+    end;
+end;
+
+function ChangedPropertiesJSON(obj, otherObj: TDSSObject; joptions: Integer): TJSONObject;
+var
+    cls, otherCls: TDSSClass;
+    pnames: pStringArray;
+    iProp: Integer;
+    jvalue: TJSONData = NIL;
+    jother: TJSONData = NIL;
+    hasValue, hasOther: Boolean;
+begin
+    Result := NIL;
+    cls := obj.ParentClass;
+    otherCls := otherObj.ParentClass;
+    pnames := PropertyNames(cls, joptions);
+    for iProp := 1 to cls.NumProperties do
+    begin
+        if not IsCompared(cls, iProp) then
+            continue;
+
+        jvalue := NIL;
+        jother := NIL;
+        try
+            hasValue := cls.GetObjPropertyJSONValue(Pointer(obj), iProp, joptions, jvalue, True);
+            hasOther := otherCls.GetObjPropertyJSONValue(Pointer(otherObj), iProp, joptions, jother, True);
+            if (hasValue <> hasOther) or (hasValue and (jvalue.AsJSON <> jother.AsJSON)) then
+            begin
+                if Result = NIL then
+                    Result := TJSONObject.Create(['Name', obj.Name]);
+                if not hasValue then
+                    jvalue := TJSONNull.Create();
+                if not hasOther then
+                    jother := TJSONNull.Create();
+                Result.Add(pnames[iProp], TJSONArray.Create([jvalue, jother]));
+                jvalue := NIL;
+                jother := NIL;
+            end;
+        finally
+            FreeAndNil(jvalue);
+            FreeAndNil(jother);
+        end;
+    end;
+end;
+
+procedure TCircuitDiff.DiffClass(Index: Integer);
+var
+    cls, otherCls: TDSSClass;
+    obj: TDSSObject;
+    otherNames: THashList;
+    matched: Array of Boolean;
+    added, removed, changed: TJSONArray;
+    objData: TJSONObject;
+    i, ref: Integer;
+begin
+    cls := ThisClasses[Index];
+    otherCls := OtherClasses[Index];
+
+    added := TJSONArray.Create();
+    removed := TJSONArray.Create();
+    changed := TJSONArray.Create();
+    otherNames := THashList.Create(otherCls.ElementList.Count + 1);
+    try
+        for i := 1 to otherCls.ElementList.Count do
+            otherNames.Add(TDSSObject(otherCls.ElementList.At(i)).Name);
+        SetLength(matched, otherCls.ElementList.Count + 1);
+
+        for i := 1 to cls.ElementList.Count do
+        begin
+            obj := cls.ElementList.At(i);
+            ref := otherNames.Find(obj.Name);
+            if ref = 0 then
+            begin
+                removed.Add(SetPropertiesJSON(obj, joptions));
+                continue;
+            end;
+            matched[ref] := True;
+            objData := ChangedPropertiesJSON(obj, otherCls.ElementList.At(ref), joptions);
+            if objData <> NIL then
+                changed.Add(objData);
+        end;
+
+        for i := 1 to otherCls.ElementList.Count do
+            if not matched[i] then
+                added.Add(SetPropertiesJSON(otherCls.ElementList.At(i), joptions));
+
+        if (added.Count + removed.Count + changed.Count) <> 0 then
+        begin
+            Results[Index] := TJSONObject.Create(['Added', added, 'Removed', removed, 'Changed', changed]);
+            added := NIL;
+            removed := NIL;
+            changed := NIL;
+        end;
+    finally
+        otherNames.Free();
+        added.Free();
+        removed.Free();
+        changed.Free();
+    end;
+end;
+
+function DiffCircuits(DSS, Other: TDSSContext; joptions: Integer): TJSONObject;
+var
+    diff: TCircuitDiff;
+    cls: TDSSClass;
+    i, n, idx: Integer;
+begin
+    Result := NIL;
+    diff := TCircuitDiff.Create();
+    try
+        diff.joptions := joptions;
+
+        // Pair the classes here, since the class lookup changes the state of
+        // the name list. Both contexts come from the same engine, so the
+        // classes only go missing for user-defined classes.
+        SetLength(diff.ThisClasses, DSS.DSSClassList.Count);
+        SetLength(diff.OtherClasses, DSS.DSSClassList.Count);
+        n := 0;
+        for i := 1 to DSS.DSSClassList.Count do
+        begin
+            cls := DSS.DSSClassList.At(i);
+            idx := Other.ClassNames.Find(cls.Name);
+            if idx = 0 then
+                continue;
+            diff.ThisClasses[n] := cls;
+            diff.OtherClasses[n] := Other.DSSClassList.At(idx);
+            Inc(n);
+        end;
+        SetLength(diff.Results, n);
+
+        for i := 0 to n - 1 do
+            diff.DiffClass(i);
+
+        Result := TJSONObject.Create();
+        for i := 0 to n - 1 do
+            if diff.Results[i] <> NIL then
+            begin
+                Result.Add(diff.ThisClasses[i].Name, diff.Results[i]);
+                diff.Results[i] := NIL;
+            end;
+    finally
+        for i := 0 to High(diff.Results) do
+            FreeAndNil(diff.Results[i]);
+        diff.Free();
+    end;
+end;
+
+end.
@@ -64,6 +64,7 @@ type
 
         procedure Set_Enabled(Value: Boolean); VIRTUAL;
         procedure Set_ConductorClosed(Index: Integer; Value: Boolean); VIRTUAL;
+        procedure ConductorStateChanged();
         procedure Set_NTerms(Value: Int8);
     PUBLIC
         Handle: Integer;
@@ -239,6 +240,12 @@ end;
 
 procedure TDSSCktElement.Set_YprimInvalid(const Value: Boolean);
 begin
+    if Value and (Flg.EditTransaction in Flags) then
+    begin
+        // Applied with the rest of the transaction, see EditTransaction.pas
+        Include(Flags, Flg.YprimDeferred);
+        Exit;
+    end;
     FYPrimInvalid := value;
     if Value and FEnabled then
         // If this device is in the circuit, then we have to rebuild Y on a change in Yprim
@@ -292,18 +299,37 @@ begin
     begin  // Do all conductors
         for i := 0 to Fnphases - 1 do
             Terminals[FActiveTerminal].ConductorsClosed[i] := Value;
-        YPrimInvalid := TRUE; // this also sets the global SystemYChanged flag
+        ConductorStateChanged(); // this also sets the global SystemYChanged flag
     end
     else
     begin
         if (Index > 0) and (Index <= Fnconds) then
         begin
             Terminals[FActiveTerminal].ConductorsClosed[index - 1] := Value;
-            YPrimInvalid := TRUE;
+            ConductorStateChanged();
         end;
     end;
 end;
 
+procedure TDSSCktElement.ConductorStateChanged();
+begin
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    // With low-rank updates, handle switching incrementally. Open conductors
+    // don't change the order or the nodes of YPrim (see DoYprimCalcs).
+    if ((ActiveCircuit.Solution.SolverOptions and ord(TSolverOptions.LowRankUpdates)) <> 0) and 
+        FEnabled and
+        (not ActiveCircuit.Solution.SystemYChanged) and 
+        (YPrim <> NIL) and 
+        (not YPrimInvalid)
+    then
+    begin
+        ActiveCircuit.IncrCktElements.Add(Self);
+        Exit;
+    end;
+{$ENDIF}
+    YPrimInvalid := TRUE;
+end;
+
 procedure TDSSCktElement.Set_NConds(Value: Int8);
 begin
     // Check for an almost certain programming error
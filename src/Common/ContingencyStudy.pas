@@ -0,0 +1,634 @@
+unit ContingencyStudy;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// N-1/N-k contingency screening of branch outages.
+//
+// Each case removes a set of PD elements from the base (solved) circuit.
+// Removing the elements subtracts their primitive Y matrices from the system
+// Y matrix at the k nodes they connect, so the post-contingency voltages follow
+// from a rank-k update of the base solution, as in FastFault.pas:
+//
+//     (I + Zkk dY) u = V0k,    V = V0 - Zk (dY u)
+//
+// The k columns Zk of inv(Y) are computed with the base factorization; no
+// matrix is rebuilt or refactorized per case. The injection currents of the
+// base solution are kept (loads and generators are not re-solved), as usual
+// for a linear screening. Buses left without a path to a source are reported
+// as isolated and excluded from the checks.
+//
+// The cases are split across worker threads. Worker 0 uses the factorization
+// of the circuit; the others use a copy of the system Y matrix each, since a
+// KLU handle cannot be used by several threads at once.
+
+interface
+
+uses
+    DSSClass;
+
+type
+    // Results, stored column-wise, one row per case, in the input order.
+    TContingencyStudyResults = class(TObject)
+    public
+        Count: Integer;
+        CaseNames: Array of String;
+        Converged: Array of Integer; // 1 if the post-contingency system could be solved
+        NumIsolatedBuses: Array of Integer; // buses isolated by the outage
+        NumUnderVoltages: Array of Integer; // buses below NormalMinVolts
+        NumOverVoltages: Array of Integer; // buses above NormalMaxVolts
+        MinVoltages: Array of Double; // pu, energized nodes only
+        MaxVoltages: Array of Double; // pu, energized nodes only
+        NumOverloads: Array of Integer; // elements above NormAmps
+        NumEmergOverloads: Array of Integer; // elements above EmergAmps
+        MaxLoadings: Array of Double; // max. terminal 1 current, % of NormAmps
+        WorstElements: Array of String; // element with the max. loading
+
+        function NumViolations(): Integer;
+    end;
+
+// Runs the contingency screening on the active circuit, which must be solved.
+// Each case is a list of PD element names (e.g. "Line.L1 Line.L2"), separated
+// by spaces or commas. If no cases are given, each enabled series PD element
+// is a case (N-1). NumThreads <= 0 uses all the logical CPUs. The results are
+// kept in DSS.ContingencyResults. Returns False on errors, which are reported
+// through DoSimpleMsg.
+function RunContingencyStudy(DSS: TDSSContext; const Cases: Array of String; NumThreads: Integer): Boolean;
+
+implementation
+
+uses
+    Classes,
+    SysUtils,
+    Math,
+    UComplex,
+    DSSUcomplex,
+    ArrayDef,
+    Ucmatrix,
+    DSSGlobals,
+    DSSClassDefs,
+    DSSHelper,
+    Circuit,
+    Bus,
+    CktElement,
+    PDElement,
+    Solution,
+    YMatrix,
+    KLUSolve,
+    ParallelLoop;
+
+type
+    TContingencyElement = record
+        Obj: TPDElement;
+        Yorder, NumPhases: Integer;
+        NodeRef: Array of Integer; // copy of NodeRef, 0-based
+        Y: Array of Complex; // copy of YPrim, column-major, 0-based
+        Buses: Array of Integer; // bus index of each terminal
+        Series: Boolean; // connects buses, used for the connectivity check
+        Monitored: Boolean; // checked for overloads
+        NormAmps, EmergAmps: Double;
+    end;
+
+    TContingencyWorker = record
+        hY: NativeUInt;
+        OwnsMatrix: Boolean;
+        V: Array of Complex; // post-contingency voltages, 1-based
+        Z: Array of Complex; // columns of inv(Y), NumNodes each
+        Work: Array of Complex;
+        Nodes: Array of Integer; // affected nodes
+        NodeIndex: Array of Integer; // index in Nodes for each system node, -1 if not affected
+        Outaged: Array of Integer; // element index -> stamp of the last case that removed it
+        Reached: Array of Integer; // bus index -> stamp of the last case that reached it
+        Queue: Array of Integer;
+        Stamp: Integer;
+    end;
+
+    TContingencyStudyRunner = class(TObject)
+    public
+        DSS: TDSSContext;
+        ckt: TDSSCircuit;
+        NumNodes: Integer;
+        V0: Array of Complex;
+        Elements: Array of TContingencyElement;
+        BusFirstSlot: Array of Integer; // bus index -> first slot at the bus, -1 if none
+        SlotElement: Array of Integer; // element of each slot
+        NextSlot: Array of Integer; // next slot at the same bus, -1 at the end
+        SourceBuses: Array of Integer;
+        BaseIsolatedBuses: Integer; // already isolated without outages
+        CaseNames: Array of String;
+        CaseElements: Array of Array of Integer;
+        Workers: Array of TContingencyWorker;
+        Results: TContingencyStudyResults;
+
+        destructor Destroy; override;
+        procedure Prepare();
+        function AddCase(const CaseSpec: String; const HandleToElement: Array of Integer): Boolean;
+        procedure PrepareWorker(var W: TContingencyWorker; Worker: Integer);
+        procedure SolveCase(Index, Worker: Integer);
+        function CheckConnectivity(var W: TContingencyWorker): Integer;
+        procedure CheckLimits(var W: TContingencyWorker; Index: Integer);
+    end;
+
+function TContingencyStudyResults.NumViolations(): Integer;
+var
+    i: Integer;
+begin
+    Result := 0;
+    for i := 0 to Count - 1 do
+        if (Converged[i] = 0) or (NumUnderVoltages[i] > 0) or (NumOverVoltages[i] > 0) or (NumOverloads[i] > 0) then
+            Inc(Result);
+end;
+
+destructor TContingencyStudyRunner.Destroy;
+var
+    w: Integer;
+begin
+    for w := 0 to High(Workers) do
+        if Workers[w].OwnsMatrix and (Workers[w].hY <> 0) then
+            DeleteSparseSet(Workers[w].hY);
+    Results.Free;
+    inherited Destroy;
+end;
+
+procedure TContingencyStudyRunner.Prepare();
+// Copies the data used by the workers, so that they don't touch the elements
+var
+    elem: TPDElement;
+    src: TDSSCktElement;
+    YValues: pComplexArray;
+    n, i, t, slot: Integer;
+begin
+    NumNodes := ckt.NumNodes;
+    SetLength(V0, NumNodes + 1);
+    Move(ckt.Solution.NodeV[0], V0[0], (NumNodes + 1) * SizeOf(Complex));
+
+    SetLength(Elements, ckt.PDElements.Count);
+    n := 0;
+    for elem in ckt.PDElements do
+    begin
+        if (not elem.Enabled) or (elem.NodeRef = NIL) or ((elem.DSSObjType and CLASSMASK) = FAULTOBJECT) then
+            continue;
+        YValues := elem.GetYPrimValues(ALL_YPRIM);
+        if YValues = NIL then
+            continue;
+
+        with Elements[n] do
+        begin
+            Obj := elem;
+            Yorder := elem.Yorder;
+            NumPhases := elem.NPhases;
+            SetLength(NodeRef, Yorder);
+            for i := 1 to Yorder do
+                NodeRef[i - 1] := elem.NodeRef[i];
+            SetLength(Y, Yorder * Yorder);
+            Move(YValues[1], Y[0], Yorder * Yorder * SizeOf(Complex));
+            SetLength(Buses, elem.NTerms);
+            for t := 1 to elem.NTerms do
+                Buses[t - 1] := elem.Terminals[t - 1].BusRef;
+            Series := (not elem.IsShunt) and (elem.NTerms > 1);
+            NormAmps := elem.NormAmps;
+            EmergAmps := elem.EmergAmps;
+            Monitored := (not elem.IsShunt) and ((NormAmps > 0) or (EmergAmps > 0));
+        end;
+        Inc(n);
+    end;
+    SetLength(Elements, n);
+
+    // Bus -> series element lists, for the connectivity check, with one
+    // slot per element terminal
+    SetLength(BusFirstSlot, ckt.NumBuses + 1);
+    for i := 0 to ckt.NumBuses do
+        BusFirstSlot[i] := -1;
+    slot := 0;
+    for i := 0 to n - 1 do
+    begin
+        if not Elements[i].Series then
+            continue;
+        for t := 0 to High(Elements[i].Buses) do
+        begin
+            if slot >= Length(SlotElement) then
+            begin
+                SetLength(SlotElement, Max(64, 2 * slot));
+                SetLength(NextSlot, Length(SlotElement));
+            end;
+            SlotElement[slot] := i;
+            NextSlot[slot] := BusFirstSlot[Elements[i].Buses[t]];
+            BusFirstSlot[Elements[i].Buses[t]] := slot;
+            Inc(slot);
+        end;
+    end;
+
+    SetLength(SourceBuses, 0);
+    for src in ckt.Sources do
+        if src.Enabled and (src.Terminals[0].BusRef > 0) then
+        begin
+            SetLength(SourceBuses, Length(SourceBuses) + 1);
+            SourceBuses[High(SourceBuses)] := src.Terminals[0].BusRef;
+        end;
+end;
+
+function TContingencyStudyRunner.AddCase(const CaseSpec: String; const HandleToElement: Array of Integer): Boolean;
+var
+    indices: Array of Integer;
+    elemName: String;
+    i, start, handle, n: Integer;
+begin
+    Result := False;
+    n := 0;
+    i := 1;
+    while i <= Length(CaseSpec) do
+    begin
+        while (i <= Length(CaseSpec)) and (CaseSpec[i] in [' ', ',', #9]) do
+            Inc(i);
+        start := i;
+        while (i <= Length(CaseSpec)) and not (CaseSpec[i] in [' ', ',', #9]) do
+            Inc(i);
+        if i = start then
+            break;
+
+        elemName := Copy(CaseSpec, start, i - start);
+        handle := ckt.SetElementActive(elemName);
+        if (handle <= 0) or (handle > High(HandleToElement)) or (HandleToElement[handle] < 0) then
+        begin
+            DoSimpleMsg(DSS, 'Contingency study: "%s" is not an enabled PD element of the active circuit.', [elemName], 20240721);
+            Exit;
+        end;
+        SetLength(indices, n + 1);
+        indices[n] := HandleToElement[handle];
+        Inc(n);
+    end;
+
+    SetLength(CaseNames, Length(CaseNames) + 1);
+    CaseNames[High(CaseNames)] := CaseSpec;
+    SetLength(CaseElements, Length(CaseElements) + 1);
+    CaseElements[High(CaseElements)] := indices;
+    Result := True;
+end;
+
+procedure TContingencyStudyRunner.PrepareWorker(var W: TContingencyWorker; Worker: Integer);
+// Worker 0 uses the factorization of the circuit, the others a copy of the
+// system Y matrix
+var
+    i: Integer;
+begin
+    W.OwnsMatrix := (Worker > 0);
+    if Worker = 0 then
+        W.hY := ckt.Solution.hYsystem
+    else
+        W.hY := NewSystemYCopy(DSS);
+
+    SetLength(W.V, NumNodes + 1);
+    SetLength(W.Work, NumNodes + 1);
+    SetLength(W.NodeIndex, NumNodes + 1);
+    for i := 0 to NumNodes do
+        W.NodeIndex[i] := -1;
+    SetLength(W.Outaged, Length(Elements)); // zero-filled
+    SetLength(W.Reached, ckt.NumBuses + 1);
+    SetLength(W.Queue, ckt.NumBuses + 1);
+    W.Stamp := 0;
+end;
+
+function TContingencyStudyRunner.CheckConnectivity(var W: TContingencyWorker): Integer;
+// Marks the buses reachable from the sources without the outaged elements.
+// Returns the number of isolated buses.
+var
+    head, tail, b, slot, e, t: Integer;
+begin
+    head := 0;
+    tail := 0;
+    for b in SourceBuses do
+        if W.Reached[b] <> W.Stamp then
+        begin
+            W.Reached[b] := W.Stamp;
+            W.Queue[tail] := b;
+            Inc(tail);
+        end;
+
+    while head < tail do
+    begin
+        b := W.Queue[head];
+        Inc(head);
+        slot := BusFirstSlot[b];
+        while slot >= 0 do
+        begin
+            e := SlotElement[slot];
+            if W.Outaged[e] <> W.Stamp then
+                for t in Elements[e].Buses do
+                    if (t > 0) and (W.Reached[t] <> W.Stamp) then
+                    begin
+                        W.Reached[t] := W.Stamp;
+                        W.Queue[tail] := t;
+                        Inc(tail);
+                    end;
+            slot := NextSlot[slot];
+        end;
+    end;
+    Result := ckt.NumBuses - tail;
+end;
+
+procedure TContingencyStudyRunner.CheckLimits(var W: TContingencyWorker; Index: Integer);
+var
+    pBus: TDSSBus;
+    b, j, e, i, l, order, numUnder, numOver, numOverloads, numEmerg, worst: Integer;
+    Vpu, Vmin, Vmax, Imax, Iphase, loading, maxLoading: Double;
+    busUnder, busOver: Boolean;
+    s: Complex;
+begin
+    numUnder := 0;
+    numOver := 0;
+    Vmin := NaN;
+    Vmax := NaN;
+    for b := 1 to ckt.NumBuses do
+    begin
+        pBus := ckt.Buses[b];
+        if (W.Reached[b] <> W.Stamp) or (pBus.kVBase <= 0) then
+            continue;
+        busUnder := False;
+        busOver := False;
+        for j := 1 to pBus.NumNodesThisBus do
+        begin
+            Vpu := Cabs(W.V[pBus.RefNo[j]]) / pBus.kVBase * 0.001;
+            if Vpu <= 0.1 then
+                continue; // ignore neutral nodes, as in the EnergyMeter reports
+            if IsNaN(Vmin) or (Vpu < Vmin) then
+                Vmin := Vpu;
+            if IsNaN(Vmax) or (Vpu > Vmax) then
+                Vmax := Vpu;
+            if Vpu < ckt.NormalMinVolts then
+                busUnder := True
+            else if Vpu > ckt.NormalMaxVolts then
+                busOver := True;
+        end;
+        if busUnder then
+            Inc(numUnder)
+        else if busOver then
+            Inc(numOver);
+    end;
+
+    // Terminal 1 phase currents against the ratings, as in the EnergyMeter overload report
+    numOverloads := 0;
+    numEmerg := 0;
+    maxLoading := 0;
+    worst := -1;
+    for e := 0 to High(Elements) do
+        with Elements[e] do
+        begin
+            if (not Monitored) or (W.Outaged[e] = W.Stamp) then
+                continue;
+            order := Yorder;
+            Imax := 0;
+            for i := 0 to NumPhases - 1 do
+            begin
+                s := 0;
+                for l := 0 to order - 1 do
+                    if NodeRef[l] > 0 then
+                        s += Y[l * order + i] * W.V[NodeRef[l]];
+                Iphase := Cabs(s);
+                if Iphase > Imax then
+                    Imax := Iphase;
+            end;
+
+            if (NormAmps > 0) and (Imax > NormAmps) then
+                Inc(numOverloads);
+            if (EmergAmps > 0) and (Imax > EmergAmps) then
+                Inc(numEmerg);
+            if NormAmps > 0 then
+            begin
+                loading := Imax / NormAmps * 100;
+                if loading > maxLoading then
+                begin
+                    maxLoading := loading;
+                    worst := e;
+                end;
+            end;
+        end;
+
+    Results.NumUnderVoltages[Index] := numUnder;
+    Results.NumOverVoltages[Index] := numOver;
+    Results.MinVoltages[Index] := Vmin;
+    Results.MaxVoltages[Index] := Vmax;
+    Results.NumOverloads[Index] := numOverloads;
+    Results.NumEmergOverloads[Index] := numEmerg;
+    Results.MaxLoadings[Index] := maxLoading;
+    if worst >= 0 then
+        Results.WorstElements[Index] := Elements[worst].Obj.FullName
+    else
+        Results.WorstElements[Index] := '';
+end;
+
+procedure TContingencyStudyRunner.SolveCase(Index, Worker: Integer);
+var
+    W: ^TContingencyWorker;
+    dY, A: TCMatrix;
+    V0k, u, dYu: Array of Complex;
+    e, c, i, j, l, k, ref, order: Integer;
+    s: Complex;
+    solved: Boolean;
+begin
+    W := @Workers[Worker];
+    Inc(W^.Stamp);
+
+    // Affected nodes
+    k := 0;
+    for c := 0 to High(CaseElements[Index]) do
+    begin
+        e := CaseElements[Index][c];
+        W^.Outaged[e] := W^.Stamp;
+        for ref in Elements[e].NodeRef do
+            if (ref > 0) and (W^.NodeIndex[ref] < 0) then
+            begin
+                if k >= Length(W^.Nodes) then
+                    SetLength(W^.Nodes, k + 16);
+                W^.NodeIndex[ref] := k;
+                W^.Nodes[k] := ref;
+                Inc(k);
+            end;
+    end;
+
+    solved := True;
+    dY := TCMatrix.CreateMatrix(Max(k, 1));
+    A := TCMatrix.CreateMatrix(Max(k, 1));
+    try
+        // dY = -sum(YPrim) of the outaged elements
+        for c := 0 to High(CaseElements[Index]) do
+            with Elements[CaseElements[Index][c]] do
+            begin
+                order := Yorder;
+                for j := 0 to order - 1 do
+                begin
+                    if NodeRef[j] = 0 then
+                        continue;
+                    for i := 0 to order - 1 do
+                        if NodeRef[i] > 0 then
+                            dY.AddElement(W^.NodeIndex[NodeRef[i]] + 1, W^.NodeIndex[NodeRef[j]] + 1, -Y[j * order + i]);
+                end;
+            end;
+
+        // Columns of inv(Y) for the affected nodes
+        if Length(W^.Z) < k * NumNodes then
+            SetLength(W^.Z, k * NumNodes);
+        for i := 1 to NumNodes do
+            W^.Work[i] := 0;
+        for l := 0 to k - 1 do
+        begin
+            W^.Work[W^.Nodes[l]] := 1;
+            if SolveSparseSet(W^.hY, pComplexArray(@W^.Z[l * NumNodes]), pComplexArray(@W^.Work[1])) <> 1 then
+                raise EEsolv32Problem.Create(_('Error solving System Y Matrix in the contingency study. Problem with Sparse matrix solver.'));
+            W^.Work[W^.Nodes[l]] := 0;
+        end;
+
+        // A = I + Zkk dY
+        for i := 1 to k do
+            for j := 1 to k do
+            begin
+                if i = j then
+                    s := 1
+                else
+                    s := 0;
+                for l := 1 to k do
+                    s += W^.Z[(l - 1) * NumNodes + W^.Nodes[i - 1] - 1] * dY[l, j];
+                A[i, j] := s;
+            end;
+
+        SetLength(V0k, k + 1);
+        SetLength(u, k + 1);
+        SetLength(dYu, k + 1);
+        if k > 0 then
+        begin
+            A.Invert();
+            if A.InvertError <> 0 then
+                solved := False
+            else
+            begin
+                for i := 0 to k - 1 do
+                    V0k[i] := V0[W^.Nodes[i]];
+                A.MVmult(pComplexArray(@u[0]), pComplexArray(@V0k[0]));
+                dY.MVmult(pComplexArray(@dYu[0]), pComplexArray(@u[0]));
+            end;
+        end;
+
+        if solved then
+            for i := 1 to NumNodes do
+            begin
+                s := V0[i];
+                for l := 0 to k - 1 do
+                    s -= W^.Z[l * NumNodes + i - 1] * dYu[l];
+                W^.V[i] := s;
+            end;
+    finally
+        dY.Free();
+        A.Free();
+        for l := 0 to k - 1 do
+            W^.NodeIndex[W^.Nodes[l]] := -1;
+    end;
+
+    Results.NumIsolatedBuses[Index] := CheckConnectivity(W^) - BaseIsolatedBuses;
+    if not solved then
+    begin
+        Results.Converged[Index] := 0;
+        Results.MinVoltages[Index] := NaN;
+        Results.MaxVoltages[Index] := NaN;
+        Results.MaxLoadings[Index] := NaN;
+        Exit;
+    end;
+    Results.Converged[Index] := 1;
+
+    // Isolated nodes are de-energized
+    for i := 1 to NumNodes do
+        if W^.Reached[ckt.MapNodeToBus[i].BusRef] <> W^.Stamp then
+            W^.V[i] := 0;
+    CheckLimits(W^, Index);
+end;
+
+function RunContingencyStudy(DSS: TDSSContext; const Cases: Array of String; NumThreads: Integer): Boolean;
+var
+    runner: TContingencyStudyRunner;
+    ckt: TDSSCircuit;
+    res: TContingencyStudyResults;
+    SavedActiveElement: TDSSCktElement;
+    HandleToElement: Array of Integer;
+    i, w, n: Integer;
+begin
+    Result := False;
+    FreeAndNil(DSS.ContingencyResults);
+    ckt := DSS.ActiveCircuit;
+    if (ckt = NIL) or (not ckt.IsSolved) or ckt.Solution.SystemYChanged or (ckt.Solution.hYsystem = 0)
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+        or (ckt.IncrCktElements.Count <> 0)
+{$ENDIF}
+    then
+    begin
+        DoSimpleMsg(DSS, _('Contingency study: the active circuit must be solved first.'), 20240720);
+        Exit;
+    end;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    ApplyLowRankUpdates(DSS); // the columns are computed directly from the factorization
+{$ENDIF}
+
+    runner := TContingencyStudyRunner.Create();
+    SavedActiveElement := ckt.ActiveCktElement;
+    try
+        runner.DSS := DSS;
+        runner.ckt := ckt;
+        runner.Prepare();
+
+        SetLength(HandleToElement, ckt.CktElements.Count + 1);
+        for i := 0 to High(HandleToElement) do
+            HandleToElement[i] := -1;
+        for i := 0 to High(runner.Elements) do
+            HandleToElement[runner.Elements[i].Obj.Handle] := i;
+
+        if Length(Cases) = 0 then
+        begin
+            for i := 0 to High(runner.Elements) do
+                if runner.Elements[i].Series then
+                    runner.AddCase(runner.Elements[i].Obj.FullName, HandleToElement);
+        end
+        else
+            for i := 0 to High(Cases) do
+                if not runner.AddCase(Cases[i], HandleToElement) then
+                    Exit;
+        ckt.ActiveCktElement := SavedActiveElement;
+
+        n := Length(runner.CaseNames);
+        res := TContingencyStudyResults.Create();
+        runner.Results := res;
+        res.Count := n;
+        res.CaseNames := runner.CaseNames;
+        SetLength(res.Converged, n);
+        SetLength(res.NumIsolatedBuses, n);
+        SetLength(res.NumUnderVoltages, n);
+        SetLength(res.NumOverVoltages, n);
+        SetLength(res.MinVoltages, n);
+        SetLength(res.MaxVoltages, n);
+        SetLength(res.NumOverloads, n);
+        SetLength(res.NumEmergOverloads, n);
+        SetLength(res.MaxLoadings, n);
+        SetLength(res.WorstElements, n);
+
+        SetLength(runner.Workers, ParallelLoopWorkers(NumThreads, n));
+        try
+            for w := 0 to High(runner.Workers) do
+                runner.PrepareWorker(runner.Workers[w], w);
+            Inc(runner.Workers[0].Stamp);
+            runner.BaseIsolatedBuses := runner.CheckConnectivity(runner.Workers[0]);
+            ParallelFor(n, runner.SolveCase, NumThreads);
+        except
+            on E: Exception do
+            begin
+                DoSimpleMsg(DSS, 'Contingency study: %s', [E.Message], 20240722);
+                Exit;
+            end;
+        end;
+        DSS.ContingencyResults := res;
+        runner.Results := NIL;
+        Result := True;
+    finally
+        ckt.ActiveCktElement := SavedActiveElement;
+        runner.Free;
+    end;
+end;
+
+end.
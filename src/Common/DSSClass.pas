@@ -22,6 +22,7 @@ USES
     UComplex, DSSUcomplex, 
     contnrs,
     CAPI_Types,
+    SolverProfile,
     gettext,
     fpjson;
 
@@ -146,7 +147,9 @@ type
         HasOCPDevice, // Fuse, Relay, or Recloser
         HasAutoOCPDevice, // Relay or Recloser only
         NeedsRecalc, // Used for Edit command loops
-        NeedsYPrim // Used for Edit command loops + setter flags
+        NeedsYPrim, // Used for Edit command loops + setter flags
+        EditTransaction, // In an edit transaction of the batch API (see EditTransaction.pas)
+        YprimDeferred // YPrim invalidated during an edit transaction, applied on commit
         // IsPartofFeeder,  -- UNUSED
         // Drawn,  // Flag used in tree searches etc  -- UNUSED
         // HasSwtControl // Has a remotely-controlled Switch -- UNUSED
@@ -322,6 +325,13 @@ type
         DeprecatedAndRemoved
         // OtherProperty
     );
+
+    // Output of the tabular exports (option ExportFormat)
+    TExportFormat = (
+        CSV = 0,
+        Binary = 1,
+        Memory = 2
+    );
 {$Z4} // keep enums as int32 values
     TPlotPhases = (LLPrimary = -6, LLAll = -5, LL3Ph = -4, Primary = -3, All = -2, ThreePhase = -1);
 
@@ -424,7 +434,7 @@ type
 
     TDSSClass = class(TObject)
     type 
-        THashListType = {$IFDEF DSS_CAPI_HASHLIST}TAltHashList;{$ELSE}THashList;{$ENDIF}
+        THashListType = {$IFDEF DSS_CAPI_HASHLIST}TAltHashList;{$ELSE}TOAHashList;{$ENDIF}
      private
 
         procedure Set_Active(value:Integer);
@@ -658,6 +668,36 @@ type
         DSSPlotCallback: dss_callback_plot_t;
         DSSMessageCallback: dss_callback_message_t;
         DSSAltEventCallbacks: Array[TAltDSSEvent] of altdss_callbacks_event_t;
+
+        // Optional timers/counters for the solver hot paths
+        SolverProfile: TSolverProfile;
+
+        // Incremented whenever the solution arrays (NodeV, Currents) are
+        // reallocated/released or the system is solved. Used to validate the
+        // zero-copy views returned by YMatrix_Get_NodeVView and related.
+        SolutionGeneration: UInt64;
+
+        // Incremented whenever the system Y matrix is built or modified. Used to
+        // validate the snapshot of the matrix and the views from YMatrix_Get_CSCView.
+        YGeneration: UInt64;
+        // Compressed column snapshot of the system Y (TSystemYSnapshot)
+        SystemYSnapshot: TObject;
+
+        // Results of the last protection coordination study (TProtectionStudyResults)
+        ProtectionResults: TObject;
+
+        // Results of the last contingency study (TContingencyStudyResults)
+        ContingencyResults: TObject;
+
+        // Results of the last hosting capacity study (THostingCapacityResults)
+        HostingCapacityResults: TObject;
+
+        // Table of the last export written with ExportFormat other than CSV (TMeterTable)
+        ExportFormat: TExportFormat;
+        ExportTable: TObject;
+
+        // Objects in the open edit transaction of the batch API (TEditTransaction)
+        EditTransaction: TObject;
     
         // Parallel Machine state
 {$IFDEF DSS_CAPI_PM}
@@ -1158,8 +1198,8 @@ begin
     Enums.Add(SolveModeEnum);
 
     SolveAlgEnum := TDSSEnum.Create('Solution Algorithm', True, 2, 2,
-        ['Normal', 'Newton'],
-        [NORMALSOLVE, NEWTONSOLVE]);
+        ['Normal', 'Newton', 'Sweep'],
+        [NORMALSOLVE, NEWTONSOLVE, SWEEPSOLVE]);
     SolveAlgEnum.DefaultValue := Ord(NORMALSOLVE);
     Enums.Add(SolveAlgEnum);
 
@@ -1205,6 +1245,10 @@ begin
     for i := 0 to ord(High(TAltDSSEvent)) do
         DSSAltEventCallbacks[TAltDSSEvent(i)] := nil;
 
+    SolverProfile := TSolverProfile.Create();
+    SolutionGeneration := 0;
+    YGeneration := 0;
+
     ClassNames := NIL;
     DSSClassList := NIL;
     Circuits := NIL;
@@ -1276,6 +1320,7 @@ begin
     MaxAllocationIterations := 2;
     FSolutionAbort := 0;
     AutoShowExport        := FALSE;
+    ExportFormat          := TExportFormat.CSV;
     AutoDisplayShowReport := TRUE;
     SolutionWasAttempted  := FALSE;
 
@@ -1353,6 +1398,13 @@ begin
     ComParser.Free;
 
     Enums.Free;
+    SolverProfile.Free;
+    ProtectionResults.Free;
+    ContingencyResults.Free;
+    HostingCapacityResults.Free;
+    ExportTable.Free;
+    SystemYSnapshot.Free;
+    EditTransaction.Free;
 
     if IsPrime then
     begin
@@ -0,0 +1,195 @@
+unit DynamicsIntegrator;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Integration of the states of the PC elements in the Dynamics mode (see
+// TSolutionAlgs.SolveDynamic).
+//
+// The elements whose IntegrateStates only touches their own data
+// (CanIntegrateInParallel) are split in chunks of consecutive elements of the
+// same class, which are distributed among the workers of a ParallelFor. The
+// remaining elements (e.g. PVSystem and Storage, which share shapes, curves and
+// user models) are integrated afterwards on the calling thread, in circuit
+// order. Each element only reads the node voltages of the last solution, so the
+// order does not change the results.
+//
+// For the adaptive time step, the states (Variable[]) can be saved after the
+// predictor and compared to the ones after the corrector; the difference is
+// used as the estimate of the local error of the step.
+
+interface
+
+uses
+    ArrayDef,
+    DSSClass,
+    PCElement;
+
+type
+    TDynamicsIntegrator = class(TObject)
+    private
+        DSS: TDSSContext;
+        Elements: Array of TPCElement; // all, in circuit order
+        Chunked: Array of TPCElement; // parallel elements, sorted by chunk
+        ChunkStart: Array of Integer; // NumChunks + 1 entries, into Chunked
+        Serial: Array of TPCElement;
+        Predicted: ArrayOfDouble;
+
+        procedure IntegrateChunk(Index, Worker: Integer);
+    public
+        constructor Create(dssContext: TDSSContext);
+
+        // Builds the chunks from the present list of PC elements
+        procedure Prepare();
+        // Calls IntegrateStates on every element, using up to NumThreads
+        // workers (all logical CPUs if <= 0)
+        procedure IntegrateStates(NumThreads: Integer);
+
+        procedure SavePredicted();
+        // Largest difference between the present states and the ones saved by
+        // SavePredicted, relative to the magnitude of the state (or absolute,
+        // for magnitudes below 1)
+        function CorrectorError(): Double;
+    end;
+
+implementation
+
+uses
+    Math,
+    ParallelLoop,
+    DSSHelper;
+
+const
+    CHUNK_SIZE = 16;
+
+constructor TDynamicsIntegrator.Create(dssContext: TDSSContext);
+begin
+    inherited Create();
+    DSS := dssContext;
+end;
+
+procedure TDynamicsIntegrator.Prepare();
+var
+    ElemClasses: Array of TDSSClass;
+    pcelem: TPCElement;
+    c, i, n, NumChunked, NumSerial, NumChunks: Integer;
+begin
+    SetLength(Elements, DSS.ActiveCircuit.PCElements.Count);
+    SetLength(Chunked, Length(Elements));
+    SetLength(Serial, Length(Elements));
+    SetLength(ChunkStart, Length(Elements) + 1);
+    SetLength(ElemClasses, 0);
+    n := 0;
+    NumSerial := 0;
+    for pcelem in DSS.ActiveCircuit.PCElements do
+    begin
+        Elements[n] := pcelem;
+        Inc(n);
+        if not pcelem.CanIntegrateInParallel() then
+        begin
+            Serial[NumSerial] := pcelem;
+            Inc(NumSerial);
+            continue;
+        end;
+        c := 0;
+        while (c < Length(ElemClasses)) and (ElemClasses[c] <> pcelem.ParentClass) do
+            Inc(c);
+        if c = Length(ElemClasses) then
+        begin
+            SetLength(ElemClasses, c + 1);
+            ElemClasses[c] := pcelem.ParentClass;
+        end;
+    end;
+    SetLength(Serial, NumSerial);
+
+    // Chunks of up to CHUNK_SIZE elements of a single class
+    NumChunked := 0;
+    NumChunks := 0;
+    for c := 0 to High(ElemClasses) do
+    begin
+        i := 0;
+        for pcelem in Elements do
+        begin
+            if (pcelem.ParentClass <> ElemClasses[c]) or not pcelem.CanIntegrateInParallel() then
+                continue;
+            if (i mod CHUNK_SIZE) = 0 then
+            begin
+                ChunkStart[NumChunks] := NumChunked;
+                Inc(NumChunks);
+            end;
+            Chunked[NumChunked] := pcelem;
+            Inc(NumChunked);
+            Inc(i);
+        end;
+    end;
+    ChunkStart[NumChunks] := NumChunked;
+    SetLength(ChunkStart, NumChunks + 1);
+    SetLength(Chunked, NumChunked);
+end;
+
+procedure TDynamicsIntegrator.IntegrateChunk(Index, Worker: Integer);
+var
+    i: Integer;
+begin
+    for i := ChunkStart[Index] to ChunkStart[Index + 1] - 1 do
+        Chunked[i].IntegrateStates();
+end;
+
+procedure TDynamicsIntegrator.IntegrateStates(NumThreads: Integer);
+var
+    pcelem: TPCElement;
+begin
+    if ParallelLoopWorkers(NumThreads, High(ChunkStart)) < 2 then
+    begin
+        for pcelem in Elements do
+            pcelem.IntegrateStates();
+        Exit;
+    end;
+
+    ParallelFor(High(ChunkStart), IntegrateChunk, NumThreads);
+    for pcelem in Serial do
+        pcelem.IntegrateStates();
+end;
+
+procedure TDynamicsIntegrator.SavePredicted();
+var
+    pcelem: TPCElement;
+    i, n: Integer;
+begin
+    n := 0;
+    for pcelem in Elements do
+        n := n + pcelem.NumVariables();
+    SetLength(Predicted, n);
+
+    n := 0;
+    for pcelem in Elements do
+        for i := 1 to pcelem.NumVariables() do
+        begin
+            Predicted[n] := pcelem.Variable[i];
+            Inc(n);
+        end;
+end;
+
+function TDynamicsIntegrator.CorrectorError(): Double;
+var
+    pcelem: TPCElement;
+    i, n: Integer;
+    Value: Double;
+begin
+    Result := 0;
+    n := 0;
+    for pcelem in Elements do
+        for i := 1 to pcelem.NumVariables() do
+        begin
+            if n > High(Predicted) then
+                Exit;
+            Value := pcelem.Variable[i];
+            if not (IsNan(Value) or IsNan(Predicted[n])) then
+                Result := Max(Result, Abs(Value - Predicted[n]) / Max(Abs(Value), 1.0));
+            Inc(n);
+        end;
+end;
+
+end.
@@ -0,0 +1,271 @@
+unit EditTransaction;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Edit transactions of the batch API (Batch_BeginEdit ... Batch_EndEdit or
+// Batch_Commit).
+//
+// Batch_BeginEdit puts the objects in edit mode and adds them to the
+// transaction of their DSS context, with the sequence number of their last
+// property set (PrpSequence[0]); the properties with a higher sequence number
+// on commit are the ones changed in the transaction. As for any object in
+// edit mode, the setters skip the EndEdit (RecalcElementData, etc.) of each
+// change. The property side effects still run for each change, since several
+// classes depend on their order (e.g. phases, conn).
+//
+// While in a transaction, the circuit elements don't invalidate the system Y
+// matrix when their YPrim becomes invalid; the request is only kept in the
+// flags of the element (Flg.YprimDeferred, see TDSSCktElement.Set_YprimInvalid).
+//
+// On commit, EndEdit runs once for each object with changes, on the calling
+// thread and in the order the objects entered the transaction; it is not run
+// in parallel since RecalcElementData reads shared state (e.g. loadshapes,
+// the message buffers and the circuit options). The deferred
+// YPrim invalidations are then applied together: when incremental Y updates
+// are enabled (SolverOptions) and the changes keep the structure of the
+// circuit, the elements are queued for a single incremental update
+// (UpdateYMatrix) on the next build of the system Y. Otherwise, their YPrims
+// are invalidated as usual and the system Y is rebuilt once.
+
+interface
+
+uses
+    DSSClass,
+    DSSObject;
+
+procedure TransactionBeginEdit(batch: TDSSObjectPtr; batchSize: Integer);
+// Ends the edit of the objects of the batch, as Batch_EndEdit
+procedure TransactionEndEdit(batch: TDSSObjectPtr; batchSize: Integer; NumEdits: Integer);
+// Ends the edit of all the objects in the transaction of the context, with the
+// number of properties changed for each. Returns the number of objects changed.
+function TransactionCommit(DSS: TDSSContext): Integer;
+
+implementation
+
+uses
+    DSSGlobals,
+    DSSHelper,
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    Solution,
+{$ENDIF}
+    CktElement;
+
+type
+    TEditTransaction = class(TObject)
+    public
+        Objects: Array of TDSSObject;
+        StartSeq: Array of Integer;
+        Count: Integer;
+
+        procedure Add(obj: TDSSObject);
+        // Removes the objects that left the transaction
+        procedure Compact();
+    end;
+
+    TEditCommit = class(TObject)
+    public
+        Objects: Array of TDSSObject;
+        NumChanges: Array of Integer;
+        Count: Integer;
+
+        constructor Create(Capacity: Integer);
+        procedure Add(obj: TDSSObject; NumEdits: Integer);
+        procedure Run(DSS: TDSSContext);
+    end;
+
+procedure TEditTransaction.Add(obj: TDSSObject);
+begin
+    if Count >= Length(Objects) then
+    begin
+        SetLength(Objects, 2 * Count + 16);
+        SetLength(StartSeq, Length(Objects));
+    end;
+    Objects[Count] := obj;
+    StartSeq[Count] := obj.PrpSequence[0];
+    Inc(Count);
+end;
+
+procedure TEditTransaction.Compact();
+var
+    i, n: Integer;
+begin
+    n := 0;
+    for i := 0 to Count - 1 do
+    begin
+        if not (Flg.EditTransaction in Objects[i].Flags) then
+            continue;
+        Objects[n] := Objects[i];
+        StartSeq[n] := StartSeq[i];
+        Inc(n);
+    end;
+    Count := n;
+end;
+
+constructor TEditCommit.Create(Capacity: Integer);
+begin
+    inherited Create();
+    SetLength(Objects, Capacity);
+    SetLength(NumChanges, Capacity);
+    Count := 0;
+end;
+
+procedure TEditCommit.Add(obj: TDSSObject; NumEdits: Integer);
+begin
+    Objects[Count] := obj;
+    NumChanges[Count] := NumEdits;
+    Inc(Count);
+end;
+
+procedure TEditCommit.Run(DSS: TDSSContext);
+var
+    obj: TDSSObject;
+    elem: TDSSCktElement;
+    i: Integer;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    incremental: Boolean;
+{$ENDIF}
+begin
+    // EndEdit, still in the transaction so that the YPrims are only marked
+    for i := 0 to Count - 1 do
+    begin
+        obj := Objects[i];
+        obj.ParentClass.EndEdit(obj, NumChanges[i]);
+    end;
+
+    for i := 0 to Count - 1 do
+        Exclude(Objects[i].Flags, Flg.EditTransaction);
+
+    // Deferred YPrim invalidations
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    incremental := (DSS.ActiveCircuit <> NIL) and
+        ((DSS.ActiveCircuit.Solution.SolverOptions and $FFFFFFFF) <> ord(TSolverOptions.ReuseNothing)) and
+        (not DSS.ActiveCircuit.Solution.SystemYChanged) and
+        (not DSS.ActiveCircuit.BusNameRedefined);
+    if incremental then
+        for i := 0 to Count - 1 do
+        begin
+            if not (Flg.YprimDeferred in Objects[i].Flags) then
+                continue;
+            elem := TDSSCktElement(Objects[i]);
+            if elem.Enabled and ((elem.YPrim = NIL) or elem.YPrimInvalid) then
+            begin
+                incremental := False;
+                break;
+            end;
+        end;
+{$ENDIF}
+    for i := 0 to Count - 1 do
+    begin
+        if not (Flg.YprimDeferred in Objects[i].Flags) then
+            continue;
+        elem := TDSSCktElement(Objects[i]);
+        Exclude(elem.Flags, Flg.YprimDeferred);
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+        if incremental and elem.Enabled then
+        begin
+            DSS.ActiveCircuit.IncrCktElements.Add(elem);
+            continue;
+        end;
+{$ENDIF}
+        elem.YPrimInvalid := TRUE;
+    end;
+end;
+
+procedure TransactionBeginEdit(batch: TDSSObjectPtr; batchSize: Integer);
+var
+    i: Integer;
+    cls: TDSSClass;
+    trans: TEditTransaction;
+begin
+    if (batch = NIL) or (batch^ = NIL) or (batchSize <= 0) then
+        Exit;
+
+    cls := batch^.ParentClass;
+    if batch^.DSS.EditTransaction = NIL then
+        batch^.DSS.EditTransaction := TEditTransaction.Create();
+    trans := TEditTransaction(batch^.DSS.EditTransaction);
+    for i := 1 to batchSize do
+    begin
+        if not (Flg.EditingActive in batch^.Flags) then
+        begin
+            cls.BeginEdit(batch^, False);
+            Include(batch^.Flags, Flg.EditTransaction);
+            trans.Add(batch^);
+        end
+        else
+            cls.BeginEdit(batch^, False); // reports the error
+        inc(batch);
+    end;
+end;
+
+procedure TransactionEndEdit(batch: TDSSObjectPtr; batchSize: Integer; NumEdits: Integer);
+var
+    i: Integer;
+    DSS: TDSSContext;
+    commit: TEditCommit;
+begin
+    if (batch = NIL) or (batch^ = NIL) or (batchSize <= 0) then
+        Exit;
+
+    DSS := batch^.DSS;
+    commit := TEditCommit.Create(batchSize);
+    try
+        for i := 1 to batchSize do
+        begin
+            if Flg.EditTransaction in batch^.Flags then
+                commit.Add(batch^, NumEdits)
+            else
+                batch^.ParentClass.EndEdit(batch^, NumEdits);
+            inc(batch);
+        end;
+        if commit.Count = 0 then
+            Exit;
+        commit.Run(DSS);
+    finally
+        commit.Free();
+    end;
+    if DSS.EditTransaction <> NIL then
+        TEditTransaction(DSS.EditTransaction).Compact();
+end;
+
+function TransactionCommit(DSS: TDSSContext): Integer;
+var
+    trans: TEditTransaction;
+    commit: TEditCommit;
+    obj: TDSSObject;
+    i, n: Integer;
+begin
+    Result := 0;
+    trans := TEditTransaction(DSS.EditTransaction);
+    if (trans = NIL) or (trans.Count = 0) then
+        Exit;
+
+    commit := TEditCommit.Create(trans.Count);
+    try
+        for i := 0 to trans.Count - 1 do
+        begin
+            obj := trans.Objects[i];
+            if not (Flg.EditTransaction in obj.Flags) then
+                continue;
+            n := obj.PrpSequence[0] - trans.StartSeq[i];
+            if (n = 0) and not (Flg.YprimDeferred in obj.Flags) then
+            begin
+                // Nothing changed, nothing to recalculate
+                Exclude(obj.Flags, Flg.EditTransaction);
+                Exclude(obj.Flags, Flg.EditingActive);
+                continue;
+            end;
+            commit.Add(obj, n);
+        end;
+        trans.Count := 0;
+        commit.Run(DSS);
+        Result := commit.Count;
+    finally
+        commit.Free();
+    end;
+end;
+
+end.
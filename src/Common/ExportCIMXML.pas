@@ -40,6 +40,10 @@ type
 
     TCIMExporter = class;
 
+    // Writes the item Index of a parallel section with W; Section is the main
+    // exporter, with the data of the section (see RunSection)
+    TCIMSectionItem = procedure(W, Section: TCIMExporter; Index: Integer);
+
     TCIMBankObject = class(TNamedObject)
     PUBLIC
         vectorGroup: String;
@@ -133,8 +137,27 @@ type
         F_DYN: TStream;
         roots: array[ProfileChoice] of String;
         ids: array[ProfileChoice] of TUuid;
+
+        // Parallel sections: chunks of items are written by chunk exporters,
+        // each one with in-memory streams, which are then appended to the
+        // files in the order of the items. The UUIDs used by the items are
+        // looked up (or created) before the section runs, in SectionUuids,
+        // so the chunk exporters don't touch the UUID lists.
+        SectionUuids: array of TUuid;
+        SectionItem: TCIMSectionItem;
+        SectionCount: Integer;
+        SectionChunks: array of TCIMExporter;
+        TopoIslandID: TUuid;
+        NormLimitType: TNamedObject;
+        EmergLimitType: TNamedObject;
+
+        constructor CreateChunk(Main: TCIMExporter);
+        function ProfileStream(prf: ProfileChoice): TStream;
+        procedure RunSectionChunk(Index, Worker: Integer);
+        procedure RunSection(Count: Integer; Item: TCIMSectionItem);
     public
         Separate: Boolean;
+        NumThreads: Integer; // for the parallel sections; <= 0 for all logical CPUs, 1 for a serial export
         procedure WriteCimLn(prf: ProfileChoice; const s: String);
         procedure StartInstance(prf: ProfileChoice; Root: String; Obj: TNamedObject);
         procedure StartFreeInstance(prf: ProfileChoice; Root: String; uuid: TUUID);
@@ -233,12 +256,14 @@ uses
     Recloser,
     XYCurve,
     DSSObject,
-    DSSHelper;
+    DSSHelper,
+    ParallelLoop;
 
 const
 //  CIM_NS = 'http://iec.ch/TC57/2012/CIM-schema-cim17';
     CIM_NS = 'http://iec.ch/TC57/CIM100';
     CatBQmin = 0.43; // for IEEE 1547 Category B estimate
+    CIM_SECTION_CHUNK = 256; // items per chunk exporter, in the parallel sections
 
 type
     TCIMExporterHelper = class helper for TCIMExporter
@@ -373,38 +398,37 @@ begin
     Result := DSS.ActiveCircuit;
 end;
 
+function TCIMExporter.ProfileStream(prf: ProfileChoice): TStream;
+begin
+    Result := F_FUN;
+    if not Separate then
+        Exit;
+    case prf of
+        EpPrf:
+            Result := F_EP;
+        GeoPrf:
+            Result := F_GEO;
+        TopoPrf:
+            Result := F_TOPO;
+        CatPrf:
+            Result := F_CAT;
+        SshPrf:
+            Result := F_SSH;
+        DynPrf:
+            Result := F_DYN;
+    end;
+end;
+
 procedure TCIMExporter.WriteCimLn(prf: ProfileChoice; const s: String);
 begin
-    if Separate then
+    if Separate and (prf <> FunPrf) then
     begin
-        if prf <> FunPrf then
+        if length(roots[prf]) < 1 then
         begin
-            if length(roots[prf]) < 1 then
-            begin
-                StartFreeInstance(prf, roots[FunPrf], ids[FunPrf]);
-            end;
+            StartFreeInstance(prf, roots[FunPrf], ids[FunPrf]);
         end;
-        case prf of
-            FunPrf:
-                FSWriteLn(F_FUN, s);
-            EpPrf:
-                FSWriteLn(F_EP, s);
-            GeoPrf:
-                FSWriteLn(F_GEO, s);
-            TopoPrf:
-                FSWriteLn(F_TOPO, s);
-            CatPrf:
-                FSWriteLn(F_CAT, s);
-            SshPrf:
-                FSWriteLn(F_SSH, s);
-            DynPrf:
-                FSWriteLn(F_DYN, s);
-        end;
-    end
-    else
-    begin
-        FSWriteLn(F_FUN, s)
     end;
+    FSWriteLn(ProfileStream(prf), s);
 end;
 
 procedure TCIMExporter.StartInstance(prf: ProfileChoice; Root: String; Obj: TNamedObject);
@@ -2074,7 +2098,7 @@ procedure TCIMExporterHelper.WriteReferenceTerminals(pElem: TDSSCktElement; RefU
 var
     Nterm, j, ref: Integer;
     BusName, TermName, LimitName: String;
-    TermUuid, LimiTUuid: TUuid;
+    TermUuid: TUuid;
     pLimit: TCIMOpLimitObject;
 begin
     Nterm := pElem.Nterms;
@@ -2105,8 +2129,7 @@ begin
                     pLimit.UUID := GetDevUuid(OpLimI, LimitName, 0);
                     AddOpLimit(pLimit);
                 end;
-                LimiTUuid := GetDevUuid(OpLimI, LimitName, 0);
-                UuidNode(FunPrf, 'ACDCTerminal.OperationalLimitSet', LimiTUuid);
+                UuidNode(FunPrf, 'ACDCTerminal.OperationalLimitSet', pLimit.UUID);
             end;
             EndInstance(FunPrf, 'Terminal');
         end;
@@ -3185,6 +3208,142 @@ end;
 ///////// end helper class for exporting IEEE 1547 model parameters /////////////
 
 
+constructor TCIMExporter.CreateChunk(Main: TCIMExporter);
+var
+    i: ProfileChoice;
+begin
+    Create(Main.DSS);
+    Separate := Main.Separate;
+    for i := Low(ProfileChoice) to High(ProfileChoice) do
+        roots[i] := '';
+    F_FUN := TMemoryStream.Create();
+    if Separate then
+    begin
+        F_EP := TMemoryStream.Create();
+        F_SSH := TMemoryStream.Create();
+        F_CAT := TMemoryStream.Create();
+        F_GEO := TMemoryStream.Create();
+        F_TOPO := TMemoryStream.Create();
+        F_DYN := TMemoryStream.Create();
+    end;
+end;
+
+procedure TCIMExporter.RunSectionChunk(Index, Worker: Integer);
+var
+    i: Integer;
+begin
+    for i := Index * CIM_SECTION_CHUNK to Min(SectionCount, (Index + 1) * CIM_SECTION_CHUNK) - 1 do
+        SectionItem(SectionChunks[Index], self, i);
+end;
+
+procedure TCIMExporter.RunSection(Count: Integer; Item: TCIMSectionItem);
+var
+    i: Integer;
+    prf: ProfileChoice;
+    F: TStream;
+begin
+    if Count <= 0 then
+        Exit;
+
+    SetLength(SectionChunks, (Count + CIM_SECTION_CHUNK - 1) div CIM_SECTION_CHUNK);
+    if ParallelLoopWorkers(NumThreads, Length(SectionChunks)) <= 1 then
+    begin
+        // Serial export, written directly to the files
+        SectionChunks := NIL;
+        for i := 0 to Count - 1 do
+            Item(self, self, i);
+        Exit;
+    end;
+
+    SectionItem := Item;
+    SectionCount := Count;
+    try
+        for i := 0 to High(SectionChunks) do
+            SectionChunks[i] := TCIMExporter.CreateChunk(self);
+
+        ParallelFor(Length(SectionChunks), RunSectionChunk, NumThreads);
+
+        for i := 0 to High(SectionChunks) do
+            for prf := Low(ProfileChoice) to High(ProfileChoice) do
+            begin
+                if (not Separate) and (prf <> FunPrf) then
+                    break;
+                F := SectionChunks[i].ProfileStream(prf);
+                if F.Size > 0 then
+                    ProfileStream(prf).CopyFrom(F, 0);
+            end;
+
+        // Open instances, as left by the last item
+        roots := SectionChunks[High(SectionChunks)].roots;
+        ids := SectionChunks[High(SectionChunks)].ids;
+    finally
+        for i := 0 to High(SectionChunks) do
+            FreeAndNil(SectionChunks[i]);
+        SectionChunks := NIL;
+    end;
+end;
+
+// Items of the parallel sections of ExportCDPSM. These run on worker threads:
+// the UUIDs they use come from Section.SectionUuids, and they must not change
+// the state of the main exporter.
+
+procedure WriteBusTopology(W, Section: TCIMExporter; Index: Integer);
+var
+    ckt: TDSSCircuit;
+    busName: String;
+    busUUID, geoUUID: TUuid;
+begin
+    // SectionUuids: topological node, connectivity node and voltage limit set of each bus
+    ckt := W.ActiveCircuit;
+    busName := ckt.Buses[Index + 1].localName;
+    geoUUID := Section.SectionUuids[3 * Index];
+    busUUID := Section.SectionUuids[3 * Index + 1];
+    W.StartFreeInstance(TopoPrf, 'TopologicalNode', geoUUID);
+    W.StringNode(TopoPrf, 'IdentifiedObject.mRID', UUIDToCIMString(geoUUID));
+    W.StringNode(TopoPrf, 'IdentifiedObject.name', busName);
+    W.UuidNode(TopoPrf, 'TopologicalNode.TopologicalIsland', Section.TopoIslandID);
+    W.EndInstance(TopoPrf, 'TopologicalNode');
+
+    W.StartFreeInstance(TopoPrf, 'ConnectivityNode', busUUID);
+    W.StringNode(TopoPrf, 'IdentifiedObject.mRID', UUIDToCIMString(busUUID));
+    W.StringNode(TopoPrf, 'IdentifiedObject.name', busName);
+    W.UuidNode(TopoPrf, 'ConnectivityNode.TopologicalNode', geoUUID);
+    W.UuidNode(TopoPrf, 'ConnectivityNode.OperationalLimitSet', Section.SectionUuids[3 * Index + 2]);
+    W.WriteCimLn(TopoPrf, Format('  <cim:ConnectivityNode.ConnectivityNodeContainer rdf:resource="urn:uuid:%s"/>',
+        [ckt.CIM_ID]));
+    W.EndInstance(TopoPrf, 'ConnectivityNode');
+end;
+
+procedure WriteOpLimitSet(W, Section: TCIMExporter; Index: Integer);
+var
+    pILimit: TCIMOpLimitObject;
+    pName: TNamedObject;
+begin
+    // SectionUuids: normal and emergency current limits of each set
+    pILimit := Section.OpLimitList[Index];
+    W.StartInstance(FunPrf, 'OperationalLimitSet', pILimit);
+    W.EndInstance(FunPrf, 'OperationalLimitSet');
+    pName := TNamedObject.Create('Temp1');
+    try
+        pName.LocalName := pILimit.LocalName + '_Norm';
+        pName.UUID := Section.SectionUuids[2 * Index];
+        W.StartInstance(FunPrf, 'CurrentLimit', pName);
+        W.RefNode(FunPrf, 'OperationalLimit.OperationalLimitSet', pILimit);
+        W.RefNode(FunPrf, 'OperationalLimit.OperationalLimitType', Section.NormLimitType);
+        W.DoubleNode(FunPrf, 'CurrentLimit.value', pILimit.NormAmps);
+        W.EndInstance(FunPrf, 'CurrentLimit');
+        pName.LocalName := pILimit.LocalName + '_Emerg';
+        pName.UUID := Section.SectionUuids[2 * Index + 1];
+        W.StartInstance(FunPrf, 'CurrentLimit', pName);
+        W.RefNode(FunPrf, 'OperationalLimit.OperationalLimitSet', pILimit);
+        W.RefNode(FunPrf, 'OperationalLimit.OperationalLimitType', Section.EmergLimitType);
+        W.DoubleNode(FunPrf, 'CurrentLimit.value', pILimit.EmergAmps);
+        W.EndInstance(FunPrf, 'CurrentLimit');
+    finally
+        pName.Free();
+    end;
+end;
+
 procedure TCIMExporterHelper.StartCIMFile(var F: TStream; FileNm: String; prf: ProfileChoice);
 begin
     F := DSS.GetOutputStreamEx(FileNm, fmCreate);
@@ -3226,6 +3385,7 @@ var
     pNormLimit, pEmergLimit, pRangeAHiLimit, pRangeALoLimit, pRangeBHiLimit, pRangeBLoLimit: TNamedObject; // OperationalLimitType
     LimitName: String;
     LimiTUuid: TUuid;
+    NumLimits: Integer;
 
     zbase: Double;
     s: String;
@@ -3462,25 +3622,20 @@ begin
             ActiveCircuit.Buses[i].localName := ActiveCircuit.BusList.NameOfIndex(i);
         end;
 
-        // each bus corresponds to a topo node (TODO, do we need topo nodes anymore?) and connectivity node
+        // each bus corresponds to a topo node (TODO, do we need topo nodes anymore?) and connectivity node;
+        // the UUIDs are looked up here, in the order of the serial export, since new UUIDs are
+        // added to the UUID list (and to the "uuids" export) as they are requested; the nodes
+        // are then written in parallel
+        SetLength(SectionUuids, 3 * ActiveCircuit.NumBuses);
         for i := 1 to ActiveCircuit.NumBuses do
         begin
-            geoUUID := GetDevUuid(Topo, ActiveCircuit.Buses[i].localName, 1);
-            StartFreeInstance(TopoPrf, 'TopologicalNode', geoUUID);
-            StringNode(TopoPrf, 'IdentifiedObject.mRID', UUIDToCIMString(geoUUID));
-            StringNode(TopoPrf, 'IdentifiedObject.name', ActiveCircuit.Buses[i].localName);
-            UuidNode(TopoPrf, 'TopologicalNode.TopologicalIsland', pIsland.UUID);
-            EndInstance(TopoPrf, 'TopologicalNode');
-
-            StartFreeInstance(TopoPrf, 'ConnectivityNode', ActiveCircuit.Buses[i].UUID);
-            StringNode(TopoPrf, 'IdentifiedObject.mRID', UUIDToCIMString(ActiveCircuit.Buses[i].UUID));
-            StringNode(TopoPrf, 'IdentifiedObject.name', ActiveCircuit.Buses[i].localName);
-            UuidNode(TopoPrf, 'ConnectivityNode.TopologicalNode', geoUUID);
-            UuidNode(TopoPrf, 'ConnectivityNode.OperationalLimitSet', GetOpLimVUuid(sqrt(3.0) * ActiveCircuit.Buses[i].kVBase));
-            FD.WriteCimLn(TopoPrf, Format('  <cim:ConnectivityNode.ConnectivityNodeContainer rdf:resource="urn:uuid:%s"/>',
-                [ActiveCircuit.CIM_ID]));
-            EndInstance(TopoPrf, 'ConnectivityNode');
+            SectionUuids[3 * (i - 1)] := GetDevUuid(Topo, ActiveCircuit.Buses[i].localName, 1);
+            SectionUuids[3 * (i - 1) + 1] := ActiveCircuit.Buses[i].UUID;
+            SectionUuids[3 * (i - 1) + 2] := GetOpLimVUuid(sqrt(3.0) * ActiveCircuit.Buses[i].kVBase);
         end;
+        TopoIslandID := pIsland.UUID;
+        RunSection(ActiveCircuit.NumBuses, @WriteBusTopology);
+        SectionUuids := NIL;
 
         // find the swing bus ==> first voltage source
         for pVsrc in ActiveCircuit.Sources do // pIsrc are in the same list
@@ -4656,28 +4811,24 @@ begin
         end;
 
     // export the operational current limits that were created on-the-fly
-        for i := Low(OpLimitList) to High(OpLimitList) do
+        // look up the UUIDs of the limits in the order of the serial export (see the buses above),
+        // then write the sets in parallel
+        NumLimits := 0;
+        while (NumLimits <= High(OpLimitList)) and (OpLimitList[NumLimits] <> NIL) do
+            Inc(NumLimits);
+        SetLength(SectionUuids, 2 * NumLimits);
+        for i := 0 to NumLimits - 1 do
         begin
             pILimit := OpLimitList[i];
-            if pILimit = NIL then
-                break;
-            StartInstance(FunPrf, 'OperationalLimitSet', pILimit);
-            EndInstance(FunPrf, 'OperationalLimitSet');
-            pName1.LocalName := pILimit.LocalName + '_Norm';
-            pName1.UUID := GetDevUuid(NormAmps, pILimit.LocalName, 1);
-            StartInstance(FunPrf, 'CurrentLimit', pName1);
-            RefNode(FunPrf, 'OperationalLimit.OperationalLimitSet', pILimit);
-            RefNode(FunPrf, 'OperationalLimit.OperationalLimitType', pNormLimit);
-            DoubleNode(FunPrf, 'CurrentLimit.value', pILimit.NormAmps);
-            EndInstance(FunPrf, 'CurrentLimit');
-            pName2.LocalName := pILimit.LocalName + '_Emerg';
-            pName2.UUID := GetDevUuid(EmergAmps, pILimit.LocalName, 1);
-            StartInstance(FunPrf, 'CurrentLimit', pName2);
-            RefNode(FunPrf, 'OperationalLimit.OperationalLimitSet', pILimit);
-            RefNode(FunPrf, 'OperationalLimit.OperationalLimitType', pEmergLimit);
-            DoubleNode(FunPrf, 'CurrentLimit.value', pILimit.EmergAmps);
-            EndInstance(FunPrf, 'CurrentLimit');
+            SectionUuids[2 * i] := GetDevUuid(NormAmps, pILimit.LocalName, 1);
+            SectionUuids[2 * i + 1] := GetDevUuid(EmergAmps, pILimit.LocalName, 1);
         end;
+        NormLimitType := pNormLimit;
+        EmergLimitType := pEmergLimit;
+        RunSection(NumLimits, @WriteOpLimitSet);
+        NormLimitType := NIL;
+        EmergLimitType := NIL;
+        SectionUuids := NIL;
 
         FreeAndNil(pName1);
         FreeAndNil(pName2);
@@ -4719,10 +4870,20 @@ begin
     BankHash := NIL;
     ECPHash := NIL;
     OpLimitHash := NIL;
+    SectionUuids := NIL;
+    NumThreads := 0;
 end;
 
 destructor TCIMExporter.Destroy;
 begin
+    // only the chunk exporters still have streams here
+    FreeAndNil(F_FUN);
+    FreeAndNil(F_EP);
+    FreeAndNil(F_SSH);
+    FreeAndNil(F_CAT);
+    FreeAndNil(F_GEO);
+    FreeAndNil(F_TOPO);
+    FreeAndNil(F_DYN);
     inherited Destroy;
 end;
 
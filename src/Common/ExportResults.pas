@@ -12,7 +12,8 @@ interface
 uses
     EnergyMeter,
     XYCurve,
-    DSSClass;
+    DSSClass,
+    SparseExport;
 
 procedure ExportVoltages(DSS: TDSSContext; FileNm: String);
 procedure ExportSeqVoltages(DSS: TDSSContext; FileNm: String);
@@ -31,8 +32,8 @@ procedure ExportLoads(DSS: TDSSContext; FileNm: String);
 procedure ExportCapacity(DSS: TDSSContext; FileNm: String);
 procedure ExportOverloads(DSS: TDSSContext; FileNm: String);
 procedure ExportUnserved(DSS: TDSSContext; FileNm: String; UE_Only: Boolean);
-procedure ExportYprim(DSS: TDSSContext; FileNm: String);
-procedure ExportY(DSS: TDSSContext; FileNm: String; TripletOpt: Boolean);
+procedure ExportYprim(DSS: TDSSContext; FileNm: String; Fmt: TSparseExportFormat);
+procedure ExportY(DSS: TDSSContext; FileNm: String; Fmt: TSparseExportFormat);
 procedure ExportSeqZ(DSS: TDSSContext; FileNm: String);
 procedure ExportBusCoords(DSS: TDSSContext; FileNm: String);
 procedure ExportLosses(DSS: TDSSContext; FileNm: String);
@@ -111,7 +112,8 @@ uses
     CNData,
     TSData,
     StrUtils,
-    DSSObject;
+    DSSObject,
+    ExportWriter;
 
 procedure WriteElementVoltagesExportFile(DSS: TDSSContext; F: TFileStream; pElem: TDSSCktElement; MaxNumNodes: Integer);
 
@@ -179,7 +181,7 @@ procedure ExportSeqVoltages(DSS: TDSSContext; FileNm: String);
 // Export Symmetrical Component bus voltages
 
 var
-    F: TFileStream = nil;
+    W: TExportWriter = nil;
     i, j: Integer;
     nref: Integer;
     Vph, VphLL, V012: Complex3;
@@ -191,9 +193,9 @@ var
 
 begin
     try
-        F := TBufferedFileStream.Create(FileNm, fmCreate);
+        W := CreateExportWriter(DSS, FileNm);
 
-        FSWriteln(F, 'Bus,  V1,  p.u.,Base kV, V2, %V2/V1, V0, %V0/V1, Vresidual, %NEMA');
+        W.WriteHeader('Bus,  V1,  p.u.,Base kV, V2, %V2/V1, V0, %V0/V1, Vresidual, %NEMA');
         with DSS.ActiveCircuit do
         begin
             for i := 1 to NumBuses do
@@ -255,21 +257,26 @@ begin
                     for j := 1 to Buses^[i].NumNodesThisBus do
                         Vresidual += NodeV^[Buses^[i].GetRef(j)];
 
-                FSWriteln(F,
-                    Format('"%s", %10.6g, %9.5g, %8.2f, %10.6g, %8.4g, %10.6g, %8.4g, %10.6g, %8.4g',
-                    [AnsiUpperCase(BusList.NameOfIndex(i)), V1, Vpu, (Buses^[i].kvbase * SQRT3), V2, V2V1, V0, V0V1, Cabs(Vresidual), V_NEMA]
-                    ));
-
-
+                W.BeginRow();
+                W.AddText(AnsiUpperCase(BusList.NameOfIndex(i)), '"%s"');
+                W.Add(V1, ', %10.6g');
+                W.Add(Vpu, ', %9.5g');
+                W.Add(Buses^[i].kvbase * SQRT3, ', %8.2f');
+                W.Add(V2, ', %10.6g');
+                W.Add(V2V1, ', %8.4g');
+                W.Add(V0, ', %10.6g');
+                W.Add(V0V1, ', %8.4g');
+                W.Add(Cabs(Vresidual), ', %10.6g');
+                W.Add(V_NEMA, ', %8.4g');
+                W.EndRow();
             end;
         end;
 
-
-        DSS.GlobalResult := FileNm;
+        W.Finish();
 
     finally
 
-        FreeAndNil(F);
+        FreeAndNil(W);
     end;
 end;
 
@@ -280,9 +287,10 @@ procedure ExportVoltages(DSS: TDSSContext; FileNm: String);
 
 var
     MaxNumNodes: Integer;
-    F: TFileStream = nil;
+    W: TExportWriter = nil;
     i, j, jj: Integer;
     BusName: String;
+    Header: String;
     Volts: Complex;
     nref: Integer;
     NodeIdx: Integer;
@@ -298,19 +306,21 @@ begin
             MaxNumNodes := max(MaxNumNodes, Buses^[i].NumNodesThisBus);
 
     try
-        F := TBufferedFileStream.Create(FileNm, fmCreate);
+        W := CreateExportWriter(DSS, FileNm);
 
-        FSWrite(F, 'Bus, BasekV');
+        Header := 'Bus, BasekV';
         for i := 1 to MaxNumNodes do
-            FSWrite(F, Format(', Node%d, Magnitude%d, Angle%d, pu%d', [i, i, i, i]));
-        FSWriteln(F);
+            Header := Header + Format(', Node%d, Magnitude%d, Angle%d, pu%d', [i, i, i, i]);
+        W.WriteHeader(Header);
 
         with DSS.ActiveCircuit do
         begin
             for i := 1 to NumBuses do
             begin
                 BusName := BusList.NameOfIndex(i);
-                FSWrite(F, Format('"%s", %.5g', [AnsiUpperCase(BusName), Buses^[i].kvbase * SQRT3]));
+                W.BeginRow();
+                W.AddText(AnsiUpperCase(BusName), '"%s"');
+                W.Add(Buses^[i].kvbase * SQRT3, ', %.5g');
 
                 jj := 1;
                 with Buses^[i] do
@@ -328,28 +338,34 @@ begin
                         else
                             Vpu := 0.0;
 
-                        FSWrite(F,
-                            Format(', %d, %10.6g, %6.1f, %9.5g',
-                            [GetNum(NodeIdx), Vmag, cdang(Volts), Vpu]));
+                        W.AddInt(GetNum(NodeIdx), ', %d');
+                        W.Add(Vmag, ', %10.6g');
+                        W.Add(cdang(Volts), ', %6.1f');
+                        W.Add(Vpu, ', %9.5g');
                     end;
            {Zero Fill row}
                 for j := Buses^[i].NumNodesThisBus + 1 to MaxNumNodes do
-                    FSWrite(F, ', 0, 0, 0, 0');
-                FSWriteln(F);
+                begin
+                    W.AddInt(0, ', 0');
+                    W.Add(0, ', 0');
+                    W.Add(0, ', 0');
+                    W.Add(0, ', 0');
+                end;
+                W.EndRow();
             end;
         end;
 
-        DSS.GlobalResult := FileNm;
+        W.Finish();
 
     finally
 
-        FreeAndNil(F);
+        FreeAndNil(W);
 
     end;
 end;
 // = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = =
 
-procedure CalcAndWriteSeqCurrents(DSS: TDSSContext; F: TFileStream; j: Integer; pelem: TDSSCktElement; cBuffer: pComplexArray; DoRatings: Boolean);
+procedure CalcAndWriteSeqCurrents(DSS: TDSSContext; W: TExportWriter; j: Integer; pelem: TDSSCktElement; cBuffer: pComplexArray; DoRatings: Boolean);
 var
     I0, I1, I2, I2I1, I0I1, iNormal, iEmerg: Double;
     i, k, NCond: Integer;
@@ -424,13 +440,24 @@ begin
         Iresidual += cBuffer^[i];
 
 
-    FSWriteln(F, Format('"%s", %3d, %10.6g, %8.4g, %8.4g, %10.6g, %8.4g, %10.6g, %8.4g, %10.6g, %8.4g',
-        [(pelem.DSSClassName + '.' + AnsiUpperCase(pelem.Name)), j, I1, iNormal, iEmerg, I2, I2I1, I0, I0I1, Cabs(Iresidual), I_NEMA]));
+    W.BeginRow();
+    W.AddText(pelem.DSSClassName + '.' + AnsiUpperCase(pelem.Name), '"%s"');
+    W.AddInt(j, ', %3d');
+    W.Add(I1, ', %10.6g');
+    W.Add(iNormal, ', %8.4g');
+    W.Add(iEmerg, ', %8.4g');
+    W.Add(I2, ', %10.6g');
+    W.Add(I2I1, ', %8.4g');
+    W.Add(I0, ', %10.6g');
+    W.Add(I0I1, ', %8.4g');
+    W.Add(Cabs(Iresidual), ', %10.6g');
+    W.Add(I_NEMA, ', %8.4g');
+    W.EndRow();
 end;
 
 procedure ExportSeqCurrents(DSS: TDSSContext; FileNm: String);
 var
-    F: TFileStream = nil;
+    W: TExportWriter = nil;
     j: Integer;
     pElem: TDSSCktElement;
     PDElem: TPDElement;
@@ -439,10 +466,10 @@ var
 begin
     cBuffer := NIL;
     try
-        F := TBufferedFileStream.Create(FileNm, fmCreate);
+        W := CreateExportWriter(DSS, FileNm);
 
         // Sequence Currents
-        FSWriteln(F, 'Element, Terminal,  I1, %Normal, %Emergency, I2, %I2/I1, I0, %I0/I1, Iresidual, %NEMA');
+        W.WriteHeader('Element, Terminal,  I1, %Normal, %Emergency, I2, %I2/I1, I0, %I0/I1, Iresidual, %NEMA');
 
         // Allocate cBuffer big enough for largest circuit element
         Getmem(cbuffer, SizeOf(Complex) * DSS.ActiveCircuit.GetMaxCktElementSize());
@@ -456,7 +483,7 @@ begin
             begin
                 pelem.GetCurrents(cBuffer);
                 for j := 1 to pelem.Nterms do
-                    CalcAndWriteSeqCurrents(DSS, F, j, pelem, cBuffer, FALSE);
+                    CalcAndWriteSeqCurrents(DSS, W, j, pelem, cBuffer, FALSE);
             end;
             pelem := DSS.ActiveCircuit.Sources.Next;
         end;
@@ -471,7 +498,7 @@ begin
             begin
                 PDelem.GetCurrents(cBuffer);
                 for j := 1 to PDelem.Nterms do
-                    CalcAndWriteSeqCurrents(DSS, F, j, pDelem, cBuffer, TRUE);
+                    CalcAndWriteSeqCurrents(DSS, W, j, pDelem, cBuffer, TRUE);
             end;
             PDelem := DSS.ActiveCircuit.PDElements.Next;
         end;
@@ -485,7 +512,7 @@ begin
             begin
                 PCelem.GetCurrents(cBuffer);
                 for j := 1 to PCelem.Nterms do
-                    CalcAndWriteSeqCurrents(DSS, F, j, pCelem, cBuffer, FALSE);
+                    CalcAndWriteSeqCurrents(DSS, W, j, pCelem, cBuffer, FALSE);
             end;
             PCelem := DSS.ActiveCircuit.PCelements.Next;
         end;
@@ -499,50 +526,58 @@ begin
             begin
                 pelem.GetCurrents(cBuffer);
                 for j := 1 to pelem.Nterms do
-                    CalcAndWriteSeqCurrents(DSS, F, j, pelem, cBuffer, FALSE);
+                    CalcAndWriteSeqCurrents(DSS, W, j, pelem, cBuffer, FALSE);
             end;
             pelem := DSS.ActiveCircuit.Faults.Next;
         end;
 
-        DSS.GlobalResult := FileNm;
+        W.Finish();
 
 
     finally
         if Assigned(Cbuffer) then
             Freemem(cBuffer);
-        FreeAndNil(F);
+        FreeAndNil(W);
 
     end;
 end;
 
-procedure CalcAndWriteCurrents(F: TFileStream; pElem: TDSSCktElement; Cbuffer: pComplexArray; CondWidth, TermWidth: Integer);
+procedure CalcAndWriteCurrents(W: TExportWriter; pElem: TDSSCktElement; Cbuffer: pComplexArray; CondWidth, TermWidth: Integer);
 var
     i, j, k: Integer;
     Iresid: Complex;
 begin
     k := 0;
-    FSWrite(F, Format('%s', [pelem.DSSClassName + '.' + AnsiUpperCase(pElem.Name)]));
+    W.BeginRow();
+    W.AddText(pelem.DSSClassName + '.' + AnsiUpperCase(pElem.Name), '%s');
     for      j := 1 to pElem.Nterms do
     begin
         Iresid := CZERO;
         for    i := 1 to pElem.NConds do
         begin
             Inc(k);
-            FSWrite(F,
-                Format(', %10.6g, %8.2f', [Cabs(cBuffer^[k]), cdang(cBuffer^[k])]));
+            W.Add(Cabs(cBuffer^[k]), ', %10.6g');
+            W.Add(cdang(cBuffer^[k]), ', %8.2f');
             Iresid += cBuffer^[k];
         end;
         for i := pElem.Nconds + 1 to CondWidth do
-            FSWrite(F, Format(', %10.6g, %8.2f', [0.0, 0.0]));
-        FSWrite(F, Format(', %10.6g, %8.2f', [Cabs(Iresid), cdang(Iresid)]));
+        begin
+            W.Add(0.0, ', %10.6g');
+            W.Add(0.0, ', %8.2f');
+        end;
+        W.Add(Cabs(Iresid), ', %10.6g');
+        W.Add(cdang(Iresid), ', %8.2f');
     end;
 
     {Filler if no. terms less than termwidth}
     for j := pElem.Nterms + 1 to TermWidth do
         for i := 1 to Condwidth + 1 do
-            FSWrite(F, Format(', %10.6g, %8.2f', [0.0, 0.0]));
+        begin
+            W.Add(0.0, ', %10.6g');
+            W.Add(0.0, ', %8.2f');
+        end;
 
-    FSWriteln(F);
+    W.EndRow();
 end;
 
 
@@ -612,17 +647,18 @@ end;
 procedure ExportCurrents(DSS: TDSSContext; FileNm: String);
 
 var
-    F: TFileStream = nil;
+    W: TExportWriter = nil;
     cBuffer: pComplexArray;
     pElem: TDSSCktElement;
     MaxCond, MaxTerm: Integer;
     i, j: Integer;
+    Header: String;
 
 begin
     cBuffer := NIL;
 
     try
-        F := TBufferedFileStream.Create(FileNm, fmCreate);
+        W := CreateExportWriter(DSS, FileNm);
 
         Getmem(cBuffer, sizeof(cBuffer^[1]) * DSS.ActiveCircuit.GetMaxCktElementSize());
 
@@ -641,14 +677,14 @@ begin
 
 
         {Branch Currents}
-        FSWrite(F, 'Element');
+        Header := 'Element';
         for i := 1 to MaxTerm do
         begin
             for j := 1 to MaxCond do
-                FSWrite(F, Format(', I%d_%d, Ang%d_%d', [i, j, i, j]));
-            FSWrite(F, Format(', Iresid%d, AngResid%d', [i, i]));
+                Header := Header + Format(', I%d_%d, Ang%d_%d', [i, j, i, j]);
+            Header := Header + Format(', Iresid%d, AngResid%d', [i, i]);
         end;
-        FSWriteln(F);
+        W.WriteHeader(Header);
 
 
      // Sources first
@@ -658,7 +694,7 @@ begin
             if pElem.Enabled then
             begin
                 pElem.GetCurrents(cBuffer);
-                CalcAndWriteCurrents(F, pElem, Cbuffer, maxcond, maxterm);
+                CalcAndWriteCurrents(W, pElem, Cbuffer, maxcond, maxterm);
             end;
             pElem := DSS.ActiveCircuit.Sources.Next;
         end;
@@ -671,7 +707,7 @@ begin
             if pElem.Enabled then
             begin
                 pElem.GetCurrents(cBuffer);
-                CalcAndWriteCurrents(F, pElem, Cbuffer, maxcond, maxterm);
+                CalcAndWriteCurrents(W, pElem, Cbuffer, maxcond, maxterm);
             end;
             pElem := DSS.ActiveCircuit.PDElements.Next;
         end;
@@ -683,7 +719,7 @@ begin
             if pElem.Enabled then
             begin
                 pElem.GetCurrents(cBuffer);
-                CalcAndWriteCurrents(F, pElem, Cbuffer, maxcond, maxterm);
+                CalcAndWriteCurrents(W, pElem, Cbuffer, maxcond, maxterm);
             end;
             pElem := DSS.ActiveCircuit.Faults.Next;
         end;
@@ -695,18 +731,18 @@ begin
             if pElem.Enabled then
             begin
                 pElem.GetCurrents(cBuffer);
-                CalcAndWriteCurrents(F, pElem, Cbuffer, maxcond, maxterm);
+                CalcAndWriteCurrents(W, pElem, Cbuffer, maxcond, maxterm);
             end;
             pElem := DSS.ActiveCircuit.PCElements.Next;
         end;
 
-        DSS.GlobalResult := FileNm;
+        W.Finish();
 
 
     finally
         if Assigned(cBuffer) then
             Freemem(cBuffer);
-        FreeAndNil(F);
+        FreeAndNil(W);
 
     end;
 end;
@@ -959,7 +995,7 @@ begin
     end;
 end;
 
-procedure WriteElemPowers(DSS: TDSSContext; F: TFileStream; const CktElementName: String);
+procedure WriteElemPowers(DSS: TDSSContext; W: TExportWriter; const CktElementName: String; MaxValues: Integer);
 var
     NValues, i: Integer;
     S: Complex;
@@ -980,14 +1016,19 @@ begin
             begin
                 ComputeVterminal;
                 ComputeIterminal;
-                FSWrite(F, Format('"%s", %d, %d', [CktElementName, Nterms, Nconds]));
+                W.BeginRow();
+                W.AddText(CktElementName, '"%s"');
+                W.AddInt(Nterms, ', %d');
+                W.AddInt(Nconds, ', %d');
                 NValues := NConds * Nterms;
                 for i := 1 to NValues do
                 begin
                     S := Vterminal^[i] * cong(Iterminal^[i]);
-                    FSWrite(F, Format(', %10.6g, %10.6g', [S.re * 0.001, S.im * 0.001]));
+                    W.Add(S.re * 0.001, ', %10.6g');
+                    W.Add(S.im * 0.001, ', %10.6g');
                 end;
-                FSWriteln(F);
+                W.AddMissing(2 * (MaxValues - NValues));
+                W.EndRow();
             end
     end;
 end;
@@ -998,18 +1039,23 @@ procedure ExportElemPowers(DSS: TDSSContext; FileNm: String);
 { Export conductor powers in same order as NodeOrder export
 }
 var
-    F: TFileStream = nil;
+    W: TExportWriter = nil;
     pElem: TDSSCktElement;
     strName: String;
+    MaxValues: Integer;
 
 begin
 
     try
-        F := TBufferedFileStream.Create(FileNm, fmCreate);
+        W := CreateExportWriter(DSS, FileNm);
+
+        {Width of the rows, for the table}
+        MaxValues := 0;
+        for pElem in DSS.ActiveCircuit.CktElements do
+            MaxValues := Max(MaxValues, pElem.NConds * pElem.NTerms);
 
      {Header Record}
-        FSWrite(F, 'Element, Nterminals, Nconductors, P_1, Q_1, ...');
-        FSWriteln(F);
+        W.WriteHeader('Element, Nterminals, Nconductors, P_1, Q_1, ...');
 
 
      // Sources first
@@ -1019,7 +1065,7 @@ begin
             if pElem.Enabled then
             begin
                 strName := pElem.FullName;
-                WriteElemPowers(DSS, F, strName);
+                WriteElemPowers(DSS, W, strName, MaxValues);
             end;
             pElem := DSS.ActiveCircuit.Sources.Next;
         end;
@@ -1032,7 +1078,7 @@ begin
             if pElem.Enabled then
             begin
                 strName := pElem.FullName;
-                WriteElemPowers(DSS, F, strName);
+                WriteElemPowers(DSS, W, strName, MaxValues);
             end;
             pElem := DSS.ActiveCircuit.PDElements.Next;
         end;
@@ -1044,7 +1090,7 @@ begin
             if pElem.Enabled then
             begin
                 strName := pElem.FullName;
-                WriteElemPowers(DSS, F, strName);
+                WriteElemPowers(DSS, W, strName, MaxValues);
             end;
             pElem := DSS.ActiveCircuit.Faults.Next;
         end;
@@ -1056,16 +1102,16 @@ begin
             if pElem.Enabled then
             begin
                 strName := pElem.FullName;
-                WriteElemPowers(DSS, F, strName);
+                WriteElemPowers(DSS, W, strName, MaxValues);
             end;
             pElem := DSS.ActiveCircuit.PCElements.Next;
         end;
 
-        DSS.GlobalResult := FileNm;
+        W.Finish();
 
 
     finally
-        FreeAndNil(F);
+        FreeAndNil(W);
 
     end;
 end;
@@ -1079,25 +1125,21 @@ procedure ExportPowers(DSS: TDSSContext; FileNm: String; opt: Integer);
  }
 
 var
-    F: TFileStream = nil;
+    W: TExportWriter = nil;
     Nterm, j: Integer;
     PDElem: TPDElement;
     PCElem: TPCElement;
     S: Complex;
-    Separator: String;
-    sout: String;
 begin
 
     try
-        F := TBufferedFileStream.Create(FileNm, fmCreate);
-        Separator := ', ';
-
+        W := CreateExportWriter(DSS, FileNm);
 
         case Opt of
             1:
-                FSWriteln(F, 'Element, Terminal, P(MW), Q(Mvar), P_Normal, Q_Normal, P_Emergency, Q_Emergency');
+                W.WriteHeader('Element, Terminal, P(MW), Q(Mvar), P_Normal, Q_Normal, P_Emergency, Q_Emergency');
         else
-            FSWriteln(F, 'Element, Terminal, P(kW), Q(kvar),  P_Normal, Q_Normal, P_Emergency, Q_Emergency');
+            W.WriteHeader('Element, Terminal, P(kW), Q(kvar),  P_Normal, Q_Normal, P_Emergency, Q_Emergency');
         end;
 
      // PDELEMENTS first
@@ -1111,35 +1153,32 @@ begin
 
                 for j := 1 to NTerm do
                 begin
-                    WriteStr(sout, Pad('"' + PDelem.DSSClassName + '.' + AnsiUpperCase(PDElem.Name) + '"', 24), Separator, j: 3);
-                    FSWrite(F, sout);
+                    W.BeginRow();
+                    W.AddText(PDelem.DSSClassName + '.' + AnsiUpperCase(PDElem.Name), '"%s"', 24);
+                    W.AddInt(j, ', %3d');
            //----PDElem.ActiveTerminalIdx := j;
                     S := PDElem.Power[j];
                     if Opt = 1 then
                         S := S * 0.001;
-                    WriteStr(sout, Separator, S.re * 0.001: 11: 1);
-                    FSWrite(F, sout);
-                    WriteStr(sout, Separator, S.im * 0.001: 11: 1);
-                    FSWrite(F, sout);
+                    W.Add(S.re * 0.001, ', %11.1f');
+                    W.Add(S.im * 0.001, ', %11.1f');
                     if j = 1 then
                     begin
              //----PDelem.ActiveTerminalIdx := 1;
                         S := PDElem.ExcesskVANorm[1];
                         if Opt = 1 then
                             S := S * 0.001;
-                        WriteStr(sout, Separator, Abs(S.re): 11: 1);
-                        FSWrite(F, sout);
-                        WriteStr(sout, Separator, Abs(S.im): 11: 1);
-                        FSWrite(F, sout);
+                        W.Add(Abs(S.re), ', %11.1f');
+                        W.Add(Abs(S.im), ', %11.1f');
                         S := PDElem.ExcesskVAEmerg[1];
                         if Opt = 1 then
                             S := S * 0.001;
-                        WriteStr(sout, Separator, Abs(S.re): 11: 1);
-                        FSWrite(F, sout);
-                        WriteStr(sout, Separator, Abs(S.im): 11: 1);
-                        FSWrite(F, sout);
-                    end;
-                    FSWriteln(F);
+                        W.Add(Abs(S.re), ', %11.1f');
+                        W.Add(Abs(S.im), ', %11.1f');
+                    end
+                    else
+                        W.AddMissing(4);
+                    W.EndRow();
                 end;
             end;
             PDElem := DSS.ActiveCircuit.PDElements.Next;
@@ -1156,27 +1195,28 @@ begin
 
                 for j := 1 to NTerm do
                 begin
-                    FSWrite(F, Pad('"' + PCElem.DSSClassName + '.' + AnsiUpperCase(PCElem.Name) + '"', 24), Separator, Format('%3d', [j]));
+                    W.BeginRow();
+                    W.AddText(PCElem.DSSClassName + '.' + AnsiUpperCase(PCElem.Name), '"%s"', 24);
+                    W.AddInt(j, ', %3d');
            //----pcElem.ActiveTerminalIdx := j;
                     S := pCElem.Power[j];
                     if Opt = 1 then
                         S := S * 0.001;
-                    
-                    WriteStr(sout, Separator, S.re * 0.001: 11: 1);
-                    FSWrite(F, sout);
-                    WriteStr(sout, Separator, S.im * 0.001: 11: 1);
-                    FSWrite(F, sout);
-                    FSWriteln(F);
+
+                    W.Add(S.re * 0.001, ', %11.1f');
+                    W.Add(S.im * 0.001, ', %11.1f');
+                    W.AddMissing(4);
+                    W.EndRow();
 
                 end;
             end;
             PCElem := DSS.ActiveCircuit.PCElements.Next;
         end;
 
-        DSS.GlobalResult := FileNm;
+        W.Finish();
 
     finally
-        FreeAndNil(F);
+        FreeAndNil(W);
 
     end;
 end;
@@ -1189,16 +1229,16 @@ procedure ExportLosses(DSS: TDSSContext; FileNm: String);
  }
 
 var
-    F: TFileStream = nil;
+    W: TExportWriter = nil;
     PDElem: TPDElement;
     S_total, S_Load, S_NoLoad: Complex;
 
 begin
 
     try
-        F := TBufferedFileStream.Create(FileNm, fmCreate);
+        W := CreateExportWriter(DSS, FileNm);
 
-        FSWriteln(F, 'Element,  Total(W), Total(var),  I2R(W), I2X(var), No-load(W), No-load(var)');
+        W.WriteHeader('Element,  Total(W), Total(var),  I2R(W), I2X(var), No-load(W), No-load(var)');
      // PDELEMENTS first
         PDElem := DSS.ActiveCircuit.PDElements.First;
 
@@ -1207,15 +1247,23 @@ begin
             if (PDElem.Enabled) then
             begin
                 PDElem.GetLosses(S_total, S_Load, S_NoLoad);
-                FSWriteln(F, Format('%s.%s, %.7g, %.7g, %.7g, %.7g, %.7g, %.7g', [PDElem.ParentClass.Name, AnsiUpperCase(PDElem.Name), S_total.re, S_total.im, S_Load.re, S_Load.im, S_NoLoad.re, S_NoLoad.im]));
+                W.BeginRow();
+                W.AddText(PDElem.ParentClass.Name + '.' + AnsiUpperCase(PDElem.Name), '%s');
+                W.Add(S_total.re, ', %.7g');
+                W.Add(S_total.im, ', %.7g');
+                W.Add(S_Load.re, ', %.7g');
+                W.Add(S_Load.im, ', %.7g');
+                W.Add(S_NoLoad.re, ', %.7g');
+                W.Add(S_NoLoad.im, ', %.7g');
+                W.EndRow();
             end;
             PDElem := DSS.ActiveCircuit.PDElements.Next;
         end;
 
-        DSS.GlobalResult := FileNm;
+        W.Finish();
 
     finally
-        FreeAndNil(F);
+        FreeAndNil(W);
 
     end;
 end;
@@ -1315,7 +1363,7 @@ procedure ExportSeqPowers(DSS: TDSSContext; FileNm: String; opt: Integer);
  }
 
 var
-    F: TFileStream = nil;
+    W: TExportWriter = nil;
     cBuffer: pComplexArray;
     NCond, Nterm, i, j, k: Integer;
     PDElem: TPDElement;
@@ -1325,23 +1373,20 @@ var
     nref: Integer;
     Vph, V012: Complex3;
     Iph, I012: Complex3;
-    Separator: String;
-    sout: String;
 
 begin
     cBuffer := NIL;
 
     try
-        F := TBufferedFileStream.Create(FileNm, fmCreate);
-        Separator := ', ';
+        W := CreateExportWriter(DSS, FileNm);
 
         Getmem(cBuffer, sizeof(cBuffer^[1]) * DSS.ActiveCircuit.GetMaxCktElementSize());
 
         case Opt of
             1:
-                FSWriteln(F, 'Element, Terminal, P1(MW), Q1(Mvar), P2, Q2, P0, Q0, P_Normal, Q_Normal, P_Emergency, Q_Emergency');
+                W.WriteHeader('Element, Terminal, P1(MW), Q1(Mvar), P2, Q2, P0, Q0, P_Normal, Q_Normal, P_Emergency, Q_Emergency');
         else
-            FSWriteln(F, 'Element, Terminal, P1(kW), Q1(kvar), P2, Q2, P0, Q0, P_Normal, Q_Normal, P_Emergency, Q_Emergency');
+            W.WriteHeader('Element, Terminal, P1(kW), Q1(kvar), P2, Q2, P0, Q0, P_Normal, Q_Normal, P_Emergency, Q_Emergency');
         end;
 
      // PDELEMENTS first
@@ -1357,7 +1402,9 @@ begin
 
                 for j := 1 to NTerm do
                 begin
-                    FSWrite(F, Pad('"' + PDelem.DSSClassName + '.' + AnsiUpperCase(PDElem.Name) + '"', 24), Separator, Format('%3d', [j]));
+                    W.BeginRow();
+                    W.AddText(PDelem.DSSClassName + '.' + AnsiUpperCase(PDElem.Name), '"%s"', 24);
+                    W.AddInt(j, ', %3d');
                     for i := 1 to PDElem.NPhases do
                     begin
                         k := (j - 1) * Ncond + i;
@@ -1393,24 +1440,18 @@ begin
                     if Opt = 1 then
                         S := S * 0.001;
                     
-                    WriteStr(sout, Separator, S.re * 0.003: 11: 1);
-                    FSWrite(F, sout);
-                    WriteStr(sout, Separator, S.im * 0.003: 11: 1);
-                    FSWrite(F, sout);
+                    W.Add(S.re * 0.003, ', %11.1f');
+                    W.Add(S.im * 0.003, ', %11.1f');
                     S := V012[3] * cong(I012[3]);
                     if Opt = 1 then
                         S := S * 0.001;
-                    WriteStr(sout, Separator, S.re * 0.003: 11: 1);
-                    FSWrite(F, sout);
-                    WriteStr(sout, Separator, S.im * 0.003: 11: 1);
-                    FSWrite(F, sout);
+                    W.Add(S.re * 0.003, ', %11.1f');
+                    W.Add(S.im * 0.003, ', %11.1f');
                     S := V012[1] * cong(I012[1]);
                     if Opt = 1 then
                         S := S * 0.001;
-                    WriteStr(sout, Separator, S.re * 0.003: 8: 1);
-                    FSWrite(F, sout);
-                    WriteStr(sout, Separator, S.im * 0.003: 8: 1);
-                    FSWrite(F, sout);
+                    W.Add(S.re * 0.003, ', %8.1f');
+                    W.Add(S.im * 0.003, ', %8.1f');
 
                     if j = 1 then
                     begin
@@ -1418,19 +1459,17 @@ begin
                         S := PDElem.ExcesskVANorm[1];
                         if Opt = 1 then
                             S := S * 0.001;
-                        WriteStr(sout, Separator, Abs(S.re): 11: 1);
-                        FSWrite(F, sout);
-                        WriteStr(sout, Separator, Abs(S.im): 11: 1);
-                        FSWrite(F, sout);
+                        W.Add(Abs(S.re), ', %11.1f');
+                        W.Add(Abs(S.im), ', %11.1f');
                         S := PDElem.ExcesskVAEmerg[1];
                         if Opt = 1 then
                             S := S * 0.001;
-                        WriteStr(sout, Separator, Abs(S.re): 11: 1);
-                        FSWrite(F, sout);
-                        WriteStr(sout, Separator, Abs(S.im): 11: 1);
-                        FSWrite(F, sout);
-                    end;
-                    FSWriteln(F);
+                        W.Add(Abs(S.re), ', %11.1f');
+                        W.Add(Abs(S.im), ', %11.1f');
+                    end
+                    else
+                        W.AddMissing(4);
+                    W.EndRow();
 
                 end;
             end;
@@ -1450,7 +1489,9 @@ begin
 
                 for j := 1 to NTerm do
                 begin
-                    FSWrite(F, Pad('"' + PCElem.DSSClassName + '.' + AnsiUpperCase(PCElem.Name) + '"', 24), Separator, Format('%3d', [j]));
+                    W.BeginRow();
+                    W.AddText(PCElem.DSSClassName + '.' + AnsiUpperCase(PCElem.Name), '"%s"', 24);
+                    W.AddInt(j, ', %3d');
                     for i := 1 to PCElem.NPhases do
                     begin
                         k := (j - 1) * Ncond + i;
@@ -1485,38 +1526,32 @@ begin
                     S := V012[2] * cong(I012[2]);
                     if Opt = 1 then
                         S := S * 0.001;
-                    WriteStr(sout, Separator, S.re * 0.003: 11: 1);
-                    FSWrite(F, sout);
-                    WriteStr(sout, Separator, S.im * 0.003: 11: 1);
-                    FSWrite(F, sout);
+                    W.Add(S.re * 0.003, ', %11.1f');
+                    W.Add(S.im * 0.003, ', %11.1f');
                     S := V012[3] * cong(I012[3]);
                     if Opt = 1 then
                         S := S * 0.001;
-                    WriteStr(sout, Separator, S.re * 0.003: 11: 1);
-                    FSWrite(F, sout);
-                    WriteStr(sout, Separator, S.im * 0.003: 11: 1);
-                    FSWrite(F, sout);
+                    W.Add(S.re * 0.003, ', %11.1f');
+                    W.Add(S.im * 0.003, ', %11.1f');
                     S := V012[1] * cong(I012[1]);
                     if Opt = 1 then
                         S := S * 0.001;
-                    WriteStr(sout, Separator, S.re * 0.003: 8: 1);
-                    FSWrite(F, sout);
-                    WriteStr(sout, Separator, S.im * 0.003: 8: 1);
-                    FSWrite(F, sout);
-
-                    FSWriteln(F);
+                    W.Add(S.re * 0.003, ', %8.1f');
+                    W.Add(S.im * 0.003, ', %8.1f');
+                    W.AddMissing(4);
+                    W.EndRow();
 
                 end;
             end;
             PCElem := DSS.ActiveCircuit.PCElements.Next;
         end;
 
-        DSS.GlobalResult := FileNm;
+        W.Finish();
 
     finally
         if Assigned(cBuffer) then
             Freemem(CBuffer);
-        FreeAndNil(F);
+        FreeAndNil(W);
 
     end;
 end;
@@ -2677,7 +2712,7 @@ begin
     end;
 end;
 
-procedure ExportYprim(DSS: TDSSContext; FileNm: String);
+procedure ExportYprim(DSS: TDSSContext; FileNm: String; Fmt: TSparseExportFormat);
 // Exports  YPrim matrices for all  Circuit Elements
 var
     F: TFileStream = nil;
@@ -2687,6 +2722,12 @@ begin
     if DSS.ActiveCircuit = NIL then
         Exit;
 
+    if Fmt in [TSparseExportFormat.MatrixMarket, TSparseExportFormat.Binary] then
+    begin
+        ExportYprimSparse(DSS, FileNm, Fmt);
+        Exit;
+    end;
+
     try
         F := TBufferedFileStream.Create(FileNm, fmCreate);
 
@@ -2724,60 +2765,53 @@ begin
 end;
 
 // illustrate retrieval of System Y using compressed column format
-procedure ExportY(DSS: TDSSContext; FileNm: String; TripletOpt: Boolean);
+procedure ExportY(DSS: TDSSContext; FileNm: String; Fmt: TSparseExportFormat);
 // Exports System Y Matrix in Node Order
 var
     F: TFileStream = nil;
     i, j, p: Longword;
     col, row: Longword;
-    hY: NativeUInt;
-    nNZ, nBus: Longword;
-    ColPtr, RowIdx: array of Longword;
-    cVals: array of Complex;
+    Snapshot: TSystemYSnapshot;
     re, im: Double;
 
 begin
     if DSS.ActiveCircuit = NIL then
         Exit;
-    hY := DSS.ActiveCircuit.Solution.hY;
-    if hY <= 0 then
+
+    if Fmt in [TSparseExportFormat.MatrixMarket, TSparseExportFormat.Binary] then
     begin
-        DoSimpleMsg(DSS, _('Y Matrix not Built.'), 222);
+        ExportSystemYSparse(DSS, FileNm, Fmt);
         Exit;
     end;
-    // this compresses the entries if necessary - no extra work if already solved
-    FactorSparseMatrix(hY);
-    GetNNZ(hY, @nNZ);
-    GetSize(hY, @nBus); // we should already know this
+
+    // The compressed columns are shared with the other exports and the C API,
+    // and only copied from KLU again when the matrix changes
+    Snapshot := GetSystemYSnapshot(DSS);
+    if Snapshot = NIL then
+        Exit;
 
     try
         F := TBufferedFileStream.Create(FileNm, fmCreate);
 
-        if TripletOpt then
+        if Fmt = TSparseExportFormat.Triplet then
         begin
-            SetLength(ColPtr, nNZ);
-            SetLength(RowIdx, nNZ);
-            SetLength(cVals, nNZ);
-            GetTripletMatrix(hY, nNZ, @RowIdx[0], @ColPtr[0], @cVals[0]);
             FSWriteln(F, 'Row,Col,G,B');
-            for i := 0 to nNZ - 1 do
+            for col := 1 to Snapshot.NumNodes do
             begin
-                col := ColPtr[i] + 1;
-                row := RowIdx[i] + 1;
-                if row >= col then
+                for p := Snapshot.ColPtr[col - 1] to Snapshot.ColPtr[col] - 1 do
                 begin
-                    re := cVals[i].re;
-                    im := cVals[i].im;
-                    FSWriteln(F, Format('%d,%d,%.10g,%.10g', [row, col, re, im]));
+                    row := Snapshot.RowIdx[p] + 1;
+                    if row >= col then
+                    begin
+                        re := Snapshot.Values[p].re;
+                        im := Snapshot.Values[p].im;
+                        FSWriteln(F, Format('%d,%d,%.10g,%.10g', [row, col, re, im]));
+                    end;
                 end;
             end;
         end
         else
         begin
-            SetLength(ColPtr, nBus + 1);
-            SetLength(RowIdx, nNZ);
-            SetLength(cVals, nNZ);
-            GetCompressedMatrix(hY, nBus + 1, nNZ, @ColPtr[0], @RowIdx[0], @cVals[0]);
             // Write out fully qualified Bus Names
             with DSS.ActiveCircuit do
             begin
@@ -2798,12 +2832,12 @@ begin
                         im := 0.0;
                         // search for a non-zero element [i,j]
                         //  DSS indices are 1-based, KLU indices are 0-based
-                        for p := ColPtr[j - 1] to ColPtr[j] - 1 do
+                        for p := Snapshot.ColPtr[j - 1] to Snapshot.ColPtr[j] - 1 do
                         begin
-                            if RowIdx[p] + 1 = i then
+                            if Snapshot.RowIdx[p] + 1 = i then
                             begin
-                                re := cVals[p].re;
-                                im := cVals[p].im;
+                                re := Snapshot.Values[p].re;
+                                im := Snapshot.Values[p].im;
                             end;
                         end;
                         FSWrite(F, Format('%-13.10g, +j %-13.10g,', [re, im]));
@@ -3085,18 +3119,27 @@ begin
     end;
 end;
 
-procedure WriteNewLine(F: TFileStream;
+procedure WriteNewLine(W: TExportWriter;
     const CktELementName: String; DistFromMeter1, puV1, DistFromMeter2, puV2: Double;
     ColorCode, Thickness, LineType: Integer;
     MarkCenter: Integer;
     CenterMarkerCode, NodeMarkerCode, NodeMarkerWidth: Integer);
 
 begin
-    FSWrite(F, Format('%s, %.6g, %.6g, %.6g, %.6g,', [AnsiUpperCase(CktElementName), DistFromMeter1, puV1, DistFromMeter2, puV2]));
-    FSWrite(F, Format('%d, %d, %d, ', [ColorCode, Thickness, LineType]));
-    FSWrite(F, Format('%d, ', [MarkCenter]));
-    FSWrite(F, Format('%d, %d, %d', [CenterMarkerCode, NodeMarkerCode, NodeMarkerWidth]));
-    FSWriteln(F);
+    W.BeginRow();
+    W.AddText(AnsiUpperCase(CktElementName), '%s');
+    W.Add(DistFromMeter1, ', %.6g');
+    W.Add(puV1, ', %.6g');
+    W.Add(DistFromMeter2, ', %.6g');
+    W.Add(puV2, ', %.6g,');
+    W.AddInt(ColorCode, '%d');
+    W.AddInt(Thickness, ', %d');
+    W.AddInt(LineType, ', %d');
+    W.AddInt(MarkCenter, ', %d');
+    W.AddInt(CenterMarkerCode, ', %d');
+    W.AddInt(NodeMarkerCode, ', %d');
+    W.AddInt(NodeMarkerWidth, ', %d');
+    W.EndRow();
 end;
 
 
@@ -3110,13 +3153,11 @@ var
     iphs: Integer;
     iphs2: Integer;
     S: String;
-    F: TFileStream = nil;
+    W: TExportWriter = nil;
     Linetype: Integer;
 begin
     try
-        F := TBufferedFileStream.Create(FileNm, fmCreate);
-
-        FSWrite(F, 'Name, Distance1, puV1, Distance2, puV2, Color, Thickness, Linetype, Markcenter, Centercode, NodeCode, NodeWidth,');
+        W := CreateExportWriter(DSS, FileNm);
 
         // New graph created before this routine is entered
         case phasesToPlot of
@@ -3126,7 +3167,8 @@ begin
             S := 'L-N Voltage Profile';
         end;
 
-        FSWriteln(F, 'Title=', S, ', Distance in km');
+        W.WriteHeader('Name, Distance1, puV1, Distance2, puV2, Color, Thickness, Linetype, Markcenter, Centercode, NodeCode, NodeWidth,' +
+            'Title=' + S + ', Distance in km');
 
         iEnergyMeter := DSS.EnergyMeterClass.First;
         while iEnergyMeter > 0 do
@@ -3151,7 +3193,7 @@ begin
                                         begin
                                             puV1 := CABS(Solution.NodeV^[Bus1.GetRef(Bus1.FindIdx(iphs))]) / Bus1.kVBase / 1000.0;
                                             puV2 := CABS(Solution.NodeV^[Bus2.GetRef(Bus2.FindIdx(iphs))]) / Bus2.kVBase / 1000.0;
-                                            WriteNewLine(F, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
+                                            WriteNewLine(W, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
                                                 iphs, 2, 0, 0, 0, NodeMarkerCode, NodeMarkerWidth);
                                         end;
                                 // Plot all phases present (between 1 and 3)
@@ -3166,7 +3208,7 @@ begin
                                                 Linetype := 0;
                                             puV1 := CABS(Solution.NodeV^[Bus1.GetRef(Bus1.FindIdx(iphs))]) / Bus1.kVBase / 1000.0;
                                             puV2 := CABS(Solution.NodeV^[Bus2.GetRef(Bus2.FindIdx(iphs))]) / Bus2.kVBase / 1000.0;
-                                            WriteNewLine(F, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
+                                            WriteNewLine(W, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
                                                 iphs, 2, Linetype, 0, 0, NodeMarkerCode, NodeMarkerWidth);
                                         end;
                                 end;
@@ -3183,7 +3225,7 @@ begin
                                                     Linetype := 0;
                                                 puV1 := CABS(Solution.NodeV^[Bus1.GetRef(Bus1.FindIdx(iphs))]) / Bus1.kVBase / 1000.0;
                                                 puV2 := CABS(Solution.NodeV^[Bus2.GetRef(Bus2.FindIdx(iphs))]) / Bus2.kVBase / 1000.0;
-                                                WriteNewLine(F, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
+                                                WriteNewLine(W, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
                                                     iphs, 2, Linetype, 0, 0, NodeMarkerCode, NodeMarkerWidth);
                                             end;
                                 end;
@@ -3207,7 +3249,7 @@ begin
                                                     puV1 := CABS(NodeV^[Bus1.GetRef(Bus1.FindIdx(iphs))] - NodeV^[Bus1.GetRef(Bus1.FindIdx(iphs2))]) / Bus1.kVBase / 1732.0;
                                                     puV2 := CABS(NodeV^[Bus2.GetRef(Bus2.FindIdx(iphs))] - NodeV^[Bus2.GetRef(Bus2.FindIdx(iphs2))]) / Bus2.kVBase / 1732.0;
                                                 end;
-                                                WriteNewLine(F, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
+                                                WriteNewLine(W, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
                                                     iphs, 2, Linetype, 0, 0, NodeMarkerCode, NodeMarkerWidth);
                                             end;
                                         end;
@@ -3231,7 +3273,7 @@ begin
                                                 puV1 := CABS(NodeV^[Bus1.GetRef(Bus1.FindIdx(iphs))] - NodeV^[Bus1.GetRef(Bus1.FindIdx(iphs2))]) / Bus1.kVBase / 1732.0;
                                                 puV2 := CABS(NodeV^[Bus2.GetRef(Bus2.FindIdx(iphs))] - NodeV^[Bus2.GetRef(Bus2.FindIdx(iphs2))]) / Bus2.kVBase / 1732.0;
                                             end;
-                                            WriteNewLine(F, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
+                                            WriteNewLine(W, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
                                                 iphs, 2, Linetype, 0, 0, NodeMarkerCode, NodeMarkerWidth);
                                         end;
                                     end;
@@ -3256,7 +3298,7 @@ begin
                                                     puV1 := CABS(NodeV^[Bus1.GetRef(Bus1.FindIdx(iphs))] - NodeV^[Bus1.GetRef(Bus1.FindIdx(iphs2))]) / Bus1.kVBase / 1732.0;
                                                     puV2 := CABS(NodeV^[Bus2.GetRef(Bus2.FindIdx(iphs))] - NodeV^[Bus2.GetRef(Bus2.FindIdx(iphs2))]) / Bus2.kVBase / 1732.0;
                                                 end;
-                                                WriteNewLine(F, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
+                                                WriteNewLine(W, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
                                                     iphs, 2, Linetype, 0, 0, NodeMarkerCode, NodeMarkerWidth);
                                             end;
                                         end;
@@ -3271,7 +3313,7 @@ begin
                                         Linetype := 0;
                                     puV1 := CABS(DSS.ActiveCircuit.Solution.NodeV^[Bus1.GetRef(Bus1.FindIdx(iphs))]) / Bus1.kVBase / 1000.0;
                                     puV2 := CABS(DSS.ActiveCircuit.Solution.NodeV^[Bus2.GetRef(Bus2.FindIdx(iphs))]) / Bus2.kVBase / 1000.0;
-                                    WriteNewLine(F, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
+                                    WriteNewLine(W, PresentCktElement.Name, Bus1.DistFromMeter, puV1, Bus2.DistFromMeter, puV2,
                                         iphs, 2, Linetype, 0, 0,
                                         NodeMarkerCode, NodeMarkerWidth);
                                 end;
@@ -3286,10 +3328,10 @@ begin
             iEnergyMeter := DSS.EnergyMeterClass.Next;
         end;
 
-        DSS.GlobalResult := FileNm;
+        W.Finish();
 
     finally
-        FreeAndNil(F);
+        FreeAndNil(W);
     end;
 end;
 
@@ -3698,14 +3740,14 @@ end;
 // = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = =
 procedure ExportNodeNames(DSS: TDSSContext; FileNm: String);
 var
-    F: TFileStream = nil;
+    W: TExportWriter = nil;
     i: Integer;
     j: Integer;
     BusName: String;
 begin
     try
-        F := TBufferedFileStream.Create(FileNm, fmCreate);
-        FSWriteln(F, 'Node_Name');
+        W := CreateExportWriter(DSS, FileNm);
+        W.WriteHeader('Node_Name');
         with DSS.ActiveCircuit do
         begin
             for i := 1 to NumBuses do
@@ -3714,15 +3756,17 @@ begin
                 with Buses^[i] do
                     for j := 1 to NumNodesThisBus do
                     begin
-                        FSWriteln(F, Format('%s.%d ', [BusName, GetNum(j)]));
+                        W.BeginRow();
+                        W.AddText(BusName + '.' + IntToStr(GetNum(j)), '%s ');
+                        W.EndRow();
                     end;
             end;
 
         end;
 
-        DSS.GlobalResult := FileNm;
+        W.Finish();
     finally
-        FreeAndNil(F);
+        FreeAndNil(W);
     end;
 end;
 // = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = =
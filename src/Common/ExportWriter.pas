@@ -0,0 +1,227 @@
+unit ExportWriter;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Output backends for the tabular exports of ExportResults.
+//
+// The export procedures describe each row as a sequence of typed values, each
+// one with the format of its text in the CSV file (separators included). The
+// CSV backend formats and writes the text as the exports always did. The table
+// backend keeps the values as they are in the typed columns of a TMeterTable,
+// which is written as a binary table (ExportFormat=Binary, .bin extension) or
+// not written at all (ExportFormat=Memory). In both cases, the table is kept
+// in DSS.ExportTable until the next export that uses it, so the C API can
+// return its columns as arrays.
+
+interface
+
+uses
+    Classes,
+    DSSClass,
+    MeterTable;
+
+type
+    TExportWriter = class(TObject)
+    protected
+        DSS: TDSSContext;
+        FFileName: String;
+    public
+        constructor Create(dssContext: TDSSContext; const FileName: String);
+
+        // Header is the first line of the CSV file; the column names are
+        // taken from it, separated by commas.
+        procedure WriteHeader(const Header: String); virtual; abstract;
+        procedure BeginRow(); virtual; abstract;
+        procedure Add(Value: Double; const Fmt: String); virtual; abstract;
+        procedure AddInt(Value: Integer; const Fmt: String); virtual; abstract;
+        // The text is padded to Width characters, if given
+        procedure AddText(const Value: String; const Fmt: String; Width: Integer = 0); virtual; abstract;
+        // Values of the row not present in the CSV file; NaN in the table
+        procedure AddMissing(Count: Integer); virtual; abstract;
+        procedure EndRow(); virtual; abstract;
+        // Completes the output, setting DSS.GlobalResult to the file written
+        procedure Finish(); virtual; abstract;
+    end;
+
+    TExportTextWriter = class(TExportWriter)
+    private
+        F: TStream;
+    public
+        constructor Create(dssContext: TDSSContext; const FileName: String);
+        destructor Destroy(); override;
+
+        procedure WriteHeader(const Header: String); override;
+        procedure BeginRow(); override;
+        procedure Add(Value: Double; const Fmt: String); override;
+        procedure AddInt(Value: Integer; const Fmt: String); override;
+        procedure AddText(const Value: String; const Fmt: String; Width: Integer = 0); override;
+        procedure AddMissing(Count: Integer); override;
+        procedure EndRow(); override;
+        procedure Finish(); override;
+    end;
+
+    TExportTableWriter = class(TExportWriter)
+    private
+        Table: TMeterTable;
+    public
+        destructor Destroy(); override;
+
+        procedure WriteHeader(const Header: String); override;
+        procedure BeginRow(); override;
+        procedure Add(Value: Double; const Fmt: String); override;
+        procedure AddInt(Value: Integer; const Fmt: String); override;
+        procedure AddText(const Value: String; const Fmt: String; Width: Integer = 0); override;
+        procedure AddMissing(Count: Integer); override;
+        procedure EndRow(); override;
+        procedure Finish(); override;
+    end;
+
+// Creates the writer for the current ExportFormat of DSS
+function CreateExportWriter(DSS: TDSSContext; const FileName: String): TExportWriter;
+
+implementation
+
+uses
+    SysUtils,
+    Math,
+    BufStream,
+    Utilities;
+
+function CreateExportWriter(DSS: TDSSContext; const FileName: String): TExportWriter;
+begin
+    if DSS.ExportFormat = TExportFormat.CSV then
+        Result := TExportTextWriter.Create(DSS, FileName)
+    else
+        Result := TExportTableWriter.Create(DSS, FileName);
+end;
+
+constructor TExportWriter.Create(dssContext: TDSSContext; const FileName: String);
+begin
+    inherited Create();
+    DSS := dssContext;
+    FFileName := FileName;
+end;
+
+//------------------------------------------------------------------------------
+constructor TExportTextWriter.Create(dssContext: TDSSContext; const FileName: String);
+begin
+    inherited Create(dssContext, FileName);
+    F := TBufferedFileStream.Create(FileName, fmCreate);
+end;
+
+destructor TExportTextWriter.Destroy();
+begin
+    FreeAndNil(F);
+    inherited Destroy();
+end;
+
+procedure TExportTextWriter.WriteHeader(const Header: String);
+begin
+    FSWriteln(F, Header);
+end;
+
+procedure TExportTextWriter.BeginRow();
+begin
+end;
+
+procedure TExportTextWriter.Add(Value: Double; const Fmt: String);
+begin
+    FSWrite(F, Format(Fmt, [Value]));
+end;
+
+procedure TExportTextWriter.AddInt(Value: Integer; const Fmt: String);
+begin
+    FSWrite(F, Format(Fmt, [Value]));
+end;
+
+procedure TExportTextWriter.AddText(const Value: String; const Fmt: String; Width: Integer);
+begin
+    if Width > 0 then
+        FSWrite(F, Pad(Format(Fmt, [Value]), Width))
+    else
+        FSWrite(F, Format(Fmt, [Value]));
+end;
+
+procedure TExportTextWriter.AddMissing(Count: Integer);
+begin
+end;
+
+procedure TExportTextWriter.EndRow();
+begin
+    FSWriteln(F);
+end;
+
+procedure TExportTextWriter.Finish();
+begin
+    DSS.GlobalResult := FFileName;
+end;
+
+//------------------------------------------------------------------------------
+destructor TExportTableWriter.Destroy();
+begin
+    Table.Free();
+    inherited Destroy();
+end;
+
+procedure TExportTableWriter.WriteHeader(const Header: String);
+begin
+    FreeAndNil(Table);
+    Table := TMeterTable.Create(Header, False);
+end;
+
+procedure TExportTableWriter.BeginRow();
+begin
+    Table.BeginRow();
+end;
+
+procedure TExportTableWriter.Add(Value: Double; const Fmt: String);
+begin
+    Table.Add(Value);
+end;
+
+procedure TExportTableWriter.AddInt(Value: Integer; const Fmt: String);
+begin
+    Table.AddInt(Value);
+end;
+
+procedure TExportTableWriter.AddText(const Value: String; const Fmt: String; Width: Integer);
+begin
+    Table.AddText(Value);
+end;
+
+procedure TExportTableWriter.AddMissing(Count: Integer);
+begin
+    while Count > 0 do
+    begin
+        Table.Add(NaN);
+        Dec(Count);
+    end;
+end;
+
+procedure TExportTableWriter.EndRow();
+begin
+    Table.EndRow();
+end;
+
+procedure TExportTableWriter.Finish();
+begin
+    if Table = NIL then
+        Table := TMeterTable.Create('', False);
+
+    if DSS.ExportFormat = TExportFormat.Binary then
+    begin
+        SaveMeterTable(DSS, Table, FFileName, False, True);
+        DSS.GlobalResult := ChangeFileExt(FFileName, '.bin');
+    end
+    else
+        DSS.GlobalResult := '';
+
+    FreeAndNil(DSS.ExportTable);
+    DSS.ExportTable := Table;
+    Table := NIL;
+end;
+
+end.
@@ -0,0 +1,315 @@
+unit FastFault;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Fast evaluation of Fault objects from a pre-fault direct solution.
+//
+// A fault only adds a small admittance block Yf to the system Y matrix, at the
+// k nodes it connects. Given the pre-fault voltages V0 (direct solution, all
+// faults disabled) and the k columns Zf of Z = inv(Y) at those nodes, the
+// post-fault voltages follow from a rank-k update:
+//
+//     (I + Zff Yf) u = V0f,    V = V0 - Zf (Yf u)
+//
+// where Zff and V0f are the rows of Zf and V0 at the fault nodes. The columns
+// are computed with the existing factorization of the system Y matrix (no
+// rebuild or refactorization) and cached per fault, so repeated evaluations of
+// the same fault, e.g. MonteFault with random fault resistances, cost O(N k).
+// For the bus nodes, Zff is the same as the bus Zsc matrix from the fault study.
+
+interface
+
+uses
+    UComplex,
+    DSSUcomplex,
+    DSSClass,
+    Fault;
+
+type
+    TFastFaultEntry = class(TObject)
+    public
+        NumFaultNodes: Integer;
+        FaultNodes: Array of Integer; // system node refs connected by the fault (0-based)
+        CondNode: Array of Integer; // index in FaultNodes for each YPrim row/col, -1 for ground
+        Z: Array of Complex; // columns of Z at FaultNodes, NumNodes each; empty until needed
+    end;
+
+    TFastFaultSolver = class(TObject)
+    private
+        DSS: TDSSContext;
+        NumNodes: Integer;
+        V0, I0: Array of Complex; // pre-fault voltages and injection currents, as NodeV (1-based)
+        Entries: Array of TFastFaultEntry; // per fault index in ckt.Faults
+
+        function ResolveNodes(FaultObj: TFaultObj): TFastFaultEntry;
+        procedure ComputeColumns(Entry: TFastFaultEntry);
+        procedure ClearEntries();
+    public
+        constructor Create(dssContext: TDSSContext);
+        destructor Destroy; override;
+
+        // Captures the present solution as the pre-fault state. The circuit
+        // must have just been solved with SolveDirect, with all faults disabled.
+        // Returns False if any fault connects nodes that don't exist in the
+        // pre-fault circuit; those require a full solution.
+        function Prepare(): Boolean;
+
+        // Sets NodeV to the solution with only the FaultIdx-th fault of the
+        // circuit applied, with its present (possibly randomized) resistance.
+        // Returns False if the post-fault system is singular.
+        function Apply(FaultIdx: Integer): Boolean;
+    end;
+
+implementation
+
+uses
+    SysUtils,
+    Math,
+    Ucmatrix,
+    ArrayDef,
+    DSSGlobals,
+    Circuit,
+    Bus,
+    Solution,
+    YMatrix,
+    KLUSolve,
+    DSSHelper;
+
+constructor TFastFaultSolver.Create(dssContext: TDSSContext);
+begin
+    inherited Create();
+    DSS := dssContext;
+    NumNodes := 0;
+end;
+
+destructor TFastFaultSolver.Destroy;
+begin
+    ClearEntries();
+    inherited Destroy;
+end;
+
+procedure TFastFaultSolver.ClearEntries();
+var
+    i: Integer;
+begin
+    for i := 0 to High(Entries) do
+        FreeAndNil(Entries[i]);
+    SetLength(Entries, 0);
+end;
+
+function TFastFaultSolver.ResolveNodes(FaultObj: TFaultObj): TFastFaultEntry;
+// Map the fault conductors to the nodes of the present circuit. The fault is
+// disabled, so its NodeRef array cannot be used; the bus specs are parsed as
+// in TDSSCircuit.ProcessBusDefs, but nothing is added to the circuit.
+var
+    ckt: TDSSCircuit;
+    nodeBuffer: Array of Integer;
+    busName: String;
+    nNodes, np, ncond, iTerm, i, m, busIdx, ref: Integer;
+begin
+    ckt := DSS.ActiveCircuit;
+    np := FaultObj.NPhases;
+    ncond := FaultObj.NConds;
+    SetLength(nodeBuffer, ncond + 100);
+
+    Result := TFastFaultEntry.Create();
+    SetLength(Result.FaultNodes, FaultObj.Yorder);
+    SetLength(Result.CondNode, FaultObj.Yorder);
+    Result.NumFaultNodes := 0;
+    for iTerm := 1 to FaultObj.NTerms do
+    begin
+        for i := 1 to np do
+            nodeBuffer[i] := i;
+        for i := np + 1 to ncond do
+            nodeBuffer[i] := 0;
+
+        busName := DSS.Parser.ParseAsBusName(FaultObj.GetBus(iTerm), nNodes, pIntegerArray(@nodeBuffer[0]));
+        busIdx := ckt.BusList.Find(busName);
+        if busIdx = 0 then
+        begin
+            FreeAndNil(Result);
+            Exit;
+        end;
+
+        for i := 1 to ncond do
+        begin
+            ref := 0;
+            if nodeBuffer[i] < 0 then
+            begin
+                FreeAndNil(Result);
+                Exit;
+            end;
+            if nodeBuffer[i] > 0 then
+            begin
+                ref := ckt.Buses[busIdx].Find(nodeBuffer[i]);
+                if ref = 0 then
+                begin
+                    FreeAndNil(Result);
+                    Exit;
+                end;
+            end;
+
+            if ref = 0 then
+            begin
+                Result.CondNode[(iTerm - 1) * ncond + i - 1] := -1;
+                continue;
+            end;
+
+            m := 0;
+            while (m < Result.NumFaultNodes) and (Result.FaultNodes[m] <> ref) do
+                Inc(m);
+            if m = Result.NumFaultNodes then
+            begin
+                Result.FaultNodes[m] := ref;
+                Inc(Result.NumFaultNodes);
+            end;
+            Result.CondNode[(iTerm - 1) * ncond + i - 1] := m;
+        end;
+    end;
+end;
+
+procedure TFastFaultSolver.ComputeColumns(Entry: TFastFaultEntry);
+// Same as TSolutionAlgs.ComputeYsc, for the fault nodes and keeping the full columns
+var
+    sol: TSolutionObj;
+    m, i: Integer;
+begin
+    sol := DSS.ActiveCircuit.Solution;
+    SetLength(Entry.Z, Entry.NumFaultNodes * NumNodes);
+    for i := 1 to NumNodes do
+        sol.Currents[i] := 0;
+
+    for m := 0 to Entry.NumFaultNodes - 1 do
+    begin
+        sol.Currents[Entry.FaultNodes[m]] := 1;
+        if SolveSparseSet(sol.hYsystem, pComplexArray(@sol.NodeV[1]), pComplexArray(@sol.Currents[1])) < 1 then
+            raise EEsolv32Problem.Create('Error Solving System Y Matrix in TFastFaultSolver. Problem with Sparse matrix solver.');
+        Move(sol.NodeV[1], Entry.Z[m * NumNodes], NumNodes * SizeOf(Complex));
+        sol.Currents[Entry.FaultNodes[m]] := 0;
+    end;
+
+    Move(I0[1], sol.Currents[1], NumNodes * SizeOf(Complex));
+end;
+
+function TFastFaultSolver.Prepare(): Boolean;
+var
+    ckt: TDSSCircuit;
+    sol: TSolutionObj;
+    i: Integer;
+begin
+    Result := False;
+    ckt := DSS.ActiveCircuit;
+    sol := ckt.Solution;
+    ClearEntries();
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    ApplyLowRankUpdates(DSS); // the columns are computed directly from the factorization
+{$ENDIF}
+
+    NumNodes := ckt.NumNodes;
+    SetLength(V0, NumNodes + 1);
+    SetLength(I0, NumNodes + 1);
+    Move(sol.NodeV[0], V0[0], (NumNodes + 1) * SizeOf(Complex));
+    Move(sol.Currents[0], I0[0], (NumNodes + 1) * SizeOf(Complex));
+
+    SetLength(Entries, ckt.Faults.Count + 1);
+    for i := 1 to ckt.Faults.Count do
+    begin
+        Entries[i] := ResolveNodes(ckt.Faults.Get(i));
+        if Entries[i] = NIL then
+            Exit;
+    end;
+    Result := True;
+end;
+
+function TFastFaultSolver.Apply(FaultIdx: Integer): Boolean;
+var
+    sol: TSolutionObj;
+    FaultObj: TFaultObj;
+    Entry: TFastFaultEntry;
+    YPrim, Yf, A: TCMatrix;
+    V0f, u, w: Array of Complex;
+    k, i, j, l, ci, cj, r: Integer;
+    s: Complex;
+begin
+    Result := False;
+    sol := DSS.ActiveCircuit.Solution;
+    FaultObj := DSS.ActiveCircuit.Faults.Get(FaultIdx);
+    Entry := Entries[FaultIdx];
+    k := Entry.NumFaultNodes;
+    if (k > 0) and (Length(Entry.Z) = 0) then
+        ComputeColumns(Entry);
+
+    // Picks the present fault resistance (and the random multiplier in MonteFault)
+    FaultObj.CalcYPrim();
+    YPrim := NIL;
+    FaultObj.GetYPrim(YPrim, ALL_YPRIM);
+
+    Yf := TCMatrix.CreateMatrix(Max(k, 1));
+    A := TCMatrix.CreateMatrix(Max(k, 1));
+    try
+        for i := 1 to FaultObj.Yorder do
+        begin
+            ci := Entry.CondNode[i - 1];
+            if ci < 0 then
+                continue;
+            for j := 1 to FaultObj.Yorder do
+            begin
+                cj := Entry.CondNode[j - 1];
+                if cj >= 0 then
+                    Yf.AddElement(ci + 1, cj + 1, YPrim[i, j]);
+            end;
+        end;
+
+        // A = I + Zff Yf
+        for i := 1 to k do
+            for j := 1 to k do
+            begin
+                if i = j then
+                    s := 1
+                else
+                    s := 0;
+                for l := 1 to k do
+                    s += Entry.Z[(l - 1) * NumNodes + Entry.FaultNodes[i - 1] - 1] * Yf[l, j];
+                A[i, j] := s;
+            end;
+
+        SetLength(V0f, k + 1);
+        SetLength(u, k + 1);
+        SetLength(w, k + 1);
+        if k > 0 then
+        begin
+            A.Invert();
+            if A.InvertError <> 0 then
+                Exit;
+            for i := 1 to k do
+                V0f[i - 1] := V0[Entry.FaultNodes[i - 1]];
+            A.MVmult(pComplexArray(@u[0]), pComplexArray(@V0f[0]));
+            Yf.MVmult(pComplexArray(@w[0]), pComplexArray(@u[0]));
+        end;
+
+        for r := 1 to NumNodes do
+        begin
+            s := V0[r];
+            for l := 0 to k - 1 do
+                s -= Entry.Z[l * NumNodes + r - 1] * w[l];
+            sol.NodeV[r] := s;
+        end;
+    finally
+        Yf.Free();
+        A.Free();
+    end;
+
+    // Same bookkeeping as a direct solution
+    Inc(sol.SolutionCount);
+    Inc(DSS.SolutionGeneration);
+    sol.Iteration := 1;
+    sol.LastSolutionWasDirect := TRUE;
+    sol.ConvergedFlag := TRUE;
+    DSS.ActiveCircuit.IsSolved := TRUE;
+    Result := True;
+end;
+
+end.
@@ -0,0 +1,506 @@
+unit HostingCapacity;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Hosting capacity analysis: the largest PV (balanced, unity power factor,
+// constant power injection) that each bus accepts without:
+//
+//  - overvoltage: a node above the NormalMaxVolts of the circuit;
+//  - thermal: a series PD element above its NormAmps (terminal 1);
+//  - voltage deviation: a node voltage magnitude changing by more than
+//    MaxDeviation (pu) from the present solution;
+//  - protection reach: the PV fault contribution (HC_FAULT_FACTOR times its
+//    rated current) above ReachFraction of the bus short-circuit current, so
+//    that the upstream protection could be blinded.
+//
+// Nodes and elements already above their limits in the present solution only
+// count if they get worse.
+//
+// For each bus, the voltage response to an injection (TVoltageSensitivity,
+// from the present factorization) gives the first estimate: the injection at
+// which the linearized voltages and currents reach each limit. The protection
+// reach limit comes directly from the bus Zsc (from the last fault study, or
+// the driving point impedance of the same response). The estimate is then
+// refined by bisection over approximate power flows with the PV (ApproxCheck):
+// fixed-point iterations on the present system Y, with the PV as a constant
+// power injection and every other injection frozen at its value in the present
+// solution. These are not engine solutions: voltage-dependent loads, the
+// compensation currents, the controls (regulators, capacitors) and the
+// response of the other PC elements are ignored, so the result is only an
+// approximation that accounts for the nonlinearity of the PV injection itself.
+// They use a copy of the system Y matrix per worker, so the buses are
+// evaluated in parallel (ParallelFor) and the circuit itself is not modified.
+
+interface
+
+uses
+    DSSClass;
+
+const
+    // Binding constraints
+    HC_NONE = 0; // reached the max. size of the study
+    HC_OVERVOLTAGE = 1;
+    HC_THERMAL = 2;
+    HC_DEVIATION = 3;
+    HC_PROTECTION = 4;
+    HC_NONCONVERGENCE = 5; // the approximate power flow with the PV did not converge
+
+    HC_FAULT_FACTOR = 1.2; // PV fault current, per unit of its rated current
+
+type
+    // Results, stored column-wise, one row per bus, in the input order.
+    THostingCapacityResults = class(TObject)
+    public
+        Count: Integer;
+        BusNames: Array of String;
+        Capacities: Array of Double; // kW
+        Estimates: Array of Double; // kW, from the sensitivities
+        Constraints: Array of Integer; // binding constraint, HC_*
+        LimitingElements: Array of String; // node ("bus.node") or element at the binding limit
+        NumSolutions: Array of Integer; // approximate power flows used by the bisection
+    end;
+
+// Runs the study for the given buses (all buses with phase nodes if empty), up
+// to MaxkW per bus. MaxDeviation (pu) and ReachFraction <= 0 disable the
+// respective criteria. The circuit must be solved. Stores the results in
+// DSS.HostingCapacityResults.
+function RunHostingCapacity(DSS: TDSSContext; const Buses: Array of String; MaxkW, MaxDeviation, ReachFraction: Double; NumThreads: Integer): Boolean;
+
+implementation
+
+uses
+    SysUtils,
+    Math,
+    UComplex,
+    DSSUcomplex,
+    ArrayDef,
+    DSSGlobals,
+    Circuit,
+    Bus,
+    PDElement,
+    Solution,
+    YMatrix,
+    ParallelLoop,
+    VoltageSensitivity,
+    DSSHelper;
+
+type
+    THCElement = record
+        Obj: TPDElement;
+        Y: pComplexArray; // primitive Y, column-major
+        Order, NPhases: Integer;
+        MaxAmps: ArrayOfDouble; // per phase of terminal 1: NormAmps, or the present current if above it
+        I0: ArrayOfComplex; // present terminal 1 currents
+    end;
+
+    THCWorker = record
+        dV, V, Vnew, b: ArrayOfComplex;
+        Where: String; // limiting node or element of the last violation
+        NumSolutions: Integer;
+    end;
+    PHCWorker = ^THCWorker;
+
+    THostingCapacityRunner = class(TObject)
+    public
+        DSS: TDSSContext;
+        ckt: TDSSCircuit;
+        Calc: TVoltageSensitivity;
+        NumNodes: Integer;
+        I0: ArrayOfComplex; // injection currents of the present solution
+        Vbase: ArrayOfDouble;
+        Vmax: ArrayOfDouble; // per node, volts: NormalMaxVolts, or the present voltage if above it
+        Elements: Array of THCElement;
+        BusIdx: Array of Integer;
+        MaxkW, MaxDeviation, ReachFraction, Tolerance: Double;
+        MaxIterations: Integer;
+        Workers: Array of THCWorker;
+        Results: THostingCapacityResults;
+
+        destructor Destroy; override;
+        procedure Prepare();
+        function ElementCurrent(const E: THCElement; const V: ArrayOfComplex; k: Integer): Complex;
+        function NodeName(Ref: Integer): String;
+        function Estimate(var W: THCWorker; const refs: TPhaseNodes; np, BusRef: Integer; out ProtectionkW: Double): Double;
+        function Violation(var W: THCWorker; const V: ArrayOfComplex): Integer;
+        function ApproxCheck(var W: THCWorker; Worker: Integer; const refs: TPhaseNodes; np: Integer; kW: Double): Integer;
+        procedure SolveBus(Index, Worker: Integer);
+    end;
+
+function QuadraticLimit(a, b, c: Double): Double;
+// Smallest positive x with a x^2 + b x + c = 0, for c < 0 (within the limit at
+// x = 0); Infinity if none
+var
+    disc: Double;
+begin
+    Result := Infinity;
+    if a > 0 then
+    begin
+        disc := b * b - 4 * a * c;
+        Result := (-b + Sqrt(disc)) / (2 * a);
+    end
+    else
+    if b > 0 then
+        Result := -c / b;
+end;
+
+destructor THostingCapacityRunner.Destroy;
+begin
+    Calc.Free();
+    Results.Free();
+    inherited Destroy;
+end;
+
+function THostingCapacityRunner.ElementCurrent(const E: THCElement; const V: ArrayOfComplex; k: Integer): Complex;
+// Current into conductor k of the element, as in TDSSCktElement.GetCurrents
+var
+    j: Integer;
+begin
+    Result := 0;
+    for j := 1 to E.Order do
+        Result += E.Y[(j - 1) * E.Order + k] * V[E.Obj.NodeRef[j]];
+end;
+
+function THostingCapacityRunner.NodeName(Ref: Integer): String;
+begin
+    Result := ckt.BusList.NameOfIndex(ckt.MapNodeToBus[Ref].BusRef) + '.' + IntToStr(ckt.MapNodeToBus[Ref].NodeNum);
+end;
+
+procedure THostingCapacityRunner.Prepare();
+var
+    sol: TSolutionObj;
+    elem: TPDElement;
+    i, k, n: Integer;
+    Imag: Double;
+begin
+    sol := ckt.Solution;
+    NumNodes := ckt.NumNodes;
+    MaxIterations := Max(sol.MaxIterations, 2);
+    Tolerance := sol.ConvergenceTolerance;
+
+    SetLength(I0, NumNodes + 1);
+    Move(sol.Currents[0], I0[0], (NumNodes + 1) * SizeOf(Complex));
+    SetLength(Vbase, NumNodes + 1);
+    SetLength(Vmax, NumNodes + 1);
+    for i := 1 to NumNodes do
+    begin
+        Vbase[i] := sol.NodeVbase[i];
+        Vmax[i] := Max(ckt.NormalMaxVolts * Vbase[i], Cabs(Calc.V0[i]));
+    end;
+
+    SetLength(Elements, ckt.PDElements.Count);
+    n := 0;
+    for elem in ckt.PDElements do
+    begin
+        if (not elem.Enabled) or (elem.NTerms < 2) or (elem.NormAmps <= 0) or (elem.GetYPrimValues(ALL_YPRIM) = NIL) then
+            continue;
+        Elements[n].Obj := elem;
+        Elements[n].Y := elem.GetYPrimValues(ALL_YPRIM);
+        Elements[n].Order := elem.Yorder;
+        Elements[n].NPhases := elem.NPhases;
+        SetLength(Elements[n].MaxAmps, elem.NPhases + 1);
+        SetLength(Elements[n].I0, elem.NPhases + 1);
+        for k := 1 to elem.NPhases do
+        begin
+            Elements[n].I0[k] := ElementCurrent(Elements[n], Calc.V0, k);
+            Imag := Cabs(Elements[n].I0[k]);
+            Elements[n].MaxAmps[k] := Max(elem.NormAmps, Imag);
+        end;
+        Inc(n);
+    end;
+    SetLength(Elements, n);
+end;
+
+function THostingCapacityRunner.Estimate(var W: THCWorker; const refs: TPhaseNodes; np, BusRef: Integer; out ProtectionkW: Double): Double;
+// Limit from the linearized response W.dV to 1 kW at the bus
+var
+    pBus: TDSSBus;
+    i, k, e: Integer;
+    dI, Zth: Complex;
+    Vsum, Isc, dmag: Double;
+begin
+    Result := Infinity;
+
+    for i := 1 to NumNodes do
+    begin
+        if Vbase[i] = 0 then
+            continue;
+        // Overvoltage: |V0 + x dV| = Vmax
+        Result := Min(Result, QuadraticLimit(Cabs2(W.dV[i]), 2 * (Calc.V0[i].re * W.dV[i].re + Calc.V0[i].im * W.dV[i].im), Cabs2(Calc.V0[i]) - Sqr(Vmax[i])));
+        if MaxDeviation > 0 then
+        begin
+            dmag := Abs(Calc.dVdP(W.dV, i));
+            if dmag > 0 then
+                Result := Min(Result, MaxDeviation / dmag);
+        end;
+    end;
+
+    // Thermal: |I0 + x dI| = MaxAmps
+    for e := 0 to High(Elements) do
+        for k := 1 to Elements[e].NPhases do
+        begin
+            dI := ElementCurrent(Elements[e], W.dV, k);
+            Result := Min(Result, QuadraticLimit(Cabs2(dI), 2 * (Elements[e].I0[k].re * dI.re + Elements[e].I0[k].im * dI.im), Cabs2(Elements[e].I0[k]) - Sqr(Elements[e].MaxAmps[k])));
+        end;
+
+    // Protection reach, from the bus Zsc or the driving point impedance
+    ProtectionkW := Infinity;
+    if ReachFraction > 0 then
+    begin
+        pBus := ckt.Buses[BusRef];
+        Vsum := 0;
+        Zth := 0;
+        for k := 1 to np do
+        begin
+            Vsum += Cabs(Calc.V0[refs[k]]);
+            dI := cong(Cmplx(1000.0 / np, 0) / Calc.V0[refs[k]]);
+            Zth += W.dV[refs[k]] / dI;
+        end;
+        Zth := Zth / np;
+        if Assigned(pBus.Zsc) and (Cabs(pBus.Zsc1) > 0) then
+            Zth := pBus.Zsc1;
+        if Cabs(Zth) > 0 then
+        begin
+            // Isc per phase; the PV rated current is kW * 1000 / Vsum
+            Isc := Vsum / np / Cabs(Zth);
+            ProtectionkW := ReachFraction * Isc * Vsum / (HC_FAULT_FACTOR * 1000.0);
+        end;
+    end;
+end;
+
+function THostingCapacityRunner.Violation(var W: THCWorker; const V: ArrayOfComplex): Integer;
+var
+    i, k, e: Integer;
+begin
+    Result := HC_NONE;
+    for i := 1 to NumNodes do
+        if (Vbase[i] <> 0) and (Cabs(V[i]) > Vmax[i] * (1 + 1e-9)) then
+        begin
+            W.Where := NodeName(i);
+            Result := HC_OVERVOLTAGE;
+            Exit;
+        end;
+
+    for e := 0 to High(Elements) do
+        for k := 1 to Elements[e].NPhases do
+            if Cabs(ElementCurrent(Elements[e], V, k)) > Elements[e].MaxAmps[k] * (1 + 1e-9) then
+            begin
+                W.Where := Elements[e].Obj.FullName;
+                Result := HC_THERMAL;
+                Exit;
+            end;
+
+    if MaxDeviation > 0 then
+        for i := 1 to NumNodes do
+            if (Vbase[i] <> 0) and (Abs(Cabs(V[i]) - Cabs(Calc.V0[i])) / Vbase[i] > MaxDeviation) then
+            begin
+                W.Where := NodeName(i);
+                Result := HC_DEVIATION;
+                Exit;
+            end;
+end;
+
+function THostingCapacityRunner.ApproxCheck(var W: THCWorker; Worker: Integer; const refs: TPhaseNodes; np: Integer; kW: Double): Integer;
+// Approximate power flow with kW at the bus (fixed Y, other injections at I0),
+// then checks the limits
+var
+    tmp: ArrayOfComplex;
+    dS: Complex;
+    i, k, it: Integer;
+    maxdiff: Double;
+begin
+    Inc(W.NumSolutions);
+    Move(Calc.V0[0], W.V[0], (NumNodes + 1) * SizeOf(Complex));
+    dS := Cmplx(kW * 1000.0 / np, 0);
+    for it := 1 to MaxIterations do
+    begin
+        Move(I0[0], W.b[0], (NumNodes + 1) * SizeOf(Complex));
+        for k := 1 to np do
+            W.b[refs[k]] += cong(dS / W.V[refs[k]]);
+        Calc.Solve(Worker, W.Vnew, W.b);
+
+        maxdiff := 0;
+        for i := 1 to NumNodes do
+            if Vbase[i] <> 0 then
+                maxdiff := Max(maxdiff, Cabs(W.Vnew[i] - W.V[i]) / Vbase[i]);
+        tmp := W.V;
+        W.V := W.Vnew;
+        W.Vnew := tmp;
+        if maxdiff <= Tolerance then
+        begin
+            Result := Violation(W, W.V);
+            Exit;
+        end;
+    end;
+    W.Where := '';
+    Result := HC_NONCONVERGENCE;
+end;
+
+procedure THostingCapacityRunner.SolveBus(Index, Worker: Integer);
+var
+    W: PHCWorker;
+    refs: TPhaseNodes;
+    np, code, hiCode: Integer;
+    est, protkW, cap, lo, hi, p: Double;
+    hiWhere: String;
+begin
+    W := @Workers[Worker];
+    W.NumSolutions := 0;
+    Results.Capacities[Index] := 0;
+    Results.Estimates[Index] := 0;
+    Results.Constraints[Index] := HC_NONE;
+    Results.LimitingElements[Index] := '';
+    np := Calc.PhaseNodes(BusIdx[Index], refs);
+    if not Calc.BusResponse(BusIdx[Index], Worker, W.dV) then
+        Exit;
+
+    est := Estimate(W^, refs, np, BusIdx[Index], protkW);
+    cap := Min(MaxkW, protkW);
+    Results.Estimates[Index] := Min(est, cap);
+
+    // Bisection, starting at the estimate; lo is always within the limits
+    lo := 0;
+    hi := -1; // smallest size found with a violation
+    hiCode := HC_NONE;
+    hiWhere := '';
+    p := Min(est, cap);
+    if p <= 0 then
+        p := cap * 0.01;
+    while True do
+    begin
+        code := ApproxCheck(W^, Worker, refs, np, p);
+        if code = HC_NONE then
+        begin
+            lo := p;
+            if p >= cap then
+                break;
+            if hi < 0 then
+                p := Min(cap, p * 1.5)
+            else
+                p := (lo + hi) / 2;
+        end
+        else
+        begin
+            hi := p;
+            hiCode := code;
+            hiWhere := W.Where;
+            p := (lo + hi) / 2;
+        end;
+        if (hi >= 0) and (hi - lo <= Max(0.5, 0.005 * hi)) then
+            break;
+    end;
+
+    Results.Capacities[Index] := lo;
+    Results.NumSolutions[Index] := W.NumSolutions;
+    if hi >= 0 then
+    begin
+        Results.Constraints[Index] := hiCode;
+        Results.LimitingElements[Index] := hiWhere;
+    end
+    else
+    if protkW < MaxkW then
+    begin
+        Results.Constraints[Index] := HC_PROTECTION;
+        Results.LimitingElements[Index] := Results.BusNames[Index];
+    end;
+end;
+
+function RunHostingCapacity(DSS: TDSSContext; const Buses: Array of String; MaxkW, MaxDeviation, ReachFraction: Double; NumThreads: Integer): Boolean;
+var
+    runner: THostingCapacityRunner;
+    ckt: TDSSCircuit;
+    res: THostingCapacityResults;
+    refs: TPhaseNodes;
+    i, w, n, numWorkers: Integer;
+begin
+    Result := False;
+    FreeAndNil(DSS.HostingCapacityResults);
+    ckt := DSS.ActiveCircuit;
+    if MaxkW <= 0 then
+    begin
+        DoSimpleMsg(DSS, _('Hosting capacity: the max. PV size must be positive.'), 20240740);
+        Exit;
+    end;
+
+    runner := THostingCapacityRunner.Create();
+    try
+        runner.DSS := DSS;
+        runner.ckt := ckt;
+        runner.MaxkW := MaxkW;
+        runner.MaxDeviation := MaxDeviation;
+        runner.ReachFraction := ReachFraction;
+        runner.Calc := TVoltageSensitivity.Create(DSS);
+
+        // Workers are only known after the buses, but the phase nodes need the
+        // base voltages: check the circuit first, then prepare the solvers
+        if not runner.Calc.Prepare(1) then
+            Exit;
+
+        if Length(Buses) = 0 then
+        begin
+            for i := 1 to ckt.NumBuses do
+                if runner.Calc.PhaseNodes(i, refs) > 0 then
+                begin
+                    SetLength(runner.BusIdx, Length(runner.BusIdx) + 1);
+                    runner.BusIdx[High(runner.BusIdx)] := i;
+                end;
+        end
+        else
+        begin
+            SetLength(runner.BusIdx, Length(Buses));
+            for i := 0 to High(Buses) do
+            begin
+                runner.BusIdx[i] := ckt.BusList.Find(AnsiLowerCase(Buses[i]));
+                if runner.BusIdx[i] = 0 then
+                begin
+                    DoSimpleMsg(DSS, 'Hosting capacity: bus "%s" not found.', [Buses[i]], 20240741);
+                    Exit;
+                end;
+            end;
+        end;
+
+        n := Length(runner.BusIdx);
+        numWorkers := ParallelLoopWorkers(NumThreads, n);
+        if (numWorkers > 1) and not runner.Calc.Prepare(numWorkers) then
+            Exit;
+        runner.Prepare();
+
+        res := THostingCapacityResults.Create();
+        runner.Results := res;
+        res.Count := n;
+        SetLength(res.BusNames, n);
+        for i := 0 to n - 1 do
+            res.BusNames[i] := ckt.BusList.NameOfIndex(runner.BusIdx[i]);
+        SetLength(res.Capacities, n);
+        SetLength(res.Estimates, n);
+        SetLength(res.Constraints, n);
+        SetLength(res.LimitingElements, n);
+        SetLength(res.NumSolutions, n);
+
+        SetLength(runner.Workers, Max(numWorkers, 1));
+        for w := 0 to High(runner.Workers) do
+        begin
+            SetLength(runner.Workers[w].V, runner.NumNodes + 1);
+            SetLength(runner.Workers[w].Vnew, runner.NumNodes + 1);
+            SetLength(runner.Workers[w].b, runner.NumNodes + 1);
+        end;
+        try
+            ParallelFor(n, runner.SolveBus, NumThreads);
+        except
+            on E: Exception do
+            begin
+                DoSimpleMsg(DSS, 'Hosting capacity: %s', [E.Message], 20240742);
+                Exit;
+            end;
+        end;
+        DSS.HostingCapacityResults := res;
+        runner.Results := NIL;
+        Result := True;
+    finally
+        runner.Free;
+    end;
+end;
+
+end.
@@ -0,0 +1,249 @@
+unit LowRankUpdate;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Low-rank (Sherman-Morrison-Woodbury) corrections to the factorized system Y.
+//
+// With the LowRankUpdates solver option, the incremental changes to the
+// system Y matrix (switching, capacitor steps, transformer taps, etc.) are not
+// written to the KLU matrix. They are accumulated as a dense block dY over the
+// k affected nodes, and each solve uses the base factorization of Y0 with a
+// correction:
+//
+//     (Y0 + P dY P') x = b:    y = inv(Y0) b,    x = y - Zk inv(I + dY Zkk) dY yk
+//
+// where Zk = inv(Y0) P are the columns of the inverse for the affected nodes,
+// computed once per node with the base factorization, and yk, Zkk are the rows
+// of y and Zk at those nodes. Each solve costs one KLU solve plus O(N k).
+// Once k passes the threshold (TSolutionObj.LowRankThreshold), the changes are
+// written to the matrix (see Ymatrix.pas) and the next solve refactorizes it.
+
+interface
+
+uses
+    UComplex,
+    DSSUcomplex,
+    ArrayDef,
+    Ucmatrix;
+
+type
+    TLowRankUpdate = class(TObject)
+    private
+        NumNodes: Integer;
+        FRank: Integer;
+        NodeIndex: Array of Integer; // index in Nodes for each system node, -1 if not affected
+        Nodes: Array of Integer; // system node refs of the affected nodes
+        dY: Array of Array of Complex; // accumulated change, FRank x FRank
+        Z: Array of Array of Complex; // columns of inv(Y0) for Nodes, 1-based rows
+        NumColumns: Integer; // number of valid columns in Z
+        Minv: TCMatrix; // inv(I + dY Zkk)
+        Dirty: Boolean; // dY changed since Minv was computed
+        Work: Array of Complex;
+
+        function AddNode(Ref: Integer): Integer;
+        function Refresh(hY: NativeUInt): Integer;
+    public
+        constructor Create;
+        destructor Destroy; override;
+
+        // Drops all the accumulated changes. Must be called whenever the KLU
+        // matrix is rebuilt or the accumulated changes are written to it.
+        procedure Clear();
+
+        // Accumulates the change Delta of a primitive Y matrix, for the nodes
+        // given by NodeRef (1-based, 0 for ground)
+        procedure AddPrimitive(ANumNodes, Order: Integer; NodeRef: pIntegerArray; Delta: TCMatrix);
+
+        // Same as SolveSparseSet(hY, x, b), including the accumulated changes.
+        // x and b point to the first node, as in SolveSparseSet.
+        function Solve(hY: NativeUInt; x, b: pComplexArray): Integer;
+
+        // Affected node i (0-based) and whether the entry (i, j) was changed,
+        // used to write the changes to the matrix
+        function Node(i: Integer): Integer;
+        function IsChanged(i, j: Integer): Boolean;
+
+        property Rank: Integer read FRank;
+    end;
+
+implementation
+
+uses
+    SysUtils,
+    KLUSolve;
+
+constructor TLowRankUpdate.Create;
+begin
+    inherited Create;
+    Minv := NIL;
+    Clear();
+end;
+
+destructor TLowRankUpdate.Destroy;
+begin
+    FreeAndNil(Minv);
+    inherited Destroy;
+end;
+
+procedure TLowRankUpdate.Clear();
+var
+    i: Integer;
+begin
+    for i := 0 to FRank - 1 do
+        NodeIndex[Nodes[i]] := -1;
+    FRank := 0;
+    NumColumns := 0;
+    SetLength(Nodes, 0);
+    SetLength(dY, 0);
+    SetLength(Z, 0);
+    FreeAndNil(Minv);
+    Dirty := False;
+end;
+
+function TLowRankUpdate.AddNode(Ref: Integer): Integer;
+var
+    i: Integer;
+begin
+    Result := NodeIndex[Ref];
+    if Result >= 0 then
+        Exit;
+
+    Result := FRank;
+    Inc(FRank);
+    NodeIndex[Ref] := Result;
+    SetLength(Nodes, FRank);
+    Nodes[Result] := Ref;
+    SetLength(dY, FRank);
+    for i := 0 to FRank - 1 do
+        SetLength(dY[i], FRank); // new entries are zero
+end;
+
+procedure TLowRankUpdate.AddPrimitive(ANumNodes, Order: Integer; NodeRef: pIntegerArray; Delta: TCMatrix);
+var
+    i, j, li, lj: Integer;
+    val: Complex;
+begin
+    if (FRank = 0) and (ANumNodes <> NumNodes) then
+    begin
+        NumNodes := ANumNodes;
+        SetLength(NodeIndex, NumNodes + 1);
+        for i := 0 to NumNodes do
+            NodeIndex[i] := -1;
+    end;
+
+    for i := 1 to Order do
+    begin
+        if NodeRef[i] = 0 then
+            continue;
+        for j := 1 to Order do
+        begin
+            if NodeRef[j] = 0 then
+                continue;
+            val := Delta[i, j];
+            if (val.re = 0) and (val.im = 0) then
+                continue;
+            li := AddNode(NodeRef[i]);
+            lj := AddNode(NodeRef[j]);
+            dY[li][lj] += val;
+            Dirty := True;
+        end;
+    end;
+end;
+
+function TLowRankUpdate.Refresh(hY: NativeUInt): Integer;
+// Computes the missing columns of inv(Y0) and inv(I + dY Zkk)
+var
+    m, i, j, l: Integer;
+    s: Complex;
+begin
+    Result := 1;
+    SetLength(Work, NumNodes + 1);
+    SetLength(Z, FRank);
+    for m := NumColumns to FRank - 1 do
+    begin
+        SetLength(Z[m], NumNodes + 1);
+        for i := 1 to NumNodes do
+            Work[i] := 0;
+        Work[Nodes[m]] := 1;
+        Result := SolveSparseSet(hY, pComplexArray(@Z[m][1]), pComplexArray(@Work[1]));
+        if Result <> 1 then
+            Exit;
+    end;
+    NumColumns := FRank;
+
+    FreeAndNil(Minv);
+    Minv := TCMatrix.CreateMatrix(FRank);
+    for i := 0 to FRank - 1 do
+        for j := 0 to FRank - 1 do
+        begin
+            if i = j then
+                s := 1
+            else
+                s := 0;
+            for l := 0 to FRank - 1 do
+                s += dY[i][l] * Z[j][Nodes[l]];
+            Minv[i + 1, j + 1] := s;
+        end;
+    Minv.Invert();
+    if Minv.InvertError <> 0 then
+    begin
+        FreeAndNil(Minv);
+        Result := 2; // singular, as reported by SolveSparseSet
+        Exit;
+    end;
+    Dirty := False;
+end;
+
+function TLowRankUpdate.Solve(hY: NativeUInt; x, b: pComplexArray): Integer;
+var
+    t, u: Array of Complex;
+    i, l, r: Integer;
+    s: Complex;
+begin
+    Result := SolveSparseSet(hY, x, b);
+    if (Result <> 1) or (FRank = 0) then
+        Exit;
+
+    if Dirty or (Minv = NIL) then
+    begin
+        Result := Refresh(hY);
+        if Result <> 1 then
+            Exit;
+    end;
+
+    // t = dY yk, u = inv(I + dY Zkk) t
+    SetLength(t, FRank);
+    SetLength(u, FRank);
+    for i := 0 to FRank - 1 do
+    begin
+        s := 0;
+        for l := 0 to FRank - 1 do
+            s += dY[i][l] * x[Nodes[l]];
+        t[i] := s;
+    end;
+    Minv.MVmult(pComplexArray(@u[0]), pComplexArray(@t[0]));
+
+    // x = y - Zk u
+    for r := 1 to NumNodes do
+    begin
+        s := x[r];
+        for l := 0 to FRank - 1 do
+            s -= Z[l][r] * u[l];
+        x[r] := s;
+    end;
+end;
+
+function TLowRankUpdate.Node(i: Integer): Integer;
+begin
+    Result := Nodes[i];
+end;
+
+function TLowRankUpdate.IsChanged(i, j: Integer): Boolean;
+begin
+    Result := (dY[i][j].re <> 0) or (dY[i][j].im <> 0);
+end;
+
+end.
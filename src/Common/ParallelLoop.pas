@@ -0,0 +1,131 @@
+unit ParallelLoop;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// A minimal parallel-for for independent work items inside a single DSS
+// context, used by the study engines (e.g. protection coordination).
+//
+// The items are handed out dynamically through a shared counter, so uneven
+// workloads are balanced automatically. The body receives the index of the
+// worker running it (0..NumWorkers-1), which callers use to keep per-worker
+// scratch buffers and results without locking. Worker 0 runs on the calling
+// thread. The body must not touch the shared engine state (solution arrays,
+// control queue, etc.) besides reading it.
+
+interface
+
+type
+    TParallelLoopBody = procedure(Index, Worker: Integer) of object;
+
+// Number of workers that ParallelFor will use for the given parameters.
+// NumThreads <= 0 uses all the logical CPUs.
+function ParallelLoopWorkers(NumThreads, Count: Integer): Integer;
+
+// Runs Body for every index in 0..Count-1. If any call raises an exception,
+// the remaining items are skipped and the first error is raised again on the
+// calling thread.
+procedure ParallelFor(Count: Integer; Body: TParallelLoopBody; NumThreads: Integer = 0);
+
+implementation
+
+uses
+    Classes,
+    SysUtils,
+    Math,
+    DSSGlobals;
+
+type
+    TParallelLoopState = record
+        Next: LongInt;
+        Count: LongInt;
+        Body: TParallelLoopBody;
+    end;
+    PParallelLoopState = ^TParallelLoopState;
+
+    TParallelLoopThread = class(TThread)
+    protected
+        procedure Execute; override;
+    public
+        State: PParallelLoopState;
+        Worker: Integer;
+        ErrorMessage: String;
+    end;
+
+function RunItems(State: PParallelLoopState; Worker: Integer): String;
+var
+    i: Integer;
+begin
+    Result := '';
+    try
+        while True do
+        begin
+            i := InterLockedIncrement(State^.Next) - 1;
+            if i >= State^.Count then
+                Exit;
+            State^.Body(i, Worker);
+        end;
+    except
+        on E: Exception do
+        begin
+            Result := E.Message;
+            if Result = '' then
+                Result := E.ClassName;
+            InterLockedExchange(State^.Next, State^.Count); // skip the remaining items
+        end;
+    end;
+end;
+
+procedure TParallelLoopThread.Execute;
+begin
+    ErrorMessage := RunItems(State, Worker);
+end;
+
+function ParallelLoopWorkers(NumThreads, Count: Integer): Integer;
+begin
+    if NumThreads <= 0 then
+        NumThreads := CPU_Cores;
+    Result := Max(1, Min(NumThreads, Count));
+end;
+
+procedure ParallelFor(Count: Integer; Body: TParallelLoopBody; NumThreads: Integer);
+var
+    State: TParallelLoopState;
+    Threads: Array of TParallelLoopThread;
+    NumWorkers, i: Integer;
+    ErrorMessage: String;
+begin
+    if Count <= 0 then
+        Exit;
+
+    State.Next := 0;
+    State.Count := Count;
+    State.Body := Body;
+    NumWorkers := ParallelLoopWorkers(NumThreads, Count);
+
+    SetLength(Threads, NumWorkers - 1);
+    for i := 0 to High(Threads) do
+    begin
+        Threads[i] := TParallelLoopThread.Create(True);
+        Threads[i].State := @State;
+        Threads[i].Worker := i + 1;
+        Threads[i].Start();
+    end;
+
+    ErrorMessage := RunItems(@State, 0);
+
+    for i := 0 to High(Threads) do
+    begin
+        Threads[i].WaitFor();
+        if (ErrorMessage = '') and (Threads[i].ErrorMessage <> '') then
+            ErrorMessage := Threads[i].ErrorMessage;
+        Threads[i].Free();
+    end;
+
+    if ErrorMessage <> '' then
+        raise Exception.Create(ErrorMessage);
+end;
+
+end.
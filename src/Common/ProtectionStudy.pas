@@ -0,0 +1,565 @@
+unit ProtectionStudy;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Static protection coordination study.
+//
+// Instead of solving each fault case and sampling the controls, the Thevenin
+// data from the fault study (open-circuit voltages and Zsc matrices, from
+// ComputeAllYsc) is used to compute the bolted fault currents at each bus.
+// For each fault, the overcurrent devices (Relay, Recloser, Fuse) found
+// upstream of the faulted bus in the circuit topology are assumed to carry
+// the fault current (referred to their voltage base; no zero-sequence current
+// beyond transformers), and their operating times are evaluated directly from
+// their TCC curves. Each pair of consecutive devices on the path is reported
+// as a primary/backup pair, with the coordination time interval (CTI) check.
+//
+// Load and DG contributions to the branch currents are neglected, as usual
+// for radial coordination studies. The buses are processed in parallel: the
+// devices are shared by the workers, which only call OvercurrentTripTime on
+// them -- it reads the settings and curves (GetTCCTimeHint, with a local hint)
+// and never changes the state of the device or the control queue.
+
+interface
+
+uses
+    DSSClass;
+
+type
+{$SCOPEDENUMS ON}
+    TProtectionFaultType = (
+        ThreePhase = 1, // all phases of the bus to ground
+        LineToLine = 2, // first two phases of the bus
+        LineToGround = 4 // first phase of the bus
+    );
+
+    TProtectionPairStatus = (
+        OK = 0, // primary operates; backup doesn't, or does after at least CTI
+        CTIViolation = 1, // both operate, backup after the primary but within CTI
+        Miscoordination = 2 // backup operates before the primary, or primary doesn't operate
+    );
+{$SCOPEDENUMS OFF}
+
+    // Results, stored column-wise. One row for each primary/backup pair and
+    // fault (bus, fault type). Rows are ordered by bus index.
+    TProtectionStudyResults = class(TObject)
+    public
+        CTI: Double;
+        Count: Integer;
+        BusNames: Array of String;
+        FaultTypes: Array of Integer;
+        PrimaryNames: Array of String;
+        BackupNames: Array of String;
+        FaultAmps: Array of Double; // max. phase current at the faulted bus
+        PrimaryTimes: Array of Double; // -1 if it doesn't operate
+        BackupTimes: Array of Double; // -1 if it doesn't operate
+        Margins: Array of Double; // BackupTimes - PrimaryTimes; NaN if one doesn't operate
+        Status: Array of Integer; // TProtectionPairStatus
+
+        function NumViolations(): Integer;
+    end;
+
+const
+    ProtectionFaultTypes: Array[0..2] of TProtectionFaultType = (
+        TProtectionFaultType.ThreePhase,
+        TProtectionFaultType.LineToLine,
+        TProtectionFaultType.LineToGround
+    );
+    PROTECTION_FAULT_ALL = ord(TProtectionFaultType.ThreePhase) or ord(TProtectionFaultType.LineToLine) or ord(TProtectionFaultType.LineToGround);
+
+// Runs the fault study and the coordination check on the active circuit.
+// FaultTypes is a combination of TProtectionFaultType values (0 for all).
+// NumThreads <= 0 uses all the logical CPUs. The results are kept in
+// DSS.ProtectionResults. Returns False on errors, which are reported through
+// DoSimpleMsg.
+function RunProtectionStudy(DSS: TDSSContext; FaultTypes: Integer; CTI: Double; NumThreads: Integer): Boolean;
+
+implementation
+
+uses
+    SysUtils,
+    Math,
+    UComplex,
+    DSSUcomplex,
+    ArrayDef,
+    Ucmatrix,
+    DSSGlobals,
+    DSSClassDefs,
+    DSSHelper,
+    Circuit,
+    Bus,
+    CktElement,
+    CktTree,
+    Solution,
+    SolutionAlgs,
+    ControlElem,
+    Relay,
+    Recloser,
+    Fuse,
+    ParallelLoop;
+
+type
+    TProtectionDeviceKind = (pdkRelay, pdkRecloser, pdkFuse);
+
+    TProtectionDevice = record
+        Obj: TControlElem;
+        Kind: TProtectionDeviceKind;
+        NumPhases: Integer;
+        NodeNums: Array[0..2] of Integer; // bus node number (1..3) of each monitored phase, 0 if none
+        kVBase: Double;
+        NextAtNode: Integer; // next device index at the same tree node, -1 at the end
+    end;
+
+    TProtectionRows = record
+        Count: Integer;
+        Bus: Array of Integer;
+        FaultType: Array of Integer;
+        Primary, Backup: Array of Integer;
+        FaultAmps, PrimaryTime, BackupTime, Margin: Array of Double;
+        Status: Array of Integer;
+    end;
+
+    TProtectionStudyRunner = class(TObject)
+    public
+        DSS: TDSSContext;
+        ckt: TDSSCircuit;
+        FaultTypes: Integer;
+        CTI: Double;
+
+        Devices: Array of TProtectionDevice;
+        NodeParent: Array of Integer; // tree node index (1-based) -> parent index, 0 for the root
+        NodeFirstDevice: Array of Integer; // -1 if none
+        NodeIsTransformer: Array of Boolean;
+        BusFeedNode: Array of Integer; // bus index -> tree node feeding it, 0 if none
+        WorkerRows: Array of TProtectionRows;
+
+        procedure BuildTopology();
+        procedure AddDevice(Obj: TControlElem; Kind: TProtectionDeviceKind; const NodeOfHandle: Array of Integer);
+        procedure ProcessBus(Index, Worker: Integer);
+        procedure AddRow(var Rows: TProtectionRows; BusIdx, FaultType, Primary, Backup: Integer; FaultAmps, tPrimary, tBackup: Double);
+        function Collect(): TProtectionStudyResults;
+    end;
+
+function TProtectionStudyResults.NumViolations(): Integer;
+var
+    i: Integer;
+begin
+    Result := 0;
+    for i := 0 to Count - 1 do
+        if Status[i] <> ord(TProtectionPairStatus.OK) then
+            Inc(Result);
+end;
+
+procedure TProtectionStudyRunner.AddDevice(Obj: TControlElem; Kind: TProtectionDeviceKind; const NodeOfHandle: Array of Integer);
+var
+    elem: TDSSCktElement;
+    dev: TProtectionDevice;
+    term, i, node, ref: Integer;
+begin
+    if (not Obj.Enabled) or (Obj.MonitoredElement = NIL) then
+        Exit;
+    if (Kind = pdkRelay) and not TRelayObj(Obj).IsOvercurrent() then
+        Exit;
+
+    elem := Obj.MonitoredElement;
+    if (elem.Handle < 0) or (elem.Handle > High(NodeOfHandle)) then
+        Exit;
+    node := NodeOfHandle[elem.Handle];
+    if node = 0 then
+        Exit; // not in the tree (isolated or not a branch)
+
+    case Kind of
+        pdkRelay:
+            term := TRelayObj(Obj).MonitoredElementTerminal;
+        pdkRecloser:
+            term := TRecloserObj(Obj).MonitoredElementTerminal;
+    else
+        term := TFuseObj(Obj).MonitoredElementTerminal;
+    end;
+    if (term < 1) or (term > elem.NTerms) then
+        term := 1;
+
+    dev.Obj := Obj;
+    dev.Kind := Kind;
+    dev.NumPhases := Min(3, elem.NPhases);
+    for i := 0 to 2 do
+        dev.NodeNums[i] := 0;
+    for i := 0 to dev.NumPhases - 1 do
+    begin
+        ref := elem.Terminals[term - 1].TermNodeRef[i];
+        if ref > 0 then
+            dev.NodeNums[i] := ckt.MapNodeToBus[ref].NodeNum;
+    end;
+    dev.kVBase := ckt.Buses[elem.Terminals[term - 1].BusRef].kVBase;
+    dev.NextAtNode := NodeFirstDevice[node];
+
+    SetLength(Devices, Length(Devices) + 1);
+    Devices[High(Devices)] := dev;
+    NodeFirstDevice[node] := High(Devices);
+end;
+
+procedure TProtectionStudyRunner.BuildTopology();
+var
+    tree: TCktTree;
+    node: TCktTreeNode;
+    elem: TDSSCktElement;
+    NodeOfHandle: Array of Integer;
+    nNodes, t, busRef: Integer;
+    obj: TControlElem;
+begin
+    SetLength(NodeOfHandle, ckt.CktElements.Count + 1); // zero-filled
+    SetLength(BusFeedNode, ckt.NumBuses + 1);
+    SetLength(NodeParent, 1);
+    SetLength(NodeFirstDevice, 1);
+    SetLength(NodeIsTransformer, 1);
+
+    tree := ckt.GetTopology();
+    nNodes := 0;
+    if tree.First() <> NIL then
+    repeat
+        node := tree.PresentBranch;
+        elem := TDSSCktElement(node.CktObject);
+        Inc(nNodes);
+        if nNodes >= Length(NodeParent) then
+        begin
+            SetLength(NodeParent, 2 * nNodes);
+            SetLength(NodeFirstDevice, 2 * nNodes);
+            SetLength(NodeIsTransformer, 2 * nNodes);
+        end;
+        NodeOfHandle[elem.Handle] := nNodes;
+        NodeFirstDevice[nNodes] := -1;
+        NodeIsTransformer[nNodes] :=
+            ((elem.DSSObjType and CLASSMASK) = XFMR_ELEMENT) or
+            ((elem.DSSObjType and CLASSMASK) = AUTOTRANS_ELEMENT);
+
+        // Parents are always visited before their children
+        if node.ParentBranch <> NIL then
+            NodeParent[nNodes] := NodeOfHandle[TDSSCktElement(node.ParentBranch.CktObject).Handle]
+        else
+            NodeParent[nNodes] := 0;
+
+        for t := 1 to elem.NTerms do
+        begin
+            if t = node.FromTerminal then
+                continue;
+            busRef := elem.Terminals[t - 1].BusRef;
+            if (busRef > 0) and (busRef <= ckt.NumBuses) and (BusFeedNode[busRef] = 0) then
+                BusFeedNode[busRef] := nNodes;
+        end;
+    until tree.GoForward() = NIL;
+
+    for obj in ckt.Relays do
+        AddDevice(obj, pdkRelay, NodeOfHandle);
+    for obj in ckt.Reclosers do
+        AddDevice(obj, pdkRecloser, NodeOfHandle);
+    for obj in ckt.Fuses do
+        AddDevice(obj, pdkFuse, NodeOfHandle);
+end;
+
+procedure TProtectionStudyRunner.AddRow(var Rows: TProtectionRows; BusIdx, FaultType, Primary, Backup: Integer; FaultAmps, tPrimary, tBackup: Double);
+var
+    n: Integer;
+    status: TProtectionPairStatus;
+    margin: Double;
+begin
+    if (tPrimary <= 0) and (tBackup <= 0) then
+        Exit; // neither sees this fault
+
+    margin := NaN;
+    if tPrimary <= 0 then
+        status := TProtectionPairStatus.Miscoordination
+    else if tBackup <= 0 then
+        status := TProtectionPairStatus.OK
+    else
+    begin
+        margin := tBackup - tPrimary;
+        if margin < 0 then
+            status := TProtectionPairStatus.Miscoordination
+        else if margin < CTI then
+            status := TProtectionPairStatus.CTIViolation
+        else
+            status := TProtectionPairStatus.OK;
+    end;
+
+    n := Rows.Count;
+    if n >= Length(Rows.Bus) then
+    begin
+        SetLength(Rows.Bus, Max(64, 2 * n));
+        SetLength(Rows.FaultType, Length(Rows.Bus));
+        SetLength(Rows.Primary, Length(Rows.Bus));
+        SetLength(Rows.Backup, Length(Rows.Bus));
+        SetLength(Rows.FaultAmps, Length(Rows.Bus));
+        SetLength(Rows.PrimaryTime, Length(Rows.Bus));
+        SetLength(Rows.BackupTime, Length(Rows.Bus));
+        SetLength(Rows.Margin, Length(Rows.Bus));
+        SetLength(Rows.Status, Length(Rows.Bus));
+    end;
+    Rows.Bus[n] := BusIdx;
+    Rows.FaultType[n] := FaultType;
+    Rows.Primary[n] := Primary;
+    Rows.Backup[n] := Backup;
+    Rows.FaultAmps[n] := FaultAmps;
+    Rows.PrimaryTime[n] := tPrimary;
+    Rows.BackupTime[n] := tBackup;
+    Rows.Margin[n] := margin;
+    Rows.Status[n] := ord(status);
+    Rows.Count := n + 1;
+end;
+
+procedure TProtectionStudyRunner.ProcessBus(Index, Worker: Integer);
+var
+    pBus: TDSSBus;
+    busIdx, node, d, i, j, k, n, f: Integer;
+    ft: TProtectionFaultType;
+    phaseIdx: Array[0..2] of Integer; // bus node indices of the phases
+    chain: Array of Integer;
+    chainNoGround: Array of Boolean;
+    times: Array of Double;
+    crossed: Boolean;
+    If_: Array[0..3] of Complex; // fault current by node number
+    Zf: TCMatrix;
+    Vf, Ibuf: Array[1..3] of Complex;
+    Zll, Isum: Complex;
+    amps: Array[0..2] of Double;
+    maxAmps, scale, ground: Double;
+begin
+    busIdx := Index + 1;
+    node := BusFeedNode[busIdx];
+    if node = 0 then
+        Exit;
+    pBus := ckt.Buses[busIdx];
+    if (pBus.Zsc = NIL) or (pBus.VBus = NIL) then
+        Exit;
+
+    // Devices from the faulted bus towards the source
+    n := 0;
+    crossed := False;
+    while node > 0 do
+    begin
+        d := NodeFirstDevice[node];
+        while d >= 0 do
+        begin
+            if n >= Length(chain) then
+            begin
+                SetLength(chain, n + 8);
+                SetLength(chainNoGround, n + 8);
+            end;
+            chain[n] := d;
+            chainNoGround[n] := crossed;
+            Inc(n);
+            d := Devices[d].NextAtNode;
+        end;
+        if NodeIsTransformer[node] then
+            crossed := True;
+        node := NodeParent[node];
+    end;
+    if n < 2 then
+        Exit;
+    SetLength(times, n);
+
+    k := 0;
+    for i := 1 to pBus.NumNodesThisBus do
+        if (pBus.GetNum(i) >= 1) and (pBus.GetNum(i) <= 3) and (k < 3) then
+        begin
+            phaseIdx[k] := i;
+            Inc(k);
+        end;
+    if k = 0 then
+        Exit;
+
+    for f := 0 to High(ProtectionFaultTypes) do
+    begin
+        ft := ProtectionFaultTypes[f];
+        if (FaultTypes and ord(ft)) = 0 then
+            continue;
+
+        for i := 0 to 3 do
+            If_[i] := 0;
+
+        case ft of
+            TProtectionFaultType.ThreePhase:
+            begin
+                Zf := TCMatrix.CreateMatrix(k);
+                try
+                    for i := 1 to k do
+                    begin
+                        Vf[i] := pBus.VBus[phaseIdx[i - 1]];
+                        for j := 1 to k do
+                            Zf[i, j] := pBus.Zsc[phaseIdx[i - 1], phaseIdx[j - 1]];
+                    end;
+                    Zf.Invert();
+                    if Zf.InvertError <> 0 then
+                        continue;
+                    Zf.MVmult(pComplexArray(@Ibuf[1]), pComplexArray(@Vf[1]));
+                    for i := 1 to k do
+                        If_[pBus.GetNum(phaseIdx[i - 1])] := Ibuf[i];
+                finally
+                    Zf.Free;
+                end;
+            end;
+            TProtectionFaultType.LineToLine:
+            begin
+                if k < 2 then
+                    continue;
+                Zll := pBus.Zsc[phaseIdx[0], phaseIdx[0]] + pBus.Zsc[phaseIdx[1], phaseIdx[1]] -
+                       pBus.Zsc[phaseIdx[0], phaseIdx[1]] - pBus.Zsc[phaseIdx[1], phaseIdx[0]];
+                if Cabs(Zll) = 0 then
+                    continue;
+                Isum := (pBus.VBus[phaseIdx[0]] - pBus.VBus[phaseIdx[1]]) / Zll;
+                If_[pBus.GetNum(phaseIdx[0])] := Isum;
+                If_[pBus.GetNum(phaseIdx[1])] := -Isum;
+            end;
+            TProtectionFaultType.LineToGround:
+            begin
+                Zll := pBus.Zsc[phaseIdx[0], phaseIdx[0]];
+                if Cabs(Zll) = 0 then
+                    continue;
+                If_[pBus.GetNum(phaseIdx[0])] := pBus.VBus[phaseIdx[0]] / Zll;
+            end;
+        end;
+
+        maxAmps := 0;
+        for i := 1 to 3 do
+            maxAmps := Max(maxAmps, Cabs(If_[i]));
+        if maxAmps = 0 then
+            continue;
+
+        for i := 0 to n - 1 do
+        begin
+            with Devices[chain[i]] do
+            begin
+                if (kVBase > 0) and (pBus.kVBase > 0) then
+                    scale := pBus.kVBase / kVBase
+                else
+                    scale := 1;
+
+                Isum := 0;
+                for j := 0 to NumPhases - 1 do
+                begin
+                    amps[j] := Cabs(If_[NodeNums[j]]) * scale;
+                    Isum += If_[NodeNums[j]];
+                end;
+                if chainNoGround[i] then
+                    ground := 0
+                else
+                    ground := Cabs(Isum) * scale;
+
+                case Kind of
+                    pdkRelay:
+                        times[i] := TRelayObj(Obj).OvercurrentTripTime(Slice(amps, NumPhases), ground);
+                    pdkRecloser:
+                        times[i] := TRecloserObj(Obj).OvercurrentTripTime(Slice(amps, NumPhases), ground);
+                else
+                    times[i] := TFuseObj(Obj).OvercurrentTripTime(Slice(amps, NumPhases), ground);
+                end;
+            end;
+        end;
+
+        for i := 0 to n - 2 do
+            AddRow(WorkerRows[Worker], busIdx, ord(ft), chain[i], chain[i + 1], maxAmps, times[i], times[i + 1]);
+    end;
+end;
+
+function TProtectionStudyRunner.Collect(): TProtectionStudyResults;
+var
+    Offsets: Array of Integer;
+    w, i, r, total: Integer;
+begin
+    Result := TProtectionStudyResults.Create();
+    Result.CTI := CTI;
+
+    // Counting sort by bus, so that the output doesn't depend on the scheduling
+    SetLength(Offsets, ckt.NumBuses + 2);
+    total := 0;
+    for w := 0 to High(WorkerRows) do
+        for i := 0 to WorkerRows[w].Count - 1 do
+            Inc(Offsets[WorkerRows[w].Bus[i] + 1]);
+    for i := 1 to High(Offsets) do
+        Offsets[i] := Offsets[i] + Offsets[i - 1];
+    total := Offsets[High(Offsets)];
+
+    Result.Count := total;
+    SetLength(Result.BusNames, total);
+    SetLength(Result.FaultTypes, total);
+    SetLength(Result.PrimaryNames, total);
+    SetLength(Result.BackupNames, total);
+    SetLength(Result.FaultAmps, total);
+    SetLength(Result.PrimaryTimes, total);
+    SetLength(Result.BackupTimes, total);
+    SetLength(Result.Margins, total);
+    SetLength(Result.Status, total);
+
+    for w := 0 to High(WorkerRows) do
+        with WorkerRows[w] do
+            for i := 0 to Count - 1 do
+            begin
+                r := Offsets[Bus[i]];
+                Inc(Offsets[Bus[i]]);
+                Result.BusNames[r] := ckt.BusList.NameOfIndex(Bus[i]);
+                Result.FaultTypes[r] := FaultType[i];
+                Result.PrimaryNames[r] := Devices[Primary[i]].Obj.FullName;
+                Result.BackupNames[r] := Devices[Backup[i]].Obj.FullName;
+                Result.FaultAmps[r] := FaultAmps[i];
+                Result.PrimaryTimes[r] := PrimaryTime[i];
+                Result.BackupTimes[r] := BackupTime[i];
+                Result.Margins[r] := Margin[i];
+                Result.Status[r] := Status[i];
+            end;
+end;
+
+function RunProtectionStudy(DSS: TDSSContext; FaultTypes: Integer; CTI: Double; NumThreads: Integer): Boolean;
+var
+    runner: TProtectionStudyRunner;
+    ckt: TDSSCircuit;
+    SavedLoadModel: Integer;
+begin
+    Result := False;
+    FreeAndNil(DSS.ProtectionResults);
+    ckt := DSS.ActiveCircuit;
+    if (ckt = NIL) or (ckt.Sources.Count = 0) then
+    begin
+        DoSimpleMsg(DSS, _('Protection study: the active circuit has no sources.'), 20240701);
+        Exit;
+    end;
+    if (FaultTypes and PROTECTION_FAULT_ALL) = 0 then
+        FaultTypes := PROTECTION_FAULT_ALL;
+
+    // Same as "solve mode=faultstudy", preserving the load model
+    SavedLoadModel := ckt.Solution.LoadModel;
+    try
+        ckt.Solution.SolveFaultStudy();
+    finally
+        ckt.Solution.LoadModel := SavedLoadModel;
+        ckt.Solution.SystemYChanged := True;
+    end;
+    if DSS.SolutionAbort or (DSS.ErrorNumber <> 0) then
+        Exit;
+
+    runner := TProtectionStudyRunner.Create();
+    try
+        runner.DSS := DSS;
+        runner.ckt := ckt;
+        runner.FaultTypes := FaultTypes;
+        runner.CTI := CTI;
+        runner.BuildTopology();
+        SetLength(runner.WorkerRows, ParallelLoopWorkers(NumThreads, ckt.NumBuses));
+        try
+            ParallelFor(ckt.NumBuses, runner.ProcessBus, NumThreads);
+        except
+            on E: Exception do
+            begin
+                DoSimpleMsg(DSS, 'Protection study: %s', [E.Message], 20240702);
+                Exit;
+            end;
+        end;
+        DSS.ProtectionResults := runner.Collect();
+        Result := True;
+    finally
+        runner.Free;
+    end;
+end;
+
+end.
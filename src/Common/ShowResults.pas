@@ -3548,6 +3548,9 @@ var
 begin
     if DSS.ActiveCircuit = NIL then
         Exit;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    ApplyLowRankUpdates(DSS); // the matrix must include any pending low-rank corrections
+{$ENDIF}
     hY := DSS.ActiveCircuit.Solution.hY;
     if hY <= 0 then
     begin
@@ -22,6 +22,11 @@ uses
     ISource,
     SysUtils,
     generics.collections,
+    SweepSolver,
+    DynamicsIntegrator,
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    LowRankUpdate,
+{$ENDIF}
 {$IFDEF MSWINDOWS}
     Windows,
 {$ELSE}
@@ -39,6 +44,7 @@ uses
 const
     NORMALSOLVE = 0;
     NEWTONSOLVE = 1;
+    SWEEPSOLVE = 2; // backward/forward sweep on radial circuits, see SweepSolver.pas
 
 {$IFDEF DSS_CAPI_ADIAKOPTICS}
     AD_ACTORS = 1; // Wait flag to wait only for the A-Diakoptics actors
@@ -77,7 +83,8 @@ type
         ReuseSymbolicFactorization = 2, // Reuse the symbolic factorization, implies ReuseCompressedMatrix
         ReuseNumericFactorization = 3, // Reuse the numeric factorization, implies ReuseSymbolicFactorization
         
-        AlwaysResetYPrimInvalid = $10000000 // Bit flag, see CktElement.pas
+        AlwaysResetYPrimInvalid = $10000000, // Bit flag, see CktElement.pas
+        LowRankUpdates = $20000000 // Bit flag: keep the factorization and apply incremental changes as low-rank corrections, see LowRankUpdate.pas
     );
 {$SCOPEDENUMS OFF}
 {$ENDIF}
@@ -138,6 +145,7 @@ type
 
         procedure DoNewtonSolution;
         procedure DoNormalSolution;
+        procedure DoSweepSolution;
         procedure SumAllCurrents;
         procedure Set_Frequency(const Value: Double);
         procedure Set_Mode(const Value: TSolveMode);
@@ -146,7 +154,7 @@ type
     PUBLIC
         DSS: TDSSContext;
         cktptr: Pointer;
-        Algorithm: Integer;      // NORMALSOLVE or NEWTONSOLVE
+        Algorithm: Integer;      // NORMALSOLVE, NEWTONSOLVE or SWEEPSOLVE
         AuxCurrents: pComplexArray; // For injections like AutoAdd
         ControlActionsDone: Boolean;
         ControlIteration: Integer;
@@ -193,6 +201,22 @@ type
         VoltageBaseChanged: Boolean;
         ProgressCount: Integer; // used in SolutionAlgs
         SolverOptions: Uint64;   // KLUSolveX options
+        FastMonteFault: Boolean; // MonteFault: evaluate the faults as low-rank updates (FastFault unit)
+        Sweep: TSweepSolver;
+        SweepPlanInvalid: Boolean; // Sweep must be rebuilt, set with the system Y
+        SweepActive: Boolean; // SWEEPSOLVE: the last solution used the sweep (otherwise, the normal algorithm)
+        BatchSize: Integer; // Daily, Yearly and Duty modes: steps solved together when the system Y is fixed (< 2 to disable)
+        BatchThreads: Integer; // workers for the batched steps (<= 0 for all logical CPUs)
+
+        // Dynamics mode, see TSolutionAlgs.SolveDynamic
+        Integrator: TDynamicsIntegrator;
+        DynamicsTolerance: Double; // local error for the adaptive time step (<= 0 for the fixed step)
+        DynamicsMinStep, DynamicsMaxStep: Double; // limits of the adaptive time step, s (<= 0 for h/100 and 10*h)
+        DynamicsThreads: Integer; // workers for IntegrateStates (<= 0 for all logical CPUs)
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+        LowRank: TLowRankUpdate; // Pending changes to hYsystem, with TSolverOptions.LowRankUpdates
+        LowRankThreshold: Integer; // Max. rank of LowRank before writing the changes to hYsystem
+{$ENDIF}
 
         // Voltage and Current Arrays
         NodeV: pNodeVArray;    // Main System Voltage Array   allows NodeV[0]=0
@@ -356,6 +380,7 @@ uses
     Diakoptics,
 {$ENDIF}
     DSSHelper,
+    SolverProfile,
     StrUtils;
 
 const
@@ -416,6 +441,21 @@ begin
     cktptr := dssCkt;
 
     SolverOptions := 0;
+    FastMonteFault := FALSE;
+    Sweep := TSweepSolver.Create(DSS);
+    SweepPlanInvalid := TRUE;
+    SweepActive := FALSE;
+    BatchSize := 0;
+    BatchThreads := 0;
+    Integrator := TDynamicsIntegrator.Create(DSS);
+    DynamicsTolerance := 0;
+    DynamicsMinStep := 0;
+    DynamicsMaxStep := 0;
+    DynamicsThreads := 1;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    LowRank := TLowRankUpdate.Create();
+    LowRankThreshold := 16;
+{$ENDIF}
 
     FYear := 0;
     DynaVars.intHour := 0;
@@ -507,6 +547,8 @@ end;
 
 destructor TSolutionObj.Destroy;
 begin
+    Inc(DSS.SolutionGeneration); // invalidates any external views of NodeV/Currents
+    Inc(DSS.YGeneration);
     Reallocmem(AuxCurrents, 0);
     Reallocmem(Currents, 0);
     Reallocmem(dV, 0);
@@ -519,6 +561,11 @@ begin
         DeleteSparseSet(hYsystem);
     if hYseries <> 0 then
         DeleteSparseSet(hYseries);
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    LowRank.Free;
+{$ENDIF}
+    Sweep.Free;
+    Integrator.Free;
 
 {$IFDEF DSS_CAPI_PM}    
     // Sends a message to the working actor
@@ -915,6 +962,61 @@ begin
     until (Converged and (Iteration >= MinIterations)) or (Iteration >= MaxIterations);
 end;
 
+procedure TSolutionObj.DoSweepSolution;
+// Same iteration as DoNormalSolution, with a backward/forward sweep over the
+// radial circuit in place of the KLU solve. Uses DoNormalSolution when the
+// circuit is not radial (see TSweepSolver.Build).
+
+    function SweepReady(): Boolean;
+    begin
+        if SweepPlanInvalid then
+        begin
+            SweepPlanInvalid := FALSE;
+            SweepActive := Sweep.Build();
+            if (not SweepActive) and ckt.LogEvents then
+                DSS.LogThisEvent('Sweep solution not used: ' + Sweep.FallbackReason);
+        end;
+        Result := SweepActive;
+    end;
+
+begin
+    if SystemYChanged {$IFDEF DSS_CAPI_INCREMENTAL_Y}or (ckt.IncrCktElements.Count <> 0){$ENDIF} then
+        BuildYMatrix(DSS, WHOLEMATRIX, FALSE);
+    if not SweepReady() then
+    begin
+        DoNormalSolution;
+        Exit;
+    end;
+
+    Iteration := 0;
+    repeat
+        Inc(Iteration);
+
+        if ckt.LogEvents then
+            DSS.LogThisEvent('Solution Iteration ' + IntToStr(Iteration));
+
+        ZeroInjCurr();
+        GetSourceInjCurrents();
+        GetPCInjCurr();
+
+        // The above call could change the primitive Y matrix, so have to check
+        if SystemYChanged {$IFDEF DSS_CAPI_INCREMENTAL_Y}or (ckt.IncrCktElements.Count <> 0){$ENDIF} then
+        begin
+            BuildYMatrix(DSS, WHOLEMATRIX, FALSE);
+            if not SweepReady() then
+            begin
+                DoNormalSolution;
+                Exit;
+            end;
+        end;
+        if UseAuxCurrents then
+            AddInAuxCurrents(NORMALSOLVE);
+
+        Sweep.Solve();
+        LoadsNeedUpdating := FALSE;
+    until (Converged and (Iteration >= MinIterations)) or (Iteration >= MaxIterations);
+end;
+
 procedure TSolutionObj.DoNewtonSolution;
 // Newton Iteration
 //
@@ -1014,6 +1116,8 @@ begin
     case Algorithm of
         NEWTONSOLVE:
             DoNewtonSolution;
+        SWEEPSOLVE:
+            DoSweepSolution;
         else // was NORMALSOLVE:
             DoNormalSolution;
     end;
@@ -1753,7 +1857,9 @@ procedure TSolutionObj.GetPCInjCurr(GFMOnly: Boolean = FALSE);
 var
     pElem: TDSSCktElement;
     valid, onGFM: Boolean;
+    t0: Int64;
 begin
+    t0 := DSS.SolverProfile.Start();
     for pElem in ckt.PCElements do
     begin
         onGFM := ((pElem is TInvBasedPCE) and (TInvBasedPCE(pElem).GFM_Mode));
@@ -1763,6 +1869,7 @@ begin
         if valid then
             pElem.InjCurrents(); // uses NodeRef to add current into InjCurr Array;
     end;
+    DSS.SolverProfile.Stop(TSolverProfilePhase.GetPCInjCurr, t0);
 end;
 
 procedure TSolutionObj.DumpProperties(F: TStream; Complete: Boolean; Leaf: Boolean);
@@ -1864,6 +1971,9 @@ begin
 
     if Complete then
     begin
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+        ApplyLowRankUpdates(DSS); // the matrix must include any pending low-rank corrections
+{$ENDIF}
         // get the compressed columns out of KLU
         FactorSparseMatrix(hY); // no extra work if already done
         GetNNZ(hY, @nNZ);
@@ -1931,18 +2041,23 @@ end;
 procedure TSolutionObj.SumAllCurrents;
 var
     pelem: TDSSCktElement;
+    t0: Int64;
 begin
+    t0 := DSS.SolverProfile.Start();
     for pelem in ckt.CktElements do
     begin
         pelem.SumCurrents;   // sum terminal currents into system Currents Array
     end;
+    DSS.SolverProfile.Stop(TSolverProfilePhase.SumAllCurrents, t0);
 end;
 
 procedure TSolutionObj.DoControlActions;
 var
     XHour: Integer;
     XSec: Double;
+    t0: Int64;
 begin
+    t0 := DSS.SolverProfile.Start();
     case ControlMode of
         CTRLSTATIC:
         begin  //  execute the nearest set of control actions but leaves time where it is
@@ -1969,21 +2084,27 @@ begin
                 ControlActionsDone := TRUE;
         end;
     end;
+    DSS.SolverProfile.Stop(TSolverProfilePhase.ControlActions, t0);
 end;
 
 procedure TSolutionObj.SampleControlDevices;
 var
     ControlDevice: TControlElem;
+    t0: Int64;
 begin
     ControlDevice := NIL;
+    t0 := DSS.SolverProfile.Start();
     try
-        // Sample all controls and set action times in control Queue
-        for ControlDevice in ckt.DSSControls do
-        begin
-            if ControlDevice.Enabled then
-                ControlDevice.Sample();
+        try
+            // Sample all controls and set action times in control Queue
+            for ControlDevice in ckt.DSSControls do
+            begin
+                if ControlDevice.Enabled then
+                    ControlDevice.Sample();
+            end;
+        finally
+            DSS.SolverProfile.Stop(TSolverProfilePhase.ControlSample, t0);
         end;
-
     except
         On E: Exception do
         begin
@@ -2320,13 +2441,33 @@ function TSolutionObj.SolveSystem(V: pNodeVArray): Integer;
 var
     iRes: LongWord;
     dRes: Double;
+    t0: Int64;
+    Phase: TSolverProfilePhase;
 begin
     Result := 0;
 
     // Note: NodeV[0] = 0 + j0 always.  Therefore, pass the address of the element 1 of the array.
     try
+        // KLU factors the matrix inside SolveSparseSet when it changed, so the
+        // first solve after a build of the system Y is counted as its
+        // factorization (KLUFactor or KLURefactor), factor and solve together.
+        Phase := TSolverProfilePhase.KLUSolve;
+        if DSS.SolverProfile.FactorPending then
+        begin
+            DSS.SolverProfile.FactorPending := False;
+            Phase := DSS.SolverProfile.PendingFactor;
+        end;
+        t0 := DSS.SolverProfile.Start();
 {$IFDEF DSS_CAPI_ADIAKOPTICS}
         if not ADiakoptics or (DSS.Parent = NIL) then
+{$ENDIF}
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+            if (LowRank.Rank <> 0) and (hY = hYsystem) then
+            begin
+                Result := LowRank.Solve(hY, pComplexArray(@V[1]), pComplexArray(@Currents[1])); // Base factorization + pending changes
+                Phase := TSolverProfilePhase.KLUSolve; // no refactorization
+            end
+            else
 {$ENDIF}
             Result := SolveSparseSet(hY, pComplexArray(@V[1]), pComplexArray(@Currents[1])) // Solve for present InjCurr
 {$IFDEF DSS_CAPI_ADIAKOPTICS}
@@ -2335,6 +2476,7 @@ begin
 {$ELSE}
         ;
 {$ENDIF}
+        DSS.SolverProfile.Stop(Phase, t0);
 
         if (DSS_CAPI_INFO_SPARSE_COND) then // Disabled by default with DSS C-API
         begin
@@ -2355,6 +2497,7 @@ begin
             DSS.SolutionAbort := TRUE;
         end;
     end;
+    Inc(DSS.SolutionGeneration);
 end;
 
 procedure TSolutionObj.Update_dblHour;
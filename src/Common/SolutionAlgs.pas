@@ -9,7 +9,7 @@ unit SolutionAlgs;
 
 interface
 
-uses DSSClass, ArrayDef, PCElement, Solution, Circuit, Bus;
+uses DSSClass, ArrayDef, PCElement, Solution, Circuit, Bus, LoadShape;
 
 type
     TSolutionAlgs = class helper for TSolutionObj
@@ -35,19 +35,25 @@ type
 
         procedure ComputeYsc(pBus: TDSSBus);
         procedure ComputeAllYsc;
+        function FastFaultVoltages(var Voltages: ArrayOfDouble): Boolean;
+        function ValidateFastFaults: Double;
         procedure IntegratePCStates;
         procedure EndOfTimeStepCleanup();
         procedure FinishTimeStep;
         property ckt: TDSSCircuit read get_ckt;
     private
         procedure Show10PctProgress(i, N: Integer);
-        procedure PickAFault;
+        function PickAFault(SetEnabled: Boolean = True): Integer;
+        procedure EnableOnlyFault(Whichone: Integer);
         procedure AllocateAllSCParms;
         procedure ComputeIsc;
         procedure DisableAllFaults;
         procedure AddFrequency(var FreqList: ArrayOfDouble; var NumFreq, MaxFreq: Integer; F: Double);
         function GetSourceFrequency(pc: TPCElement): Double;
         procedure CollectAllFrequencies(var FreqList: ArrayOfDouble);
+        function CanSolveBatched(): Boolean;
+        function SolveBatchedSteps(NumSteps: Integer; Shape: TLoadShapeObj; UsePrice: Boolean; TwoPct: Integer): Integer;
+        function SolveDynamicStep(): Double;
     end;
 
 implementation
@@ -65,6 +71,14 @@ uses
     Vsource,
     Isource,
     KLUSolve,
+    FastFault,
+    BatchSolve,
+    Monitor,
+    CktElement,
+    InvBasedPCE,
+{$IFDEF MSWINDOWS}
+    Windows,
+{$ENDIF}
     DSSHelper;
 
 function TSolutionAlgs.get_ckt(): TDSSCircuit;
@@ -109,9 +123,194 @@ begin
     end;
 end;
 
+function TSolutionAlgs.CanSolveBatched(): Boolean;
+// The steps are independent direct solutions with a fixed system Y matrix:
+// admittance load model, nothing that reacts to the solution of the previous
+// step (controls, grid-forming inverters, storage elements, which change their
+// state at the end of each step), no faults that the control iterations of
+// SolveSnap could apply or clear (Check_Fault_Status) and no callbacks that
+// could change the circuit between steps.
+var
+    pElem: TDSSCktElement;
+    pFault: TFaultObj;
+    evt: TAltDSSEvent;
+begin
+    Result := False;
+    if (BatchSize < 2) or (LoadModel <> ADMITTANCE) or IsDynamicModel or IsHarmonicModel then
+        Exit;
+{$IFDEF DSS_CAPI_ADIAKOPTICS}
+    if ADiakoptics then
+        Exit;
+{$ENDIF}
+    for pElem in ckt.DSSControls do
+        if pElem.Enabled then
+            Exit;
+    for pElem in ckt.PCElements do
+        if pElem.Enabled and (pElem is TInvBasedPCE) and TInvBasedPCE(pElem).GFM_Mode then
+            Exit;
+    for pElem in ckt.StorageElements do
+        if pElem.Enabled then
+            Exit;
+    if ControlMode <> CTRLSTATIC then
+        for pFault in ckt.Faults do
+            if pFault.Enabled then
+                Exit;
+    for evt := Low(TAltDSSEvent) to High(TAltDSSEvent) do
+        if Length(DSS.DSSAltEventCallbacks[evt]) <> 0 then
+            Exit;
+    Result := True;
+end;
+
+function TSolutionAlgs.SolveBatchedSteps(NumSteps: Integer; Shape: TLoadShapeObj; UsePrice: Boolean; TwoPct: Integer): Integer;
+// Batched time series (see BatchSolve): the injection currents of up to
+// BatchSize steps are built first and solved together, using BatchThreads
+// workers, then the monitors and meters take their samples step by step, as
+// in the normal loop. Returns the number of steps done; the normal loop
+// continues from there if the batched path cannot be used, or if the system Y
+// changes while building a batch or at the end of a step (the remaining steps
+// of the batch used the old Y). Each step reports an equal share of the time
+// of its batch as Solve_Time_Elapsed. The progress is updated as in the
+// normal loops; TwoPct = 0 only updates ActorPctProgress.
+type
+    TStepTime = record
+        t, dblHour: Double;
+        intHour: Integer;
+        HourMult: Complex;
+        PriceSignal: Double;
+    end;
+var
+    Batch: TBatchSolver;
+    Times: Array of TStepTime;
+    K, s, NumNodes: Integer;
+    BatchStartTime, StepTicks: Int64;
+
+    function Ticks(): Int64;
+    begin
+{$IFDEF MSWINDOWS}
+        QueryPerformanceCounter(Result);
+{$ELSE}
+        Result := GetTickCount64;
+{$ENDIF}
+    end;
+
+    procedure SaveTime(var st: TStepTime);
+    begin
+        st.t := DynaVars.t;
+        st.dblHour := DynaVars.dblHour;
+        st.intHour := DynaVars.intHour;
+        st.HourMult := ckt.DefaultHourMult;
+        st.PriceSignal := ckt.PriceSignal;
+    end;
+
+    procedure RestoreTime(const st: TStepTime);
+    begin
+        DynaVars.t := st.t;
+        DynaVars.dblHour := st.dblHour;
+        DynaVars.intHour := st.intHour;
+        ckt.DefaultHourMult := st.HourMult;
+        ckt.PriceSignal := st.PriceSignal;
+    end;
+
+begin
+    Result := 0;
+    if not CanSolveBatched() then
+        Exit;
+
+    Batch := TBatchSolver.Create(DSS);
+    try
+        SetLength(Times, BatchSize + 1);
+        while (Result < NumSteps) and not DSS.SolutionAbort do
+        begin
+            if SystemYChanged or (not Batch.Prepared()) then
+            begin
+                if SystemYChanged then
+                    BuildYMatrix(DSS, WHOLEMATRIX, TRUE);
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+                ApplyLowRankUpdates(DSS); // the batch uses the factorization directly
+{$ENDIF}
+                try
+                    Batch.Prepare(BatchSize, BatchThreads);
+                except
+                    on E: EEsolv32Problem do
+                    begin
+                        DoSimpleMsg(DSS, 'From SolveBatchedSteps: %s', [CRLF + E.Message + CheckYMatrixforZeroes(ckt)], 20240750);
+                        raise ESolveError.Create('Aborting');
+                    end;
+                end;
+            end;
+            NumNodes := ckt.NumNodes;
+
+            K := Min(BatchSize, NumSteps - Result);
+            BatchStartTime := Ticks();
+            SaveTime(Times[0]);
+            for s := 1 to K do
+            begin
+                IncrementTime();
+                ckt.DefaultHourMult := Shape.GetMultAtHour(DynaVars.dblHour);
+                if UsePrice and (ckt.PriceCurveObj <> NIL) then
+                    ckt.PriceSignal := ckt.PriceCurveObj.GetPrice(DynaVars.dblHour);
+                SnapShotInit();
+                ZeroInjCurr;
+                GetSourceInjCurrents;
+                Move(Currents[1], Batch.B[s - 1][1], NumNodes * SizeOf(Complex));
+                SaveTime(Times[s]);
+            end;
+            if SystemYChanged or DSS.SolutionAbort then
+            begin
+                RestoreTime(Times[0]);
+                Exit;
+            end;
+
+            try
+                Batch.Solve(K);
+            except
+                on E: Exception do
+                begin
+                    DoSimpleMsg(DSS, 'From SolveBatchedSteps: %s', [CRLF + E.Message + CheckYMatrixforZeroes(ckt)], 20240750);
+                    raise ESolveError.Create('Aborting');
+                end;
+            end;
+            StepTicks := (Ticks() - BatchStartTime) div K;
+
+            for s := 1 to K do
+            begin
+                RestoreTime(Times[s]);
+                // Timers, as if the step started its share of the batch ago
+                SolveStartTime := Ticks() - StepTicks;
+                Solve_Time_Elapsed := (StepTicks / CPU_Freq) * 1000000;
+                Move(Batch.X[s - 1][1], NodeV[1], NumNodes * SizeOf(Complex));
+                Move(Batch.B[s - 1][1], Currents[1], NumNodes * SizeOf(Complex));
+                // Same bookkeeping as a direct solution
+                Inc(SolutionCount);
+                Inc(DSS.SolutionGeneration);
+                Iteration := 1;
+                LastSolutionWasDirect := TRUE;
+                ConvergedFlag := TRUE;
+                ckt.IsSolved := TRUE;
+
+                DSS.MonitorClass.SampleAll();  // Make all monitors take a sample
+                if SampleTheMeters then
+                    DSS.EnergyMeterClass.SampleAll(); // Make all Energy Meters take a sample
+                EndOfTimeStepCleanup();
+                Inc(Result);
+{$IFDEF DSS_CAPI_PM}
+                DSS.ActorPctProgress := (Result * 100) div NumberOfTimes;
+{$ELSE}
+                if (TwoPct > 0) and ((Result mod TwoPct) = 0) then
+                    DSS.ShowPctProgress((Result * 100) div NumberOfTimes);
+{$ENDIF}
+                if SystemYChanged then
+                    Exit;
+            end;
+        end;
+    finally
+        Batch.Free;
+    end;
+end;
+
 function TSolutionAlgs.SolveYearly: Integer;
 var
-    N, Twopct: Integer;
+    N, Twopct, NumBatched: Integer;
 begin
     Result := 0;
     ProgressCount := 0;
@@ -127,7 +326,8 @@ begin
         if not DSS.DIFilesAreOpen then
             DSS.EnergyMeterClass.OpenAllDIFiles();   // Open Demand Interval Files, if desired   Creates DI_Totals
         Twopct := Max(NumberOfTimes div 50, 1);
-        for N := 1 to NumberOfTimes do
+        NumBatched := SolveBatchedSteps(NumberOfTimes, ckt.DefaultYearlyShapeObj, TRUE, Twopct);
+        for N := NumBatched + 1 to NumberOfTimes do
             if not DSS.SolutionAbort then
                 with Dynavars do
                 begin
@@ -162,7 +362,7 @@ function TSolutionAlgs.SolveDaily: Integer;
 // Stepsize defaults to 1 hr and number of times = 24.
 // Load is modified by yearly growth, time of day, and global load multiplier.
 var
-    N: Integer;
+    N, NumBatched: Integer;
 begin
     Result := 0;
 
@@ -175,7 +375,8 @@ begin
         if not DSS.DIFilesAreOpen then
             DSS.EnergyMeterClass.OpenAllDIFiles();   // Append Demand Interval Files, if desired
 
-        for N := 1 to NumberOfTimes do
+        NumBatched := SolveBatchedSteps(NumberOfTimes, ckt.DefaultDailyShapeObj, TRUE, 0);
+        for N := NumBatched + 1 to NumberOfTimes do
             if not DSS.SolutionAbort then
                 with DynaVars do
                 begin
@@ -248,7 +449,7 @@ end;
 
 function TSolutionAlgs.SolveDuty: Integer;
 var
-    N, TwoPct: Integer;
+    N, TwoPct, NumBatched: Integer;
 begin
     Result := 0;
 
@@ -265,7 +466,8 @@ begin
     TwoPct := Max(1, NumberOfTimes div 50);
     try
         IntervalHrs := DynaVars.h / 3600.0;  // needed for energy meters and storage devices
-        for N := 1 to NumberOfTimes do
+        NumBatched := SolveBatchedSteps(NumberOfTimes, ckt.DefaultDailyShapeObj, FALSE, TwoPct);
+        for N := NumBatched + 1 to NumberOfTimes do
             if not DSS.SolutionAbort then
                 with DynaVars do
                 begin
@@ -330,36 +532,84 @@ begin
     end;
 end;
 
+function TSolutionAlgs.SolveDynamicStep(): Double;
+// One predictor-corrector step of the Dynamics mode, with the present DynaVars.h.
+// Returns the difference between the predicted and corrected states if the
+// adaptive step is enabled, zero otherwise.
+begin
+    Result := 0;
+    with DynaVars do
+    begin
+        IncrementTime();
+        ckt.DefaultHourMult := ckt.DefaultDailyShapeObj.GetMultAtHour(dblHour);
+        // Assume price signal stays constant for dynamic calcs
+        // Predictor
+        IterationFlag := 0;
+        Integrator.IntegrateStates(DynamicsThreads);
+        if DynamicsTolerance > 0 then
+            Integrator.SavePredicted();
+        SolveSnap();
+        // Corrector
+        IterationFlag := 1;
+        Integrator.IntegrateStates(DynamicsThreads);
+        if DynamicsTolerance > 0 then
+            Result := Integrator.CorrectorError();
+        // Full solution with controls; when no element changed the system Y
+        // since the predictor, its factorization is reused (see SolveSystem)
+        SolveSnap();
+    end;
+end;
+
 function TSolutionAlgs.SolveDynamic: Integer;
 var
     N: Integer;
+    h0, hMin, hMax, Remaining, StepError: Double;
 begin
     Result := 0;
-
+    h0 := DynaVars.h;
+    Integrator.Prepare();
     try
         SolutionInitialized := TRUE; // If we're in dynamics mode, no need to re-initialize.
-        IntervalHrs := DynaVars.h / 3600.0;  // needed for energy meters and storage devices
-        for N := 1 to NumberOfTimes do
-            if not DSS.SolutionAbort then
-                with DynaVars do
+        if DynamicsTolerance <= 0 then
+        begin
+            IntervalHrs := DynaVars.h / 3600.0;  // needed for energy meters and storage devices
+            for N := 1 to NumberOfTimes do
+                if not DSS.SolutionAbort then
                 begin
-                    IncrementTime();
-                    ckt.DefaultHourMult := ckt.DefaultDailyShapeObj.GetMultAtHour(dblHour);
-                    // Assume price signal stays constant for dynamic calcs
-                    // Predictor
-                    IterationFlag := 0;
-                    IntegratePCStates();
-                    SolveSnap();
-                    // Corrector
-                    IterationFlag := 1;
-                    IntegratePCStates();
-                    SolveSnap();
+                    SolveDynamicStep();
                     DSS.MonitorClass.SampleAll();  // Make all monitors take a sample
 
                     EndOfTimeStepCleanup();
-
                 end;
+            Exit;
+        end;
+
+        // Adaptive step: covers the same interval (NumberOfTimes * h), sizing
+        // each step from the error of the previous one. A step is never
+        // repeated, since the PC elements cannot restore their previous states.
+        hMin := IfThen(DynamicsMinStep > 0, DynamicsMinStep, h0 / 100);
+        hMax := Max(hMin, IfThen(DynamicsMaxStep > 0, DynamicsMaxStep, 10 * h0));
+        DynaVars.h := EnsureRange(h0, hMin, hMax);
+        Remaining := NumberOfTimes * h0;
+        while (Remaining > 1e-9 * h0) and not DSS.SolutionAbort do
+        begin
+            DynaVars.h := Min(DynaVars.h, Remaining);
+            IntervalHrs := DynaVars.h / 3600.0;
+            StepError := SolveDynamicStep();
+            Remaining := Remaining - DynaVars.h;
+            DSS.MonitorClass.SampleAll();
+
+            EndOfTimeStepCleanup();
+
+            if StepError > 0 then
+                DynaVars.h := DynaVars.h * EnsureRange(0.9 * Sqrt(DynamicsTolerance / StepError), 0.5, 2.0)
+            else
+                DynaVars.h := DynaVars.h * 2.0;
+            DynaVars.h := EnsureRange(DynaVars.h, hMin, hMax);
+        end;
     finally
+        DynaVars.h := h0;
+        IntervalHrs := h0 / 3600.0;
         DSS.MonitorClass.SaveAll();
     end;
 end;
@@ -698,35 +948,55 @@ begin
     end;
 end;
 
-procedure TSolutionAlgs.PickAFault;
+function TSolutionAlgs.PickAFault(SetEnabled: Boolean): Integer;
 // Enable one of the faults in the circuit.  Disable the rest
+// If SetEnabled is false, only pick the fault (for the fast path)
 var
-    NumFaults, i, Whichone: Integer;
-    FaultObj: TFaultObj;
+    NumFaults, Whichone: Integer;
 begin
     NumFaults := ckt.Faults.Count;
     Whichone := Trunc(Random * NumFaults) + 1;
     if Whichone > NumFaults then
         Whichone := NumFaults;
 
-    for i := 1 to NumFaults do
+    DSS.ActiveFaultObj := ckt.Faults.Get(Whichone); // in Fault Unit
+    if SetEnabled then
+        EnableOnlyFault(Whichone);
+    Result := Whichone;
+end;
+
+procedure TSolutionAlgs.EnableOnlyFault(Whichone: Integer);
+var
+    i: Integer;
+    FaultObj: TFaultObj;
+begin
+    for i := 1 to ckt.Faults.Count do
     begin
         FaultObj := ckt.Faults.Get(i);
-        if i = Whichone then
-        begin
-            DSS.ActiveFaultObj := FaultObj; // in Fault Unit
-            FaultObj.Enabled := TRUE;
-        end
-        else
-            FaultObj.Enabled := FALSE;
+        FaultObj.Enabled := (i = Whichone);
     end;
 end;
 
 function TSolutionAlgs.SolveMonteFault: Integer;
 var
-    N: Integer;
+    N, Whichone: Integer;
+    FastSolver: TFastFaultSolver;
+
+    function MonitorOnFault(): Boolean;
+    var
+        Mon: TMonitorObj;
+    begin
+        Result := True;
+        for Mon in ckt.Monitors do
+            if Mon.Enabled and (Mon.MeteredElement is TFaultObj) then
+                Exit;
+        Result := False;
+    end;
+
 begin
     Result := 0;
+    FastSolver := NIL;
+    Whichone := 0;
     try
         LoadModel := ADMITTANCE;   // All Direct solution
         ckt.LoadMultiplier := 1.0;    // Always set LoadMultiplier WITH prop in case matrix must be rebuilt
@@ -745,13 +1015,37 @@ begin
 
         SetGeneratorDispRef();
 
+        if FastMonteFault and (ckt.Faults.Count > 0) and not MonitorOnFault() then
+        begin
+            // Solve once without faults; each case is then a low-rank update
+            // of this solution. Falls back to the full solution if any fault
+            // cannot be evaluated that way. The faults stay disabled while the
+            // monitors sample, so a monitor on a Fault would record zero; the
+            // full solution is used in that case too.
+            DisableAllFaults();
+            SolveDirect();
+            FastSolver := TFastFaultSolver.Create(DSS);
+            if not FastSolver.Prepare() then
+                FreeAndNil(FastSolver);
+        end;
+
         for N := 1 to NumberOfTimes do
             if not DSS.SolutionAbort then
             begin
                 Inc(DynaVars.intHour);
-                PickAFault();  // Randomly enable one of the faults
-                DSS.ActiveFaultObj.Randomize();  // Randomize the fault resistance
-                SolveDirect();
+                if FastSolver = NIL then
+                begin
+                    PickAFault();  // Randomly enable one of the faults
+                    DSS.ActiveFaultObj.Randomize();  // Randomize the fault resistance
+                    SolveDirect();
+                end
+                else
+                begin
+                    Whichone := PickAFault(False);
+                    DSS.ActiveFaultObj.Randomize();
+                    if not FastSolver.Apply(Whichone) then
+                        raise EEsolv32Problem.Create(Format(_('Singular post-fault system for fault "%s".'), [DSS.ActiveFaultObj.FullName]));
+                end;
                 DSS.MonitorClass.SampleAll();  // Make all monitors take a sample
 {$IFDEF DSS_CAPI_PM}
                 DSS.ActorPctProgress := (N * 100) div NumberOfTimes;
@@ -760,6 +1054,13 @@ begin
 {$ENDIF}
             end;
     finally
+        if FastSolver <> NIL then
+        begin
+            // Leave the fault states as in the full solution
+            if Whichone <> 0 then
+                EnableOnlyFault(Whichone);
+            FastSolver.Free();
+        end;
         DSS.MonitorClass.SaveAll();
 {$IFNDEF DSS_CAPI_PM}
         DSS.ProgressHide();
@@ -819,6 +1120,9 @@ procedure TSolutionAlgs.ComputeAllYsc;
 var
     iB, j: Integer;
 begin
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    ApplyLowRankUpdates(DSS); // the columns are computed directly from the factorization
+{$ENDIF}
     for j := 1 to ckt.NumNodes do
         Currents[j] := 0;
 
@@ -849,6 +1153,100 @@ begin
     end
 end;
 
+function TSolutionAlgs.FastFaultVoltages(var Voltages: ArrayOfDouble): Boolean;
+// Node voltages with each fault of the circuit applied alone, evaluated as
+// low-rank updates of the solution without faults (see TFastFaultSolver).
+// One column of NumNodes complex values per fault, in the order of ckt.Faults.
+// The fault states and load model are restored; NodeV is left with the
+// solution without faults. Returns False if the fast path is not applicable.
+var
+    FastSolver: TFastFaultSolver;
+    SavedEnabled: Array of Boolean;
+    SavedLoadModel, NumNodes, i: Integer;
+    Vpre: ArrayOfComplex;
+begin
+    Result := False;
+    SetLength(Voltages, 0);
+    SetLength(SavedEnabled, ckt.Faults.Count);
+    for i := 1 to ckt.Faults.Count do
+        SavedEnabled[i - 1] := TFaultObj(ckt.Faults.Get(i)).Enabled;
+    SavedLoadModel := LoadModel;
+
+    FastSolver := TFastFaultSolver.Create(DSS);
+    try
+        LoadModel := ADMITTANCE;
+        DisableAllFaults();
+        SolveDirect();
+        if not FastSolver.Prepare() then
+            Exit;
+
+        NumNodes := ckt.NumNodes;
+        SetLength(Vpre, NumNodes + 1);
+        Move(NodeV[0], Vpre[0], (NumNodes + 1) * SizeOf(Complex));
+        SetLength(Voltages, 2 * NumNodes * ckt.Faults.Count);
+        for i := 1 to ckt.Faults.Count do
+        begin
+            if not FastSolver.Apply(i) then
+            begin
+                SetLength(Voltages, 0);
+                Exit;
+            end;
+            Move(NodeV[1], Voltages[2 * NumNodes * (i - 1)], NumNodes * SizeOf(Complex));
+        end;
+        Move(Vpre[0], NodeV[0], (NumNodes + 1) * SizeOf(Complex));
+        Result := True;
+    finally
+        FastSolver.Free();
+        for i := 1 to ckt.Faults.Count do
+            TFaultObj(ckt.Faults.Get(i)).Enabled := SavedEnabled[i - 1];
+        LoadModel := SavedLoadModel;
+        SystemYChanged := True;
+    end;
+end;
+
+function TSolutionAlgs.ValidateFastFaults: Double;
+// Compares FastFaultVoltages to full solutions with each fault enabled alone.
+// Returns the largest node voltage difference, relative to the node voltage
+// magnitude without faults (or in volts, below 1 V), or -1 if the fast path
+// is not applicable. The fault states and load model are restored.
+var
+    Voltages: ArrayOfDouble;
+    Vmag: ArrayOfDouble;
+    SavedEnabled: Array of Boolean;
+    SavedLoadModel, NumNodes, i, r, offset: Integer;
+begin
+    Result := -1;
+    if (ckt.Faults.Count = 0) or not FastFaultVoltages(Voltages) then
+        Exit;
+
+    NumNodes := ckt.NumNodes;
+    SetLength(Vmag, NumNodes + 1);
+    for r := 1 to NumNodes do
+        Vmag[r] := Max(Cabs(NodeV[r]), 1.0);
+
+    SetLength(SavedEnabled, ckt.Faults.Count);
+    for i := 1 to ckt.Faults.Count do
+        SavedEnabled[i - 1] := TFaultObj(ckt.Faults.Get(i)).Enabled;
+    SavedLoadModel := LoadModel;
+    try
+        LoadModel := ADMITTANCE;
+        Result := 0;
+        for i := 1 to ckt.Faults.Count do
+        begin
+            EnableOnlyFault(i);
+            SolveDirect();
+            offset := 2 * NumNodes * (i - 1);
+            for r := 1 to NumNodes do
+                Result := Max(Result, Cabs(NodeV[r] - Cmplx(Voltages[offset + 2 * r - 2], Voltages[offset + 2 * r - 1])) / Vmag[r]);
+        end;
+    finally
+        for i := 1 to ckt.Faults.Count do
+            TFaultObj(ckt.Faults.Get(i)).Enabled := SavedEnabled[i - 1];
+        LoadModel := SavedLoadModel;
+        SystemYChanged := True;
+    end;
+end;
+
 function TSolutionAlgs.SolveFaultStudy: Integer;
 begin
     Result := 0;
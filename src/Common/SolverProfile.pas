@@ -0,0 +1,167 @@
+unit SolverProfile;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Optional, low-overhead timers and counters for the solver hot paths.
+//
+// Each DSS context owns a TSolverProfile. When disabled (the default), each
+// instrumented section only costs a boolean test. When enabled, the number of
+// calls and the accumulated time of each phase are collected until Reset is
+// called, including the number of YPrim recalculations per DSS class.
+// The data is exposed through the Solution_*Profile* functions in the C-API.
+
+interface
+
+type
+{$SCOPEDENUMS ON}
+    TSolverProfilePhase = (
+        BuildYFull = 0,
+        BuildYIncremental,
+        KLUFactor,
+        KLURefactor,
+        KLUSolve,
+        GetPCInjCurr,
+        SumAllCurrents,
+        ControlSample,
+        ControlActions,
+        MonitorSample,
+        MeterSample
+    );
+{$SCOPEDENUMS OFF}
+
+    TSolverProfile = class(TObject)
+    public
+        Enabled: Boolean;
+        Counts: Array[TSolverProfilePhase] of Int64;
+        Ticks: Array[TSolverProfilePhase] of Int64;
+        YPrimCounts: Array of Int64; // indexed by DSSClassIndex
+        PendingFactor: TSolverProfilePhase; // KLUFactor or KLURefactor, set by BuildYMatrix
+        FactorPending: Boolean;
+
+        constructor Create;
+        procedure Reset();
+        function Start(): Int64; inline;
+        procedure Stop(Phase: TSolverProfilePhase; StartTicks: Int64); inline;
+        procedure CountYPrim(ClassIndex: Integer); inline;
+    end;
+
+const
+    SolverProfilePhaseNames: Array[TSolverProfilePhase] of String = (
+        'BuildYFull',
+        'BuildYIncremental',
+        'KLUFactor',
+        'KLURefactor',
+        'KLUSolve',
+        'GetPCInjCurr',
+        'SumAllCurrents',
+        'ControlSample',
+        'ControlActions',
+        'MonitorSample',
+        'MeterSample'
+    );
+
+function ProfileTicks(): Int64;
+function ProfileTicksToMicroseconds(Ticks: Int64): Double;
+
+implementation
+
+uses
+{$IFDEF MSWINDOWS}
+    Windows;
+{$ELSE}
+{$IFDEF LINUX}
+    Linux,
+{$ENDIF}
+    BaseUnix,
+    Unix;
+{$ENDIF}
+
+var
+    TicksPerMicrosecond: Double;
+
+function ProfileTicks(): Int64;
+{$IFDEF MSWINDOWS}
+begin
+    QueryPerformanceCounter(Result);
+end;
+{$ELSE}
+{$IFDEF LINUX}
+var
+    ts: TTimeSpec;
+begin
+    clock_gettime(CLOCK_MONOTONIC, @ts);
+    Result := Int64(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+end;
+{$ELSE}
+var
+    tv: TTimeVal;
+begin
+    fpgettimeofday(@tv, NIL);
+    Result := Int64(tv.tv_sec) * 1000000 + tv.tv_usec;
+end;
+{$ENDIF}
+{$ENDIF}
+
+function ProfileTicksToMicroseconds(Ticks: Int64): Double;
+begin
+    Result := Ticks / TicksPerMicrosecond;
+end;
+
+constructor TSolverProfile.Create;
+begin
+    inherited Create;
+    Enabled := False;
+    Reset();
+end;
+
+procedure TSolverProfile.Reset();
+begin
+    FillChar(Counts, SizeOf(Counts), 0);
+    FillChar(Ticks, SizeOf(Ticks), 0);
+    SetLength(YPrimCounts, 0);
+    FactorPending := False;
+end;
+
+function TSolverProfile.Start(): Int64;
+begin
+    if Enabled then
+        Result := ProfileTicks()
+    else
+        Result := 0;
+end;
+
+procedure TSolverProfile.Stop(Phase: TSolverProfilePhase; StartTicks: Int64);
+begin
+    if (not Enabled) or (StartTicks = 0) then // StartTicks is 0 if enabled after Start
+        Exit;
+    Inc(Counts[Phase]);
+    Inc(Ticks[Phase], ProfileTicks() - StartTicks);
+end;
+
+procedure TSolverProfile.CountYPrim(ClassIndex: Integer);
+begin
+    if (not Enabled) or (ClassIndex < 0) then
+        Exit;
+    if ClassIndex >= Length(YPrimCounts) then
+        SetLength(YPrimCounts, ClassIndex + 1); // new entries are zero-filled
+    Inc(YPrimCounts[ClassIndex]);
+end;
+
+{$IFDEF MSWINDOWS}
+var
+    freq: Int64;
+initialization
+    QueryPerformanceFrequency(freq);
+    TicksPerMicrosecond := freq / 1000000;
+{$ELSE}
+initialization
+{$IFDEF LINUX}
+    TicksPerMicrosecond := 1000;
+{$ELSE}
+    TicksPerMicrosecond := 1;
+{$ENDIF}
+{$ENDIF}
+end.
@@ -0,0 +1,301 @@
+unit SparseExport;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Sparse exports of the system Y matrix and of the primitive Y matrices
+// (export Y / export Yprims), and the snapshot of the system Y in compressed
+// sparse column (CSC) form used by these exports and by YMatrix_Get_CSCView.
+//
+// KLU only copies its matrix out, so the snapshot is taken once per build of
+// the system Y (DSS.YGeneration) and kept in DSS.SystemYSnapshot. The exports
+// write it as it is, column by column, and the C API returns pointers to its
+// arrays, which are valid until the next rebuild.
+//
+// Binary Y file (.bin), in native byte order:
+//   'DSSYCSC1', UInt32 number of nodes (N), UInt32 number of non-zeros (NNZ),
+//   N node names (UInt32 length + characters), N + 1 UInt32 column pointers,
+//   NNZ UInt32 row indices (0-based), NNZ complex values (2 Doubles each).
+// Binary Yprims file (.bin), in native byte order:
+//   'DSSYPRM1', then one block per element up to the end of the file: element
+//   name (UInt32 length + characters), UInt32 order (M), M UInt32 node numbers
+//   (0 = ground), M * M complex values (column-major).
+// Matrix Market files (.mtx) use the "coordinate complex general" format, with
+// 1-based indices. The node names, or the element of each diagonal block of
+// the Yprims, are listed in the comment lines.
+
+interface
+
+uses
+    UComplex, DSSUcomplex,
+    DSSClass;
+
+type
+{$SCOPEDENUMS ON}
+    TSparseExportFormat = (
+        Dense = 0, // text, the original formats
+        Triplet = 1, // text, lower triangle of the system Y
+        MatrixMarket = 2,
+        Binary = 3
+    );
+{$SCOPEDENUMS OFF}
+
+    TSystemYSnapshot = class(TObject)
+    public
+        Handle: NativeUInt;
+        Generation: UInt64;
+        NumNodes, NumNZ: LongWord;
+        ColPtr, RowIdx: Array of LongWord;
+        Values: Array of Complex;
+    end;
+
+// Returns the snapshot of the active Y matrix, updated if the matrix was
+// rebuilt since it was taken. Returns NIL if the Y matrix was not built.
+function GetSystemYSnapshot(DSS: TDSSContext): TSystemYSnapshot;
+
+// Write the Matrix Market and Binary formats; set DSS.GlobalResult to the
+// file written (".mtx" or ".bin" extension), or to '' on errors.
+procedure ExportSystemYSparse(DSS: TDSSContext; FileNm: String; Fmt: TSparseExportFormat);
+procedure ExportYprimSparse(DSS: TDSSContext; FileNm: String; Fmt: TSparseExportFormat);
+
+implementation
+
+uses
+    Classes,
+    SysUtils,
+    BufStream,
+    Circuit,
+    CktElement,
+    PDElement,
+    PCElement,
+    DSSGlobals,
+    DSSHelper,
+    Utilities,
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    Ymatrix,
+{$ENDIF}
+    KLUSolve;
+
+function GetSystemYSnapshot(DSS: TDSSContext): TSystemYSnapshot;
+var
+    hY: NativeUInt;
+begin
+    Result := NIL;
+    if (DSS.ActiveCircuit = NIL) or (DSS.ActiveCircuit.Solution = NIL) then
+        Exit;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    ApplyLowRankUpdates(DSS); // the matrix must include any pending low-rank corrections
+{$ENDIF}
+    hY := DSS.ActiveCircuit.Solution.hY;
+    if hY <= 0 then
+    begin
+        DoSimpleMsg(DSS, _('Y Matrix not Built.'), 222);
+        Exit;
+    end;
+
+    if DSS.SystemYSnapshot = NIL then
+        DSS.SystemYSnapshot := TSystemYSnapshot.Create();
+    Result := TSystemYSnapshot(DSS.SystemYSnapshot);
+    if (Result.Handle = hY) and (Result.Generation = DSS.YGeneration) then
+        Exit;
+
+    // Another matrix is active (e.g. the series Y, during a solution); the
+    // views of the previous one are not valid anymore.
+    if (Result.Handle <> 0) and (Result.Handle <> hY) then
+        Inc(DSS.YGeneration);
+
+    // this compresses the entries if necessary - no extra work if already solved
+    FactorSparseMatrix(hY);
+    GetNNZ(hY, @Result.NumNZ);
+    GetSize(hY, @Result.NumNodes);
+    SetLength(Result.ColPtr, Result.NumNodes + 1);
+    SetLength(Result.RowIdx, Result.NumNZ + 1); // never empty, to take the address
+    SetLength(Result.Values, Result.NumNZ + 1);
+    GetCompressedMatrix(hY, Result.NumNodes + 1, Result.NumNZ, @Result.ColPtr[0], @Result.RowIdx[0], @Result.Values[0]);
+    Result.Handle := hY;
+    Result.Generation := DSS.YGeneration;
+end;
+
+procedure WriteUInt32(F: TStream; Value: LongWord); inline;
+begin
+    F.WriteBuffer(Value, SizeOf(Value));
+end;
+
+procedure WriteName(F: TStream; const Name: AnsiString);
+begin
+    WriteUInt32(F, Length(Name));
+    if Length(Name) > 0 then
+        F.WriteBuffer(Name[1], Length(Name));
+end;
+
+function NodeName(Ckt: TDSSCircuit; i: Integer): String;
+begin
+    with Ckt.MapNodeToBus^[i] do
+        Result := Format('%s.%d', [AnsiUpperCase(Ckt.BusList.NameOfIndex(BusRef)), NodeNum]);
+end;
+
+function IsYprimExported(Elem: TDSSCktElement): Boolean; inline;
+begin
+    Result := Elem.Enabled and ((Elem is TPDElement) or (Elem is TPCElement));
+end;
+
+function ElementName(Elem: TDSSCktElement): String;
+begin
+    Result := Elem.ParentClass.Name + '.' + AnsiUpperCase(Elem.Name);
+end;
+
+procedure ExportSystemYSparse(DSS: TDSSContext; FileNm: String; Fmt: TSparseExportFormat);
+var
+    F: TStream = NIL;
+    Snapshot: TSystemYSnapshot;
+    Ckt: TDSSCircuit;
+    i, j, p: LongWord;
+begin
+    DSS.GlobalResult := '';
+    Ckt := DSS.ActiveCircuit;
+    Snapshot := GetSystemYSnapshot(DSS);
+    if Snapshot = NIL then
+        Exit;
+    if Snapshot.NumNodes <> LongWord(Ckt.NumNodes) then
+    begin
+        DoSimpleMsg(DSS, _('The Y matrix does not match the nodes of the circuit. Solve the circuit before exporting it.'), 20240765);
+        Exit;
+    end;
+
+    if Fmt = TSparseExportFormat.Binary then
+        FileNm := ChangeFileExt(FileNm, '.bin')
+    else
+        FileNm := ChangeFileExt(FileNm, '.mtx');
+
+    try
+        F := TBufferedFileStream.Create(FileNm, fmCreate);
+        with Snapshot do
+            if Fmt = TSparseExportFormat.Binary then
+            begin
+                FSWrite(F, 'DSSYCSC1');
+                WriteUInt32(F, NumNodes);
+                WriteUInt32(F, NumNZ);
+                for i := 1 to NumNodes do
+                    WriteName(F, NodeName(Ckt, i));
+                F.WriteBuffer(ColPtr[0], (NumNodes + 1) * SizeOf(LongWord));
+                F.WriteBuffer(RowIdx[0], NumNZ * SizeOf(LongWord));
+                F.WriteBuffer(Values[0], NumNZ * SizeOf(Complex));
+            end
+            else
+            begin
+                FSWriteln(F, '%%MatrixMarket matrix coordinate complex general');
+                FSWriteln(F, Format('%% System Y matrix of circuit "%s", in node order', [Ckt.Name]));
+                for i := 1 to NumNodes do
+                    FSWriteln(F, Format('%% node %d %s', [i, NodeName(Ckt, i)]));
+                FSWriteln(F, Format('%d %d %d', [NumNodes, NumNodes, NumNZ]));
+                // traverse the compressed column format; KLU indices are 0-based
+                for j := 0 to NumNodes - 1 do
+                    for p := ColPtr[j] to ColPtr[j + 1] - 1 do
+                    begin
+                        i := RowIdx[p];
+                        FSWriteln(F, Format('%d %d %.17g %.17g', [i + 1, j + 1, Values[p].re, Values[p].im]));
+                    end;
+            end;
+
+        DSS.GlobalResult := FileNm;
+    finally
+        FreeAndNil(F);
+    end;
+end;
+
+procedure ExportYprimSparse(DSS: TDSSContext; FileNm: String; Fmt: TSparseExportFormat);
+var
+    F: TStream = NIL;
+    Elem: TDSSCktElement;
+    cValues: pComplexArray;
+    i, j, Offset, Order, NumEntries: Integer;
+    Line: String;
+begin
+    DSS.GlobalResult := '';
+    if DSS.ActiveCircuit = NIL then
+        Exit;
+
+    if Fmt = TSparseExportFormat.Binary then
+        FileNm := ChangeFileExt(FileNm, '.bin')
+    else
+        FileNm := ChangeFileExt(FileNm, '.mtx');
+
+    try
+        F := TBufferedFileStream.Create(FileNm, fmCreate);
+        if Fmt = TSparseExportFormat.Binary then
+        begin
+            FSWrite(F, 'DSSYPRM1');
+            for Elem in DSS.ActiveCircuit.CktElements do
+            begin
+                if not IsYprimExported(Elem) then
+                    continue;
+                cValues := Elem.GetYprimValues(ALL_YPRIM);
+                if cValues = NIL then
+                    continue;
+                WriteName(F, ElementName(Elem));
+                WriteUInt32(F, Elem.Yorder);
+                F.WriteBuffer(Elem.NodeRef^[1], Elem.Yorder * SizeOf(LongWord));
+                F.WriteBuffer(cValues^[1], Elem.Yorder * Elem.Yorder * SizeOf(Complex));
+            end;
+        end
+        else
+        begin
+            // The header needs the size of the block-diagonal matrix and its
+            // number of non-zeros, so the Yprims are traversed twice.
+            Order := 0;
+            NumEntries := 0;
+            for Elem in DSS.ActiveCircuit.CktElements do
+            begin
+                if not IsYprimExported(Elem) then
+                    continue;
+                cValues := Elem.GetYprimValues(ALL_YPRIM);
+                if cValues = NIL then
+                    continue;
+                Order := Order + Elem.Yorder;
+                for i := 1 to Elem.Yorder * Elem.Yorder do
+                    if (cValues^[i].re <> 0) or (cValues^[i].im <> 0) then
+                        Inc(NumEntries);
+            end;
+
+            FSWriteln(F, '%%MatrixMarket matrix coordinate complex general');
+            FSWriteln(F, Format('%% Primitive Y matrices of circuit "%s", as the blocks of a block-diagonal matrix', [DSS.ActiveCircuit.Name]));
+            FSWriteln(F, '% block <first row> <order> <element> <node numbers, 0 = ground>');
+            Offset := 0;
+            for Elem in DSS.ActiveCircuit.CktElements do
+            begin
+                if not IsYprimExported(Elem) or (Elem.GetYprimValues(ALL_YPRIM) = NIL) then
+                    continue;
+                Line := Format('%% block %d %d %s', [Offset + 1, Elem.Yorder, ElementName(Elem)]);
+                for i := 1 to Elem.Yorder do
+                    Line := Line + ' ' + IntToStr(Elem.NodeRef^[i]);
+                FSWriteln(F, Line);
+                Offset := Offset + Elem.Yorder;
+            end;
+            FSWriteln(F, Format('%d %d %d', [Order, Order, NumEntries]));
+
+            Offset := 0;
+            for Elem in DSS.ActiveCircuit.CktElements do
+            begin
+                if not IsYprimExported(Elem) then
+                    continue;
+                cValues := Elem.GetYprimValues(ALL_YPRIM);
+                if cValues = NIL then
+                    continue;
+                for j := 1 to Elem.Yorder do
+                    for i := 1 to Elem.Yorder do
+                        with cValues^[i + (j - 1) * Elem.Yorder] do
+                            if (re <> 0) or (im <> 0) then
+                                FSWriteln(F, Format('%d %d %.17g %.17g', [Offset + i, Offset + j, re, im]));
+                Offset := Offset + Elem.Yorder;
+            end;
+        end;
+
+        DSS.GlobalResult := FileNm;
+    finally
+        FreeAndNil(F);
+    end;
+end;
+
+end.
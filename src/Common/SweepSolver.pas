@@ -0,0 +1,531 @@
+unit SweepSolver;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Backward/forward sweep solution of radial circuits (SWEEPSOLVE algorithm).
+//
+// The circuit topology from the first source (as in TDSSCircuit.GetTopology) gives
+// the order of the series (branch) elements. Each branch connects the nodes V1
+// of its upstream bus to the nodes V2 of its downstream bus. From its primitive
+// Y matrix, partitioned by terminal and reduced to the nodes,
+//
+//     I1 = Y11 V1 + Y12 V2,    I2 = Y21 V1 + Y22 V2
+//
+// so, for a known I2, V2 = H I2 - K V1 and I1 = S V1 + G I2, with H = inv(Y22),
+// K = H Y21, G = Y12 H and S = Y11 - G Y21. Every other element is a shunt of
+// its bus. Each pass sums the bus currents from the leaves to the source
+// (backward) and then updates the voltages from the source bus out (forward),
+// using only these small dense blocks; the system Y matrix is not factorized.
+// The outer iteration is the same as in the normal solution, with a pass in
+// place of the KLU solve.
+//
+// Circuits that don't fit this scheme (meshes, loops, parallel branches, more
+// than one voltage source, elements with more than two terminals, branches that
+// don't connect all nodes of the downstream bus, singular blocks, etc.) are
+// rejected by Build, with the reason in FallbackReason; the solution then uses
+// the normal (KLU) algorithm.
+
+interface
+
+uses
+    UComplex,
+    DSSUcomplex,
+    ArrayDef,
+    DSSClass,
+    CktTree;
+
+type
+    TSweepBranch = record
+        Up, Dn: ArrayOfInteger; // system node refs at the upstream and downstream terminals
+        H, K, G, S: ArrayOfComplex; // row-major blocks, see above
+        I2: ArrayOfComplex; // currents into the downstream terminal, from the last backward pass
+    end;
+    PSweepBranch = ^TSweepBranch;
+
+    TSweepShunt = record
+        Nodes: ArrayOfInteger;
+        Y: ArrayOfComplex; // row-major
+    end;
+    PSweepShunt = ^TSweepShunt;
+
+    TSweepSolver = class(TObject)
+    private
+        DSS: TDSSContext;
+        NumNodes: Integer;
+        Branches: Array of TSweepBranch; // tree order, parents before children
+        Shunts: Array of TSweepShunt; // except the ones at the source bus
+        RootNodes: ArrayOfInteger;
+        RootZ: ArrayOfComplex; // inverse of the total shunt admittance at the source bus, row-major
+        J: ArrayOfComplex; // current balance per system node, backward pass
+
+        function BuildFromTree(tree: TCktTree): Boolean;
+
+    public
+        FallbackReason: String; // why the last Build failed
+
+        constructor Create(dssContext: TDSSContext);
+
+        // Builds the sweep data from the present topology and primitive Y
+        // matrices. Returns False if the circuit cannot be solved by the sweep.
+        function Build(): Boolean;
+
+        // One backward/forward pass: updates NodeV from the present NodeV and
+        // injection currents, as an iteration of the normal solution.
+        procedure Solve();
+    end;
+
+implementation
+
+uses
+    SysUtils,
+    Ucmatrix,
+    DSSGlobals,
+    CktElement,
+    Circuit,
+    Solution,
+    VSource,
+    DSSHelper;
+
+function IsZero(const Value: Complex): Boolean; inline;
+begin
+    Result := (Value.re = 0) and (Value.im = 0);
+end;
+
+function GetNodeY(Elem: TDSSCktElement; FirstTerm: Integer; out Nodes: ArrayOfInteger; out Y: ArrayOfComplex; out NumFirst: Integer): Boolean;
+// Reduces the primitive Y matrix of Elem to its nodes, listing first the ones
+// of terminal FirstTerm. Ground and conductors without any admittance (e.g.
+// open) are skipped. Returns False if the element has no Y matrix.
+var
+    YPrim: pComplexArray;
+    CondNode: ArrayOfInteger;
+    order, ncond, t, term, c, i, j, m, ref: Integer;
+    active: Boolean;
+begin
+    Result := False;
+    NumFirst := 0;
+    SetLength(Nodes, 0);
+    SetLength(Y, 0);
+    YPrim := Elem.GetYPrimValues(ALL_YPRIM);
+    if YPrim = NIL then
+        Exit;
+
+    order := Elem.Yorder;
+    ncond := Elem.NConds;
+    SetLength(CondNode, order + 1);
+    m := 0;
+    for t := 0 to Elem.NTerms - 1 do
+    begin
+        // FirstTerm, then the other terminals in order
+        if t = 0 then
+            term := FirstTerm
+        else
+        if t < FirstTerm then
+            term := t
+        else
+            term := t + 1;
+
+        for c := (term - 1) * ncond + 1 to term * ncond do
+        begin
+            CondNode[c] := -1;
+            ref := Elem.NodeRef[c];
+            if ref <= 0 then
+                continue;
+
+            active := False;
+            for i := 1 to order do
+                if not (IsZero(YPrim[(c - 1) * order + i]) and IsZero(YPrim[(i - 1) * order + c])) then
+                begin
+                    active := True;
+                    break;
+                end;
+            if not active then
+                continue;
+
+            j := 0;
+            while (j < m) and (Nodes[j] <> ref) do
+                Inc(j);
+            if j = m then
+            begin
+                SetLength(Nodes, m + 1);
+                Nodes[m] := ref;
+                Inc(m);
+            end;
+            CondNode[c] := j;
+        end;
+        if t = 0 then
+            NumFirst := m;
+    end;
+
+    SetLength(Y, m * m);
+    for j := 1 to order do
+    begin
+        if CondNode[j] < 0 then
+            continue;
+        for i := 1 to order do
+            if CondNode[i] >= 0 then
+                Y[CondNode[i] * m + CondNode[j]] += YPrim[(j - 1) * order + i];
+    end;
+    Result := True;
+end;
+
+function Invert(var A: ArrayOfComplex; n: Integer): Boolean;
+var
+    M: TCMatrix;
+    i, j: Integer;
+begin
+    M := TCMatrix.CreateMatrix(n);
+    try
+        for i := 0 to n - 1 do
+            for j := 0 to n - 1 do
+                M[i + 1, j + 1] := A[i * n + j];
+        M.Invert();
+        Result := (M.InvertError = 0);
+        if Result then
+            for i := 0 to n - 1 do
+                for j := 0 to n - 1 do
+                    A[i * n + j] := M[i + 1, j + 1];
+    finally
+        M.Free();
+    end;
+end;
+
+function MatMul(const A, B: ArrayOfComplex; r, n, c: Integer): ArrayOfComplex;
+// (r x n) times (n x c), row-major
+var
+    i, j, l: Integer;
+    acc: Complex;
+begin
+    SetLength(Result, r * c);
+    for i := 0 to r - 1 do
+        for j := 0 to c - 1 do
+        begin
+            acc := 0;
+            for l := 0 to n - 1 do
+                acc += A[i * n + l] * B[l * c + j];
+            Result[i * c + j] := acc;
+        end;
+end;
+
+constructor TSweepSolver.Create(dssContext: TDSSContext);
+begin
+    inherited Create();
+    DSS := dssContext;
+    NumNodes := 0;
+    FallbackReason := '';
+end;
+
+function TSweepSolver.Build(): Boolean;
+// The circuit is traversed on its own adjacency lists and tree, built from the
+// present state; the topology cached in the circuit (used by the Topology
+// interface, meter zones, etc.) and the IsIsolated flags are left as they were.
+var
+    ckt: TDSSCircuit;
+    tree: TCktTree;
+    lstPD, lstPC: TAdjArray;
+    elem: TDSSCktElement;
+    Isolated: Array of Boolean;
+    i: Integer;
+begin
+    Result := False;
+    FallbackReason := '';
+    ckt := DSS.ActiveCircuit;
+    NumNodes := ckt.NumNodes;
+    SetLength(Branches, 0);
+    SetLength(Shunts, 0);
+    if ckt.Sources.Count = 0 then
+    begin
+        FallbackReason := 'no voltage source';
+        Exit;
+    end;
+
+    SetLength(Isolated, ckt.CktElements.Count + 1);
+    for elem in ckt.CktElements do
+    begin
+        Isolated[elem.Handle] := Flg.IsIsolated in elem.Flags;
+        Exclude(elem.Flags, Flg.Checked);
+        for i := 1 to elem.NTerms do
+            elem.TerminalsChecked[i - 1] := FALSE;
+    end;
+    for i := 1 to ckt.NumBuses do
+        ckt.Buses[i].BusChecked := FALSE;
+
+    tree := NIL;
+    BuildActiveBusAdjacencyLists(ckt, lstPD, lstPC);
+    try
+        tree := GetIsolatedSubArea(ckt, ckt.Sources.First, lstPD, lstPC, TRUE);
+        Result := BuildFromTree(tree);
+    finally
+        tree.Free();
+        FreeAndNilBusAdjacencyLists(lstPD, lstPC);
+        for elem in ckt.CktElements do
+            if Isolated[elem.Handle] then
+                Include(elem.Flags, Flg.IsIsolated)
+            else
+                Exclude(elem.Flags, Flg.IsIsolated);
+    end;
+end;
+
+function TSweepSolver.BuildFromTree(tree: TCktTree): Boolean;
+var
+    ckt: TDSSCircuit;
+    node: TCktTreeNode;
+    elem, root: TDSSCktElement;
+    br: PSweepBranch;
+    IsBranch: Array of Boolean;
+    BusOwner: ArrayOfInteger; // 0 = not reached, -1 = source bus, b > 0 = downstream bus of branch b - 1
+    RootIdx: ArrayOfInteger; // position in RootNodes per system node, -1 if not at the source bus
+    Nodes: ArrayOfInteger;
+    Y, Y11, Y12, Y21, YRoot: ArrayOfComplex;
+    n, n1, n2, nr, nb, ns, i, k, RootBus, BusRef, DnBus, DnTerm: Integer;
+begin
+    Result := False;
+    ckt := DSS.ActiveCircuit;
+    root := tree.First();
+    if (root = NIL) or not (root is TVsourceObj) or not root.Enabled then
+    begin
+        FallbackReason := 'no voltage source';
+        Exit;
+    end;
+    RootBus := root.Terminals[0].BusRef;
+    if RootBus = 0 then
+    begin
+        FallbackReason := 'source connected to ground';
+        Exit;
+    end;
+    if tree.PresentBranch.IsLoopedHere then
+    begin
+        FallbackReason := 'loop at the source bus';
+        Exit;
+    end;
+
+    SetLength(IsBranch, ckt.CktElements.Count + 1);
+    SetLength(BusOwner, ckt.NumBuses + 1);
+    BusOwner[RootBus] := -1;
+    SetLength(Branches, ckt.PDElements.Count);
+    nb := 0;
+
+    // Series elements, parents first
+    elem := tree.GoForward();
+    while elem <> NIL do
+    begin
+        node := tree.PresentBranch;
+        if node.IsLoopedHere or node.IsParallel then
+        begin
+            FallbackReason := Format('loop or parallel branch at "%s"', [elem.FullName]);
+            Exit;
+        end;
+        if elem.NTerms <> 2 then
+        begin
+            FallbackReason := Format('"%s" has more than two terminals', [elem.FullName]);
+            Exit;
+        end;
+
+        DnTerm := 3 - node.FromTerminal;
+        DnBus := elem.Terminals[DnTerm - 1].BusRef;
+        if (DnBus = 0) or (BusOwner[DnBus] <> 0) then
+        begin
+            FallbackReason := Format('loop closed by "%s"', [elem.FullName]);
+            Exit;
+        end;
+        if not GetNodeY(elem, node.FromTerminal, Nodes, Y, n1) then
+        begin
+            FallbackReason := Format('"%s" has no Y matrix', [elem.FullName]);
+            Exit;
+        end;
+        n := Length(Nodes);
+        n2 := n - n1;
+        if n2 <> ckt.Buses[DnBus].NumNodesThisBus then
+        begin
+            FallbackReason := Format('"%s" does not connect all nodes of bus "%s"', [elem.FullName, ckt.BusList.NameOfIndex(DnBus)]);
+            Exit;
+        end;
+
+        br := @Branches[nb];
+        br.Up := Copy(Nodes, 0, n1);
+        br.Dn := Copy(Nodes, n1, n2);
+        SetLength(br.I2, n2);
+        SetLength(Y11, n1 * n1);
+        SetLength(Y12, n1 * n2);
+        SetLength(Y21, n2 * n1);
+        SetLength(br.H, n2 * n2);
+        for i := 0 to n - 1 do
+            for k := 0 to n - 1 do
+                if i < n1 then
+                begin
+                    if k < n1 then
+                        Y11[i * n1 + k] := Y[i * n + k]
+                    else
+                        Y12[i * n2 + k - n1] := Y[i * n + k];
+                end
+                else
+                begin
+                    if k < n1 then
+                        Y21[(i - n1) * n1 + k] := Y[i * n + k]
+                    else
+                        br.H[(i - n1) * n2 + k - n1] := Y[i * n + k];
+                end;
+
+        if not Invert(br.H, n2) then
+        begin
+            FallbackReason := Format('singular downstream admittance in "%s"', [elem.FullName]);
+            Exit;
+        end;
+        br.K := MatMul(br.H, Y21, n2, n2, n1);
+        br.G := MatMul(Y12, br.H, n1, n2, n2);
+        br.S := MatMul(br.G, Y21, n1, n2, n1);
+        for i := 0 to n1 * n1 - 1 do
+            br.S[i] := Y11[i] - br.S[i];
+
+        IsBranch[elem.Handle] := True;
+        Inc(nb);
+        BusOwner[DnBus] := nb;
+        elem := tree.GoForward();
+    end;
+    SetLength(Branches, nb);
+
+    for i := 1 to ckt.NumBuses do
+        if (BusOwner[i] = 0) and (ckt.Buses[i].NumNodesThisBus > 0) then
+        begin
+            FallbackReason := Format('bus "%s" is not fed from the source', [ckt.BusList.NameOfIndex(i)]);
+            Exit;
+        end;
+
+    // Shunts; the ones at the source bus go to its admittance
+    nr := ckt.Buses[RootBus].NumNodesThisBus;
+    SetLength(RootNodes, nr);
+    SetLength(RootIdx, NumNodes + 1);
+    for i := 0 to NumNodes do
+        RootIdx[i] := -1;
+    for i := 0 to nr - 1 do
+    begin
+        RootNodes[i] := ckt.Buses[RootBus].RefNo[i + 1];
+        RootIdx[RootNodes[i]] := i;
+    end;
+    SetLength(YRoot, nr * nr);
+    SetLength(Shunts, ckt.CktElements.Count);
+    ns := 0;
+    for elem in ckt.CktElements do
+    begin
+        if (not elem.Enabled) or IsBranch[elem.Handle] then
+            continue;
+        if not GetNodeY(elem, 1, Nodes, Y, n1) then
+            continue;
+        n := Length(Nodes);
+        if n = 0 then
+            continue;
+
+        BusRef := ckt.MapNodeToBus[Nodes[0]].BusRef;
+        for i := 1 to n - 1 do
+            if ckt.MapNodeToBus[Nodes[i]].BusRef <> BusRef then
+            begin
+                FallbackReason := Format('"%s" connects different buses but is not a branch of the radial tree', [elem.FullName]);
+                Exit;
+            end;
+
+        if BusRef = RootBus then
+        begin
+            for i := 0 to n - 1 do
+                for k := 0 to n - 1 do
+                    YRoot[RootIdx[Nodes[i]] * nr + RootIdx[Nodes[k]]] += Y[i * n + k];
+            continue;
+        end;
+        if elem is TVsourceObj then
+        begin
+            FallbackReason := Format('more than one voltage source ("%s")', [elem.FullName]);
+            Exit;
+        end;
+        Shunts[ns].Nodes := Nodes;
+        Shunts[ns].Y := Y;
+        Inc(ns);
+    end;
+    SetLength(Shunts, ns);
+
+    if not Invert(YRoot, nr) then
+    begin
+        FallbackReason := 'singular admittance at the source bus';
+        Exit;
+    end;
+    RootZ := YRoot;
+
+    SetLength(J, NumNodes + 1);
+    Result := True;
+end;
+
+procedure TSweepSolver.Solve();
+var
+    sol: TSolutionObj;
+    br: PSweepBranch;
+    sh: PSweepShunt;
+    b, i, l, n, n1, n2: Integer;
+    acc: Complex;
+begin
+    sol := DSS.ActiveCircuit.Solution;
+
+    // Current balance at the present voltages: J = Ishunt - Iinj
+    for i := 1 to NumNodes do
+        J[i] := -sol.Currents[i];
+    for b := 0 to High(Shunts) do
+    begin
+        sh := @Shunts[b];
+        n := Length(sh.Nodes);
+        for i := 0 to n - 1 do
+        begin
+            acc := 0;
+            for l := 0 to n - 1 do
+                acc += sh.Y[i * n + l] * sol.NodeV[sh.Nodes[l]];
+            J[sh.Nodes[i]] += acc;
+        end;
+    end;
+
+    // Backward: what each bus (and its subtree) draws from its upstream branch
+    for b := High(Branches) downto 0 do
+    begin
+        br := @Branches[b];
+        n1 := Length(br.Up);
+        n2 := Length(br.Dn);
+        for i := 0 to n2 - 1 do
+            br.I2[i] := -J[br.Dn[i]];
+        for i := 0 to n1 - 1 do
+        begin
+            acc := 0;
+            for l := 0 to n1 - 1 do
+                acc += br.S[i * n1 + l] * sol.NodeV[br.Up[l]];
+            for l := 0 to n2 - 1 do
+                acc += br.G[i * n2 + l] * br.I2[l];
+            J[br.Up[i]] += acc;
+        end;
+    end;
+
+    // Source bus: Yroot V = Iinj - sum(I1)
+    n := Length(RootNodes);
+    for i := 0 to n - 1 do
+    begin
+        acc := 0;
+        for l := 0 to n - 1 do
+            acc -= RootZ[i * n + l] * J[RootNodes[l]];
+        sol.NodeV[RootNodes[i]] := acc;
+    end;
+
+    // Forward: V2 = H I2 - K V1
+    for b := 0 to High(Branches) do
+    begin
+        br := @Branches[b];
+        n1 := Length(br.Up);
+        n2 := Length(br.Dn);
+        for i := 0 to n2 - 1 do
+        begin
+            acc := 0;
+            for l := 0 to n2 - 1 do
+                acc += br.H[i * n2 + l] * br.I2[l];
+            for l := 0 to n1 - 1 do
+                acc -= br.K[i * n1 + l] * sol.NodeV[br.Up[l]];
+            sol.NodeV[br.Dn[i]] := acc;
+        end;
+    end;
+    Inc(DSS.SolutionGeneration); // new NodeV, as after SolveSystem
+end;
+
+end.
@@ -0,0 +1,666 @@
+unit SyntheticCircuit;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Generator of synthetic distribution circuits, for scale testing and benchmarks.
+//
+// The circuit is a substation transformer feeding a number of three-phase
+// feeders. Each feeder has an optional regulator at the head, a main line
+// and laterals spread along the main line. Loads, PV systems and storage
+// are placed randomly (but deterministically, given the seed) at the buses,
+// and capacitors (optionally with CapControls) are placed along the main line.
+//
+// The elements are created in batches through Batch_CreateFromNew and the
+// property setters, without going through the text parser, so that very
+// large circuits can be created quickly.
+
+interface
+
+uses
+    DSSClass,
+    fpjson;
+
+type
+    TSyntheticCircuitParams = record
+        Name: String;
+        SourcekV: Double; // line-to-line, at the substation high side
+        FeederkV: Double; // line-to-line
+        NumFeeders: Integer;
+        MainSections: Integer; // line sections in the main line of each feeder
+        LateralsPerFeeder: Integer;
+        LateralSections: Integer;
+        SectionLength: Double; // km
+        LoadDensity: Double; // probability of a bus having a load, 0 to 1
+        LoadkW: Double; // average kW per phase
+        LoadPF: Double;
+        PVDensity: Double; // probability of a load having a PV system, 0 to 1
+        PVkVA: Double;
+        StorageDensity: Double; // probability of a load having a storage, 0 to 1
+        StoragekW: Double;
+        StoragekWh: Double;
+        Regulators: Boolean; // regulator (transformer + RegControl) at each feeder head
+        CapacitorsPerFeeder: Integer;
+        Capacitorkvar: Double;
+        CapControls: Boolean;
+        NumLoadShapes: Integer;
+        LoadShapeNpts: Integer;
+        LoadShapeInterval: Double; // hours
+        EnergyMeter: Boolean; // at the substation transformer
+        SetVoltageBases: Boolean;
+        Seed: Cardinal;
+    end;
+
+procedure SyntheticCircuitDefaults(var Params: TSyntheticCircuitParams);
+procedure SyntheticCircuitParamsFromJSON(var Params: TSyntheticCircuitParams; jparams: TJSONObject);
+procedure GenerateSyntheticCircuit(DSS: TDSSContext; const Params: TSyntheticCircuitParams);
+
+implementation
+
+uses
+    SysUtils,
+    Math,
+    CAPI_Types,
+    CAPI_Obj,
+    DSSGlobals,
+    DSSHelper,
+    DSSObject,
+    DSSObjectHelper,
+    Arraydef,
+    Circuit,
+    CktElement,
+    Line,
+    LineCode,
+    Load,
+    LoadShape,
+    PVSystem,
+    Storage,
+    Transformer,
+    RegControl,
+    Capacitor,
+    CapControl,
+    VSource,
+    EnergyMeter;
+
+const
+    LINE_UNITS_KM = 3; // same as the LineUnits enum
+    CAPCONTROL_VOLTAGE = 1;
+
+procedure SyntheticCircuitDefaults(var Params: TSyntheticCircuitParams);
+begin
+    with Params do
+    begin
+        Name := 'synthetic';
+        SourcekV := 115;
+        FeederkV := 12.47;
+        NumFeeders := 4;
+        MainSections := 100;
+        LateralsPerFeeder := 10;
+        LateralSections := 10;
+        SectionLength := 0.1;
+        LoadDensity := 1.0;
+        LoadkW := 10;
+        LoadPF := 0.95;
+        PVDensity := 0.2;
+        PVkVA := 8;
+        StorageDensity := 0.05;
+        StoragekW := 5;
+        StoragekWh := 13.5;
+        Regulators := True;
+        CapacitorsPerFeeder := 2;
+        Capacitorkvar := 300;
+        CapControls := True;
+        NumLoadShapes := 4;
+        LoadShapeNpts := 24;
+        LoadShapeInterval := 1;
+        EnergyMeter := True;
+        SetVoltageBases := True;
+        Seed := 1;
+    end;
+end;
+
+procedure SyntheticCircuitParamsFromJSON(var Params: TSyntheticCircuitParams; jparams: TJSONObject);
+begin
+    with Params do
+    begin
+        Name := jparams.Get('Name', Name);
+        SourcekV := jparams.Get('SourcekV', SourcekV);
+        FeederkV := jparams.Get('FeederkV', FeederkV);
+        NumFeeders := jparams.Get('NumFeeders', NumFeeders);
+        MainSections := jparams.Get('MainSections', MainSections);
+        LateralsPerFeeder := jparams.Get('LateralsPerFeeder', LateralsPerFeeder);
+        LateralSections := jparams.Get('LateralSections', LateralSections);
+        SectionLength := jparams.Get('SectionLength', SectionLength);
+        LoadDensity := jparams.Get('LoadDensity', LoadDensity);
+        LoadkW := jparams.Get('LoadkW', LoadkW);
+        LoadPF := jparams.Get('LoadPF', LoadPF);
+        PVDensity := jparams.Get('PVDensity', PVDensity);
+        PVkVA := jparams.Get('PVkVA', PVkVA);
+        StorageDensity := jparams.Get('StorageDensity', StorageDensity);
+        StoragekW := jparams.Get('StoragekW', StoragekW);
+        StoragekWh := jparams.Get('StoragekWh', StoragekWh);
+        Regulators := jparams.Get('Regulators', Regulators);
+        CapacitorsPerFeeder := jparams.Get('CapacitorsPerFeeder', CapacitorsPerFeeder);
+        Capacitorkvar := jparams.Get('Capacitorkvar', Capacitorkvar);
+        CapControls := jparams.Get('CapControls', CapControls);
+        NumLoadShapes := jparams.Get('NumLoadShapes', NumLoadShapes);
+        LoadShapeNpts := jparams.Get('LoadShapeNpts', LoadShapeNpts);
+        LoadShapeInterval := jparams.Get('LoadShapeInterval', LoadShapeInterval);
+        EnergyMeter := jparams.Get('EnergyMeter', EnergyMeter);
+        SetVoltageBases := jparams.Get('SetVoltageBases', SetVoltageBases);
+        Seed := Cardinal(jparams.Get('Seed', Int64(Seed)));
+    end;
+end;
+
+{$PUSH}
+{$Q-}
+{$R-}
+// xorshift32; the global RNG is not used to keep the results independent of other users
+function NextRandom(var State: Cardinal): Double;
+begin
+    State := State xor (State shl 13);
+    State := State xor (State shr 17);
+    State := State xor (State shl 5);
+    Result := State / 4294967296.0;
+end;
+{$POP}
+
+// Creates the objects through Batch_CreateFromNew, leaving them in edit mode
+function NewObjects(DSS: TDSSContext; Cls: TDSSClass; const Names: ArrayOfString): ArrayOfDSSObject;
+var
+    namePtrs: Array of PAnsiChar = NIL;
+    batch: TDSSObjectPtr = NIL;
+    batchPtr: TDSSObjectPtr;
+    counts: Array[0..1] of TAPISize = (0, 0);
+    i: Integer;
+begin
+    Result := NIL;
+    if Length(Names) = 0 then
+        Exit;
+
+    SetLength(namePtrs, Length(Names));
+    for i := 0 to High(Names) do
+        namePtrs[i] := PAnsiChar(Names[i]);
+
+    Batch_CreateFromNew(DSS, batch, @counts[0], Cls.DSSClassIndex, PPAnsiChar(@namePtrs[0]), Length(Names), True);
+    try
+        if (DSS.ErrorNumber <> 0) or (counts[0] <> Length(Names)) then
+            raise Exception.Create(Format(_('Could not create the "%s" elements.'), [Cls.Name]));
+
+        SetLength(Result, counts[0]);
+        batchPtr := batch;
+        for i := 0 to High(Result) do
+        begin
+            Result[i] := batchPtr^;
+            inc(batchPtr);
+        end;
+    finally
+        if batch <> NIL then
+            Batch_Dispose(batch);
+    end;
+end;
+
+procedure EndEdit(const Objs: ArrayOfDSSObject; NumChanges: Integer);
+var
+    obj: TDSSObject;
+begin
+    for obj in Objs do
+        obj.ParentClass.EndEdit(obj, NumChanges);
+end;
+
+procedure CheckError(DSS: TDSSContext);
+begin
+    if DSS.ErrorNumber <> 0 then
+        raise Exception.Create(DSS.LastErrorMessage);
+end;
+
+procedure ValidateParams(const p: TSyntheticCircuitParams);
+begin
+    if (p.NumFeeders < 1) or (p.MainSections < 1) then
+        raise Exception.Create(_('At least one feeder with one main line section is required.'));
+    if (p.LateralsPerFeeder < 0) or (p.LateralSections < 0) or (p.CapacitorsPerFeeder < 0) then
+        raise Exception.Create(_('The number of laterals, lateral sections and capacitors cannot be negative.'));
+    if (p.LateralsPerFeeder > 0) and (p.LateralSections < 1) then
+        raise Exception.Create(_('Laterals require at least one section.'));
+    if (p.SourcekV <= 0) or (p.FeederkV <= 0) or (p.SectionLength <= 0) then
+        raise Exception.Create(_('Voltages and section length must be positive.'));
+    if (p.NumLoadShapes < 1) or (p.LoadShapeNpts < 1) or (p.LoadShapeInterval <= 0) then
+        raise Exception.Create(_('At least one load shape with one point and a positive interval is required.'));
+end;
+
+procedure GenerateSyntheticCircuit(DSS: TDSSContext; const Params: TSyntheticCircuitParams);
+const
+    PhaseSuffix: Array[0..2] of String = ('.1', '.2', '.3');
+var
+    p: TSyntheticCircuitParams;
+    ckt: TDSSCircuit;
+    rng: Cardinal;
+    obj: TDSSObject;
+    objs, lineCodes, shapes, lines, caps, transformers: ArrayOfDSSObject;
+    names, busNames: ArrayOfString;
+    lineBus1, lineBus2, loadBus, pvBus, storageBus, capBus: ArrayOfString;
+    lineIsLateral: Array of Boolean = NIL;
+    loadPhases, loadShapeIdx, pvPhases, storagePhases, capLine, headIdx: Array of Integer;
+    loadkWs: ArrayOfDouble;
+    vals, kVs, kVAs: ArrayOfDouble;
+    f, s, k, j, i, n, numBuses, numLines, numLoads, numPV, numStorage, attachAt, phaseIdx: Integer;
+    busName, prev: String;
+    kVLN, totalkW, feederkW, x: Double;
+
+    procedure AddLine(const FromBus, ToBus: String; Lateral: Boolean);
+    begin
+        lineBus1[numLines] := FromBus;
+        lineBus2[numLines] := ToBus;
+        lineIsLateral[numLines] := Lateral;
+        Inc(numLines);
+    end;
+
+    procedure AddPCElements(const Bus: String; Phases: Integer);
+    var
+        kW: Double;
+        ph: Integer;
+    begin
+        if NextRandom(rng) >= p.LoadDensity then
+            Exit;
+
+        kW := p.LoadkW * Phases * (0.5 + NextRandom(rng));
+        totalkW := totalkW + kW;
+        feederkW := feederkW + kW;
+        if Phases = 1 then
+        begin
+            // Distribute the single-phase loads among the phases
+            ph := phaseIdx mod 3;
+            Inc(phaseIdx);
+            loadBus[numLoads] := Bus + PhaseSuffix[ph];
+        end
+        else
+            loadBus[numLoads] := Bus;
+
+        loadPhases[numLoads] := Phases;
+        loadkWs[numLoads] := kW;
+        loadShapeIdx[numLoads] := Trunc(NextRandom(rng) * p.NumLoadShapes);
+
+        if NextRandom(rng) < p.PVDensity then
+        begin
+            pvBus[numPV] := loadBus[numLoads];
+            pvPhases[numPV] := Phases;
+            Inc(numPV);
+        end;
+        if NextRandom(rng) < p.StorageDensity then
+        begin
+            storageBus[numStorage] := loadBus[numLoads];
+            storagePhases[numStorage] := Phases;
+            Inc(numStorage);
+        end;
+        Inc(numLoads);
+    end;
+
+    function PhaseKV(Phases: Integer): Double;
+    begin
+        if Phases = 1 then
+            Result := kVLN
+        else
+            Result := p.FeederkV;
+    end;
+
+begin
+    p := Params;
+    ValidateParams(p);
+    rng := p.Seed;
+    if rng = 0 then
+        rng := 1;
+    kVLN := p.FeederkV / SQRT3;
+
+    DSS.DSSExecutive.Clear();
+    MakeNewCircuit(DSS, p.Name);
+    CheckError(DSS);
+    ckt := DSS.ActiveCircuit;
+
+    obj := TDSSObject(DSS.VSourceClass.Find('source', False));
+    obj.BeginEdit(True);
+    obj.SetDouble(ord(TVsourceProp.BasekV), p.SourcekV, []);
+    obj.SetDouble(ord(TVsourceProp.pu), 1.0, []);
+    obj.SetDouble(ord(TVsourceProp.MVASC3), 2000, []);
+    obj.SetDouble(ord(TVsourceProp.MVASC1), 1800, []);
+    obj.EndEdit(4);
+    CheckError(DSS);
+
+    // Line codes: main line and laterals
+    SetLength(names, 2);
+    names[0] := 'synth_main';
+    names[1] := 'synth_lateral';
+    lineCodes := NewObjects(DSS, DSS.LineCodeClass, names);
+    for i := 0 to 1 do
+    begin
+        obj := lineCodes[i];
+        obj.SetInteger(ord(TLineCodeProp.NPhases), 3, []);
+        obj.SetInteger(ord(TLineCodeProp.Units), LINE_UNITS_KM, []);
+        if i = 0 then
+        begin
+            obj.SetDouble(ord(TLineCodeProp.R1), 0.190, []);
+            obj.SetDouble(ord(TLineCodeProp.X1), 0.396, []);
+            obj.SetDouble(ord(TLineCodeProp.R0), 0.585, []);
+            obj.SetDouble(ord(TLineCodeProp.X0), 1.328, []);
+            obj.SetDouble(ord(TLineCodeProp.NormAmps), 600, []);
+        end
+        else
+        begin
+            obj.SetDouble(ord(TLineCodeProp.R1), 0.610, []);
+            obj.SetDouble(ord(TLineCodeProp.X1), 0.463, []);
+            obj.SetDouble(ord(TLineCodeProp.R0), 1.091, []);
+            obj.SetDouble(ord(TLineCodeProp.X0), 1.549, []);
+            obj.SetDouble(ord(TLineCodeProp.NormAmps), 300, []);
+        end;
+        obj.SetDouble(ord(TLineCodeProp.C1), 3.4, []);
+        obj.SetDouble(ord(TLineCodeProp.C0), 1.6, []);
+    end;
+    EndEdit(lineCodes, 10);
+    CheckError(DSS);
+
+    // Load shapes: residential-like daily patterns with some noise; the last
+    // one is a solar profile for the PV systems
+    SetLength(names, p.NumLoadShapes + 1);
+    for i := 0 to p.NumLoadShapes - 1 do
+        names[i] := Format('synth_load%d', [i + 1]);
+    names[p.NumLoadShapes] := 'synth_solar';
+    shapes := NewObjects(DSS, DSS.LoadShapeClass, names);
+    SetLength(vals, p.LoadShapeNpts);
+    for i := 0 to High(shapes) do
+    begin
+        for j := 0 to p.LoadShapeNpts - 1 do
+        begin
+            x := Frac((j * p.LoadShapeInterval) / 24.0) * 24.0; // hour of the day
+            if i < p.NumLoadShapes then
+                vals[j] := 0.45
+                    + 0.45 * Exp(-Sqr((x - 18.5 - i mod 3) / 3.0))
+                    + 0.2 * Exp(-Sqr((x - 7.5 - i mod 2) / 2.0))
+                    + 0.1 * NextRandom(rng)
+            else
+                vals[j] := Max(0.0, Sin(Pi * (x - 6.0) / 13.0));
+        end;
+        obj := shapes[i];
+        obj.SetInteger(ord(TLoadShapeProp.NPts), p.LoadShapeNpts, []);
+        obj.SetDouble(ord(TLoadShapeProp.Interval), p.LoadShapeInterval, []);
+        obj.SetDoubles(ord(TLoadShapeProp.Mult), vals, []);
+    end;
+    EndEdit(shapes, 3);
+    CheckError(DSS);
+
+    // Topology: collect the lines and the PC elements for all feeders.
+    // There's at most one line and one set of PC elements per bus.
+    numBuses := p.NumFeeders * (1 + p.MainSections + p.LateralsPerFeeder * p.LateralSections);
+    SetLength(lineBus1, numBuses);
+    SetLength(lineBus2, numBuses);
+    SetLength(lineIsLateral, numBuses);
+    SetLength(loadBus, numBuses);
+    SetLength(loadPhases, numBuses);
+    SetLength(loadkWs, numBuses);
+    SetLength(loadShapeIdx, numBuses);
+    SetLength(pvBus, numBuses);
+    SetLength(pvPhases, numBuses);
+    SetLength(storageBus, numBuses);
+    SetLength(storagePhases, numBuses);
+    numLines := 0;
+    numLoads := 0;
+    numPV := 0;
+    numStorage := 0;
+    totalkW := 0;
+    phaseIdx := 0;
+    SetLength(headIdx, p.NumFeeders);
+    SetLength(vals, p.NumFeeders); // kW per feeder, for the regulators
+    for f := 1 to p.NumFeeders do
+    begin
+        feederkW := 0;
+        headIdx[f - 1] := numLines;
+        if not p.Regulators then
+            AddLine('subbus', Format('f%d_0', [f]), False);
+
+        prev := Format('f%d_0', [f]);
+        for s := 1 to p.MainSections do
+        begin
+            busName := Format('f%d_%d', [f, s]);
+            AddLine(prev, busName, False);
+            AddPCElements(busName, 3);
+            prev := busName;
+        end;
+
+        for k := 1 to p.LateralsPerFeeder do
+        begin
+            attachAt := Max(1, Round(k * p.MainSections / (p.LateralsPerFeeder + 1)));
+            prev := Format('f%d_%d', [f, attachAt]);
+            for j := 1 to p.LateralSections do
+            begin
+                busName := Format('f%d_l%d_%d', [f, k, j]);
+                AddLine(prev, busName, True);
+                AddPCElements(busName, 1);
+                prev := busName;
+            end;
+        end;
+        vals[f - 1] := feederkW;
+    end;
+
+    // Substation and regulator transformers
+    n := 1;
+    if p.Regulators then
+        n := n + p.NumFeeders;
+    SetLength(names, n);
+    names[0] := 'sub';
+    for f := 1 to n - 1 do
+        names[f] := Format('reg%d', [f]);
+    transformers := NewObjects(DSS, DSS.TransformerClass, names);
+    SetLength(busNames, 2);
+    SetLength(kVs, 2);
+    SetLength(kVAs, 2);
+    for i := 0 to High(transformers) do
+    begin
+        obj := transformers[i];
+        if i = 0 then
+        begin
+            busNames[0] := 'sourcebus';
+            busNames[1] := 'subbus';
+            kVs[0] := p.SourcekV;
+            kVAs[0] := Max(5000, 1.25 * totalkW / p.LoadPF);
+        end
+        else
+        begin
+            busNames[0] := 'subbus';
+            busNames[1] := Format('f%d_0', [i]);
+            kVs[0] := p.FeederkV;
+            kVAs[0] := Max(1000, 1.5 * vals[i - 1] / p.LoadPF);
+        end;
+        kVs[1] := p.FeederkV;
+        kVAs[1] := kVAs[0];
+        obj.SetInteger(ord(TTransfProp.Phases), 3, []);
+        obj.SetInteger(ord(TTransfProp.Windings), 2, []);
+        obj.SetStrings(ord(TTransfProp.Buses), busNames, []);
+        obj.SetDoubles(ord(TTransfProp.kVs), kVs, []);
+        obj.SetDoubles(ord(TTransfProp.kVAs), kVAs, []);
+        if i = 0 then
+        begin
+            obj.SetDouble(ord(TTransfProp.XHL), 8, []);
+            obj.SetDouble(ord(TTransfProp.pctLoadLoss), 0.5, []);
+        end
+        else
+        begin
+            obj.SetDouble(ord(TTransfProp.XHL), 0.01, []);
+            obj.SetDouble(ord(TTransfProp.pctLoadLoss), 0.0001, []);
+        end;
+    end;
+    EndEdit(transformers, 7);
+    CheckError(DSS);
+
+    // Lines
+    SetLength(names, numLines);
+    for i := 0 to numLines - 1 do
+        names[i] := 'l_' + lineBus2[i];
+    lines := NewObjects(DSS, DSS.LineClass, names);
+    for i := 0 to numLines - 1 do
+    begin
+        obj := lines[i];
+        obj.SetString(ord(TLineProp.Bus1), lineBus1[i], []);
+        obj.SetString(ord(TLineProp.Bus2), lineBus2[i], []);
+        if lineIsLateral[i] then
+            obj.SetObject(ord(TLineProp.LineCode), lineCodes[1], [])
+        else
+            obj.SetObject(ord(TLineProp.LineCode), lineCodes[0], []);
+        obj.SetDouble(ord(TLineProp.Length), p.SectionLength, []);
+        obj.SetInteger(ord(TLineProp.Units), LINE_UNITS_KM, []);
+    end;
+    EndEdit(lines, 5);
+    CheckError(DSS);
+
+    // Loads
+    SetLength(names, numLoads);
+    for i := 0 to numLoads - 1 do
+        names[i] := Format('ld%d', [i + 1]);
+    objs := NewObjects(DSS, DSS.LoadClass, names);
+    for i := 0 to High(objs) do
+    begin
+        obj := objs[i];
+        obj.SetInteger(ord(TLoadProp.Phases), loadPhases[i], []);
+        obj.SetString(ord(TLoadProp.Bus1), loadBus[i], []);
+        obj.SetDouble(ord(TLoadProp.kV), PhaseKV(loadPhases[i]), []);
+        obj.SetDouble(ord(TLoadProp.kW), loadkWs[i], []);
+        obj.SetDouble(ord(TLoadProp.PF), p.LoadPF, []);
+        obj.SetObject(ord(TLoadProp.Daily), shapes[loadShapeIdx[i]], []);
+        obj.SetObject(ord(TLoadProp.Yearly), shapes[loadShapeIdx[i]], []);
+    end;
+    EndEdit(objs, 7);
+    CheckError(DSS);
+
+    // PV systems
+    SetLength(names, numPV);
+    for i := 0 to numPV - 1 do
+        names[i] := Format('pv%d', [i + 1]);
+    objs := NewObjects(DSS, DSS.PVSystemClass, names);
+    for i := 0 to High(objs) do
+    begin
+        obj := objs[i];
+        obj.SetInteger(ord(TPVSystemProp.Phases), pvPhases[i], []);
+        obj.SetString(ord(TPVSystemProp.Bus1), pvBus[i], []);
+        obj.SetDouble(ord(TPVSystemProp.kV), PhaseKV(pvPhases[i]), []);
+        obj.SetDouble(ord(TPVSystemProp.kVA), p.PVkVA * pvPhases[i], []);
+        obj.SetDouble(ord(TPVSystemProp.Pmpp), p.PVkVA * pvPhases[i], []);
+        obj.SetDouble(ord(TPVSystemProp.Irradiance), 1.0, []);
+        obj.SetObject(ord(TPVSystemProp.Daily), shapes[High(shapes)], []);
+        obj.SetObject(ord(TPVSystemProp.Yearly), shapes[High(shapes)], []);
+    end;
+    EndEdit(objs, 8);
+    CheckError(DSS);
+
+    // Storage
+    SetLength(names, numStorage);
+    for i := 0 to numStorage - 1 do
+        names[i] := Format('st%d', [i + 1]);
+    objs := NewObjects(DSS, DSS.StorageClass, names);
+    for i := 0 to High(objs) do
+    begin
+        obj := objs[i];
+        obj.SetInteger(ord(TStorageProp.Phases), storagePhases[i], []);
+        obj.SetString(ord(TStorageProp.Bus1), storageBus[i], []);
+        obj.SetDouble(ord(TStorageProp.kV), PhaseKV(storagePhases[i]), []);
+        obj.SetDouble(ord(TStorageProp.kWRated), p.StoragekW * storagePhases[i], []);
+        obj.SetDouble(ord(TStorageProp.kVA), p.StoragekW * storagePhases[i], []);
+        obj.SetDouble(ord(TStorageProp.kWhRated), p.StoragekWh * storagePhases[i], []);
+        obj.SetDouble(ord(TStorageProp.pctStored), 50, []);
+    end;
+    EndEdit(objs, 7);
+    CheckError(DSS);
+
+    // Capacitors, spread along the main line of each feeder
+    n := 0;
+    SetLength(capBus, p.NumFeeders * p.CapacitorsPerFeeder);
+    SetLength(capLine, Length(capBus));
+    for f := 1 to p.NumFeeders do
+        for k := 1 to p.CapacitorsPerFeeder do
+        begin
+            s := Max(1, Round(k * p.MainSections / (p.CapacitorsPerFeeder + 1)));
+            capBus[n] := Format('f%d_%d', [f, s]);
+            // Main line sections are the first lines of each feeder
+            capLine[n] := headIdx[f - 1] + s - 1;
+            if not p.Regulators then
+                Inc(capLine[n]);
+            Inc(n);
+        end;
+
+    SetLength(names, Length(capBus));
+    for i := 0 to High(capBus) do
+        names[i] := Format('cap%d', [i + 1]);
+    caps := NewObjects(DSS, DSS.CapacitorClass, names);
+    SetLength(vals, 1);
+    vals[0] := p.Capacitorkvar;
+    for i := 0 to High(caps) do
+    begin
+        obj := caps[i];
+        obj.SetString(ord(TCapacitorProp.Bus1), capBus[i], []);
+        obj.SetDouble(ord(TCapacitorProp.kV), p.FeederkV, []);
+        obj.SetDoubles(ord(TCapacitorProp.kvar), vals, []);
+    end;
+    EndEdit(caps, 3);
+    CheckError(DSS);
+
+    if p.CapControls then
+    begin
+        for i := 0 to High(names) do
+            names[i] := Format('capctrl%d', [i + 1]);
+        objs := NewObjects(DSS, DSS.CapControlClass, names);
+        for i := 0 to High(objs) do
+        begin
+            obj := objs[i];
+            obj.SetObject(ord(TCapControlProp.Element), lines[capLine[i]], []);
+            obj.SetInteger(ord(TCapControlProp.Terminal), 2, []);
+            obj.SetObject(ord(TCapControlProp.Capacitor), caps[i], []);
+            obj.SetInteger(ord(TCapControlProp.typ), CAPCONTROL_VOLTAGE, []);
+            obj.SetDouble(ord(TCapControlProp.PTRatio), kVLN * 1000 / 120, []);
+            obj.SetDouble(ord(TCapControlProp.OnSetting), 118, []);
+            obj.SetDouble(ord(TCapControlProp.OffSetting), 125, []);
+            obj.SetDouble(ord(TCapControlProp.Delay), 30, []);
+        end;
+        EndEdit(objs, 8);
+        CheckError(DSS);
+    end;
+
+    if p.Regulators then
+    begin
+        SetLength(names, p.NumFeeders);
+        for f := 1 to p.NumFeeders do
+            names[f - 1] := Format('reg%d', [f]);
+        objs := NewObjects(DSS, DSS.RegControlClass, names);
+        for i := 0 to High(objs) do
+        begin
+            obj := objs[i];
+            obj.SetObject(ord(TRegControlProp.Transformer), transformers[i + 1], []);
+            obj.SetInteger(ord(TRegControlProp.Winding), 2, []);
+            obj.SetDouble(ord(TRegControlProp.VReg), 122, []);
+            obj.SetDouble(ord(TRegControlProp.Band), 2, []);
+            obj.SetDouble(ord(TRegControlProp.PTRatio), kVLN * 1000 / 120, []);
+        end;
+        EndEdit(objs, 5);
+        CheckError(DSS);
+    end;
+
+    if p.EnergyMeter then
+    begin
+        SetLength(names, 1);
+        names[0] := 'sub';
+        objs := NewObjects(DSS, DSS.EnergyMeterClass, names);
+        objs[0].SetObject(ord(TEnergyMeterProp.Element), transformers[0], []);
+        objs[0].SetInteger(ord(TEnergyMeterProp.Terminal), 1, []);
+        EndEdit(objs, 2);
+        CheckError(DSS);
+    end;
+
+    // Same as in Obj_Circuit_FromJSON_ ("MakeBusList")
+    if ckt.BusNameRedefined then
+        ckt.ReprocessBusDefs();
+
+    SetLength(ckt.LegalVoltageBases, 2);
+    ckt.LegalVoltageBases[0] := p.SourcekV;
+    ckt.LegalVoltageBases[1] := p.FeederkV;
+    if p.SetVoltageBases then
+        ckt.Solution.SetVoltageBases();
+end;
+
+end.
@@ -1933,7 +1933,7 @@ begin
 
         DevListSize := DeviceList.Count;
         DeviceList.Free;
-        DeviceList := THashList.Create(DevListSize);
+        DeviceList := TDeviceHashListType.Create(DevListSize);
 
         for pCktElem in Cktelements do
         begin
@@ -0,0 +1,338 @@
+unit VoltageSensitivity;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Voltage magnitude sensitivities to power injections, from the present
+// factorization of the system Y matrix.
+//
+// A small injection dS at the phase nodes k of a bus changes the injection
+// currents by dI_k = conj(dS_k / V_k). With the system Y fixed (loads and
+// generators in the linearized form used by the normal solution), dV = Z dI:
+// one solve with the existing factors per bus, the same way the unit currents
+// of TSolutionAlgs.ComputeYsc give the columns of Zsc. The magnitudes change
+// by d|V_i| = Re(conj(V_i) dV_i) / |V_i|. Since conj(j dS / V) = -j conj(dS / V),
+// the response to reactive power is -j dV, so each bus needs a single solve
+// for both dV/dP and dV/dQ.
+//
+// The solves run in parallel (ParallelFor). Worker 0 uses the factorization
+// of the circuit, the others a copy of the system Y matrix.
+
+interface
+
+uses
+    UComplex,
+    DSSUcomplex,
+    ArrayDef,
+    DSSClass;
+
+type
+    TPhaseNodes = Array[1..3] of Integer;
+
+    TVoltageSensitivity = class(TObject)
+    private
+        DSS: TDSSContext;
+        NumNodes: Integer;
+        hY: Array of NativeUInt; // per worker; hY[0] is the matrix of the circuit
+        Work: Array of ArrayOfComplex; // right-hand side, per worker
+
+        procedure FreeSolvers();
+    public
+        V0: ArrayOfComplex; // voltages of the base solution, as NodeV
+
+        constructor Create(dssContext: TDSSContext);
+        destructor Destroy; override;
+
+        // Checks that the circuit is solved and prepares the solvers for
+        // NumWorkers workers. Errors are reported with DoSimpleMsg.
+        function Prepare(NumWorkers: Integer): Boolean;
+
+        // Energized phase nodes (1-3) of the bus, as system node refs
+        function PhaseNodes(BusIdx: Integer; var Refs: TPhaseNodes): Integer;
+
+        // Solves Y x = b with the solver of the given worker; x and b as NodeV.
+        // Raises EEsolv32Problem on errors.
+        procedure Solve(Worker: Integer; var x: ArrayOfComplex; const b: ArrayOfComplex);
+
+        // Node voltage change dV (as NodeV) for 1 kW injected at the bus,
+        // split evenly among its energized phase nodes (1-3), with the solver
+        // of the given worker. Returns False if the bus has no such nodes.
+        function BusResponse(BusIdx, Worker: Integer; var dV: ArrayOfComplex): Boolean;
+
+        // d|V| in pu of the node voltage base, for the response dV at node Ref.
+        // For the response to 1 kvar, use dVdQ.
+        function dVdP(const dV: ArrayOfComplex; Ref: Integer): Double;
+        function dVdQ(const dV: ArrayOfComplex; Ref: Integer): Double;
+    end;
+
+// Sensitivities of the voltage magnitude at the output nodes ("bus.node"; all
+// nodes, in the YNodeOrder, if empty) to balanced injections at the buses.
+// Sens is a column-major NumRows x (2 * Length(Buses)) matrix, in pu per kW
+// for the first Length(Buses) columns and pu per kvar for the others.
+function ComputeVoltageSensitivities(DSS: TDSSContext; const Buses, Nodes: Array of String; NumThreads: Integer; var Sens: ArrayOfDouble; out NumRows: Integer): Boolean;
+
+implementation
+
+uses
+    SysUtils,
+    Math,
+    DSSGlobals,
+    Circuit,
+    Bus,
+    Solution,
+    YMatrix,
+    KLUSolve,
+    ParallelLoop,
+    DSSHelper;
+
+type
+    TSensitivityRunner = class(TObject)
+    public
+        Calc: TVoltageSensitivity;
+        BusIdx: Array of Integer;
+        Rows: Array of Integer; // system node refs
+        dV: Array of ArrayOfComplex; // per worker
+        Sens: ArrayOfDouble;
+        NumRows, NumBuses: Integer;
+
+        procedure SolveBus(Index, Worker: Integer);
+    end;
+
+constructor TVoltageSensitivity.Create(dssContext: TDSSContext);
+begin
+    inherited Create();
+    DSS := dssContext;
+    NumNodes := 0;
+end;
+
+destructor TVoltageSensitivity.Destroy;
+begin
+    FreeSolvers();
+    inherited Destroy;
+end;
+
+procedure TVoltageSensitivity.FreeSolvers();
+var
+    w: Integer;
+begin
+    for w := 1 to High(hY) do
+        if hY[w] <> 0 then
+            DeleteSparseSet(hY[w]);
+    SetLength(hY, 0);
+    SetLength(Work, 0);
+end;
+
+function TVoltageSensitivity.Prepare(NumWorkers: Integer): Boolean;
+var
+    ckt: TDSSCircuit;
+    w: Integer;
+begin
+    Result := False;
+    FreeSolvers();
+    ckt := DSS.ActiveCircuit;
+    if (ckt = NIL) or (not ckt.IsSolved) or ckt.Solution.SystemYChanged or (ckt.Solution.hYsystem = 0)
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+        or (ckt.IncrCktElements.Count <> 0)
+{$ENDIF}
+    then
+    begin
+        DoSimpleMsg(DSS, _('Voltage sensitivities: the active circuit must be solved first.'), 20240730);
+        Exit;
+    end;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    ApplyLowRankUpdates(DSS); // the solves use the factorization directly
+{$ENDIF}
+
+    NumNodes := ckt.NumNodes;
+    SetLength(V0, NumNodes + 1);
+    Move(ckt.Solution.NodeV[0], V0[0], (NumNodes + 1) * SizeOf(Complex));
+
+    SetLength(hY, Max(NumWorkers, 1));
+    SetLength(Work, Length(hY));
+    hY[0] := ckt.Solution.hYsystem;
+    try
+        for w := 1 to High(hY) do
+            hY[w] := NewSystemYCopy(DSS);
+    except
+        on E: EEsolv32Problem do
+        begin
+            DoSimpleMsg(DSS, 'Voltage sensitivities: %s', [E.Message], 20240731);
+            FreeSolvers();
+            Exit;
+        end;
+    end;
+    for w := 0 to High(Work) do
+        SetLength(Work[w], NumNodes + 1);
+    Result := True;
+end;
+
+function TVoltageSensitivity.PhaseNodes(BusIdx: Integer; var Refs: TPhaseNodes): Integer;
+var
+    pBus: TDSSBus;
+    k, ref: Integer;
+begin
+    Result := 0;
+    pBus := DSS.ActiveCircuit.Buses[BusIdx];
+    for k := 1 to 3 do
+    begin
+        ref := pBus.Find(k);
+        if (ref > 0) and (Cabs(V0[ref]) > 0) then
+        begin
+            Inc(Result);
+            Refs[Result] := ref;
+        end;
+    end;
+end;
+
+procedure TVoltageSensitivity.Solve(Worker: Integer; var x: ArrayOfComplex; const b: ArrayOfComplex);
+begin
+    SetLength(x, NumNodes + 1);
+    if SolveSparseSet(hY[Worker], pComplexArray(@x[1]), pComplexArray(@b[1])) < 1 then
+        raise EEsolv32Problem.Create('Error Solving System Y Matrix in TVoltageSensitivity. Problem with Sparse matrix solver.');
+end;
+
+function TVoltageSensitivity.BusResponse(BusIdx, Worker: Integer; var dV: ArrayOfComplex): Boolean;
+var
+    b: ArrayOfComplex;
+    refs: TPhaseNodes;
+    np, k: Integer;
+    dS: Complex;
+begin
+    Result := False;
+    np := PhaseNodes(BusIdx, refs);
+    if np = 0 then
+        Exit;
+
+    b := Work[Worker];
+    for k := 1 to NumNodes do
+        b[k] := 0;
+    dS := Cmplx(1000.0 / np, 0);
+    for k := 1 to np do
+        b[refs[k]] := cong(dS / V0[refs[k]]);
+
+    Solve(Worker, dV, b);
+    Result := True;
+end;
+
+function TVoltageSensitivity.dVdP(const dV: ArrayOfComplex; Ref: Integer): Double;
+var
+    vmag, vbase: Double;
+begin
+    Result := 0;
+    vmag := Cabs(V0[Ref]);
+    vbase := DSS.ActiveCircuit.Solution.NodeVbase[Ref];
+    if (vmag = 0) or (vbase = 0) then
+        Exit;
+    Result := (V0[Ref].re * dV[Ref].re + V0[Ref].im * dV[Ref].im) / (vmag * vbase);
+end;
+
+function TVoltageSensitivity.dVdQ(const dV: ArrayOfComplex; Ref: Integer): Double;
+// Re(conj(V) (-j dV)) = Im(conj(V) dV)
+var
+    vmag, vbase: Double;
+begin
+    Result := 0;
+    vmag := Cabs(V0[Ref]);
+    vbase := DSS.ActiveCircuit.Solution.NodeVbase[Ref];
+    if (vmag = 0) or (vbase = 0) then
+        Exit;
+    Result := (V0[Ref].re * dV[Ref].im - V0[Ref].im * dV[Ref].re) / (vmag * vbase);
+end;
+
+procedure TSensitivityRunner.SolveBus(Index, Worker: Integer);
+var
+    i: Integer;
+begin
+    // Columns of buses without phase nodes are left as zero
+    if not Calc.BusResponse(BusIdx[Index], Worker, dV[Worker]) then
+        Exit;
+    for i := 0 to NumRows - 1 do
+    begin
+        Sens[Index * NumRows + i] := Calc.dVdP(dV[Worker], Rows[i]);
+        Sens[(NumBuses + Index) * NumRows + i] := Calc.dVdQ(dV[Worker], Rows[i]);
+    end;
+end;
+
+function ComputeVoltageSensitivities(DSS: TDSSContext; const Buses, Nodes: Array of String; NumThreads: Integer; var Sens: ArrayOfDouble; out NumRows: Integer): Boolean;
+var
+    ckt: TDSSCircuit;
+    runner: TSensitivityRunner;
+    busName: String;
+    i, p, idx, nodeNum: Integer;
+begin
+    Result := False;
+    NumRows := 0;
+    ckt := DSS.ActiveCircuit;
+    runner := TSensitivityRunner.Create();
+    try
+        runner.NumBuses := Length(Buses);
+        SetLength(runner.BusIdx, runner.NumBuses);
+        for i := 0 to High(Buses) do
+        begin
+            runner.BusIdx[i] := ckt.BusList.Find(AnsiLowerCase(Buses[i]));
+            if runner.BusIdx[i] = 0 then
+            begin
+                DoSimpleMsg(DSS, 'Voltage sensitivities: bus "%s" not found.', [Buses[i]], 20240732);
+                Exit;
+            end;
+        end;
+
+        if Length(Nodes) = 0 then
+        begin
+            SetLength(runner.Rows, ckt.NumNodes);
+            for i := 0 to ckt.NumNodes - 1 do
+                runner.Rows[i] := i + 1;
+        end
+        else
+        begin
+            SetLength(runner.Rows, Length(Nodes));
+            for i := 0 to High(Nodes) do
+            begin
+                p := Pos('.', Nodes[i]);
+                idx := 0;
+                nodeNum := 0;
+                if p > 0 then
+                begin
+                    busName := AnsiLowerCase(Copy(Nodes[i], 1, p - 1));
+                    idx := ckt.BusList.Find(busName);
+                    nodeNum := StrToIntDef(Copy(Nodes[i], p + 1, Length(Nodes[i])), 0);
+                end;
+                if (idx > 0) and (nodeNum > 0) then
+                    runner.Rows[i] := ckt.Buses[idx].Find(nodeNum)
+                else
+                    runner.Rows[i] := 0;
+                if runner.Rows[i] = 0 then
+                begin
+                    DoSimpleMsg(DSS, 'Voltage sensitivities: node "%s" not found; use "bus.node".', [Nodes[i]], 20240733);
+                    Exit;
+                end;
+            end;
+        end;
+        runner.NumRows := Length(runner.Rows);
+
+        runner.Calc := TVoltageSensitivity.Create(DSS);
+        if not runner.Calc.Prepare(ParallelLoopWorkers(NumThreads, runner.NumBuses)) then
+            Exit;
+        SetLength(runner.dV, ParallelLoopWorkers(NumThreads, runner.NumBuses));
+        SetLength(runner.Sens, runner.NumRows * 2 * runner.NumBuses);
+        try
+            ParallelFor(runner.NumBuses, runner.SolveBus, NumThreads);
+        except
+            on E: Exception do
+            begin
+                DoSimpleMsg(DSS, 'Voltage sensitivities: %s', [E.Message], 20240731);
+                Exit;
+            end;
+        end;
+        Sens := runner.Sens;
+        NumRows := runner.NumRows;
+        Result := True;
+    finally
+        runner.Calc.Free();
+        runner.Free();
+    end;
+end;
+
+end.
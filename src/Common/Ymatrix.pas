@@ -29,6 +29,15 @@ procedure BuildYMatrix(DSS: TDSSContext; BuildOption: Integer; AllocateVI: Boole
 procedure ResetSparseMatrix(var hY: NativeUint; size: Integer);
 procedure InitializeNodeVbase(ckt: TDSSCircuit);
 function CheckYMatrixforZeroes(ckt: TDSSCircuit): String;
+// Returns a new sparse matrix with the system Y of the enabled elements, e.g.
+// for solves on other threads; the caller must delete it (DeleteSparseSet).
+// Raises EEsolv32Problem on errors.
+function NewSystemYCopy(DSS: TDSSContext): NativeUInt;
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+// Writes the pending low-rank corrections (TSolverOptions.LowRankUpdates) to
+// the system Y matrix. Required before reading or using the matrix directly.
+procedure ApplyLowRankUpdates(DSS: TDSSContext);
+{$ENDIF}
 
 implementation
 
@@ -42,6 +51,10 @@ uses
     GUtil,
     GSet,
     DSSHelper,
+    SolverProfile,
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+    LowRankUpdate,
+{$ENDIF}
     Bus;
 
 
@@ -62,6 +75,7 @@ begin
     for pElem in Ckt.CktElements do
     begin
         pElem.CalcYPrim();
+        Ckt.DSS.SolverProfile.CountYPrim(pElem.ParentClass.DSSClassIndex);
     end;
 end;
 
@@ -79,6 +93,7 @@ begin
         if pElem.YprimInvalid then
         begin
             pElem.CalcYPrim();
+            Ckt.DSS.SolverProfile.CountYPrim(pElem.ParentClass.DSSClassIndex);
         end;
     end;
 {$ENDIF}
@@ -87,6 +102,7 @@ begin
         if pElem.YprimInvalid then // or ((DSSObjType and CLASSMASK) = LOAD_ELEMENT)
         begin
             pElem.CalcYPrim();
+            Ckt.DSS.SolverProfile.CountYPrim(pElem.ParentClass.DSSClassIndex);
         end;
     end;
 end;
@@ -128,16 +144,115 @@ begin
 end;
 
 {$IFDEF DSS_CAPI_INCREMENTAL_Y}
+function ResyncMatrixElements(Ckt: TDSSCircuit; changedElements: TCoordSet; changedNodes: TNodeSet): Boolean;
+// Rewrites the given elements of the system Y matrix from the present YPrims.
+// Returns False if an element doesn't exist in the compressed matrix.
+var
+    pElem: TDSSCktElement;
+    coordIt: TCoordSet.TIterator;
+    i, j, inode, jnode: Integer;
+    val: Complex;
+begin
+    Result := False;
+    coordIt := changedElements.Min;
+    if coordIt <> nil then
+    repeat
+        // Zeroise only the exact elements affected to make it faster
+        if ZeroiseMatrixElement(Ckt.Solution.hYsystem, (coordIt.Data shr 32), coordIt.Data and $FFFFFFFF) = 0 then
+            // If the element doesn't exist in the current compressed matrix, abort!
+            Exit;
+    until not coordIt.Next();
+
+    for pElem in Ckt.CktElements do
+    begin
+        if (not pElem.Enabled) or (pElem.Yprim = NIL) then
+            continue;
+
+        for i := 1 to pElem.Yprim.order do
+        begin
+            inode := pElem.NodeRef[i];
+            if inode = 0 then continue;
+            if changedNodes.Find(inode) = NIL then
+                // nothing changed for node "inode", we can skip it completely
+                continue;
+
+            for j := 1 to pElem.Yprim.order do
+            begin
+                jnode := pElem.NodeRef[j];
+                if jnode = 0 then continue;
+
+                if (changedElements.Find((QWord(inode) shl 32) or (QWord(jnode))) = nil) then
+                    continue;
+
+                val := pElem.Yprim[i, j];
+                if (val.re = 0) and (val.im = 0) then continue;
+
+                if IncrementMatrixElement(Ckt.Solution.hYsystem, inode, jnode, val.re, val.im) = 0 then
+                    Exit;
+            end;
+        end;
+    end;
+    Result := True;
+end;
+
+procedure AddLowRankElements(Ckt: TDSSCircuit; changedElements: TCoordSet; changedNodes: TNodeSet);
+// Marks the elements changed by the pending low-rank corrections, which are
+// then written to the matrix by ResyncMatrixElements
+var
+    LowRank: TLowRankUpdate;
+    i, j: Integer;
+begin
+    LowRank := Ckt.Solution.LowRank;
+    for i := 0 to LowRank.Rank - 1 do
+        for j := 0 to LowRank.Rank - 1 do
+        begin
+            if not LowRank.IsChanged(i, j) then
+                continue;
+            changedNodes.Insert(LowRank.Node(i));
+            changedNodes.Insert(LowRank.Node(j));
+            changedElements.Insert((QWord(LowRank.Node(i)) shl 32) or QWord(LowRank.Node(j)));
+        end;
+end;
+
+procedure ApplyLowRankUpdates(DSS: TDSSContext);
+var
+    Ckt: TDSSCircuit;
+    changedElements: TCoordSet;
+    changedNodes: TNodeSet;
+    ok: Boolean;
+begin
+    Ckt := DSS.ActiveCircuit;
+    if (Ckt = NIL) or (Ckt.Solution.LowRank.Rank = 0) then
+        Exit;
+
+    changedElements := TCoordSet.Create;
+    changedNodes := TNodeSet.Create;
+    try
+        AddLowRankElements(Ckt, changedElements, changedNodes);
+        ok := ResyncMatrixElements(Ckt, changedElements, changedNodes);
+    finally
+        changedElements.Free;
+        changedNodes.Free;
+    end;
+    Ckt.Solution.LowRank.Clear();
+    Inc(DSS.YGeneration);
+    if not ok then
+    begin
+        // Retry with the full matrix
+        Ckt.Solution.SystemYChanged := True;
+        BuildYMatrix(DSS, WHOLEMATRIX, False);
+    end;
+end;
+
 function UpdateYMatrix(Ckt: TDSSCircuit; BuildOption: Integer; AllocateVI: Boolean): Boolean;
 var
     IncrYprim: TCMatrix;
     pElem: TDSSCktElement;
     changedElements: TCoordSet; // elements from the matrix that have been changed
     changedNodes: TNodeSet; // nodes which have affected elements
-    coordIt: TCoordSet.TIterator;
     
     i, j, inode, jnode: Integer;
-    abortIncremental: Boolean;
+    abortIncremental, useLowRank: Boolean;
     val: Complex;
 begin
     changedElements := TCoordSet.Create;
@@ -145,6 +260,7 @@ begin
     Result := False;
     IncrYprim := NIL;
     abortIncremental := False;
+    useLowRank := (Ckt.Solution.SolverOptions and ord(TSolverOptions.LowRankUpdates)) <> 0;
 
     // Incremental Y update, only valid for BuildOption = WHOLEMATRIX.
     for pElem in Ckt.IncrCktElements do
@@ -169,6 +285,7 @@ begin
         IncrYprim.Negate;
         
         pElem.CalcYPrim();
+        Ckt.DSS.SolverProfile.CountYPrim(pElem.ParentClass.DSSClassIndex);
         
         if (pElem.Yprim = NIL) or (IncrYprim.order <> pElem.Yprim.order) then
         begin
@@ -177,6 +294,9 @@ begin
         end;
         
         IncrYprim.AddFrom(pElem.YPrim);
+        if useLowRank then
+            Ckt.Solution.LowRank.AddPrimitive(Ckt.NumNodes, pElem.Yorder, pElem.NodeRef, IncrYprim);
+
         for i := 1 to pElem.Yprim.order do
         begin
             inode := pElem.NodeRef[i];
@@ -204,59 +324,24 @@ begin
         IncrYprim := NIL;
     end;
 
-    if not abortIncremental then
+    if (not abortIncremental) and useLowRank and (Ckt.Solution.LowRank.Rank <= Ckt.Solution.LowRankThreshold) then
     begin
-        coordIt := changedElements.Min;
-        if coordIt <> nil then
-        repeat
-            // Zeroise only the exact elements affected to make it faster
-            if ZeroiseMatrixElement(Ckt.Solution.hYsystem, (coordIt.Data shr 32), coordIt.Data and $FFFFFFFF) = 0 then
-            begin
-                // If the element doesn't exist in the current compressed matrix, abort!
-                abortIncremental := True;
-                break;
-            end;
-        until not coordIt.Next();
+        // Keep the matrix and its factorization; the changes are applied as
+        // low-rank corrections in SolveSystem
+        Ckt.IncrCktElements.Clear;
+        changedElements.Free;
+        changedNodes.Free;
+        Result := True;
+        Exit;
     end;
 
-    for pElem in Ckt.CktElements do
+    if not abortIncremental then
     begin
-        if abortIncremental then break;
-
-        if (not pElem.Enabled) or (pElem.Yprim = NIL) then
-            continue;
-
-        for i := 1 to pElem.Yprim.order do
-        begin
-            inode := pElem.NodeRef[i];
-            if inode = 0 then continue;
-            if changedNodes.Find(inode) = NIL then
-                // nothing changed for node "inode", we can skip it completely
-                continue;
-
-            for j := 1 to pElem.Yprim.order do
-            begin
-                jnode := pElem.NodeRef[j];
-                if jnode = 0 then continue;
-
-                if (changedElements.Find((QWord(inode) shl 32) or (QWord(jnode))) = nil) then
-                    continue;
-
-                val := pElem.Yprim[i, j];
-                if (val.re = 0) and (val.im = 0) then continue;
-
-                if IncrementMatrixElement(Ckt.Solution.hYsystem, inode, jnode, val.re, val.im) = 0 then
-                begin
-                    abortIncremental := True;
-                    break;
-                end;
-            end;
-
-            if abortIncremental then break;
-        end;
-
-        if abortIncremental then break;
+        // Write any pending low-rank corrections too, the matrix is refactorized next
+        AddLowRankElements(Ckt, changedElements, changedNodes);
+        abortIncremental := not ResyncMatrixElements(Ckt, changedElements, changedNodes);
     end;
+    Ckt.Solution.LowRank.Clear();
 
     if abortIncremental then
     begin
@@ -278,12 +363,35 @@ begin
 end;
 {$ENDIF} //DSS_CAPI_INCREMENTAL_Y
 
+function NewSystemYCopy(DSS: TDSSContext): NativeUInt;
+var
+    elem: TDSSCktElement;
+    CMatArray: pComplexArray;
+begin
+    Result := NewSparseSet(DSS.ActiveCircuit.NumNodes);
+    if Result < 1 then
+        raise EEsolv32Problem.Create(_('Error creating System Y Matrix.'));
+    for elem in DSS.ActiveCircuit.CktElements do
+    begin
+        if not elem.Enabled then
+            continue;
+        CMatArray := elem.GetYPrimValues(ALL_YPRIM);
+        if CMatArray <> NIL then
+            if AddPrimitiveMatrix(Result, elem.Yorder, PLongWord(@elem.NodeRef[1]), @CMatArray[1]) < 1 then
+            begin
+                DeleteSparseSet(Result);
+                raise EEsolv32Problem.Create(_('Node index out of range adding to System Y Matrix'));
+            end;
+    end;
+end;
+
 procedure BuildYMatrix(DSS: TDSSContext; BuildOption: Integer; AllocateVI: Boolean);
 // Builds designated Y matrix for system and allocates solution arrays
 var
     YMatrixsize: Integer;
     CmatArray: pComplexArray;
     pElem: TDSSCktElement;
+    t0: Int64;
 {$IFDEF DSS_CAPI_INCREMENTAL_Y}
     Incremental: Boolean;
 {$ENDIF}
@@ -292,6 +400,8 @@ begin
     Incremental := False;
 {$ENDIF}
     DSS.SignalEvent(TAltDSSEvent.BuildSystemY, 0);
+    Inc(DSS.YGeneration); // invalidates the snapshot of the system Y
+    t0 := DSS.SolverProfile.Start();
     CmatArray := NIL;
     with DSS.ActiveCircuit, Solution do
     begin
@@ -304,6 +414,7 @@ begin
             ReprocessBusDefs;      // This changes the node references into the system Y matrix!!
 
         YMatrixSize := NumNodes;
+        SweepPlanInvalid := TRUE; // uses the primitive Y matrices and the topology
 
         case BuildOption of
             WHOLEMATRIX:
@@ -322,7 +433,8 @@ begin
 {$ENDIF}
                     ResetSparseMatrix(hYsystem, YMatrixSize);
 {$IFDEF DSS_CAPI_INCREMENTAL_Y}
-                    KLUSolve.SetOptions(hYsystem, SolverOptions);
+                    LowRank.Clear();
+                    KLUSolve.SetOptions(hYsystem, SolverOptions and $FFFFFF);
                 end;
 {$ENDIF}
                 hY := hYsystem;
@@ -331,7 +443,7 @@ begin
             begin
                 ResetSparseMatrix(hYseries, YMatrixSize);
 {$IFDEF DSS_CAPI_INCREMENTAL_Y}                
-                KLUSolve.SetOptions(hYsystem, SolverOptions);
+                KLUSolve.SetOptions(hYsystem, SolverOptions and $FFFFFF);
 {$ENDIF}
                 hY := hYSeries;
             end;
@@ -417,6 +529,7 @@ begin
             NodeV[0] := 0;
             ReAllocMem(Currents, SizeOf(Complex) * (NumNodes + 1)); // Allocate System current array
             ReAllocMem(AuxCurrents, SizeOf(Complex) * (NumNodes + 1)); // Allocate System current array
+            Inc(DSS.SolutionGeneration); // invalidates any external views of NodeV/Currents
             if (VMagSaved <> NIL) then
                 ReallocMem(VMagSaved, 0);
             if (ErrorSaved <> NIL) then
@@ -450,6 +563,24 @@ begin
             RestoreNodeVfromVbus;
 
     end;
+
+    if DSS.SolverProfile.Enabled then
+    begin
+        // The next solve (in SolveSystem), which factorizes, is attributed to this build
+{$IFDEF DSS_CAPI_INCREMENTAL_Y}
+        if Incremental then
+        begin
+            DSS.SolverProfile.Stop(TSolverProfilePhase.BuildYIncremental, t0);
+            DSS.SolverProfile.PendingFactor := TSolverProfilePhase.KLURefactor;
+        end
+        else
+{$ENDIF}
+        begin
+            DSS.SolverProfile.Stop(TSolverProfilePhase.BuildYFull, t0);
+            DSS.SolverProfile.PendingFactor := TSolverProfilePhase.KLUFactor;
+        end;
+        DSS.SolverProfile.FactorPending := True;
+    end;
     DSS.SignalEvent(TAltDSSEvent.BuildSystemY, 1);
 end;
 
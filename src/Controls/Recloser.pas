@@ -117,6 +117,8 @@ type
         procedure DoPendingAction(const Code, ProxyHdl: Integer); OVERRIDE;   // Do the action that is pending from last sample
         procedure Reset; OVERRIDE;  // Reset to initial defined state
 
+        function OvercurrentTripTime(const PhaseAmps: Array of Double; GroundAmps: Double): Double;
+
         property PresentState: EControlAction read get_PresentState write set_PresentState;
     end;
 
@@ -525,6 +527,69 @@ begin
     end;
 end;
 
+function TRecloserObj.OvercurrentTripTime(const PhaseAmps: Array of Double; GroundAmps: Double): Double;
+// Time to open for the given current magnitudes, as in the first operation
+// (fast curves, if any) of Sample, or -1 if the recloser would not trip.
+// The present OperationCount is ignored, so the delayed curves are only used
+// when the recloser has no fast operations.
+var
+    i, hint: Integer;
+    GroundCurve, PhaseCurve: TTCC_CurveObj;
+    GroundTime, PhaseTime, TimeTest: Double;
+    TDPhase, TDGround: Double;
+begin
+    Result := -1.0;
+    if NumFast < 1 then
+    begin
+        GroundCurve := GroundDelayed;
+        PhaseCurve := PhaseDelayed;
+        TDGround := TDGrDelayed;
+        TDPhase := TDPhDelayed;
+    end
+    else
+    begin
+        GroundCurve := GroundFast;
+        PhaseCurve := PhaseFast;
+        TDGround := TDGrFast;
+        TDPhase := TDPhFast;
+    end;
+
+    GroundTime := -1.0;
+    PhaseTime := -1.0;
+
+    if GroundCurve <> NIL then
+    begin
+        hint := 1;
+        if (GroundInst > 0.0) and (GroundAmps >= GroundInst) then
+            GroundTime := 0.01 + DelayTime
+        else
+            GroundTime := TDGround * GroundCurve.GetTCCTimeHint(GroundAmps / GroundTrip, hint);
+    end;
+
+    if PhaseCurve <> NIL then
+    begin
+        hint := 1;
+        for i := 0 to High(PhaseAmps) do
+        begin
+            if (PhaseInst > 0.0) and (PhaseAmps[i] >= PhaseInst) then
+            begin
+                PhaseTime := 0.01 + DelayTime;
+                Break;
+            end;
+            TimeTest := TDPhase * PhaseCurve.GetTCCTimeHint(PhaseAmps[i] / PhaseTrip, hint);
+            if (TimeTest > 0.0) and ((PhaseTime < 0.0) or (TimeTest < PhaseTime)) then
+                PhaseTime := TimeTest;
+        end;
+    end;
+
+    if GroundTime > 0.0 then
+        Result := GroundTime;
+    if (PhaseTime > 0.0) and ((Result < 0.0) or (PhaseTime < Result)) then
+        Result := PhaseTime;
+    if Result > 0.0 then
+        Result := Result + DelayTime;
+end;
+
 procedure TRecloserObj.Sample;
 var
     i: Integer;
@@ -296,6 +296,9 @@ type
         procedure DoPendingAction(const Code, ProxyHdl: Integer); OVERRIDE;   // Do the action that is pending from last sample
         procedure Reset; OVERRIDE;  // Reset to initial defined state
 
+        function IsOvercurrent(): Boolean;
+        function OvercurrentTripTime(const PhaseAmps: Array of Double; GroundAmps: Double): Double;
+
         property PresentState: EControlAction Read get_PresentState write set_PresentState;
     end;
 
@@ -1323,6 +1326,76 @@ begin
     end;
 end;
 
+function TRelayObj.IsOvercurrent(): Boolean;
+begin
+    Result := (ControlType = CURRENT);
+end;
+
+function TRelayObj.OvercurrentTripTime(const PhaseAmps: Array of Double; GroundAmps: Double): Double;
+// Time to open the breaker for the given current magnitudes, as in the first
+// operation of OvercurrentLogic, or -1 if the relay would not trip.
+// Only the overcurrent settings are read: OperationCount, ArmedForOpen and
+// the control queue are left alone, and the curve lookups use a local hint.
+var
+    i, hint: Integer;
+    GroundTime,
+    PhaseTime,
+    TimeTest: Double;
+begin
+    Result := -1.0;
+    if ControlType <> CURRENT then
+        Exit;
+
+    GroundTime := -1.0;
+    PhaseTime := -1.0;
+    hint := 1;
+
+    if ((GroundCurve <> NIL) or (Delay_Time > 0.0)) and (GroundTrip > 0.0) then
+    begin
+        if (GroundInst > 0.0) and (GroundAmps >= GroundInst) then
+            GroundTime := 0.01 + Breaker_time
+        else
+        if Delay_Time > 0.0 then
+        begin
+            if (GroundAmps >= GroundTrip) then
+                GroundTime := Delay_Time;
+        end
+        else
+            GroundTime := TDGround * GroundCurve.GetTCCTimeHint(GroundAmps / GroundTrip, hint);
+    end;
+
+    if ((PhaseCurve <> NIL) or (Delay_Time > 0.0)) and (PhaseTrip > 0.0) then
+    begin
+        hint := 1;
+        for i := 0 to High(PhaseAmps) do
+        begin
+            if (PhaseInst > 0.0) and (PhaseAmps[i] >= PhaseInst) then
+            begin
+                PhaseTime := 0.01 + Breaker_time;
+                Break;
+            end;
+            if Delay_Time > 0.0 then
+            begin
+                if (PhaseAmps[i] >= PhaseTrip) then
+                    TimeTest := Delay_Time
+                else
+                    TimeTest := -1.0;
+            end
+            else
+                TimeTest := TDPhase * PhaseCurve.GetTCCTimeHint(PhaseAmps[i] / PhaseTrip, hint);
+            if (TimeTest > 0.0) and ((PhaseTime < 0.0) or (TimeTest < PhaseTime)) then
+                PhaseTime := TimeTest;
+        end;
+    end;
+
+    if GroundTime > 0.0 then
+        Result := GroundTime;
+    if (PhaseTime > 0.0) and ((Result < 0.0) or (PhaseTime < Result)) then
+        Result := PhaseTime;
+    if Result > 0.0 then
+        Result := Result + Breaker_time;
+end;
+
 procedure TRelayObj.DistanceLogic;
 var
     i, j: Integer;
@@ -181,7 +181,7 @@ uses
     DSSHelper,
     DSSClassDefs,
     EnergyMeter,
-    MemoryMap_lib,
+    MeterTable,
     TypInfo,
     KLUSolve,
     Solution
@@ -656,7 +656,7 @@ begin
                 DSS.DSSExecutive.DoRemoveCmd;
             ord(Cmd.ExportOverloads):
                 if DSS.EnergyMeterClass.OV_MHandle <> nil then
-                    CloseMHandler(DSS, DSS.EnergyMeterClass.OV_MHandle, DSS.EnergyMeterClass.DI_Dir + PathDelim + 'DI_Overloads' + '.csv', DSS.EnergyMeterClass.OV_Append);
+                    DSS.EnergyMeterClass.CloseTable(DSS.EnergyMeterClass.OV_MHandle, DSS.EnergyMeterClass.DI_Dir + PathDelim + 'DI_Overloads' + '.csv', DSS.EnergyMeterClass.OV_Append, True);
 {$IFDEF DSS_CAPI_PM}
             ord(Cmd.Abort):
                 for i := 0 to High(PMParent.Children) do
@@ -675,7 +675,7 @@ begin
 {$ENDIF}
             ord(Cmd.ExportVViolations):
                 if DSS.EnergyMeterClass.VR_MHandle <> nil then
-                    CloseMHandler(DSS, DSS.EnergyMeterClass.VR_MHandle, DSS.EnergyMeterClass.DI_Dir + PathDelim + 'DI_VoltExceptions' + '.csv', DSS.EnergyMeterClass.VR_Append);
+                    DSS.EnergyMeterClass.CloseTable(DSS.EnergyMeterClass.VR_MHandle, DSS.EnergyMeterClass.DI_Dir + PathDelim + 'DI_VoltExceptions' + '.csv', DSS.EnergyMeterClass.VR_Append, True);
             ord(Cmd.Zsc012):
                 DSS.CmdResult := DSS.DSSExecutive.DoZsc012Cmd; // Get full symmetrical component transformation of Zsc
             ord(Cmd.AllPCEatBus):
@@ -136,7 +136,11 @@ type
         LineTypes,
         EventLogDefault,
         LongLineCorrection,
-        ShowReports
+        ShowReports,
+        DIBinary,
+        DIFiles,
+        DIMemory,
+        ExportFormat
 {$IFDEF DSS_CAPI_PM}
         ,
         NumCPUs,
@@ -696,6 +700,21 @@ begin
                 DSS.SeasonalRating := InterpretYesNo(Param);
             115:
                 DSS.SeasonSignal := Param;
+            ord(Opt.DIBinary):
+                DSS.EnergyMeterClass.DI_Binary := InterpretYesNo(Param);
+            ord(Opt.DIFiles):
+                DSS.EnergyMeterClass.DI_Files := InterpretYesNo(Param);
+            ord(Opt.DIMemory):
+                DSS.EnergyMeterClass.DI_Memory := InterpretYesNo(Param);
+            ord(Opt.ExportFormat):
+                if CompareTextShortest(Param, 'binary') = 0 then
+                    DSS.ExportFormat := TExportFormat.Binary
+                else if CompareTextShortest(Param, 'memory') = 0 then
+                    DSS.ExportFormat := TExportFormat.Memory
+                else if CompareTextShortest(Param, 'csv') = 0 then
+                    DSS.ExportFormat := TExportFormat.CSV
+                else
+                    DoSimpleMsg(DSS, 'Unknown export format: "%s". Use CSV, Binary or Memory.', [Param], 20240764);
 {$IFDEF DSS_CAPI_PM}                
             ord(Opt.ActiveActor):
                 if DSS.Parser.StrValue = '*' then
@@ -1059,6 +1078,21 @@ begin
                     AppendGlobalResult(DSS, DSS.SeasonalRating);
                 115:
                     AppendGlobalResult(DSS, DSS.SeasonSignal);
+                ord(Opt.DIBinary):
+                    AppendGlobalResult(DSS, DSS.EnergyMeterClass.DI_Binary);
+                ord(Opt.DIFiles):
+                    AppendGlobalResult(DSS, DSS.EnergyMeterClass.DI_Files);
+                ord(Opt.DIMemory):
+                    AppendGlobalResult(DSS, DSS.EnergyMeterClass.DI_Memory);
+                ord(Opt.ExportFormat):
+                    case DSS.ExportFormat of
+                        TExportFormat.Binary:
+                            AppendGlobalResult(DSS, 'Binary');
+                        TExportFormat.Memory:
+                            AppendGlobalResult(DSS, 'Memory');
+                    else
+                        AppendGlobalResult(DSS, 'CSV');
+                    end;
 
 {$IFDEF DSS_CAPI_PM}
                 ord(Opt.NumCPUs):
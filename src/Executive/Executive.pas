@@ -286,6 +286,8 @@ begin
         // First get rid of all existing stuff
         ClearAllCircuits_SingleContext(DSS);
         DisposeDSSClasses(DSS);
+        // Refers to the objects just disposed
+        FreeAndNil(DSS.EditTransaction);
         if Resetting then
         begin
             // Now, Start over
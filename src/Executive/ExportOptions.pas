@@ -95,6 +95,7 @@ implementation
 
 uses
     ExportResults,
+    SparseExport,
     Monitor,
     EnergyMeter,
     ParserDel,
@@ -106,6 +107,14 @@ uses
     DSSHelper,
     TypInfo;
 
+const
+    // Exports written through TExportWriter, which honor ExportFormat
+    TableExports = [1, 2, 3, 4, 9, 10, 24, 32, 39, 44];
+    // Y and Yprims, which write a binary file with ExportFormat=Binary
+    SparseExports = [16, 17];
+    // Removed exports, which only show a message
+    RemovedExports = [22, 28..31];
+
 function AssignNewUUID(val: String): TUuid;
 begin
     if Pos('{', val) < 1 then
@@ -132,7 +141,7 @@ var
     FileName: String;
     MVAopt: Integer;
     UEonlyOpt: Boolean;
-    TripletOpt: Boolean;
+    SparseOpt: TSparseExportFormat;
     pMon: TMonitorObj;
     pMeter: TEnergyMeterObj;
     ParamPointer: Integer;
@@ -179,7 +188,7 @@ begin
 
     MVAOpt := 0;
     UEonlyOpt := FALSE;
-    TripletOpt := FALSE;
+    SparseOpt := TSparseExportFormat.Dense;
     PhasesToPlot := ord(TPlotPhases.ThreePhase);  // init this to get rid of compiler warning
     pMeter := NIL;
     Substation := DSS.ActiveCircuit.Name + '_Substation';
@@ -214,18 +223,33 @@ begin
             Parm2 := DSS.Parser.StrValue;
         end;
 
-        17:
-        begin { Trap Sparse Triplet flag  }
+        16, 17:
+        begin { Trap Sparse Triplet, Matrix Market and binary flags  }
             ParamName := DSS.Parser.nextParam;
             Parm2 := AnsiLowerCase(DSS.Parser.strvalue);
-            TripletOpt := FALSE;
+            SparseOpt := TSparseExportFormat.Dense;
+            if DSS.ExportFormat = TExportFormat.Binary then
+                SparseOpt := TSparseExportFormat.Binary;
             if Length(Parm2) > 0 then
-                if Parm2[1] = 't' then
-                    TripletOpt := TRUE;
+                if (Parm2[1] = 't') and (ParamPointer = 17) then
+                    SparseOpt := TSparseExportFormat.Triplet
+                else
+                // Whole keywords only, so that file names are not taken as formats
+                if (Parm2 = 'mtx') or (Parm2 = 'mm') or (Parm2 = 'matrixmarket') then
+                    SparseOpt := TSparseExportFormat.MatrixMarket
+                else
+                if (Parm2 = 'binary') or (Parm2 = 'bin') then
+                    SparseOpt := TSparseExportFormat.Binary
+                else
+                if Parm2 = 'csv' then
+                    SparseOpt := TSparseExportFormat.Dense
+                else
+                    FileName := DSS.Parser.StrValue; // not a format, the alternate file name
         end;
 
         20, 21:
         begin {user-supplied substation and regions}
+            DSS.CIMExporter.NumThreads := 0;
             ParamName := AnsiLowerCase(DSS.Parser.nextParam);
             Parm2 := DSS.Parser.strValue;
             while Length(ParamName) > 0 do
@@ -252,7 +276,10 @@ begin
                     SubGeoUuid := AssignNewUUID(Parm2)
                 else
                 if CompareTextShortest(ParamName, 'rg') = 0 then
-                    RgnUuid := AssignNewUUID(Parm2);
+                    RgnUuid := AssignNewUUID(Parm2)
+                else
+                if CompareTextShortest(ParamName, 'thr') = 0 then
+                    DSS.CIMExporter.NumThreads := DSS.Parser.IntValue;
                 ParamName := AnsiLowerCase(DSS.Parser.nextParam);
                 Parm2 := DSS.Parser.strValue;
             end;
@@ -528,9 +555,9 @@ begin
 {$ENDIF}
             end;
         16:
-            ExportYprim(DSS, Filename);
+            ExportYprim(DSS, Filename, SparseOpt);
         17:
-            ExportY(DSS, Filename, TripletOpt);
+            ExportY(DSS, Filename, SparseOpt);
         18:
             ExportSeqZ(DSS, Filename);
         19:
@@ -630,7 +657,17 @@ begin
     Result := 0;
     DSS.InShowResults := FALSE;
 
-    if not AbortExport then
+    if (not AbortExport) and (DSS.ExportFormat <> TExportFormat.CSV) and
+        not (ParamPointer in TableExports + SparseExports + RemovedExports) then
+        DoSimpleMsg(DSS, 'Warning: export "%s" does not support ExportFormat other than CSV; the file was written in its usual format.', [Parm1], 20240776);
+
+    // With ExportFormat other than CSV, these exports write a ".bin" file or no file at all
+    // The Matrix Market and binary exports of Y and Yprims write a ".mtx" or ".bin" file
+    if ((DSS.ExportFormat <> TExportFormat.CSV) and (ParamPointer in TableExports)) or
+        ((ParamPointer in SparseExports) and (SparseOpt in [TSparseExportFormat.MatrixMarket, TSparseExportFormat.Binary])) then
+        FileName := DSS.GlobalResult;
+
+    if (not AbortExport) and (Length(FileName) <> 0) then
     begin
         SetLastResultFile(DSS, FileName);
         DSS.ParserVars.Add('@lastexportfile', FileName);
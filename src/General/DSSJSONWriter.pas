@@ -0,0 +1,297 @@
+unit DSSJSONWriter;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Streaming JSON writer, used to serialize circuits and batches of objects
+// without building a TJSONData tree for the whole output.
+//
+// The text is appended to a growable buffer as the values are added. With a
+// stream, the buffer is written to it whenever it grows over BUFFER_SIZE, so
+// the memory used does not depend on the size of the output. The writer only
+// keeps the nesting state; keys are written together with their values, so a
+// key without a value is dropped.
+//
+// Numbers and strings are formatted like fpjson does. With Pretty, object
+// members and objects inside arrays go on their own lines; the other array
+// elements are kept on the same line.
+
+interface
+
+uses
+    Classes,
+    fpjson;
+
+type
+    TDSSJSONWriter = class(TObject)
+    private
+        F: TStream;
+        FPretty: Boolean;
+        Buf: AnsiString;
+        BufLen: Integer;
+        Depth: Integer;
+        Count: Array of Integer; // values written at each level
+        IsObject: Array of Boolean;
+        HasBlock: Array of Boolean; // a value was written on its own line
+        PendingKey: String;
+        HasPendingKey: Boolean;
+
+        procedure Write(const S: AnsiString);
+        procedure NewLine(Level: Integer);
+        procedure BeforeValue(Block: Boolean);
+        procedure Open(Obj: Boolean);
+        procedure Close();
+        procedure Flush();
+    public
+        // Stream can be NIL, to keep the whole text in memory (see Text)
+        constructor Create(Stream: TStream; Pretty: Boolean);
+        destructor Destroy(); override;
+
+        procedure BeginObject();
+        procedure EndObject();
+        procedure BeginArray();
+        procedure EndArray();
+        // Name of the next value, in objects
+        procedure Key(const Name: String);
+
+        procedure Add(Value: Double);
+        procedure AddInt(Value: Int64);
+        procedure AddBool(Value: Boolean);
+        procedure AddStr(const Value: String);
+        procedure AddNull();
+        // Writes a TJSONData value, for the parts still produced as trees
+        procedure AddData(Value: TJSONData);
+
+        // Writes the remaining text to the stream
+        procedure Finish();
+        // The text written, without a stream
+        function Text(): AnsiString;
+
+        property Pretty: Boolean read FPretty;
+    end;
+
+implementation
+
+uses
+    SysUtils,
+    Math;
+
+const
+    BUFFER_SIZE = 1 shl 16;
+
+constructor TDSSJSONWriter.Create(Stream: TStream; Pretty: Boolean);
+begin
+    inherited Create();
+    F := Stream;
+    FPretty := Pretty;
+    SetLength(Buf, BUFFER_SIZE);
+    BufLen := 0;
+    Depth := 0;
+    SetLength(Count, 16);
+    SetLength(IsObject, 16);
+    SetLength(HasBlock, 16);
+    Count[0] := 0;
+    IsObject[0] := False;
+    HasBlock[0] := False;
+    HasPendingKey := False;
+end;
+
+destructor TDSSJSONWriter.Destroy();
+begin
+    Buf := '';
+    inherited Destroy();
+end;
+
+procedure TDSSJSONWriter.Write(const S: AnsiString);
+var
+    n: Integer;
+begin
+    n := Length(S);
+    if n = 0 then
+        Exit;
+    if BufLen + n > Length(Buf) then
+    begin
+        if (F <> NIL) and (BufLen > 0) then
+            Flush();
+        if BufLen + n > Length(Buf) then
+            SetLength(Buf, Max(2 * Length(Buf), BufLen + n));
+    end;
+    Move(S[1], Buf[BufLen + 1], n);
+    BufLen := BufLen + n;
+end;
+
+procedure TDSSJSONWriter.Flush();
+begin
+    if BufLen > 0 then
+        F.WriteBuffer(Buf[1], BufLen);
+    BufLen := 0;
+end;
+
+procedure TDSSJSONWriter.NewLine(Level: Integer);
+begin
+    Write(#10 + StringOfChar(' ', 2 * Level));
+end;
+
+procedure TDSSJSONWriter.BeforeValue(Block: Boolean);
+begin
+    if Depth = 0 then
+        Exit;
+
+    if Count[Depth] > 0 then
+        Write(',');
+    Inc(Count[Depth]);
+
+    if IsObject[Depth] then
+    begin
+        if FPretty then
+        begin
+            NewLine(Depth);
+            HasBlock[Depth] := True;
+        end;
+        Write('"' + StringToJSONString(PendingKey) + '":');
+        if FPretty then
+            Write(' ');
+        HasPendingKey := False;
+        Exit;
+    end;
+
+    if FPretty then
+    begin
+        if Block then
+        begin
+            NewLine(Depth);
+            HasBlock[Depth] := True;
+        end
+        else if Count[Depth] > 1 then
+            Write(' ');
+    end;
+end;
+
+procedure TDSSJSONWriter.Key(const Name: String);
+begin
+    PendingKey := Name;
+    HasPendingKey := True;
+end;
+
+procedure TDSSJSONWriter.Open(Obj: Boolean);
+begin
+    BeforeValue(Obj);
+    if Obj then
+        Write('{')
+    else
+        Write('[');
+    Inc(Depth);
+    if Depth >= Length(Count) then
+    begin
+        SetLength(Count, 2 * Length(Count));
+        SetLength(IsObject, Length(Count));
+        SetLength(HasBlock, Length(Count));
+    end;
+    Count[Depth] := 0;
+    IsObject[Depth] := Obj;
+    HasBlock[Depth] := False;
+end;
+
+procedure TDSSJSONWriter.Close();
+begin
+    if FPretty and HasBlock[Depth] then
+        NewLine(Depth - 1);
+    if IsObject[Depth] then
+        Write('}')
+    else
+        Write(']');
+    Dec(Depth);
+end;
+
+procedure TDSSJSONWriter.BeginObject();
+begin
+    Open(True);
+end;
+
+procedure TDSSJSONWriter.EndObject();
+begin
+    Close();
+end;
+
+procedure TDSSJSONWriter.BeginArray();
+begin
+    Open(False);
+end;
+
+procedure TDSSJSONWriter.EndArray();
+begin
+    Close();
+end;
+
+procedure TDSSJSONWriter.Add(Value: Double);
+var
+    s: String;
+begin
+    if IsNaN(Value) or IsInfinite(Value) then
+    begin
+        AddNull();
+        Exit;
+    end;
+    BeforeValue(False);
+    // Same as TJSONFloatNumber
+    Str(Value, s);
+    if (Length(s) > 0) and (s[1] = ' ') then
+        Delete(s, 1, 1);
+    Write(s);
+end;
+
+procedure TDSSJSONWriter.AddInt(Value: Int64);
+begin
+    BeforeValue(False);
+    Write(IntToStr(Value));
+end;
+
+procedure TDSSJSONWriter.AddBool(Value: Boolean);
+begin
+    BeforeValue(False);
+    if Value then
+        Write('true')
+    else
+        Write('false');
+end;
+
+procedure TDSSJSONWriter.AddStr(const Value: String);
+begin
+    BeforeValue(False);
+    Write('"' + StringToJSONString(Value) + '"');
+end;
+
+procedure TDSSJSONWriter.AddNull();
+begin
+    BeforeValue(False);
+    Write('null');
+end;
+
+procedure TDSSJSONWriter.AddData(Value: TJSONData);
+begin
+    if Value = NIL then
+    begin
+        AddNull();
+        Exit;
+    end;
+    BeforeValue(Value is TJSONObject);
+    Write(Value.FormatJSON([foSingleLineArray, foSingleLineObject, foskipWhiteSpace], 0));
+end;
+
+procedure TDSSJSONWriter.Finish();
+begin
+    if F <> NIL then
+        Flush();
+end;
+
+function TDSSJSONWriter.Text(): AnsiString;
+begin
+    SetLength(Buf, BufLen);
+    Result := Buf;
+    Buf := '';
+    BufLen := 0;
+end;
+
+end.
@@ -10,6 +10,7 @@ uses
     ArrayDef,
     CAPI_Types,
     fpjson,
+    DSSJSONWriter,
     UComplex, DSSUcomplex;
 
 type
@@ -46,6 +47,8 @@ type
         function ParseObjPropertyValue(Obj: Pointer; Index: Integer; const Value: String; out prevInt: Integer; setterFlags: TDSSPropertySetterFlags): Boolean;
         function GetObjPropertyValue(obj: Pointer; Index: Integer; out PropStr: String): Boolean;
         function GetObjPropertyJSONValue(obj: Pointer; Index: Integer; joptions: Integer; var val: TJSONData; preferArray: Boolean = False): Boolean;
+        // Writes the same value as GetObjPropertyJSONValue(..., preferArray=True)
+        function WriteObjPropertyJSON(obj: Pointer; Index: Integer; joptions: Integer; W: TDSSJSONWriter): Boolean;
         function SetObjPropertyJSONValue(obj: Pointer; var Index: Integer; joptions: Integer; val: TJSONData; setterFlags: TDSSPropertySetterFlags; var prevInt: Integer): Boolean;
 
         //TODO: add error as result for the 16 following functions
@@ -1517,6 +1520,131 @@ begin
     Result := False;
 end;
 
+procedure WriteDSSArray_JSON(W: TDSSJSONWriter; n: Integer; dbls: pDoubleArray; scale: Double);
+var
+    i: Integer;
+begin
+    if dbls = NIL then
+    begin
+        W.AddNull();
+        Exit;
+    end;
+    W.BeginArray();
+    if scale = 1 then
+    begin
+        for i := 1 to n do
+            W.Add(dbls^[i]);
+    end
+    else
+    begin
+        for i := 1 to n do
+            W.Add(dbls^[i] / scale);
+    end;
+    W.EndArray();
+end;
+
+function TDSSClassHelper.WriteObjPropertyJSON(obj: Pointer; Index: Integer; joptions: Integer; W: TDSSJSONWriter): Boolean;
+// The most common property types are written directly; the others still go
+// through a (small) TJSONData from GetObjPropertyJSONValue.
+var
+    val: TJSONData = NIL;
+    ptype: TPropertyType;
+    c: PComplex;
+    Norder: Integer;
+begin
+    if PropertyArrayAlternative[Index] <> 0 then
+    begin
+        Result := WriteObjPropertyJSON(obj, PropertyArrayAlternative[Index], joptions, W);
+        Exit;
+    end;
+
+    if not ((Index > 0) and (Index <= NumProperties) and (PropertyOffset[Index] <> -1)) then
+    begin
+        Result := False;
+        Exit;
+    end;
+
+    Result := True;
+    ptype := PropertyType[Index];
+    case ptype of
+        TPropertyType.DoubleProperty:
+        begin
+            W.Add(GetObjDouble(obj, Index)); // NaN is written as null
+            Exit;
+        end;
+        TPropertyType.MappedIntEnumProperty,
+        TPropertyType.IntegerProperty:
+        begin
+            W.AddInt(GetObjInteger(obj, Index));
+            Exit;
+        end;
+        TPropertyType.BooleanActionProperty,
+        TPropertyType.EnabledProperty,
+        TPropertyType.BooleanProperty:
+        begin
+            W.AddBool(GetObjInteger(obj, Index) <> 0);
+            Exit;
+        end;
+        TPropertyType.ComplexProperty:
+        begin
+            c := PComplex(PByte(obj) + PropertyOffset[Index]);
+            W.BeginArray();
+            W.Add(c.re);
+            W.Add(c.im);
+            W.EndArray();
+            Exit;
+        end;
+        TPropertyType.BusProperty,
+        TPropertyType.StringSilentROFunctionProperty,
+        TPropertyType.StringEnumActionProperty,
+        TPropertyType.StringProperty,
+        TPropertyType.MakeLikeProperty:
+            if not (TPropertyFlag.OnArray in PropertyFlags[Index]) then
+            begin
+                W.AddStr(GetObjString(obj, Index));
+                Exit;
+            end;
+        TPropertyType.MappedStringEnumProperty:
+            if not (TPropertyFlag.OnArray in PropertyFlags[Index]) then
+            begin
+                if (joptions and Integer(DSSJSONOptions.EnumAsInt)) <> 0 then
+                    W.AddInt(GetObjInteger(obj, Index))
+                else
+                    W.AddStr(GetObjString(obj, Index));
+                Exit;
+            end;
+        TPropertyType.DoubleArrayProperty,
+        TPropertyType.DoubleDArrayProperty,
+        TPropertyType.DoubleVArrayProperty:
+            if not (TPropertyFlag.ReadByFunction in PropertyFlags[Index]) then
+            begin
+                if TPropertyFlag.SizeIsFunction in PropertyFlags[Index] then
+                    Norder := TIntegerPropertyFunction(Pointer(PropertyOffset3[Index]))(obj)
+                else
+                    Norder := PInteger(PByte(obj) + PropertyOffset2[Index])^;
+
+                if (TPropertyFlag.AllowNone in PropertyFlags[Index]) and (Norder = 0) then
+                    W.AddNull()
+                else
+                    WriteDSSArray_JSON(W, Norder, pDoubleArray(PPDouble(PByte(obj) + PropertyOffset[Index])^), PropertyScale[Index]);
+                Exit;
+            end;
+        TPropertyType.DoubleFArrayProperty:
+        begin
+            WriteDSSArray_JSON(W, PropertyOffset2[Index], pDoubleArray(PDouble(PByte(obj) + PropertyOffset[Index])), PropertyScale[Index]);
+            Exit;
+        end;
+    end;
+
+    try
+        Result := GetObjPropertyJSONValue(obj, Index, joptions, val, True);
+        if Result then
+            W.AddData(val);
+    finally
+        FreeAndNil(val);
+    end;
+end;
+
 function JSON_InterpretDblArrayCSV(DSS: TDSSContext; const CSVFileName: String; CSVColumn: Integer; CSVHeader: Boolean; prevCount: Integer): ArrayOfDouble;
 var
     F: TStream = NIL; // input
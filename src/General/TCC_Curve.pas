@@ -62,6 +62,7 @@ type
         procedure MakeLike(OtherPtr: Pointer); override;
 
         function GetTCCTime(const C_Value: Double): Double;  // Return operating time for a particular time value
+        function GetTCCTimeHint(const C_Value: Double; var Hint: Integer): Double; // Same, with a caller-owned search position (safe for concurrent use)
         function GetUVTime(const V_Value: Double): Double;  // Return operating time for undervoltage relay
         function GetOVTime(const V_Value: Double): Double;  // Return operating time for overvoltage relay
         function Value(i: Integer): Double;  // get C_Value by index
@@ -221,6 +222,11 @@ begin
 end;
 
 function TTCC_CurveObj.GetTCCtime(const C_Value: Double): Double;
+begin
+    Result := GetTCCTimeHint(C_Value, LastValueAccessed);
+end;
+
+function TTCC_CurveObj.GetTCCTimeHint(const C_Value: Double; var Hint: Integer): Double;
 // This function returns the operation time for the value given.
 // If the value is less than the first entry, return = -1 for No operation.
 // Log-Log  interpolation is used.
@@ -243,34 +249,34 @@ begin
             // Start with previous value accessed under the assumption that most
             // of the time, this function will be called sequentially
 
-            if C_Values[LastValueAccessed] > C_Value then
-                LastValueAccessed := 1;  // Start over from beginning
-            for i := LastValueAccessed + 1 to Npts do
+            if (Hint < 1) or (Hint > Npts) or (C_Values[Hint] > C_Value) then
+                Hint := 1;  // Start over from beginning
+            for i := Hint + 1 to Npts do
             begin
                 if C_Values[i] = C_Value then
                 begin
                     Result := T_Values[i];        // direct hit!
-                    LastValueAccessed := i;
+                    Hint := i;
                     Exit;
                 end
 
                 else
                 if C_Values[i] > C_Value then
                 begin   // Log-Log interpolation
-                    LastValueAccessed := i - 1;
+                    Hint := i - 1;
                     if C_value > 0.0 then
                         LogTest := Ln(C_Value)
                     else
                         LogTest := Ln(0.001);
-                    Result := exp(LogT[LastValueAccessed] +
-                        (LogTest - LogC[LastValueAccessed]) / (LogC[i] - LogC[LastValueAccessed]) *
-                        (LogT[i] - LogT[LastValueAccessed]));
+                    Result := exp(LogT[Hint] +
+                        (LogTest - LogC[Hint]) / (LogC[i] - LogC[Hint]) *
+                        (LogT[i] - LogT[Hint]));
                     Exit;
                 end;
             end;
 
             // If we fall through the loop, just use last value
-            LastValueAccessed := Npts - 1;
+            Hint := Npts - 1;
             Result := T_Values[Npts];
         end;
 end;
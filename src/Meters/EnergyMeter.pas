@@ -54,6 +54,7 @@ uses
     Generator,
     XYCurve,
     Command,
+    MeterTable,
     Classes;
 
 const
@@ -213,6 +214,21 @@ type
         destructor Destroy; OVERRIDE;
     end;
 
+{$SCOPEDENUMS ON}
+    // Tables of the demand interval data, as in the C-API
+    TMeterTableID = (
+        Meter = 0, // the registers of a meter at each interval ("<meter>.csv")
+        PhaseVoltageReport = 1, // of a meter
+        DITotals = 2,
+        DISystemMeter = 3,
+        Overloads = 4,
+        VoltExceptions = 5,
+        EnergyMeterTotals = 6,
+        Totals = 7,
+        SystemMeter = 8
+    );
+{$SCOPEDENUMS OFF}
+
     TEnergyMeter = class(TMeterClass)    // derive strait from base class
     PRIVATE
         FSaveDemandInterval: Boolean;
@@ -251,12 +267,12 @@ type
     // *                  EMT_  Energy Meter Totals                                   *
     // *                  PHV_  Phase Voltage Report                                  *
     // *     These prefixes are applied to the variables of each file mapped into     *
-    // *     Memory using the MemoryMap_Lib                                           *
+    // *     memory using the tables of MeterTable                                    *
     // ********************************************************************************
    
     PUBLIC
-        OV_MHandle: TBytesStream;  // a. Handle to the file in memory
-        VR_MHandle: TBytesStream;
+        OV_MHandle: TMeterTable;  // a. Handle to the file in memory
+        VR_MHandle: TMeterTable;
         OV_Append: Boolean;
         VR_Append: Boolean;
         SDI_Append: Boolean;
@@ -264,14 +280,17 @@ type
         SM_Append: Boolean;
         EMT_Append: Boolean;
         FM_Append: Boolean;
+        DI_Binary: Boolean; // write the files as binary tables instead of CSV
+        DI_Files: Boolean; // write the files at all
+        DI_Memory: Boolean; // keep the tables in memory after closing the files
 
         
     PROTECTED
-        SDI_MHandle: TBytesStream;
-        TDI_MHandle: TBytesStream;
-        SM_MHandle: TBytesStream;
-        EMT_MHandle: TBytesStream;
-        FM_MHandle: TBytesStream;
+        SDI_MHandle: TMeterTable;
+        TDI_MHandle: TMeterTable;
+        SM_MHandle: TMeterTable;
+        EMT_MHandle: TMeterTable;
+        FM_MHandle: TMeterTable;
 
 
         procedure DefineProperties; override;
@@ -305,6 +324,11 @@ type
         procedure AppendAllDIFiles();
         procedure OpenAllDIFiles();
         procedure CloseAllDIFiles();
+        // Writes the table to its file (unless DI_Files is off, except for
+        // exports) and frees it (unless DI_Memory is on)
+        procedure CloseTable(var Table: TMeterTable; const Path: String; AppendFile: Boolean; IsExport: Boolean = False);
+        // The table, if any; the tables of a meter (Meter, PhaseVoltageReport) need mtr
+        function GetTable(mtr: TEnergyMeterObj; ID: TMeterTableID): TMeterTable;
         function GetRegisterNames(obj: TDSSObject): ArrayOfString; override;
         function GetRegisterValues(obj: TDSSObject; var numRegisters: Integer): pDoubleArray; override;
 
@@ -389,11 +413,11 @@ type
     // *                  EMT_  Energy Meter Totals                                   *
     // *                  PHV_  Phase Voltage Report                                  *
     // *     These prefixes are applied to the variables of each file mapped into     *
-    // *     Memory using the MemoryMap_Lib                                           *
+    // *     memory using the tables of MeterTable                                    *
     // ********************************************************************************
 
-        DI_MHandle: TBytesStream;
-        PHV_MHandle: TBytesStream;
+        DI_MHandle: TMeterTable;
+        PHV_MHandle: TMeterTable;
 
         RegisterNames: ArrayOfString;
 
@@ -473,9 +497,9 @@ uses
     LineUnits,
     ReduceAlgs,
     Math,
-    MemoryMap_Lib,
     DSSHelper,
     DSSObjectHelper,
+    SolverProfile,
     TypInfo;
 
 type
@@ -539,6 +563,9 @@ begin
     SM_MHandle := NIL;
     EMT_MHandle := NIL;
     FM_MHandle := NIL;
+    DI_Binary := FALSE;
+    DI_Files := TRUE;
+    DI_Memory := FALSE;
 end;
 
 destructor TEnergyMeter.Destroy;
@@ -859,9 +886,10 @@ begin
     if FSaveDemandInterval then
     begin
         CasePath := DSS.OutputDirectory + DSS.ActiveCircuit.CaseName;
+        DI_Dir := CasePath + PathDelim + 'DI_yr_' + Trim(IntToStr(ActiveCircuit.Solution.Year));
         
         //Make directories to save data
-        if not DirectoryExists(CasePath) then
+        if DI_Files and (not DirectoryExists(CasePath)) then
         begin
             try
                 mkDir(CasePath);
@@ -870,8 +898,7 @@ begin
                     DoSimpleMsg('Error making  Directory: "%s". %s', [CasePath, E.Message], 522);
             end;
         end;
-        DI_Dir := CasePath + PathDelim + 'DI_yr_' + Trim(IntToStr(ActiveCircuit.Solution.Year));
-        if not DirectoryExists(DI_Dir) then
+        if DI_Files and (not DirectoryExists(DI_Dir)) then
         begin
             try
                 mkDir(DI_Dir);
@@ -901,7 +928,9 @@ procedure TEnergyMeter.SampleAll;  // Force all EnergyMeters in the circuit to t
 var
     mtr: TEnergyMeterObj;
     i: Integer;
+    t0: Int64;
 begin
+    t0 := DSS.SolverProfile.Start();
     for mtr in DSS.ActiveCircuit.EnergyMeters do
     begin
         if mtr.enabled then
@@ -913,10 +942,10 @@ begin
     if FSaveDemandInterval then
     begin  
         // Write Totals Demand interval file
-        WriteintoMem(TDI_MHandle, DSS.ActiveCircuit.Solution.DynaVars.dblHour);
+        TDI_MHandle.BeginRow(DSS.ActiveCircuit.Solution.DynaVars.dblHour);
         for i := 1 to NumEMRegisters do
-            WriteintoMem(TDI_MHandle, DI_RegisterTotals[i]);
-        WriteintoMemStr(TDI_MHandle, Char(10));
+            TDI_MHandle.Add(DI_RegisterTotals[i]);
+        TDI_MHandle.EndRow();
         ClearDI_Totals;
         if OverLoadFileIsOpen then
             WriteOverloadReport;
@@ -929,6 +958,7 @@ begin
     
     DSS.StorageClass.SampleAll; // samples energymeter part of storage elements (not update)
     DSS.PVSystemClass.SampleAll;
+    DSS.SolverProfile.Stop(TSolverProfilePhase.MeterSample, t0);
 end;
 
 procedure TEnergyMeter.SaveAll;  // Force all EnergyMeters in the circuit to take a sample
@@ -1124,6 +1154,8 @@ begin
         SequenceList.Free;
     if Assigned(LoadList) then
         LoadList.Free;
+    FreeAndNil(DI_MHandle);
+    FreeAndNil(PHV_MHandle);
     
     DefinedZoneList.Free;
 
@@ -2867,16 +2899,17 @@ end;
 procedure TEnergyMeterObj.CloseDemandIntervalFile;
 var
     i: Integer;
+    EMT_MHandle: TMeterTable;
 begin
     try
         if This_Meter_DIFileIsOpen then
         begin
             if DI_MHandle <> NIL then
-                CloseMHandler(DSS, DI_MHandle, MakeDIFileName, DI_Append);
+                DSS.EnergyMeterClass.CloseTable(DI_MHandle, MakeDIFileName, DI_Append);
             This_Meter_DIFileIsOpen := FALSE;
             if PHV_MHandle <> NIL then
                 if VPhaseReportFileIsOpen then
-                    CloseMHandler(DSS, PHV_MHandle, MakeVPhaseReportFileName, PHV_Append);
+                    DSS.EnergyMeterClass.CloseTable(PHV_MHandle, MakeVPhaseReportFileName, PHV_Append);
             VPhaseReportFileIsOpen := FALSE;
         end;
     except
@@ -2885,17 +2918,19 @@ begin
     end;
 
     // Write Registers to Totals File
-    WriteintoMemStr(DSS.EnergyMeterClass.EMT_MHandle, '"' + Self.Name + '"');
+    EMT_MHandle := DSS.EnergyMeterClass.EMT_MHandle;
+    EMT_MHandle.BeginRow();
+    EMT_MHandle.AddText('"' + Self.Name + '"');
     for i := 1 to NumEMregisters do
-        WriteintoMem(DSS.EnergyMeterClass.EMT_MHandle, Registers[i]);
-    WriteintoMemStr(DSS.EnergyMeterClass.EMT_MHandle, Char(10));
+        EMT_MHandle.Add(Registers[i]);
+    EMT_MHandle.EndRow();
 end;
 
 procedure TEnergyMeterObj.OpenDemandIntervalFile;
 var
     i, j: Integer;
     vbase: Double;
-    regName: String;
+    regName, Header: String;
 begin
     try
         if This_Meter_DIFileIsOpen then
@@ -2904,19 +2939,17 @@ begin
         if (DSS.EnergyMeterClass.DI_Verbose) then
         begin
             This_Meter_DIFileIsOpen := TRUE;
-            if DI_MHandle <> NIL then
-                DI_MHandle.free;
-            DI_MHandle := Create_Meter_Space('"Hour"');
+            FreeAndNil(DI_MHandle);
+            Header := '"Hour"';
             for regName in RegisterNames do
-                WriteintoMemStr(DI_MHandle, ', "' + regName + '"');
-            WriteintoMemStr(DI_MHandle, Char(10));
+                Header := Header + ', "' + regName + '"';
+            DI_MHandle := TMeterTable.Create(Header);
 
             // Phase Voltage Report, if requested
             if FPhaseVoltageReport then
             begin
-                if PHV_MHandle <> NIL then
-                    PHV_MHandle.Free;
-                PHV_MHandle := Create_Meter_Space('"Hour"');
+                FreeAndNil(PHV_MHandle);
+                Header := '"Hour"';
                 VPhaseReportFileIsOpen := TRUE;
                 for i := 1 to MaxVBaseCount do
                 begin
@@ -2924,14 +2957,14 @@ begin
                     if Vbase > 0.0 then
                     begin
                         for j := 1 to 3 do
-                            WriteintoMemStr(PHV_MHandle, Format(', %.3gkV_Phs_%d_Max', [vbase, j]));
+                            Header := Header + Format(', %.3gkV_Phs_%d_Max', [vbase, j]);
                         for j := 1 to 3 do
-                            WriteintoMemStr(PHV_MHandle, Format(', %.3gkV_Phs_%d_Min', [vbase, j]));
+                            Header := Header + Format(', %.3gkV_Phs_%d_Min', [vbase, j]);
                         for j := 1 to 3 do
-                            WriteintoMemStr(PHV_MHandle, Format(', %.3gkV_Phs_%d_Avg', [vbase, j]));
+                            Header := Header + Format(', %.3gkV_Phs_%d_Avg', [vbase, j]);
                     end;
                 end;
-                WriteintoMemStr(PHV_MHandle, ', Min Bus, MaxBus' + Char(10));
+                PHV_MHandle := TMeterTable.Create(Header + ', Min Bus, MaxBus');
             end;
 
         end;
@@ -2956,10 +2989,10 @@ var
 begin
     if DSS.EnergyMeterClass.DI_Verbose and This_Meter_DIFileIsOpen then
     begin
-        WriteintoMem(DI_MHandle, DSS.ActiveCircuit.Solution.DynaVars.dblHour);
+        DI_MHandle.BeginRow(DSS.ActiveCircuit.Solution.DynaVars.dblHour);
         for i := 1 to NumEMRegisters do
-            WriteintoMem(DI_MHandle, Derivatives[i]);
-        WriteIntoMemStr(DI_MHandle, Char(10));
+            DI_MHandle.Add(Derivatives[i]);
+        DI_MHandle.EndRow();
     end;
 
     // Add to Class demand interval registers
@@ -2970,18 +3003,18 @@ begin
     // Phase Voltage Report, if requested
     if VPhaseReportFileIsOpen then
     begin
-        WriteintoMem(PHV_MHandle, DSS.ActiveCircuit.Solution.DynaVars.dblHour);
+        PHV_MHandle.BeginRow(DSS.ActiveCircuit.Solution.DynaVars.dblHour);
         for i := 1 to MaxVBaseCount do
             if VBaseList[i] > 0.0 then
             begin
                 for j := 1 to 3 do
-                    WriteintoMem(PHV_MHandle, 0.001 * VPhaseMax[jiIndex(j, i)]);
+                    PHV_MHandle.Add(0.001 * VPhaseMax[jiIndex(j, i)]);
                 for j := 1 to 3 do
-                    WriteintoMem(PHV_MHandle, 0.001 * VPhaseMin[jiIndex(j, i)]);
+                    PHV_MHandle.Add(0.001 * VPhaseMin[jiIndex(j, i)]);
                 for j := 1 to 3 do
-                    WriteintoMem(PHV_MHandle, 0.001 * MyCount_Avg(VPhaseAccum[jiIndex(j, i)], VPhaseAccumCount[jiIndex(j, i)]));
+                    PHV_MHandle.Add(0.001 * MyCount_Avg(VPhaseAccum[jiIndex(j, i)], VPhaseAccumCount[jiIndex(j, i)]));
             end;
-        WriteintoMemStr(PHV_MHandle, Char(10));
+        PHV_MHandle.EndRow();
     end;
 end;
 
@@ -3032,25 +3065,62 @@ begin
         SystemMeter.CloseDemandIntervalFile;
         SystemMeter.Save;
         if EMT_MHandle <> NIL then
-            CloseMHandler(DSS, EMT_MHandle, DI_Dir + PathDelim + 'EnergyMeterTotals' + DSS._Name + '.csv', EMT_Append);
+            CloseTable(EMT_MHandle, DI_Dir + PathDelim + 'EnergyMeterTotals' + DSS._Name + '.csv', EMT_Append);
         if TDI_MHandle <> NIL then
-            CloseMHandler(DSS, TDI_MHandle, DI_Dir + PathDelim + 'DI_Totals' + DSS._Name + '.csv', TDI_Append);
+            CloseTable(TDI_MHandle, DI_Dir + PathDelim + 'DI_Totals' + DSS._Name + '.csv', TDI_Append);
         DSS.DIFilesAreOpen := FALSE;
         if OverloadFileIsOpen then
         begin
             if OV_MHandle <> NIL then
-                CloseMHandler(DSS, OV_MHandle, DSS.EnergyMeterClass.DI_Dir + PathDelim + 'DI_Overloads' + DSS._Name + '.csv', OV_Append);
+                CloseTable(OV_MHandle, DI_Dir + PathDelim + 'DI_Overloads' + DSS._Name + '.csv', OV_Append);
             OverloadFileIsOpen := FALSE;
         end;
         if VoltageFileIsOpen then
         begin
             if VR_MHandle <> NIL then
-                CloseMHandler(DSS, VR_MHandle, DSS.EnergyMeterClass.DI_Dir + PathDelim + 'DI_VoltExceptions' + DSS._Name + '.csv', VR_Append);
+                CloseTable(VR_MHandle, DI_Dir + PathDelim + 'DI_VoltExceptions' + DSS._Name + '.csv', VR_Append);
             VoltageFileIsOpen := FALSE;
         end;
     end;
 end;
 
+procedure TEnergyMeter.CloseTable(var Table: TMeterTable; const Path: String; AppendFile: Boolean; IsExport: Boolean);
+begin
+    if Table = NIL then
+        Exit;
+    if DI_Files or IsExport then
+        SaveMeterTable(DSS, Table, Path, AppendFile, DI_Binary);
+    if not DI_Memory then
+        FreeAndNil(Table);
+end;
+
+function TEnergyMeter.GetTable(mtr: TEnergyMeterObj; ID: TMeterTableID): TMeterTable;
+begin
+    Result := NIL;
+    case ID of
+        TMeterTableID.Meter:
+            if mtr <> NIL then
+                Result := mtr.DI_MHandle;
+        TMeterTableID.PhaseVoltageReport:
+            if mtr <> NIL then
+                Result := mtr.PHV_MHandle;
+        TMeterTableID.DITotals:
+            Result := TDI_MHandle;
+        TMeterTableID.DISystemMeter:
+            Result := SDI_MHandle;
+        TMeterTableID.Overloads:
+            Result := OV_MHandle;
+        TMeterTableID.VoltExceptions:
+            Result := VR_MHandle;
+        TMeterTableID.EnergyMeterTotals:
+            Result := EMT_MHandle;
+        TMeterTableID.Totals:
+            Result := FM_MHandle;
+        TMeterTableID.SystemMeter:
+            Result := SM_MHandle;
+    end;
+end;
+
 procedure TEnergyMeterObj.AppendDemandIntervalFile;
 var
     FileNm: String;
@@ -3068,9 +3138,8 @@ begin
                 DI_Append := TRUE
             else
                 DI_Append := FALSE;
-            if DI_MHandle <> NIL then
-                DI_MHandle.Free;
-            DI_MHandle := Create_Meter_Space(' ');
+            FreeAndNil(DI_MHandle);
+            DI_MHandle := TMeterTable.Create(''); // no header when appending
             This_Meter_DIFileIsOpen := TRUE;
         end;
     except
@@ -3273,24 +3342,23 @@ begin
                         dVector[i] := dBuffer[i];
                 end;
 
-                WriteintoMem(OV_MHandle, DSS.ActiveCircuit.Solution.DynaVars.dblHour);
-                WriteintoMemStr(OV_MHandle, ', ' + EncloseQuotes(PDelem.FullName));
-                WriteintoMem(OV_MHandle, PDElem.NormAmps);
-                WriteintoMem(OV_MHandle, pdelem.EmergAmps);
+                OV_MHandle.BeginRow(DSS.ActiveCircuit.Solution.DynaVars.dblHour);
+                OV_MHandle.AddText(EncloseQuotes(PDelem.FullName));
+                OV_MHandle.Add(PDElem.NormAmps);
+                OV_MHandle.Add(pdelem.EmergAmps);
                 if PDElem.Normamps > 0.0 then
-                    WriteintoMem(OV_MHandle, Cmax / PDElem.Normamps * 100.0)
+                    OV_MHandle.Add(Cmax / PDElem.Normamps * 100.0)
                 else
-                    WriteintoMem(OV_MHandle, 0.0);
+                    OV_MHandle.Add(0.0);
                 if PDElem.Emergamps > 0.0 then
-                    WriteintoMem(OV_MHandle, Cmax / PDElem.Emergamps * 100.0)
+                    OV_MHandle.Add(Cmax / PDElem.Emergamps * 100.0)
                 else
-                    WriteintoMem(OV_MHandle, 0.0);
-                WriteintoMem(OV_MHandle, ActiveCircuit.Buses[ActiveCircuit.MapNodeToBus[PDElem.NodeRef[1]].BusRef].kVBase);
+                    OV_MHandle.Add(0.0);
+                OV_MHandle.Add(ActiveCircuit.Buses[ActiveCircuit.MapNodeToBus[PDElem.NodeRef[1]].BusRef].kVBase);
                 // Adds the currents in Amps per phase at the end of the report
                 for i := 1 to 3 do
-                    WriteintoMem(OV_MHandle, dVector[i]);
-
-                WriteintoMemStr(OV_MHandle, ' ' + Char(10));
+                    OV_MHandle.Add(dVector[i]);
+                OV_MHandle.EndRow();
 
             end;
         end;
@@ -3308,21 +3376,20 @@ end;
 procedure TEnergyMeter.CreateFDI_Totals;
 var
     mtr: TEnergyMeterObj;
-    regName: String;
+    regName, Header: String;
 begin
     try
-        if TDI_MHandle <> NIL then
-            TDI_MHandle.Free;
-        TDI_MHandle := Create_Meter_Space('Time');
+        FreeAndNil(TDI_MHandle);
+        Header := 'Time';
         mtr := DSS.ActiveCircuit.EnergyMeters.First();  // just get the first one
         if mtr <> NIL then
         begin
             for regName in mtr.RegisterNames do
             begin
-                WriteintoMemStr(TDI_MHandle, ', "' + regName + '"');
+                Header := Header + ', "' + regName + '"';
             end;
         end;
-        WriteintoMemStr(TDI_MHandle, Char(10));
+        TDI_MHandle := TMeterTable.Create(Header);
     except
         On E: Exception do
             DoSimpleMsg('Error creating: "%sDI_Totals%s.csv": %s', [DI_Dir + PathDelim, DSS._Name, E.Message], 539)
@@ -3380,7 +3447,7 @@ begin
     if This_Meter_DIFileIsOpen then with DSS.EnergyMeterClass do
     begin
         File_Path := DSS.EnergyMeterClass.DI_Dir + PathDelim + 'DI_SystemMeter' + DSS._Name + '.csv';
-        CloseMHandler(DSS, SDI_MHandle, File_Path, DSS.EnergyMeterClass.SDI_Append);
+        CloseTable(SDI_MHandle, File_Path, SDI_Append);
         This_Meter_DIFileIsOpen := FALSE;
     end;
 end;
@@ -3430,13 +3497,9 @@ var
 begin
     try
         cls := DSS.EnergyMeterClass;
-        if This_Meter_DIFileIsOpen then
-            cls.SDI_MHandle.Free;
         This_Meter_DIFileIsOpen := TRUE;
-        if cls.SDI_MHandle <> NIL then
-            cls.SDI_MHandle.free;
-        cls.SDI_MHandle := Create_Meter_Space('"Hour", ');
-        WriteintoMemStr(cls.SDI_MHandle, 'kWh, kvarh, "Peak kW", "peak kVA", "Losses kWh", "Losses kvarh", "Peak Losses kW"' + Char(10));
+        FreeAndNil(cls.SDI_MHandle);
+        cls.SDI_MHandle := TMeterTable.Create('"Hour", kWh, kvarh, "Peak kW", "peak kVA", "Losses kWh", "Losses kvarh", "Peak Losses kW"');
     except
         On E: Exception do
             DoSimpleMsg(DSS, 'Error opening demand interval file "DI_SystemMeter%s.csv" for writing.', [DSS._Name, CRLF + E.Message], 541);
@@ -3475,16 +3538,15 @@ begin
 
     cls := DSS.EnergyMeterClass;
     try
-        if cls.SM_MHandle <> NIL then
-            FreeAndNil(cls.SM_MHandle);
-        cls.SM_MHandle := Create_Meter_Space('Year, ');
-        WriteintoMemStr(cls.SM_MHandle, 'kWh, kvarh, "Peak kW", "peak kVA", "Losses kWh", "Losses kvarh", "Peak Losses kW"' + Char(10));
-        WriteintoMemStr(cls.SM_MHandle, inttostr(DSS.ActiveCircuit.Solution.Year));
+        FreeAndNil(cls.SM_MHandle);
+        cls.SM_MHandle := TMeterTable.Create('Year, kWh, kvarh, "Peak kW", "peak kVA", "Losses kWh", "Losses kvarh", "Peak Losses kW"', False);
+        cls.SM_MHandle.BeginRow();
+        cls.SM_MHandle.AddInt(DSS.ActiveCircuit.Solution.Year);
         WriteRegisters();
-        WriteintoMemStr(cls.SM_MHandle, Char(10));
+        cls.SM_MHandle.EndRow();
 
     finally
-        CloseMHandler(DSS, cls.SM_MHandle, Folder + CSVName, cls.SM_Append);
+        cls.CloseTable(cls.SM_MHandle, Folder + CSVName, cls.SM_Append);
     end;
 end;
 
@@ -3517,46 +3579,45 @@ end;
 procedure TEnergyMeter.CreateMeterTotals;
 var
     mtr: TEnergyMeterObj;
-    regName: String;
+    regName, Header: String;
 begin
-    if EMT_MHandle <> NIL then
-        EMT_MHandle.Free;
-    EMT_MHandle := Create_Meter_Space('Name');
+    FreeAndNil(EMT_MHandle);
+    Header := 'Name';
     mtr := DSS.ActiveCircuit.EnergyMeters.First();
     if Assigned(mtr) then
         for regName in mtr.RegisterNames do
-            WriteintoMemStr(EMT_MHandle, ', "' + regName + '"');
-    WriteintoMemStr(EMT_MHandle, Char(10));
+            Header := Header + ', "' + regName + '"';
+    EMT_MHandle := TMeterTable.Create(Header, False);
 end;
 
 procedure TSystemMeter.WriteDemandIntervalData;
 var
-    SDI_MHandle: TBytesStream;
+    SDI_MHandle: TMeterTable;
 begin
     SDI_MHandle := DSS.EnergyMeterClass.SDI_MHandle;
-    WriteintoMem(SDI_MHandle, DSS.ActiveCircuit.Solution.DynaVars.dblHour);
-    WriteintoMem(SDI_MHandle, cPower.re);
-    WriteintoMem(SDI_MHandle, cPower.im);
-    WriteintoMem(SDI_MHandle, peakkW);
-    WriteintoMem(SDI_MHandle, peakkVA);
-    WriteintoMem(SDI_MHandle, cLosses.re);
-    WriteintoMem(SDI_MHandle, cLosses.im);
-    WriteintoMem(SDI_MHandle, PeakLosseskW);
-    WriteintoMemStr(SDI_MHandle, Char(10));
+    SDI_MHandle.BeginRow(DSS.ActiveCircuit.Solution.DynaVars.dblHour);
+    SDI_MHandle.Add(cPower.re);
+    SDI_MHandle.Add(cPower.im);
+    SDI_MHandle.Add(peakkW);
+    SDI_MHandle.Add(peakkVA);
+    SDI_MHandle.Add(cLosses.re);
+    SDI_MHandle.Add(cLosses.im);
+    SDI_MHandle.Add(PeakLosseskW);
+    SDI_MHandle.EndRow();
 end;
 
 procedure TSystemMeter.WriteRegisters();
 var
-    SM_MHandle: TBytesStream;
+    SM_MHandle: TMeterTable;
 begin
     SM_MHandle := DSS.EnergyMeterClass.SM_MHandle;
-    WriteintoMem(SM_MHandle, kWh);
-    WriteintoMem(SM_MHandle, kvarh);
-    WriteintoMem(SM_MHandle, peakkW);
-    WriteintoMem(SM_MHandle, peakkVA);
-    WriteintoMem(SM_MHandle, Losseskwh);
-    WriteintoMem(SM_MHandle, Losseskvarh);
-    WriteintoMem(SM_MHandle, PeakLosseskW);
+    SM_MHandle.Add(kWh);
+    SM_MHandle.Add(kvarh);
+    SM_MHandle.Add(peakkW);
+    SM_MHandle.Add(peakkVA);
+    SM_MHandle.Add(Losseskwh);
+    SM_MHandle.Add(Losseskvarh);
+    SM_MHandle.Add(PeakLosseskW);
 end;
 
 procedure TEnergyMeter.Set_DI_Verbose(const Value: Boolean);
@@ -3575,7 +3636,7 @@ var
     mtr: TEnergyMeterObj;
     Regsum: TRegisterArray;
     i: Integer;
-    regName: String;
+    regName, Header: String;
 begin
     // Sum up all registers of all meters and write to Totals.csv
     for i := 1 to NumEMRegisters do
@@ -3589,20 +3650,20 @@ begin
     end;
 
     try     // Writes the file
-        if FM_MHandle <> NIL then
-            FM_MHandle.Free;
-        FM_MHandle := Create_Meter_Space('Year');
+        FreeAndNil(FM_MHandle);
+        Header := 'Year';
         mtr := DSS.ActiveCircuit.EnergyMeters.First();
         if assigned(mtr) then
             for regName in mtr.RegisterNames do
-                WriteintoMemStr(FM_MHandle, ', "' + regName + '"'); //Write(F,', "', regName,'"');
-        WriteintoMemStr(FM_MHandle, Char(10));
+                Header := Header + ', "' + regName + '"';
+        FM_MHandle := TMeterTable.Create(Header, False);
 
-        WriteintoMemStr(FM_MHandle, inttostr(ActiveCircuit.Solution.Year));
+        FM_MHandle.BeginRow();
+        FM_MHandle.AddInt(ActiveCircuit.Solution.Year);
         for i := 1 to NumEMRegisters do
-            WriteintoMem(FM_MHandle, Double(RegSum[i]));
-        WriteintoMemStr(FM_MHandle, Char(10));
-        CloseMHandler(DSS, FM_MHandle, DI_Dir + PathDelim + 'Totals' + DSS._Name + '.csv', FM_Append);
+            FM_MHandle.Add(Double(RegSum[i]));
+        FM_MHandle.EndRow();
+        CloseTable(FM_MHandle, DI_Dir + PathDelim + 'Totals' + DSS._Name + '.csv', FM_Append);
     except
         On E: Exception do
             DoSimpleMsg('Error writing demand interval file Totals%s.csv. %s', [DSS._Name, CRLF + E.Message], 543);
@@ -3679,13 +3740,13 @@ begin
         end;
     end;
 
-    WriteintoMem(VR_MHandle, ActiveCircuit.Solution.DynaVars.dblHour);
-    WriteintoMemStr(VR_MHandle, ', ' + inttostr(UnderCount));
-    WriteintoMem(VR_MHandle, UnderVmin);
-    WriteintoMemStr(VR_MHandle, ', ' + inttostr(OverCount));
-    WriteintoMem(VR_MHandle, OverVmax);
-    WriteintoMemStr(VR_MHandle, ', ' + ActiveCircuit.BusList.NameOfIndex(minbus));
-    WriteintoMemStr(VR_MHandle, ', ' + ActiveCircuit.BusList.NameOfIndex(maxbus));
+    VR_MHandle.BeginRow(ActiveCircuit.Solution.DynaVars.dblHour);
+    VR_MHandle.AddInt(UnderCount);
+    VR_MHandle.Add(UnderVmin);
+    VR_MHandle.AddInt(OverCount);
+    VR_MHandle.Add(OverVmax);
+    VR_MHandle.AddText(ActiveCircuit.BusList.NameOfIndex(minbus));
+    VR_MHandle.AddText(ActiveCircuit.BusList.NameOfIndex(maxbus));
 
     // Klugy but it works
     // now repeat for buses under 1 kV
@@ -3740,13 +3801,13 @@ begin
         end;
     end;
 
-    WriteintoMemStr(VR_MHandle, ', ' + inttostr(UnderCount));
-    WriteintoMem(VR_MHandle, UnderVmin);
-    WriteintoMemStr(VR_MHandle, ', ' + inttostr(OverCount));
-    WriteintoMem(VR_MHandle, OverVmax);
-    WriteintoMemStr(VR_MHandle, ', ' + ActiveCircuit.BusList.NameOfIndex(minbus));
-    WriteintoMemStr(VR_MHandle, ', ' + ActiveCircuit.BusList.NameOfIndex(maxbus));
-    WriteintoMemStr(VR_MHandle, Char(10));
+    VR_MHandle.AddInt(UnderCount);
+    VR_MHandle.Add(UnderVmin);
+    VR_MHandle.AddInt(OverCount);
+    VR_MHandle.Add(OverVmax);
+    VR_MHandle.AddText(ActiveCircuit.BusList.NameOfIndex(minbus));
+    VR_MHandle.AddText(ActiveCircuit.BusList.NameOfIndex(maxbus));
+    VR_MHandle.EndRow();
 end;
 
 procedure TEnergyMeter.OpenAllDIFiles;
@@ -3789,12 +3850,9 @@ end;
 procedure TEnergyMeter.OpenOverloadReportFile;
 begin
     try
-        if OverloadFileIsOpen then
-            OV_MHandle.Free;
         OverloadFileIsOpen := TRUE;
-        if OV_MHandle <> NIL then
-            OV_MHandle.free;
-        OV_MHandle := Create_Meter_Space('"Hour", "Element", "Normal Amps", "Emerg Amps", "% Normal", "% Emerg", "kVBase", "I1(A)", "I2(A)", "I3(A)"' + Char(10));
+        FreeAndNil(OV_MHandle);
+        OV_MHandle := TMeterTable.Create('"Hour", "Element", "Normal Amps", "Emerg Amps", "% Normal", "% Emerg", "kVBase", "I1(A)", "I2(A)", "I3(A)"');
     except
         On E: Exception do
             DosimpleMsg('Error creating memory space (Overload report) for writing: %s', [E.Message], 541);
@@ -3804,13 +3862,10 @@ end;
 procedure TEnergyMeter.OpenVoltageReportFile;
 begin
     try
-        if VoltageFileIsOpen then
-            VR_MHandle.Free;
         VoltageFileIsOpen := TRUE;
-        if VR_MHandle <> NIL then
-            VR_MHandle.free;
-        VR_MHandle := Create_Meter_Space('"Hour", "Undervoltages", "Min Voltage", "Overvoltage", "Max Voltage", "Min Bus", "Max Bus"');
-        WriteintoMemStr(VR_MHandle, ', "LV Undervoltages", "Min LV Voltage", "LV Overvoltage", "Max LV Voltage", "Min LV Bus", "Max LV Bus"' + Char(10));
+        FreeAndNil(VR_MHandle);
+        VR_MHandle := TMeterTable.Create('"Hour", "Undervoltages", "Min Voltage", "Overvoltage", "Max Voltage", "Min Bus", "Max Bus"' +
+            ', "LV Undervoltages", "Min LV Voltage", "LV Overvoltage", "Max LV Voltage", "Min LV Bus", "Max LV Bus"');
     except
         On E: Exception do
             DosimpleMsg('Error creating memory space (Voltage report) for writing: %s', [E.Message], 541);
@@ -0,0 +1,423 @@
+unit MeterTable;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// In-memory tables for the demand interval and totals files of the energy
+// meters, replacing the tagged byte streams of MemoryMap_lib.
+//
+// The values are kept in typed columns: the hour of each row (when the table
+// has it) in its own column, and one column per value of the row, defined by
+// the first row -- floats, integers or texts. The table is written out only
+// when the file is closed, either as CSV (same layout as before) or as a
+// binary block with the columns as they are in memory. The columns can also
+// be read directly (see the DIFiles and DIMemory options of EnergyMeter).
+// The table backend of the exports (ExportWriter) uses the same tables.
+
+interface
+
+uses
+    Classes,
+    DSSClass,
+    ArrayDef;
+
+type
+{$SCOPEDENUMS ON}
+    TMeterColumnKind = (
+        Float = 0,
+        Int = 1,
+        Text = 2
+    );
+{$SCOPEDENUMS OFF}
+
+    TMeterColumn = record
+        Kind: TMeterColumnKind;
+        Floats: ArrayOfDouble;
+        Ints: ArrayOfInteger;
+        Texts: ArrayOfString;
+    end;
+
+    TMeterTable = class(TObject)
+    private
+        FHeader: String;
+        FHasTime: Boolean;
+        Hours: ArrayOfDouble;
+        Columns: Array of TMeterColumn;
+        FNumColumns: Integer; // defined by the first row
+        FNumRows: Integer;
+        Capacity: Integer;
+        Col: Integer; // next column of the open row
+
+        procedure Grow();
+        function NextColumn(Kind: TMeterColumnKind): Integer;
+    public
+        // Header is the first line of the CSV file, without the line break;
+        // no header line is written if it's empty.
+        constructor Create(const Header: String; HasTime: Boolean = True);
+
+        procedure BeginRow(); overload;
+        procedure BeginRow(Hour: Double); overload;
+        procedure Add(Value: Double);
+        procedure AddInt(Value: Integer);
+        procedure AddText(const Value: String);
+        procedure EndRow();
+
+        procedure WriteCSV(F: TStream);
+        procedure WriteBinary(F: TStream);
+
+        // Names of the value columns, from the header
+        function ColumnNames(): ArrayOfString;
+        function ColumnKind(Column: Integer): TMeterColumnKind;
+        procedure CopyHours(Dest: PDoubleArray0);
+        // Copies a column as floats; the texts are copied as NaN
+        procedure CopyColumn(Column: Integer; Dest: PDoubleArray0);
+        // Value of a cell as in the CSV file
+        function GetText(Row, Column: Integer): String;
+
+        property NumRows: Integer read FNumRows;
+        property NumColumns: Integer read FNumColumns;
+        property HasTime: Boolean read FHasTime;
+        property Header: String read FHeader;
+    end;
+
+// Writes the table to Dest_Path. With Binary, the path gets the .bin
+// extension and the binary block is written instead.
+procedure SaveMeterTable(DSS: TDSSContext; Table: TMeterTable; const Dest_Path: String; AppendFile: Boolean; Binary: Boolean = False);
+// Same as SaveMeterTable, then frees the table
+procedure CloseMeterTable(DSS: TDSSContext; var Table: TMeterTable; const Dest_Path: String; AppendFile: Boolean; Binary: Boolean = False);
+
+implementation
+
+uses
+    SysUtils,
+    Math,
+    BufStream,
+    DSSGlobals,
+    Utilities,
+    DSSHelper;
+
+const
+    METER_TABLE_SIGNATURE: Array[0..7] of AnsiChar = ('D', 'S', 'S', 'M', 'T', 'B', 'L', #0);
+    METER_TABLE_VERSION = 1;
+
+function FormatValue(Value: Double): String; inline;
+// Same output as Format('%-g', [Value]), with a shortcut for the integral values
+// (the hours, counts and the like), which are common in these files.
+begin
+    if (Frac(Value) = 0) and (Abs(Value) < 1e15) then
+        Result := IntToStr(Trunc(Value))
+    else
+        Result := FloatToStrF(Value, ffGeneral, 15, 3);
+end;
+
+constructor TMeterTable.Create(const Header: String; HasTime: Boolean);
+begin
+    inherited Create();
+    FHeader := Header;
+    FHasTime := HasTime;
+    FNumColumns := -1;
+    FNumRows := 0;
+    Capacity := 0;
+    Col := -1;
+end;
+
+procedure TMeterTable.Grow();
+var
+    i: Integer;
+begin
+    if Capacity = 0 then
+        Capacity := 64
+    else
+        Capacity := 2 * Capacity;
+
+    if FHasTime then
+        SetLength(Hours, Capacity);
+    for i := 0 to High(Columns) do
+        with Columns[i] do
+            case Kind of
+                TMeterColumnKind.Float:
+                    SetLength(Floats, Capacity);
+                TMeterColumnKind.Int:
+                    SetLength(Ints, Capacity);
+                TMeterColumnKind.Text:
+                    SetLength(Texts, Capacity);
+            end;
+end;
+
+procedure TMeterTable.BeginRow();
+begin
+    if Col <> -1 then
+        raise Exception.Create(_('Meter table: previous row was not finished.'));
+    if FNumRows = Capacity then
+        Grow();
+    Col := 0;
+end;
+
+procedure TMeterTable.BeginRow(Hour: Double);
+begin
+    BeginRow();
+    if FHasTime then
+        Hours[FNumRows] := Hour;
+end;
+
+function TMeterTable.NextColumn(Kind: TMeterColumnKind): Integer;
+begin
+    Result := Col;
+    if Result = -1 then
+        raise Exception.Create(_('Meter table: value added outside of a row.'));
+
+    if FNumColumns = -1 then
+    begin
+        // First row: the columns are created as the values are added
+        SetLength(Columns, Result + 1);
+        Columns[Result].Kind := Kind;
+        case Kind of
+            TMeterColumnKind.Float:
+                SetLength(Columns[Result].Floats, Capacity);
+            TMeterColumnKind.Int:
+                SetLength(Columns[Result].Ints, Capacity);
+            TMeterColumnKind.Text:
+                SetLength(Columns[Result].Texts, Capacity);
+        end;
+    end
+    else if (Result >= FNumColumns) or (Columns[Result].Kind <> Kind) then
+        raise Exception.Create(_('Meter table: row does not match the columns of the table.'));
+
+    Inc(Col);
+end;
+
+procedure TMeterTable.Add(Value: Double);
+begin
+    Columns[NextColumn(TMeterColumnKind.Float)].Floats[FNumRows] := Value;
+end;
+
+procedure TMeterTable.AddInt(Value: Integer);
+begin
+    Columns[NextColumn(TMeterColumnKind.Int)].Ints[FNumRows] := Value;
+end;
+
+procedure TMeterTable.AddText(const Value: String);
+begin
+    Columns[NextColumn(TMeterColumnKind.Text)].Texts[FNumRows] := Value;
+end;
+
+procedure TMeterTable.EndRow();
+begin
+    if FNumColumns = -1 then
+        FNumColumns := Col
+    else if Col <> FNumColumns then
+        raise Exception.Create(_('Meter table: row does not match the columns of the table.'));
+    Col := -1;
+    Inc(FNumRows);
+end;
+
+procedure TMeterTable.WriteCSV(F: TStream);
+var
+    i, j: Integer;
+    First: Boolean;
+begin
+    if FHeader <> '' then
+        FSWriteln(F, FHeader);
+
+    for i := 0 to FNumRows - 1 do
+    begin
+        First := True;
+        if FHasTime then
+        begin
+            FSWrite(F, FormatValue(Hours[i]));
+            First := False;
+        end;
+        for j := 0 to FNumColumns - 1 do
+        begin
+            if not First then
+                FSWrite(F, ', ');
+            First := False;
+            with Columns[j] do
+                case Kind of
+                    TMeterColumnKind.Float:
+                        FSWrite(F, FormatValue(Floats[i]));
+                    TMeterColumnKind.Int:
+                        FSWrite(F, IntToStr(Ints[i]));
+                    TMeterColumnKind.Text:
+                        FSWrite(F, Texts[i]);
+                end;
+        end;
+        FSWriteln(F);
+    end;
+end;
+
+function TMeterTable.ColumnNames(): ArrayOfString;
+var
+    Parts: TStringList;
+    i, n, first: Integer;
+begin
+    Parts := TStringList.Create();
+    try
+        Parts.StrictDelimiter := True;
+        Parts.Delimiter := ',';
+        Parts.QuoteChar := #0;
+        Parts.DelimitedText := FHeader;
+        first := 0;
+        if FHasTime then
+            first := 1;
+        n := Max(Parts.Count - first, 0);
+        // The header of some reports lists more columns than the rows have
+        if (FNumColumns >= 0) and (n > FNumColumns) then
+            n := FNumColumns;
+        SetLength(Result, n);
+        for i := 0 to n - 1 do
+            Result[i] := Trim(Parts[first + i]).Trim(['"']);
+    finally
+        Parts.Free();
+    end;
+end;
+
+function TMeterTable.ColumnKind(Column: Integer): TMeterColumnKind;
+begin
+    Result := Columns[Column].Kind;
+end;
+
+procedure TMeterTable.CopyHours(Dest: PDoubleArray0);
+begin
+    if FHasTime and (FNumRows > 0) then
+        Move(Hours[0], Dest[0], FNumRows * SizeOf(Double));
+end;
+
+procedure TMeterTable.CopyColumn(Column: Integer; Dest: PDoubleArray0);
+var
+    i: Integer;
+begin
+    if FNumRows = 0 then
+        Exit;
+    with Columns[Column] do
+        case Kind of
+            TMeterColumnKind.Float:
+                Move(Floats[0], Dest[0], FNumRows * SizeOf(Double));
+            TMeterColumnKind.Int:
+                for i := 0 to FNumRows - 1 do
+                    Dest[i] := Ints[i];
+            TMeterColumnKind.Text:
+                for i := 0 to FNumRows - 1 do
+                    Dest[i] := NaN;
+        end;
+end;
+
+function TMeterTable.GetText(Row, Column: Integer): String;
+begin
+    with Columns[Column] do
+        case Kind of
+            TMeterColumnKind.Float:
+                Result := FormatValue(Floats[Row]);
+            TMeterColumnKind.Int:
+                Result := IntToStr(Ints[Row]);
+        else
+            Result := Texts[Row];
+        end;
+end;
+
+procedure TMeterTable.WriteBinary(F: TStream);
+// Layout (little-endian):
+//   signature (8 bytes), version, number of rows, number of columns,
+//   has time (0/1), header length and header bytes -- all Int32 except the
+//   signature and the header; then the kind of each column (Int32), the
+//   hours (Float64) if the table has them, and the columns one after the
+//   other: Float64 or Int32 values, or Int32 length and bytes of each text.
+var
+    i, j, n: Integer;
+
+    procedure WriteInt(Value: Integer);
+    begin
+        F.WriteBuffer(Value, SizeOf(Value));
+    end;
+
+begin
+    n := Max(FNumColumns, 0);
+    F.WriteBuffer(METER_TABLE_SIGNATURE[0], SizeOf(METER_TABLE_SIGNATURE));
+    WriteInt(METER_TABLE_VERSION);
+    WriteInt(FNumRows);
+    WriteInt(n);
+    WriteInt(Ord(FHasTime));
+    WriteInt(Length(FHeader));
+    if Length(FHeader) > 0 then
+        F.WriteBuffer(FHeader[1], Length(FHeader));
+
+    for j := 0 to n - 1 do
+        WriteInt(Ord(Columns[j].Kind));
+
+    if FNumRows = 0 then
+        Exit;
+
+    if FHasTime then
+        F.WriteBuffer(Hours[0], FNumRows * SizeOf(Double));
+
+    for j := 0 to n - 1 do
+        with Columns[j] do
+            case Kind of
+                TMeterColumnKind.Float:
+                    F.WriteBuffer(Floats[0], FNumRows * SizeOf(Double));
+                TMeterColumnKind.Int:
+                    F.WriteBuffer(Ints[0], FNumRows * SizeOf(Integer));
+                TMeterColumnKind.Text:
+                    for i := 0 to FNumRows - 1 do
+                    begin
+                        WriteInt(Length(Texts[i]));
+                        if Length(Texts[i]) > 0 then
+                            F.WriteBuffer(Texts[i][1], Length(Texts[i]));
+                    end;
+            end;
+end;
+
+procedure SaveMeterTable(DSS: TDSSContext; Table: TMeterTable; const Dest_Path: String; AppendFile: Boolean; Binary: Boolean);
+var
+    F: TStream = NIL;
+    Path: String;
+begin
+    if Table = NIL then
+        Exit;
+
+    Path := Dest_Path;
+    if Binary then
+        Path := ChangeFileExt(Dest_Path, '.bin');
+
+    // Open Output file; check for errors
+    try
+        if AppendFile then
+        begin
+            F := DSS.GetOutputStreamEx(Path, fmOpenReadWrite);
+            F.Seek(0, soEnd);
+        end
+        else
+            F := DSS.GetOutputStreamEx(Path, fmCreate);
+    except
+        On E: Exception do
+        begin
+            DoSimpleMsg(DSS, 'Error Attempting to open file: "%s". %s', [Path, E.Message], 159000);
+            F.Free();
+            Exit;
+        end;
+    end;
+
+    try
+        if Binary then
+            Table.WriteBinary(F)
+        else
+            Table.WriteCSV(F);
+    finally
+        FreeAndNil(F);
+    end;
+end;
+
+procedure CloseMeterTable(DSS: TDSSContext; var Table: TMeterTable; const Dest_Path: String; AppendFile: Boolean; Binary: Boolean);
+begin
+    if Table = NIL then
+        Exit;
+    try
+        SaveMeterTable(DSS, Table, Dest_Path, AppendFile, Binary);
+    finally
+        FreeAndNil(Table);
+    end;
+end;
+
+end.
@@ -88,6 +88,7 @@ uses
     Arraydef,
     UComplex, DSSUcomplex,
     utilities,
+    MonitorStore,
     Classes;
 
 type
@@ -100,7 +101,8 @@ type
         action = 4, // buffer=clear|save
         residual = 5, // buffer=clear|save
         VIPolar = 6, // V I in mag and angle rather then re and im
-        PPolar = 7 // Power in power PF rather then power and vars
+        PPolar = 7, // Power in power PF rather then power and vars
+        compress = 8 // Keep the records in the compressed store
     );
     TMonitorProp = (
         INVALID = 0,
@@ -110,7 +112,8 @@ type
         Action = 4, // buffer=clear|save
         Residual = 5, // buffer=clear|save
         VIPolar = 6, // V I in mag and angle rather then re and im
-        PPolar = 7 // Power in power PF rather then power and vars
+        PPolar = 7, // Power in power PF rather then power and vars
+        Compress = 8 // Keep the records in the compressed store
     );
 {$SCOPEDENUMS OFF}
 
@@ -185,6 +188,8 @@ type
     PUBLIC
         Mode: Integer;
         MonitorStream: TMemoryStream;
+        Compressed: LongBool;
+        Store: TMonitorStore; // records when Compressed; MonitorStream only keeps the header then
         SampleCount: Integer;  // This is the number of samples taken
         Header: TStringList;
         RecordSize: Integer;
@@ -202,6 +207,31 @@ type
         procedure Save;     // Saves present buffer to file
         procedure PostProcess; // calculates Pst or other post-processing
 
+        // Samples available in the stream (saved), for CopyChannels
+        function StoredSampleCount(): Integer;
+        // Copies the stored samples into Dest as a column-major
+        // StoredSampleCount-by-(RecordSize + 2) matrix. The first two columns are
+        // the hour and seconds (frequency and harmonic in harmonics mode). The
+        // memory of the stream is read directly, so its position is unchanged
+        // and different monitors can be copied concurrently.
+        procedure CopyChannels(Dest: PDoubleArray0); overload;
+        procedure CopyChannels(Dest: PSingleArray0); overload;
+        // Copies a column (0-based, including the two time columns) of the
+        // stored samples into Dest[0..StoredSampleCount-1]
+        procedure ReadColumn(Column: Integer; Dest: PDoubleArray0);
+
+        // Size and contents of the stream in the uncompressed format, for both
+        // storage modes
+        function RawSize(): Int64;
+        procedure CopyRaw(Dest: PByte);
+        // Stream in the uncompressed format: MonitorStream itself, or a
+        // temporary copy for compressed monitors. If Modified, the records of
+        // the copy replace the stored ones on release.
+        function GetRawStream(): TMemoryStream;
+        procedure ReleaseRawStream(Stream: TMemoryStream; Modified: Boolean);
+        // Bytes used by the stream and the compressed store
+        function StorageSize(): Int64;
+
         procedure OpenMonitorStream;
         procedure ClearMonitorStream;
         procedure CloseMonitorStream;
@@ -236,6 +266,7 @@ uses
     DSSHelper,
     DSSObjectHelper,
     Solution,
+    SolverProfile,
     TypInfo;
 
 type
@@ -261,6 +292,8 @@ const
 
     NumSolutionVars = 12;
 
+    MONITOR_HEADER_SIZE = 4 * 4 + SizeOf(TLegacyMonitorStrBuffer); // bytes before the first record
+
 var
     EMPTY_LEGACY_HEADER: TLegacyMonitorStrBuffer;
     PropInfo: Pointer = NIL;
@@ -315,9 +348,11 @@ begin
     PropertyType[ord(TProp.residual)] := TPropertyType.BooleanProperty;
     PropertyType[ord(TProp.VIpolar)] := TPropertyType.BooleanProperty;
     PropertyType[ord(TProp.Ppolar)] := TPropertyType.BooleanProperty;
+    PropertyType[ord(TProp.Compress)] := TPropertyType.BooleanProperty;
     PropertyOffset[ord(TProp.residual)] := ptruint(@obj.IncludeResidual);
     PropertyOffset[ord(TProp.VIpolar)] := ptruint(@obj.VIpolar);
     PropertyOffset[ord(TProp.Ppolar)] := ptruint(@obj.Ppolar);
+    PropertyOffset[ord(TProp.Compress)] := ptruint(@obj.Compressed);
 
     // integer properties
     PropertyType[ord(TProp.terminal)] := TPropertyType.IntegerProperty;
@@ -385,14 +420,17 @@ end;
 procedure TDSSMonitor.SampleAll;  // Force all monitors in the circuit to take a sample
 var
     Mon: TMonitorObj;
+    t0: Int64;
     // sample all monitors except mode 5 monitors
 begin
+    t0 := DSS.SolverProfile.Start();
     for Mon in ActiveCircuit.Monitors do
     begin
         if Mon.enabled then
             if Mon.Mode <> 5 then
                 Mon.TakeSample;
     end;
+    DSS.SolverProfile.Stop(TSolverProfilePhase.MonitorSample, t0);
 end;
 
 procedure TDSSMonitor.SampleAllMode5;  // Force all mode=5 monitors in the circuit to take a sample
@@ -444,6 +482,7 @@ begin
     MeteredTerminal := Other.MeteredTerminal;
     Mode := Other.Mode;
     IncludeResidual := Other.IncludeResidual;
+    Compressed := Other.Compressed;
 
     BaseFrequency := Other.BaseFrequency;
 end;
@@ -483,6 +522,7 @@ begin
     Bufferfile := '';
 
     MonitorStream := TMemoryStream.Create; // Create memory stream
+    Store := TMonitorStore.Create();
     Header := TStringList.Create;
     RecordSize := 0;
 
@@ -491,6 +531,7 @@ begin
     IncludeResidual := FALSE;
     VIPolar := TRUE;
     Ppolar := TRUE;
+    Compressed := FALSE;
     FileSignature := 43756;
     FileVersion := 1;
     SampleCount := 0;
@@ -502,6 +543,7 @@ end;
 destructor TMonitorObj.Destroy;
 begin
     MonitorStream.Free;
+    Store.Free;
     Header.Free;
     Bufferfile := '';
     ReAllocMem(MonBuffer, 0);
@@ -1067,6 +1109,7 @@ begin
         // adds the empty dummy record to avoid
         // killing apps relying on this space
         MonitorStream.Write(EMPTY_LEGACY_HEADER, Sizeof(TLegacyMonitorStrBuffer)); 
+        Store.Clear(RecordSize + 2);
 
         // So the file now looks like: (update 05-18-2021)
         //   FileSignature (4 bytes)    32-bit Integers
@@ -1115,12 +1158,141 @@ begin
     end;
 end;
 
+function TMonitorObj.StoredSampleCount(): Integer;
+var
+    RecordBytes: Int64;
+begin
+    Result := 0;
+    if Compressed then
+    begin
+        Result := Store.RecordCount();
+        if SampleCount < Result then
+            Result := SampleCount;
+        if Result < 0 then
+            Result := 0;
+        Exit;
+    end;
+    RecordBytes := SizeOf(Single) * (RecordSize + 2);
+    if (SampleCount <= 0) or (MonitorStream.Size <= MONITOR_HEADER_SIZE) then
+        Exit;
+    Result := SampleCount;
+    if (MonitorStream.Size - MONITOR_HEADER_SIZE) div RecordBytes < Result then
+        Result := (MonitorStream.Size - MONITOR_HEADER_SIZE) div RecordBytes;
+end;
+
+procedure TMonitorObj.CopyChannels(Dest: PDoubleArray0);
+var
+    Src: PSingleArray0;
+    i, j, NumCols, NumSamples: Integer;
+begin
+    NumCols := RecordSize + 2;
+    NumSamples := StoredSampleCount();
+    if Compressed then
+    begin
+        for j := 0 to NumCols - 1 do
+            Store.ReadColumn(j, PDoubleArray0(@Dest[j * NumSamples]), NumSamples);
+        Exit;
+    end;
+    Src := PSingleArray0(PByte(MonitorStream.Memory) + MONITOR_HEADER_SIZE);
+    for i := 0 to NumSamples - 1 do
+        for j := 0 to NumCols - 1 do
+            Dest[i + j * NumSamples] := Src[i * NumCols + j];
+end;
+
+procedure TMonitorObj.CopyChannels(Dest: PSingleArray0);
+var
+    Src: PSingleArray0;
+    i, j, NumCols, NumSamples: Integer;
+begin
+    NumCols := RecordSize + 2;
+    NumSamples := StoredSampleCount();
+    if Compressed then
+    begin
+        for j := 0 to NumCols - 1 do
+            Store.ReadColumn(j, PSingleArray0(@Dest[j * NumSamples]), NumSamples);
+        Exit;
+    end;
+    Src := PSingleArray0(PByte(MonitorStream.Memory) + MONITOR_HEADER_SIZE);
+    for i := 0 to NumSamples - 1 do
+        for j := 0 to NumCols - 1 do
+            Dest[i + j * NumSamples] := Src[i * NumCols + j];
+end;
+
+procedure TMonitorObj.ReadColumn(Column: Integer; Dest: PDoubleArray0);
+var
+    Src: PSingleArray0;
+    i, NumCols, NumSamples: Integer;
+begin
+    NumSamples := StoredSampleCount();
+    if Compressed then
+    begin
+        Store.ReadColumn(Column, Dest, NumSamples);
+        Exit;
+    end;
+    NumCols := RecordSize + 2;
+    Src := PSingleArray0(PByte(MonitorStream.Memory) + MONITOR_HEADER_SIZE);
+    for i := 0 to NumSamples - 1 do
+        Dest[i] := Src[i * NumCols + Column];
+end;
+
+function TMonitorObj.RawSize(): Int64;
+begin
+    Result := MonitorStream.Size;
+    if Compressed then
+        Result := Result + SizeOf(Single) * Store.Count;
+end;
+
+procedure TMonitorObj.CopyRaw(Dest: PByte);
+begin
+    Move(MonitorStream.Memory^, Dest^, MonitorStream.Size);
+    if Compressed then
+        Store.ReadAll(PSingleArray0(Dest + MonitorStream.Size));
+end;
+
+function TMonitorObj.GetRawStream(): TMemoryStream;
+begin
+    if not Compressed then
+    begin
+        Result := MonitorStream;
+        Exit;
+    end;
+    Result := TMemoryStream.Create();
+    Result.Size := RawSize();
+    CopyRaw(PByte(Result.Memory));
+end;
+
+procedure TMonitorObj.ReleaseRawStream(Stream: TMemoryStream; Modified: Boolean);
+begin
+    if Stream = MonitorStream then
+        Exit;
+    if Modified and (Stream.Size > MonitorStream.Size) then
+    begin
+        Store.Clear(Store.NumColumns);
+        Store.Append(PSingleArray0(PByte(Stream.Memory) + MonitorStream.Size), (Stream.Size - MonitorStream.Size) div SizeOf(Single));
+    end;
+    Stream.Free;
+end;
+
+function TMonitorObj.StorageSize(): Int64;
+begin
+    Result := MonitorStream.Size;
+    if Compressed then
+        Result := Result + Store.MemoryUsed();
+end;
+
 procedure TMonitorObj.Save;
 // Saves present buffer to monitor file, resets bufferptrs and continues
 begin
     if not IsFileOpen then
         OpenMonitorStream; // Position to end of stream
 
+    if Compressed then
+    begin
+        Store.Append(PSingleArray0(MonBuffer), BufPtr);
+        BufPtr := 0;
+        Exit;
+    end;
+
     // Write present monitor buffer to monitorstream
     MonitorStream.Write(MonBuffer^, SizeOF(MonBuffer[1]) * BufPtr);
 
@@ -1619,15 +1791,17 @@ var
     defaultpst: Single;
     Vbase: Single;
     busref: Integer;
+    Stream: TMemoryStream;
 begin
     N := SampleCount;
-    MonitorStream.Seek(0, soFromBeginning);  // Start at the beginning of the Stream
-    MonitorStream.Read(Fsignature, Sizeof(Fsignature));
-    MonitorStream.Read(Fversion, Sizeof(Fversion));
-    MonitorStream.Read(RecordSize, Sizeof(RecordSize));
-    MonitorStream.Read(Mode, Sizeof(Mode));
-    MonitorStream.Seek(SizeOf(TLegacyMonitorStrBuffer), soFromCurrent);
-    bStart := MonitorStream.Position;
+    Stream := GetRawStream();
+    Stream.Seek(0, soFromBeginning);  // Start at the beginning of the Stream
+    Stream.Read(Fsignature, Sizeof(Fsignature));
+    Stream.Read(Fversion, Sizeof(Fversion));
+    Stream.Read(RecordSize, Sizeof(RecordSize));
+    Stream.Read(Mode, Sizeof(Mode));
+    Stream.Seek(SizeOf(TLegacyMonitorStrBuffer), soFromCurrent);
+    bStart := Stream.Position;
     RecordBytes := Sizeof(SngBuffer[1]) * RecordSize;
     try
     // read rms voltages out of the monitor stream into arrays
@@ -1636,11 +1810,11 @@ begin
         for p := 0 to FnPhases do
             data[p] := AllocMem(Sizeof(SngBuffer[1]) * N);
         i := 1;
-        while not (MonitorStream.Position >= MonitorStream.Size) do
+        while not (Stream.Position >= Stream.Size) do
         begin
-            MonitorStream.Read(hr, SizeOf(hr));
-            MonitorStream.Read(s, SizeOf(s));
-            MonitorStream.Read(SngBuffer, RecordBytes);
+            Stream.Read(hr, SizeOf(hr));
+            Stream.Read(s, SizeOf(s));
+            Stream.Read(SngBuffer, RecordBytes);
             data[0][i] := s + 3600.0 * hr;
             for p := 1 to FnPhases do
                 data[p][i] := SngBuffer[2 * p - 1];
@@ -1658,7 +1832,7 @@ begin
         end;
 
         // stuff the flicker level and pst back into the monitor stream
-        MonitorStream.Position := bStart;
+        Stream.Position := bStart;
         tpst := 0.0;
         ipst := 0;
         defaultpst := 0;
@@ -1669,14 +1843,14 @@ begin
                 inc(ipst);
                 tpst := data[0][i];
             end;
-            MonitorStream.Position := MonitorStream.Position + 2 * SizeOf(hr); // don't alter the time
+            Stream.Position := Stream.Position + 2 * SizeOf(hr); // don't alter the time
             for p := 1 to FnPhases do
             begin
-                MonitorStream.Write(data[p][i], sizeof(data[p][i]));
+                Stream.Write(data[p][i], sizeof(data[p][i]));
                 if (ipst > 0) and (ipst <= Npst) then
-                    MonitorStream.Write(pst[p - 1][ipst], sizeof(pst[p - 1][ipst]))
+                    Stream.Write(pst[p - 1][ipst], sizeof(pst[p - 1][ipst]))
                 else
-                    MonitorStream.Write(defaultpst, sizeof(defaultpst))
+                    Stream.Write(defaultpst, sizeof(defaultpst))
             end;
         end;
     finally
@@ -1684,6 +1858,7 @@ begin
             ReAllocMem(data[p], 0);
         for p := 0 to FnPhases - 1 do
             ReAllocMem(pst[p], 0);
+        ReleaseRawStream(Stream, True);
     end;
 end;
 
@@ -1702,6 +1877,7 @@ var
     s: Single;
     sngBuffer: array[1..100] of Single;
     sout: String;
+    Stream: TMemoryStream;
 {$IFDEF DSS_CAPI_PM}
     PMParent: TDSSContext;
 begin
@@ -1743,12 +1919,13 @@ begin
         end;
     end;
 
-    MonitorStream.Seek(0, soFromBeginning);  // Start at the beginning of the Stream
-    MonitorStream.Read(Fsignature, Sizeof(Fsignature));
-    MonitorStream.Read(Fversion, Sizeof(Fversion));
-    MonitorStream.Read(RecordSize, Sizeof(RecordSize));
-    MonitorStream.Read(Mode, Sizeof(Mode));
-    MonitorStream.Seek(SizeOf(TLegacyMonitorStrBuffer), soFromCurrent);
+    Stream := GetRawStream();
+    Stream.Seek(0, soFromBeginning);  // Start at the beginning of the Stream
+    Stream.Read(Fsignature, Sizeof(Fsignature));
+    Stream.Read(Fversion, Sizeof(Fversion));
+    Stream.Read(RecordSize, Sizeof(RecordSize));
+    Stream.Read(Mode, Sizeof(Mode));
+    Stream.Seek(SizeOf(TLegacyMonitorStrBuffer), soFromCurrent);
 
 {$IFDEF DSS_CAPI_PM}
     if not PMParent.ConcatenateReports or (PMParent = DSS) then
@@ -1758,11 +1935,11 @@ begin
 
     try
         try
-            while not (MonitorStream.Position >= MonitorStream.Size) do
+            while not (Stream.Position >= Stream.Size) do
             begin
-                MonitorStream.Read(hr, SizeOF(hr));
-                MonitorStream.Read(s, SizeOf(s));
-                Nread := MonitorStream.Read(sngBuffer, RecordBytes);
+                Stream.Read(hr, SizeOF(hr));
+                Stream.Read(s, SizeOf(s));
+                Nread := Stream.Read(sngBuffer, RecordBytes);
                 if Nread < RecordBytes then
                     Break;
                 
@@ -1783,6 +1960,7 @@ begin
         end;
 
     finally
+        ReleaseRawStream(Stream, False);
         CloseMonitorStream;
         FreeAndNil(F);
 {$IFDEF DSS_CAPI_PM}
@@ -0,0 +1,338 @@
+unit MonitorStore;
+
+// ----------------------------------------------------------
+// Copyright (c) 2024, DSS-Extensions contributors
+// All rights reserved.
+// ----------------------------------------------------------
+
+// Lossless compressed storage for the records of a monitor (compress=yes).
+//
+// The values (Singles) are appended in the order of the monitor stream and kept
+// as they are until a block of BLOCK_RECORDS records is complete. The block is
+// then encoded column by column: the first value of the column as is, and each
+// of the others as its difference to the previous value of the column -- either
+// the XOR of their bits or the integer delta of their bits (zigzag-encoded),
+// whichever is shorter for that column and block. Only the significant bytes of
+// each difference are kept, with their count in a 4-bit code. Slowly varying
+// channels and the time columns take 1 or 2 bytes per value instead of 4.
+//
+// Each column of each block is decoded on its own, so reading a single channel
+// does not decode the others. The readers do not modify the store.
+
+interface
+
+uses
+    ArrayDef;
+
+const
+    BLOCK_RECORDS = 1024;
+
+type
+    TMonitorStore = class(TObject)
+    private
+        FNumColumns: Integer;
+        FCount: Int64; // values appended
+        Pending: Array of Single; // values of the open block
+        NumPending: Integer;
+        Data: Array of Byte;
+        DataSize: Int64;
+        ColumnStart: Array of Int64; // per block and column, into Data
+        NumBlocks: Integer;
+
+        procedure Reserve(NumBytes: Int64);
+        procedure EncodeBlock();
+        procedure DecodeColumn(Block, Column: Integer; Dest: PCardinal);
+    public
+        constructor Create();
+
+        // Drops all values; the records will have NumColumns values
+        procedure Clear(NumColumns: Integer);
+        procedure Append(Values: PSingleArray0; NumValues: Integer);
+
+        // Number of complete records
+        function RecordCount(): Integer;
+        // Copies a column of the first MaxRecords complete records into Dest.
+        // Only reads the store, so it can be called concurrently.
+        procedure ReadColumn(Column: Integer; Dest: PDoubleArray0; MaxRecords: Integer); overload;
+        procedure ReadColumn(Column: Integer; Dest: PSingleArray0; MaxRecords: Integer); overload;
+        // Copies all the values, in the order they were appended
+        procedure ReadAll(Dest: PSingleArray0);
+        // Bytes allocated for the values
+        function MemoryUsed(): Int64;
+
+        property Count: Int64 read FCount;
+        property NumColumns: Integer read FNumColumns;
+    end;
+
+implementation
+
+{$PUSH}
+{$Q-}
+{$R-}
+function SignificantBytes(r: Cardinal): Integer; inline;
+begin
+    if r = 0 then
+        Result := 0
+    else if r <= $FF then
+        Result := 1
+    else if r <= $FFFF then
+        Result := 2
+    else if r <= $FFFFFF then
+        Result := 3
+    else
+        Result := 4;
+end;
+
+function ZigZag(u, prev: Cardinal): Cardinal; inline;
+var
+    d: LongInt;
+begin
+    d := LongInt(u - prev);
+    Result := Cardinal(d shl 1) xor Cardinal(SarLongint(d, 31));
+end;
+
+function UnZigZag(r, prev: Cardinal): Cardinal; inline;
+begin
+    Result := prev + ((r shr 1) xor Cardinal(-LongInt(r and 1)));
+end;
+
+constructor TMonitorStore.Create();
+begin
+    inherited Create();
+    Clear(1);
+end;
+
+procedure TMonitorStore.Clear(NumColumns: Integer);
+begin
+    if NumColumns < 1 then
+        NumColumns := 1;
+    FNumColumns := NumColumns;
+    FCount := 0;
+    SetLength(Pending, 0); // allocated on the first Append
+    NumPending := 0;
+    SetLength(Data, 0);
+    DataSize := 0;
+    SetLength(ColumnStart, 0);
+    NumBlocks := 0;
+end;
+
+procedure TMonitorStore.Reserve(NumBytes: Int64);
+var
+    NewSize: Int64;
+begin
+    if DataSize + NumBytes <= Length(Data) then
+        Exit;
+    NewSize := Length(Data) + Length(Data) div 2;
+    if NewSize < DataSize + NumBytes then
+        NewSize := DataSize + NumBytes;
+    SetLength(Data, NewSize);
+end;
+
+procedure TMonitorStore.EncodeBlock();
+var
+    c, i, k, nb: Integer;
+    u, prev, r: Cardinal;
+    SizeXor, SizeDelta: Int64;
+    UseDelta: Boolean;
+    CtrlPos, Pos: Int64;
+    Bits: PCardinal;
+begin
+    Bits := PCardinal(@Pending[0]);
+    if Length(ColumnStart) < (NumBlocks + 1) * FNumColumns then
+        SetLength(ColumnStart, 2 * (NumBlocks + 1) * FNumColumns);
+
+    for c := 0 to FNumColumns - 1 do
+    begin
+        SizeXor := 0;
+        SizeDelta := 0;
+        prev := Bits[c];
+        for i := 1 to BLOCK_RECORDS - 1 do
+        begin
+            u := Bits[i * FNumColumns + c];
+            SizeXor := SizeXor + SignificantBytes(u xor prev);
+            SizeDelta := SizeDelta + SignificantBytes(ZigZag(u, prev));
+            prev := u;
+        end;
+        UseDelta := SizeDelta < SizeXor;
+
+        ColumnStart[NumBlocks * FNumColumns + c] := DataSize;
+        Reserve(1 + 4 + BLOCK_RECORDS div 2 + 4 * BLOCK_RECORDS);
+        Pos := DataSize;
+        Data[Pos] := Ord(UseDelta);
+        prev := Bits[c];
+        for k := 0 to 3 do
+            Data[Pos + 1 + k] := (prev shr (8 * k)) and $FF;
+        CtrlPos := Pos + 5;
+        FillChar(Data[CtrlPos], BLOCK_RECORDS div 2, 0);
+        Pos := CtrlPos + BLOCK_RECORDS div 2;
+        for i := 1 to BLOCK_RECORDS - 1 do
+        begin
+            u := Bits[i * FNumColumns + c];
+            if UseDelta then
+                r := ZigZag(u, prev)
+            else
+                r := u xor prev;
+            nb := SignificantBytes(r);
+            k := i - 1;
+            Data[CtrlPos + k shr 1] := Data[CtrlPos + k shr 1] or (nb shl (4 * (k and 1)));
+            while nb > 0 do
+            begin
+                Data[Pos] := r and $FF;
+                r := r shr 8;
+                Inc(Pos);
+                Dec(nb);
+            end;
+            prev := u;
+        end;
+        DataSize := Pos;
+    end;
+    Inc(NumBlocks);
+    NumPending := 0;
+end;
+
+procedure TMonitorStore.DecodeColumn(Block, Column: Integer; Dest: PCardinal);
+// Decodes the bits of a column of a complete block into Dest[0..BLOCK_RECORDS-1]
+var
+    i, k, nb, j: Integer;
+    u, r: Cardinal;
+    UseDelta: Boolean;
+    CtrlPos, Pos: Int64;
+begin
+    Pos := ColumnStart[Block * FNumColumns + Column];
+    UseDelta := Data[Pos] <> 0;
+    u := 0;
+    for k := 0 to 3 do
+        u := u or (Cardinal(Data[Pos + 1 + k]) shl (8 * k));
+    Dest[0] := u;
+    CtrlPos := Pos + 5;
+    Pos := CtrlPos + BLOCK_RECORDS div 2;
+    for i := 1 to BLOCK_RECORDS - 1 do
+    begin
+        k := i - 1;
+        nb := (Data[CtrlPos + k shr 1] shr (4 * (k and 1))) and $F;
+        r := 0;
+        for j := 0 to nb - 1 do
+            r := r or (Cardinal(Data[Pos + j]) shl (8 * j));
+        Pos := Pos + nb;
+        if UseDelta then
+            u := UnZigZag(r, u)
+        else
+            u := u xor r;
+        Dest[i] := u;
+    end;
+end;
+{$POP}
+
+procedure TMonitorStore.Append(Values: PSingleArray0; NumValues: Integer);
+var
+    i, n: Integer;
+begin
+    if (NumValues > 0) and (Length(Pending) = 0) then
+        SetLength(Pending, BLOCK_RECORDS * FNumColumns);
+    i := 0;
+    while i < NumValues do
+    begin
+        n := Length(Pending) - NumPending;
+        if n > NumValues - i then
+            n := NumValues - i;
+        Move(Values[i], Pending[NumPending], n * SizeOf(Single));
+        NumPending := NumPending + n;
+        i := i + n;
+        if NumPending = Length(Pending) then
+            EncodeBlock();
+    end;
+    FCount := FCount + NumValues;
+end;
+
+function TMonitorStore.RecordCount(): Integer;
+begin
+    Result := NumBlocks * BLOCK_RECORDS + NumPending div FNumColumns;
+end;
+
+procedure TMonitorStore.ReadColumn(Column: Integer; Dest: PDoubleArray0; MaxRecords: Integer);
+var
+    Buf: Array of Cardinal;
+    b, i, k: Integer;
+begin
+    if MaxRecords > RecordCount() then
+        MaxRecords := RecordCount();
+    SetLength(Buf, BLOCK_RECORDS);
+    k := 0;
+    b := 0;
+    while (k < MaxRecords) and (b < NumBlocks) do
+    begin
+        DecodeColumn(b, Column, @Buf[0]);
+        i := 0;
+        while (i < BLOCK_RECORDS) and (k < MaxRecords) do
+        begin
+            Dest[k] := PSingle(@Buf[i])^;
+            Inc(i);
+            Inc(k);
+        end;
+        Inc(b);
+    end;
+    i := 0;
+    while k < MaxRecords do
+    begin
+        Dest[k] := Pending[i * FNumColumns + Column];
+        Inc(i);
+        Inc(k);
+    end;
+end;
+
+procedure TMonitorStore.ReadColumn(Column: Integer; Dest: PSingleArray0; MaxRecords: Integer);
+var
+    Buf: Array of Cardinal;
+    b, i, k: Integer;
+begin
+    if MaxRecords > RecordCount() then
+        MaxRecords := RecordCount();
+    SetLength(Buf, BLOCK_RECORDS);
+    k := 0;
+    b := 0;
+    while (k < MaxRecords) and (b < NumBlocks) do
+    begin
+        DecodeColumn(b, Column, @Buf[0]);
+        i := BLOCK_RECORDS;
+        if i > MaxRecords - k then
+            i := MaxRecords - k;
+        Move(Buf[0], Dest[k], i * SizeOf(Single));
+        k := k + i;
+        Inc(b);
+    end;
+    i := 0;
+    while k < MaxRecords do
+    begin
+        Dest[k] := Pending[i * FNumColumns + Column];
+        Inc(i);
+        Inc(k);
+    end;
+end;
+
+procedure TMonitorStore.ReadAll(Dest: PSingleArray0);
+var
+    Buf: Array of Cardinal;
+    b, c, i: Integer;
+    Offset: Int64;
+begin
+    SetLength(Buf, BLOCK_RECORDS);
+    for b := 0 to NumBlocks - 1 do
+    begin
+        Offset := Int64(b) * BLOCK_RECORDS * FNumColumns;
+        for c := 0 to FNumColumns - 1 do
+        begin
+            DecodeColumn(b, c, @Buf[0]);
+            for i := 0 to BLOCK_RECORDS - 1 do
+                PCardinal(@Dest[Offset + i * FNumColumns + c])^ := Buf[i];
+        end;
+    end;
+    if NumPending > 0 then
+        Move(Pending[0], Dest[Int64(NumBlocks) * BLOCK_RECORDS * FNumColumns], NumPending * SizeOf(Single));
+end;
+
+function TMonitorStore.MemoryUsed(): Int64;
+begin
+    Result := Length(Data) + SizeOf(Int64) * Length(ColumnStart) + SizeOf(Single) * Length(Pending);
+end;
+
+end.
@@ -205,6 +205,7 @@ type
         // Support for Dynamics Mode
         procedure InitStateVars; OVERRIDE;
         procedure IntegrateStates; OVERRIDE;
+        function CanIntegrateInParallel: Boolean; OVERRIDE;
         // Support for Harmonics Mode
         procedure InitHarmonics; OVERRIDE;
 
@@ -1186,6 +1187,11 @@ begin
     YPrimInvalid := TRUE;  // Force rebuild of YPrims
 end;
 
+function TIndMach012Obj.CanIntegrateInParallel: Boolean;
+begin
+    Result := True;
+end;
+
 procedure TIndMach012Obj.IntegrateStates;
 // This is a virtual function. You do not need to write this routine
 // if you are not integrating state variables in dynamics mode.
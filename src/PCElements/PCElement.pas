@@ -51,6 +51,9 @@ type
         // For Dynamics Mode and Control Devices
         procedure InitStateVars; VIRTUAL;
         procedure IntegrateStates; VIRTUAL;
+        // True if IntegrateStates only touches the element's own data, so it can
+        // run concurrently with other elements (see TDynamicsIntegrator)
+        function CanIntegrateInParallel: Boolean; VIRTUAL;
         function NumVariables: Integer; VIRTUAL;
         procedure GetAllVariables(var States: ArrayOfDouble); VIRTUAL;
 
@@ -182,6 +185,11 @@ begin
  // By default do nothing
 end;
 
+function TPCElement.CanIntegrateInParallel: Boolean;
+begin
+    Result := False;
+end;
+
 procedure TPCElement.GetAllVariables(var States: ArrayOfDouble);
 begin
     // Do Nothing
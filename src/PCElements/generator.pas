@@ -379,6 +379,7 @@ type
         // Support for Dynamics Mode
         procedure InitStateVars; OVERRIDE;
         procedure IntegrateStates; OVERRIDE;
+        function CanIntegrateInParallel: Boolean; OVERRIDE;
 
         // Support for Harmonics Mode
         procedure InitHarmonics; OVERRIDE;
@@ -2420,6 +2421,12 @@ begin
     end;
 end;
 
+function TGeneratorObj.CanIntegrateInParallel: Boolean;
+begin
+    // User-written models and dynamic expressions are shared objects
+    Result := (GenModel <> 6) and (DynamicEqObj = NIL);
+end;
+
 procedure TGeneratorObj.IntegrateStates;
 var
     TracePower: Complex;
@@ -208,6 +208,7 @@ type
         function Get_WdgXneutral(i: Integer): Double;
 
         procedure CalcY_Terminal(FreqMult: Double);
+        procedure BuildY_Term();
         procedure GICBuildYTerminal;
 
         procedure BuildYPrimComponent(YPrim_Component, Y_Terminal: TCMatrix);
@@ -230,6 +231,7 @@ type
         Y_Term_NL: TCMatrix;
 
         Y_Terminal_Freqmult: Double;
+        Y_1VoltValid: Boolean; // Y_1Volt and Y_1Volt_NL are up to date, see BuildY_Term
 
         HVLeadsLV: LongBool;
 
@@ -660,6 +662,7 @@ begin
             end;
 
             ZB := TCMatrix.CreateMatrix(NumWindings - 1);
+            Y_1VoltValid := False;
             Y_1Volt := TCMatrix.CreateMatrix(NumWindings);
             Y_1Volt_NL := TCMatrix.CreateMatrix(NumWindings);
             Y_Term := TCMatrix.CreateMatrix(2 * NumWindings);
@@ -837,6 +840,7 @@ begin
     Y_1Volt_NL := NIL;;
     Y_Term := NIL;
     Y_Term_NL := NIL;
+    Y_1VoltValid := False;
     SetNumWindings(2);  // must do this after setting number of phases
     ActiveWinding := 1;
 
@@ -1422,7 +1426,12 @@ begin
 {$ENDIF}
                     YPrimInvalid := TRUE;  // this property triggers setting SystemYChanged=true
 
-                RecalcElementData;
+                // Only the scaling of the terminal matrices depends on the taps,
+                // so the rest of the element data doesn't need to be recalculated
+                if Y_1VoltValid then
+                    BuildY_Term()
+                else
+                    RecalcElementData;
             end;
         end;
 end;
@@ -1856,6 +1865,54 @@ begin
         end;
 end;
 
+function ZeroTapFix(const tapvalue: Double): Double;
+// Function to fix a specification of a pu tap of 0.0
+// Regcontrol can attempt to force zero tap position in some models
+begin
+    if TapValue = 0.0 then
+        Result := 0.0001
+    else
+        Result := Tapvalue;
+end;
+
+procedure TTransfObj.BuildY_Term();
+// Y_Terminal = AT * Y_onevolt * A, where V_onevolt = A * V_terminal, i.e.
+// A[k, 2k-1] = 1/(VBase*tap) and A[k, 2k] = -1/(VBase*tap) for winding k.
+// This scaling is the only part that depends on the taps, so a tap change
+// only requires this, not a full CalcY_Terminal.
+var
+    i, j: Integer;
+    scale: Array of Double;
+    Yadder: Complex;
+begin
+    SetLength(scale, 2 * NumWindings + 1);
+    for i := 1 to NumWindings do
+        with Winding[i] do
+        begin
+            scale[2 * i - 1] := 1.0 / (VBase * ZeroTapFix(puTap));
+            scale[2 * i] := -scale[2 * i - 1];
+        end;
+
+    for j := 1 to 2 * NumWindings do
+        for i := 1 to 2 * NumWindings do
+        begin
+            Y_Term[i, j] := Y_1Volt[(i + 1) div 2, (j + 1) div 2] * (scale[i] * scale[j]);
+            Y_Term_NL[i, j] := Y_1Volt_NL[(i + 1) div 2, (j + 1) div 2] * (scale[i] * scale[j]);
+        end;
+
+    // Add a small Admittance to both conductors of each winding so that
+    // the matrix will always invert even if the user neglects to define a voltage
+    // reference on all sides
+    if ppm_FloatFactor <> 0.0 then
+        for i := 1 to NumWindings do
+        begin
+            Yadder := cmplx(0.0, Winding[i].Y_PPM);
+            for j := (2 * i - 1) to (2 * i) do
+                Y_Term.AddElement(j, j, Yadder);
+                // SetElement(j, j, CmulReal_im(GetElement(j, j) , ppm_FloatFactorPlusOne));
+        end;
+end;
+
 procedure TTransfObj.CalcY_Terminal(FreqMult: Double);
 var
     i,
@@ -1865,24 +1922,14 @@ var
     ctempArray1,
     ctempArray2: pComplexArray;
     AT: TcMatrix;
-    Yadder: Complex;
     Rmult: Double;
-    // Function to fix a specification of a pu tap of 0.0
-    // Regcontrol can attempt to force zero tap position in some models
-    function ZeroTapFix(const tapvalue: Double): Double;
-    begin
-        if TapValue = 0.0 then
-            Result := 0.0001
-        else
-            Result := Tapvalue;
-    end;
-
 begin
     if ActiveCircuit.Solution.Frequency < 0.51 then
     begin
         // Build Yterminal for GIC ~dc simulation
         GICBuildYTerminal();
         Y_Terminal_FreqMult := Freqmult;
+        Y_1VoltValid := False;
         Exit;
     end;
 
@@ -1976,66 +2023,14 @@ begin
 
     // should have admittance of one phase of the transformer on a one-volt, wye-connected base
 
-    // Now make into terminal admittance matrix and correct for actual voltage ratings
-    // Y_Terminal = AT * Y_onevolt * A  where V_onevolt = A * V_terminal
-
-    AT.Free;
-
-    Y_Term.Clear;
-    Y_Term_NL.Clear;
-    AT := TcMatrix.Creatematrix(NumWindings * 2);
-
-    for i := 1 to NumWindings do
-        with Winding[i] do
-            AT[2 * i - 1, i] := 1.0 / (VBase * ZeroTapFix(puTap));
-    for i := 1 to NumWindings do
-        with Winding[i] do
-            AT[2 * i, i] := -1.0 / (VBase * ZeroTapFix(puTap));
-    for i := 1 to 2 * Numwindings do
-        ctemparray1[i] := 0;
-
-    for i := 1 to 2 * Numwindings do
-    begin
-        for k := 1 to NumWindings do
-            with Winding[k] do
-            begin
-                if i = (2 * k - 1) then
-                    A[k] := (1.0 / (VBase * ZeroTapFix(puTap)))
-                else
-                if i = 2 * k then
-                    A[k] := (-1.0 / (VBase * ZeroTapFix(puTap)))
-                else
-                    A[k] := 0;
-            end;
-        // Main Transformer part
-        Y_1Volt.MVmult(ctemparray1, A);
-        AT.MVmult(ctemparray2, ctemparray1); // AT * Result
-        for j := 1 to 2 * NumWindings do
-            Y_Term[j, i] := ctemparray2[j];
-    
-        // No Load part
-        Y_1Volt_NL.MVmult(ctemparray1, A);
-        AT.MVmult(ctemparray2, ctemparray1); // AT * Result
-        for j := 1 to 2 * NumWindings do
-            Y_Term_NL[j, i] := ctemparray2[j];
-    end;
-
-    // Add a small Admittance to both conductors of each winding so that
-    // the matrix will always invert even if the user neglects to define a voltage
-    // reference on all sides
-    if ppm_FloatFactor <> 0.0 then
-        for i := 1 to NumWindings do
-        begin
-            Yadder := cmplx(0.0, Winding[i].Y_PPM);
-            for j := (2 * i - 1) to (2 * i) do
-                Y_Term.AddElement(j, j, Yadder);
-                // SetElement(j, j, CmulReal_im(GetElement(j, j) , ppm_FloatFactorPlusOne));
-        end;
-
     AT.Free;
     Reallocmem(A, 0);
     Reallocmem(ctemparray1, 0);
     Reallocmem(ctemparray2, 0);
+
+    // Now make into terminal admittance matrix and correct for actual voltage ratings
+    Y_1VoltValid := True;
+    BuildY_Term();
     Y_Terminal_FreqMult := Freqmult;
 end;
 
@@ -92,6 +92,7 @@ type
         procedure Sample; OVERRIDE;    // Sample control quantities and set action times in Control Queue
         procedure DoPendingAction(const Phs, ProxyHdl: Integer); OVERRIDE;   // Do the action that is pending from last sample
         procedure Reset; OVERRIDE;  // Reset to initial defined state
+        function OvercurrentTripTime(const PhaseAmps: Array of Double; GroundAmps: Double): Double;
 
         procedure GetCurrents(Curr: pComplexArray); OVERRIDE; // Get present value of terminal Curr
         property States[Idx: Integer]: EControlAction read get_States;
@@ -496,6 +497,29 @@ begin
     end;
 end;
 
+function TFuseObj.OvercurrentTripTime(const PhaseAmps: Array of Double; GroundAmps: Double): Double;
+// Time for the first phase to blow for the given current magnitudes, as in
+// Sample, or -1 if no phase would blow. GroundAmps is not used.
+// Blown phases (PresentState) and pending blow actions are not considered.
+var
+    i, hint: Integer;
+    TripTime: Double;
+begin
+    Result := -1.0;
+    if (FuseCurve = NIL) or (RatedCurrent <= 0.0) then
+        Exit;
+
+    hint := 1;
+    for i := 0 to Min(FUSEMAXDIM, Length(PhaseAmps)) - 1 do
+    begin
+        TripTime := FuseCurve.GetTCCTimeHint(PhaseAmps[i] / RatedCurrent, hint);
+        if (TripTime > 0.0) and ((Result < 0.0) or (TripTime < Result)) then
+            Result := TripTime;
+    end;
+    if Result > 0.0 then
+        Result := Result + DelayTime;
+end;
+
 procedure TFuseObj.Reset;
 var
     i: Integer;
@@ -109,7 +109,9 @@ type
 
    // build a tree of connected elements beginning at StartElement
    // Analyze = TRUE will check for loops, isolated components, and parallel lines (takes longer)
-function GetIsolatedSubArea(Circuit: TObject; StartElement: TDSSCktElement; Analyze: Boolean = FALSE): TCktTree;
+function GetIsolatedSubArea(Circuit: TObject; StartElement: TDSSCktElement; Analyze: Boolean = FALSE): TCktTree; overload;
+   // same, using the given bus adjacency lists instead of the ones cached in the circuit
+function GetIsolatedSubArea(Circuit: TObject; StartElement: TDSSCktElement; const lstPD, lstPC: TAdjArray; Analyze: Boolean = FALSE): TCktTree; overload;
 procedure BuildActiveBusAdjacencyLists(Circuit: TObject; var lstPD, lstPC: TAdjArray);
 procedure FreeAndNilBusAdjacencyLists(var lstPD, lstPC: TAdjArray);
 
@@ -622,18 +624,23 @@ begin
 end;
 
 function GetIsolatedSubArea(Circuit: TObject; StartElement: TDSSCktElement; Analyze: Boolean): TCktTree;
+var
+    Ckt: TDSSCircuit;
+begin
+    Ckt := TDSSCircuit(Circuit);
+    Result := GetIsolatedSubArea(Circuit, StartElement, Ckt.GetBusAdjacentPDLists, Ckt.GetBusAdjacentPCLists, Analyze);
+end;
+
+function GetIsolatedSubArea(Circuit: TObject; StartElement: TDSSCktElement; const lstPD, lstPC: TAdjArray; Analyze: Boolean): TCktTree;
 var
     TestBusNum: Integer;
     BranchList: TCktTree;
     iTerm: Integer;
     TestBranch,
     TestElement: TDSSCktElement;
-    lstPD, lstPC: TAdjArray;
     Ckt: TDSSCircuit;
 begin
     Ckt := TDSSCircuit(Circuit);
-    lstPD := Ckt.GetBusAdjacentPDLists;
-    lstPC := Ckt.GetBusAdjacentPCLists;
 
     BranchList := TCktTree.Create;
     TestElement := StartElement;
@@ -16,6 +16,12 @@ unit HashList;
 //
 //  All strings are saved in lower case and tested with case sensitivity.  This
 //  actually makes the search insensitive to case because everything is lower case.
+//
+//  TOAHashList (DSS-Extensions) is an open-addressing alternative used for the bus,
+//  device and element name lists. The slot table is a flat power-of-two array of
+//  (hash, index) pairs, probed linearly. Hashing and comparison fold ASCII letters
+//  on the fly, so searches don't allocate a lower case copy of the input; only names
+//  with non-ASCII characters go through AnsiLowerCase first.
 
 interface
 
@@ -75,9 +81,42 @@ type
     end;
 
 
-    TBusHashListType = TAltHashList;
-    TCommandHashListType = TAltHashList;
-    TClassNamesHashListType = TAltHashList;
+    TOAHashSlot = record
+        Hash: Cardinal;
+        Idx: Integer; // 1-based index in the name list; 0 marks an empty slot
+    end;
+
+    TOAHashList = class(TObject)
+    PRIVATE
+        Slots: array of TOAHashSlot;
+        SlotMask: Cardinal;
+        Names: array of String;
+        Hashes: array of Cardinal;
+        Values: array of Integer;
+        NumElements: Integer;
+        LastSlot: Cardinal;
+        LastHash: Cardinal;
+        LastSearchString: String;
+
+        procedure Rehash(NewSlotCount: Cardinal);
+        function Lookup(const S: String; StartSlot: Cardinal; H: Cardinal): Integer; inline;
+    PUBLIC
+        InitialAllocation: Cardinal;
+        constructor Create(Nelements: Cardinal);
+        destructor Destroy; OVERRIDE;
+        function Add(const S: String; Value: Integer = -1): Integer;
+        function Find(const S: String): Integer;
+        function FindNext: Integer;  //  repeat find for duplicate string
+        function NameOfIndex(i: Integer): String; inline;
+        procedure DumpToFile(F: TStream);
+        procedure Clear;
+        property Count: Integer READ NumElements;
+    end;
+
+    TBusHashListType = TOAHashList;
+    TCommandHashListType = TOAHashList;
+    TClassNamesHashListType = TOAHashList;
+    TDeviceHashListType = TOAHashList;
 
 implementation
 
@@ -404,5 +443,246 @@ begin
     end;
 end;
 
+{$PUSH}
+{$Q-}
+{$R-}
+// FNV-1a over the ASCII-folded bytes, followed by the MurmurHash3 finalizer
+// so that the low bits (used with the slot mask) are well mixed.
+// Returns False if S contains non-ASCII bytes, in which case the caller 
+// should lower the string with AnsiLowerCase and hash it again.
+function FoldedHash(const S: String; out H: Cardinal): Boolean; inline;
+var
+    p, pEnd: PByte;
+    c: Cardinal;
+begin
+    Result := True;
+    H := 2166136261;
+    p := PByte(S);
+    pEnd := p + Length(S);
+    while p < pEnd do
+    begin
+        c := p^;
+        if (c >= Ord('A')) and (c <= Ord('Z')) then
+            c := c or $20
+        else if c >= $80 then
+            Result := False;
+        H := (H xor c) * 16777619;
+        Inc(p);
+    end;
+    H := H xor (H shr 16);
+    H := H * $85EBCA6B;
+    H := H xor (H shr 13);
+    H := H * $C2B2AE35;
+    H := H xor (H shr 16);
+end;
+{$POP}
+
+// Compares S against a name stored in lower case, folding only ASCII letters from S
+function FoldedEquals(const S, Stored: String): Boolean; inline;
+var
+    p, q, pEnd: PByte;
+    c: Byte;
+begin
+    Result := False;
+    if Length(S) <> Length(Stored) then
+        Exit;
+    p := PByte(S);
+    q := PByte(Stored);
+    pEnd := p + Length(S);
+    while p < pEnd do
+    begin
+        c := p^;
+        if (c >= Ord('A')) and (c <= Ord('Z')) then
+            c := c or $20;
+        if c <> q^ then
+            Exit;
+        Inc(p);
+        Inc(q);
+    end;
+    Result := True;
+end;
+
+constructor TOAHashList.Create(Nelements: Cardinal);
+begin
+    inherited Create;
+    InitialAllocation := Nelements;
+    NumElements := 0;
+    SetLength(Names, Nelements);
+    SetLength(Hashes, Nelements);
+    SetLength(Values, Nelements);
+    Slots := NIL;
+    Rehash(2 * Nelements);
+    LastSlot := 0;
+    LastHash := 0;
+    LastSearchString := '';
+end;
+
+destructor TOAHashList.Destroy;
+begin
+    Clear;
+    Slots := NIL;
+    inherited Destroy;
+end;
+
+procedure TOAHashList.Rehash(NewSlotCount: Cardinal);
+var
+    i: Integer;
+    n, slot: Cardinal;
+begin
+    n := 16;
+    while n < NewSlotCount do
+        n := n shl 1;
+
+    Slots := NIL; // drop the old table; the hashes are kept in the Hashes array
+    SetLength(Slots, n); // zero-filled, i.e. all empty
+    SlotMask := n - 1;
+
+    // Reinsert in index order, which keeps duplicates in insertion order for FindNext
+    for i := 1 to NumElements do
+    begin
+        slot := Hashes[i - 1] and SlotMask;
+        while Slots[slot].Idx <> 0 do
+            slot := (slot + 1) and SlotMask;
+        Slots[slot].Hash := Hashes[i - 1];
+        Slots[slot].Idx := i;
+    end;
+end;
+
+function TOAHashList.Add(const S: String; Value: Integer): Integer;
+var
+    SS: String;
+    H, slot: Cardinal;
+begin
+    SS := AnsiLowerCase(S);
+    FoldedHash(SS, H); // SS is already lowered, including any non-ASCII chars
+
+    // Keep the load factor at or below 1/2; rehash before counting the new
+    // entry, which is only placed below, once its hash is stored
+    if Cardinal(2 * (NumElements + 1)) > SlotMask + 1 then
+        Rehash(4 * (NumElements + 1));
+
+    Inc(NumElements);
+    if NumElements > Length(Names) then
+    begin
+        SetLength(Names, 2 * NumElements);
+        SetLength(Hashes, 2 * NumElements);
+        SetLength(Values, 2 * NumElements);
+    end;
+
+    if Value < 0 then
+        Value := NumElements;
+
+    Names[NumElements - 1] := SS;
+    Hashes[NumElements - 1] := H;
+    Values[NumElements - 1] := Value;
+
+    slot := H and SlotMask;
+    while Slots[slot].Idx <> 0 do
+        slot := (slot + 1) and SlotMask;
+    Slots[slot].Hash := H;
+    Slots[slot].Idx := NumElements;
+
+    Result := NumElements;
+end;
+
+function TOAHashList.Lookup(const S: String; StartSlot: Cardinal; H: Cardinal): Integer; inline;
+var
+    slot: Cardinal;
+    idx: Integer;
+begin
+    slot := StartSlot;
+    repeat
+        idx := Slots[slot].Idx;
+        if idx = 0 then
+        begin
+            LastSlot := slot;
+            Result := 0;
+            Exit;
+        end;
+        if (Slots[slot].Hash = H) and FoldedEquals(S, Names[idx - 1]) then
+        begin
+            LastSlot := slot;
+            Result := Values[idx - 1];
+            Exit;
+        end;
+        slot := (slot + 1) and SlotMask;
+    until False;
+end;
+
+function TOAHashList.Find(const S: String): Integer;
+var
+    H: Cardinal;
+begin
+    if FoldedHash(S, H) then
+        LastSearchString := S
+    else
+    begin
+        LastSearchString := AnsiLowerCase(S);
+        FoldedHash(LastSearchString, H);
+    end;
+    LastHash := H;
+    Result := Lookup(LastSearchString, H and SlotMask, H);
+end;
+
+function TOAHashList.FindNext: Integer;
+begin
+    // Continue probing after the slot of the last match
+    if (NumElements = 0) or (Slots[LastSlot].Idx = 0) then
+    begin
+        Result := 0;
+        Exit;
+    end;
+    Result := Lookup(LastSearchString, (LastSlot + 1) and SlotMask, LastHash);
+end;
+
+function TOAHashList.NameOfIndex(i: Integer): String; inline;
+begin
+    if (i > 0) and (i <= NumElements) then
+        Result := Names[i - 1]
+    else
+        Result := '';
+end;
+
+procedure TOAHashList.DumpToFile(F: TStream);
+var
+    i: Integer;
+    slot, dist, maxDist, totalDist: Cardinal;
+begin
+    maxDist := 0;
+    totalDist := 0;
+    for slot := 0 to SlotMask do
+    begin
+        if Slots[slot].Idx = 0 then
+            continue;
+        dist := (slot + SlotMask + 1 - (Slots[slot].Hash and SlotMask)) and SlotMask;
+        Inc(totalDist, dist);
+        if dist > maxDist then
+            maxDist := dist;
+    end;
+    FSWriteln(F, Format('Number of Slots = %d, Number of Elements = %d', [SlotMask + 1, NumElements]));
+    if NumElements > 0 then
+        FSWriteln(F, Format('Average probe distance = %.3f, Maximum probe distance = %d', [totalDist / NumElements, maxDist]));
+    FSWriteln(F);
+    FSWriteln(F, 'LINEAR LISTING...');
+    for i := 1 to NumElements do
+    begin
+        FSWriteln(F, Format('%3d = "%s"', [i, Names[i - 1]]));
+    end;
+end;
+
+procedure TOAHashList.Clear;
+var
+    i: Integer;
+begin
+    for i := 0 to NumElements - 1 do
+        Names[i] := '';
+    NumElements := 0;
+    if Length(Slots) > 0 then
+        FillChar(Slots[0], SizeOf(TOAHashSlot) * Length(Slots), 0);
+    LastSlot := 0;
+    LastHash := 0;
+    LastSearchString := '';
+end;
+
 
 end.